@@ -1,5 +1,8 @@
 
 # set (BLA_STATIC ON)
+if (NOT "${BLAS_VENDOR}" STREQUAL "")
+  set (BLA_VENDOR ${BLAS_VENDOR})
+endif()
 find_package(BLAS)
 find_package(LAPACK)
 
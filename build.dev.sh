@@ -74,6 +74,7 @@ rm -Rf $BUILD_DIR/*
                         -DENABLE_LOGGING=ON \
                         -DENABLE_TRACE_LOGGING=ON \
                         -DENABLE_DART_LOGGING=ON \
+                        -DENABLE_DART_PROFILING=ON \
                         \
                         -DENABLE_LIBNUMA=ON \
                         -DENABLE_LIKWID=OFF \
@@ -74,6 +74,7 @@ rm -Rf $BUILD_DIR/*
                         -DENABLE_LOGGING=OFF \
                         -DENABLE_TRACE_LOGGING=OFF \
                         -DENABLE_DART_LOGGING=OFF \
+                        -DENABLE_DART_PROFILING=OFF \
                         \
                         -DENABLE_LIBNUMA=ON \
                         -DENABLE_LIKWID=OFF \
@@ -177,6 +177,11 @@ extern "C" {
 */
 #include "dart_synchronization.h"
 
+/*
+   --- DART communication profiling ---
+*/
+#include "dart_profile.h"
+
 
 #ifdef __cplusplus
 } // extern "C"
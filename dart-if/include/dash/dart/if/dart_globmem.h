@@ -165,6 +165,30 @@ dart_ret_t dart_gptr_getaddr(
   const dart_gptr_t    gptr,
         void        ** addr) DART_NOTHROW;
 
+/**
+ * Get the native memory address for the specified global pointer
+ * gptr if it can be accessed directly by the local unit, i.e. if the
+ * global pointer has affinity to the local unit or to a unit on the same
+ * node whose memory is mapped into the local address space.
+ *
+ * In contrast to \ref dart_gptr_getaddr, the returned address may refer
+ * to memory of another unit. Loads and stores through it bypass the
+ * communication layer and require synchronization by the caller.
+ *
+ * \param      gptr Global pointer
+ * \param[out] addr Pointer to a pointer that will hold the native
+ *                  address if the \c gptr points to memory accessible by
+ *                  the local unit, or \c NULL otherwise.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_gptr_getaddr_shared(
+  const dart_gptr_t    gptr,
+        void        ** addr) DART_NOTHROW;
+
 /**
  * Set the local memory address for the specified global pointer such
  * the the specified address.
@@ -292,6 +316,24 @@ dart_ret_t dart_memalloc(
  */
 dart_ret_t dart_memfree(dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Kinds of pages backing the local memory of an allocation.
+ *
+ * \see dart_team_memalloc_aligned_pages
+ *
+ * \ingroup DartGlobMem
+ */
+typedef enum {
+  /** Pages of the system's default size */
+  DART_MEMPAGES_DEFAULT = 0,
+  /** Transparent huge pages, if enabled in the system configuration */
+  DART_MEMPAGES_HUGE,
+  /** Explicit 2 MiB huge pages from the system's huge page pool */
+  DART_MEMPAGES_HUGE_2M,
+  /** Explicit 1 GiB huge pages from the system's huge page pool */
+  DART_MEMPAGES_HUGE_1G
+} dart_mempages_t;
+
 /**
  * Collective function on the specified team to allocate \c nelem elements
  * of type \c dtype of memory in each unit's global address space with a
@@ -328,6 +370,79 @@ dart_ret_t dart_team_memalloc_aligned(
   dart_datatype_t   dtype,
   dart_gptr_t     * gptr) DART_NOTHROW;
 
+/**
+ * Collective function similar to \ref dart_team_memalloc_aligned with
+ * local memory backed by pages of the specified kind.
+ *
+ * Local memory backed by huge pages reduces TLB misses of random accesses
+ * and the number of pages registered with the network. It is mapped by
+ * every unit separately instead of in shared memory windows, accesses of
+ * units at the same node are performed via MPI.
+ *
+ * Explicit huge pages fall back to smaller huge pages and to transparent
+ * huge pages if not available, the kind of pages may differ between
+ * units.
+ * The allocation is freed with \ref dart_team_memfree.
+ *
+ * \param teamid      The team participating in the collective memory
+ *                    allocation.
+ * \param nelem       The number of elements to allocate per unit.
+ * \param dtype       The data type of elements in \c addr.
+ * \param pages       The kind of pages backing local memory, equivalent
+ *                    to \ref dart_team_memalloc_aligned for
+ *                    \c DART_MEMPAGES_DEFAULT.
+ *
+ * \param[out]  gptr  Global pointer to store information on the allocation.
+ *
+ * \return            \c DART_OK on success,
+ *                    any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_team_memalloc_aligned_pages(
+  dart_team_t       teamid,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_mempages_t   pages,
+  dart_gptr_t     * gptr) DART_NOTHROW;
+
+/**
+ * Maps \c nbytes of local memory backed by pages of the specified kind,
+ * for example to be attached with \ref dart_team_memregister.
+ * This is *not* a collective function.
+ *
+ * Explicit huge pages fall back to smaller huge pages and to transparent
+ * huge pages if not available.
+ *
+ * \param nbytes      The number of bytes to map.
+ * \param pages       The kind of pages backing the memory.
+ * \param[out]  addr  The address of the mapped memory.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_memmap_pages(
+  size_t            nbytes,
+  dart_mempages_t   pages,
+  void           ** addr) DART_NOTHROW;
+
+/**
+ * Releases local memory mapped by \ref dart_memmap_pages.
+ * This is *not* a collective function.
+ *
+ * \param addr The address of the mapped memory.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_memunmap_pages(
+  void            * addr) DART_NOTHROW;
+
 /**
  * Collective function to free global memory previously allocated
  * using \ref dart_team_memalloc_aligned.
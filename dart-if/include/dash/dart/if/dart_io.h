@@ -27,6 +27,17 @@ dart_ret_t dart__io__hdf5__prep_mpio(
     hid_t plist_id,
     dart_team_t teamid) DART_NOTHROW;
 
+/**
+ * creates an hdf5 property list identifier for parallel IO which
+ * aggregates the file accesses of all units on a node in
+ * \c aggregators_per_node units (MPI-IO collective buffering).
+ * Falls back to \c dart__io__hdf5__prep_mpio for values <= 0.
+ */
+dart_ret_t dart__io__hdf5__prep_mpio_aggregated(
+    hid_t       plist_id,
+    dart_team_t teamid,
+    int         aggregators_per_node) DART_NOTHROW;
+
 #define DART_INTERFACE_OFF
 
 #ifdef __cplusplus
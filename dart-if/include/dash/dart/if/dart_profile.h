@@ -0,0 +1,223 @@
+#ifndef DART__IF__PROFILE_H__
+#define DART__IF__PROFILE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_util.h>
+
+/**
+ * \file dart_profile.h
+ *
+ * \defgroup  DartProfile  DART communication profiling
+ * \ingroup   DartInterface
+ *
+ * Counters of communication operations issued by the calling unit.
+ *
+ * Profiling is selected at compile time of the DART library (CMake
+ * option \c ENABLE_DART_PROFILING, defining \c DART_ENABLE_PROFILING).
+ * Otherwise, communication is not instrumented and all counters
+ * reported by the functions in this group are zero.
+ *
+ * Every thread records operations in its own counters, the functions
+ * in this group report the sum over all threads of the calling unit.
+ *
+ * Recording adds a constant cost to every operation (benchmark case
+ * \c dart.put_get_latency). To keep it low for one-sided operations,
+ * every thread measures the latency of only every 16th of them
+ * (\c DART_PROFILE_SAMPLE_PERIOD of the DART library). All operations
+ * are counted. Latencies are measured with the timestamp counter of the
+ * processor where available.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \cond DART_HIDDEN_SYMBOLS */
+#define DART_INTERFACE_ON
+/** \endcond */
+
+/**
+ * Communication operations distinguished by the profiler.
+ *
+ * One-sided operations precede \ref DART_PROFILE_NUM_RMA_OPS, they are
+ * also counted per target unit and per segment.
+ *
+ * \ingroup DartProfile
+ */
+typedef enum {
+  DART_PROFILE_OP_GET = 0,
+  DART_PROFILE_OP_PUT,
+  DART_PROFILE_OP_ACCUMULATE,
+  DART_PROFILE_OP_FETCH_AND_OP,
+  DART_PROFILE_OP_COMPARE_AND_SWAP,
+  /** Number of one-sided operations */
+  DART_PROFILE_NUM_RMA_OPS,
+  /** Flush and wait for completion of one-sided operations */
+  DART_PROFILE_OP_FLUSH = DART_PROFILE_NUM_RMA_OPS,
+  DART_PROFILE_OP_BARRIER,
+  DART_PROFILE_OP_BCAST,
+  DART_PROFILE_OP_SCATTER,
+  DART_PROFILE_OP_GATHER,
+  DART_PROFILE_OP_ALLGATHER,
+  DART_PROFILE_OP_ALLGATHERV,
+  DART_PROFILE_OP_ALLTOALLV,
+  DART_PROFILE_OP_ALLREDUCE,
+  DART_PROFILE_OP_REDUCE,
+  DART_PROFILE_OP_SEND,
+  DART_PROFILE_OP_RECV,
+  DART_PROFILE_OP_SENDRECV,
+  /** Number of operations distinguished by the profiler */
+  DART_PROFILE_NUM_OPS
+} dart_profile_op_t;
+
+/**
+ * Number of bins of latency histograms, bin \c i counts operations
+ * with a latency in <tt>[2^i, 2^(i+1))</tt> nanoseconds, the last bin
+ * also counts all longer operations.
+ *
+ * \ingroup DartProfile
+ */
+#define DART_PROFILE_HIST_BINS 32
+
+/**
+ * Statistics of a communication operation.
+ *
+ * Latencies of non-blocking operations are the time until the call
+ * returned, their completion is accounted to \ref DART_PROFILE_OP_FLUSH.
+ *
+ * \ingroup DartProfile
+ */
+typedef struct {
+  /** Number of calls */
+  uint64_t count;
+  /** Number of bytes transferred from or to the calling unit */
+  uint64_t bytes;
+  /** Number of calls with measured latency */
+  uint64_t timed;
+  /** Accumulated latency of the timed calls in nanoseconds */
+  uint64_t time_ns;
+  /** Log-scale histogram of the latencies of the timed calls */
+  uint64_t hist[DART_PROFILE_HIST_BINS];
+} dart_profile_op_stats_t;
+
+/**
+ * Number of calls and bytes transferred.
+ *
+ * \ingroup DartProfile
+ */
+typedef struct {
+  uint64_t count;
+  uint64_t bytes;
+} dart_profile_counts_t;
+
+/**
+ * One-sided operations on a global memory segment.
+ *
+ * \ingroup DartProfile
+ */
+typedef struct {
+  /** Team of the segment, \c DART_TEAM_NULL for operations on segments
+   *  that could not be accounted separately */
+  dart_team_t           teamid;
+  /** Segment id in the team */
+  int16_t               segid;
+  /** Operations on the segment, indexed by \ref dart_profile_op_t */
+  dart_profile_counts_t ops[DART_PROFILE_NUM_RMA_OPS];
+} dart_profile_segment_stats_t;
+
+/**
+ * Whether DART has been built with communication profiling.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+bool dart_profile_enabled() DART_NOTHROW;
+
+/**
+ * Reset all counters of the calling unit.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_reset() DART_NOTHROW;
+
+/**
+ * Statistics of operation \c op issued by the calling unit.
+ *
+ * \param      op     The operation to query.
+ * \param[out] stats  The statistics of \c op.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_op_stats(
+  dart_profile_op_t         op,
+  dart_profile_op_stats_t * stats) DART_NOTHROW;
+
+/**
+ * One-sided operations issued by the calling unit per target unit.
+ *
+ * \param[out] targets  Array of \c dart_size() entries, entry \c i is
+ *                      set to the operations targeting global unit \c i.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_targets(
+  dart_profile_counts_t * targets) DART_NOTHROW;
+
+/**
+ * One-sided operations issued by the calling unit per segment.
+ *
+ * \param[out] segments     Array of at least \c max_segments entries.
+ * \param      max_segments Capacity of \c segments.
+ * \param[out] num_segments Number of segments accessed by the calling
+ *                          unit, may exceed \c max_segments.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_segments(
+  dart_profile_segment_stats_t * segments,
+  size_t                         max_segments,
+  size_t                       * num_segments) DART_NOTHROW;
+
+/**
+ * Name of operation \c op as used in profile reports.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+const char * dart_profile_op_name(dart_profile_op_t op) DART_NOTHROW;
+
+/**
+ * Write the counters of the calling unit to \c file as a JSON object.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_dump(FILE * file) DART_NOTHROW;
+
+/** \cond DART_HIDDEN_SYMBOLS */
+#define DART_INTERFACE_OFF
+/** \endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DART__IF__PROFILE_H__ */
@@ -461,6 +461,38 @@ dart_ret_t dart_team_size(
   dart_team_t   teamid,
   size_t      * size) DART_NOTHROW;
 
+/**
+ * Return the units of the specified team that are located at the same
+ * shared memory node as the calling unit.
+ *
+ * Nodes are determined by the communication backend from the units that
+ * can share memory rather than by comparing host names, so the number
+ * of units exchanging data does not grow with the size of the team.
+ *
+ * With shared memory windows enabled, the units are determined from the
+ * shared memory communicator of \c DART_TEAM_ALL created during
+ * initialization and the call is local. If DART is built with
+ * \c DART_MPI_DISABLE_SHARED_WINDOWS, the call splits the team's
+ * communicator and is collective on the specified team.
+ * Portable callers must call it collectively.
+ *
+ * \param teamid          The team.
+ * \param[out] num_units  The number of units at the calling unit's node.
+ * \param[out] units      Team-relative IDs of the units at the calling
+ *                        unit's node in ascending order. The array is
+ *                        allocated by DART and must be released with
+ *                        \c free by the caller.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartGroupTeam
+ */
+dart_ret_t dart_team_node_units(
+  dart_team_t         teamid,
+  int               * num_units,
+  dart_team_unit_t ** units) DART_NOTHROW;
+
 /**
  * Return the id in the default team \ref DART_TEAM_ALL
  *
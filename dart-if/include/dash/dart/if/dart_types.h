@@ -659,6 +659,23 @@ dart_unit_locality_t;
 typedef struct
 {
   int log_enabled;
+  /**
+   * Whether transfers of strided and indexed data types from and to units
+   * on the same shared memory node are performed by direct copies instead
+   * of MPI RMA operations.
+   * Enabled by default, disabled if environment variable
+   * \c DART_SHMEM_DTYPE_COPY is set to \c 0.
+   */
+  int shmem_dtype_copy;
+  /**
+   * Maximum number of communicators of destroyed teams that are kept for
+   * reuse in teams of the same group.
+   * Defaults to 16, set by environment variable
+   * \c DART_TEAM_CACHE_SIZE, caching is disabled for \c 0.
+   * Cached communicators are only reused if caching is enabled at all
+   * units in the new team.
+   */
+  int team_cache_size;
 }
 dart_config_t;
 
@@ -25,4 +25,30 @@ dart_ret_t dart_hwinfo_init(
 dart_ret_t dart_hwinfo(
   dart_hwinfo_t * hwinfo);
 
+/**
+ * Resolves hardware locality information of units bound to the specified
+ * CPUs of the calling unit's host.
+ *
+ * The host's hardware topology is only queried once for all CPUs, such
+ * that a single unit can resolve the locality information of all units
+ * on its host.
+ *
+ * \param  cpu_os_ids  Physical indices of the CPUs as obtained from
+ *                     \c dart_hwinfo_cpu_os_id, or \c -1 for the CPU of
+ *                     the calling unit.
+ * \param  num_cpus    Number of CPUs.
+ * \param  hwinfos     Array of \c num_cpus elements receiving the
+ *                     locality information of every CPU.
+ */
+dart_ret_t dart_hwinfo_cpus(
+  const int     * cpu_os_ids,
+  int             num_cpus,
+  dart_hwinfo_t * hwinfos);
+
+/**
+ * Physical index of the CPU the calling unit is running on, or \c -1 if
+ * it cannot be determined.
+ */
+int dart_hwinfo_cpu_os_id();
+
 #endif /* DART__BASE__HWINFO_H__ */
@@ -64,5 +64,10 @@ dart_ret_t dart__base__locality__domain__create_subdomains(
   dart_host_topology_t         * host_topology,
   dart_unit_mapping_t          * unit_mapping);
 
+dart_ret_t dart__base__locality__domain__create_node_subdomains(
+  dart_domain_locality_t       * node_domain,
+  dart_host_topology_t         * host_topology,
+  dart_unit_mapping_t          * unit_mapping);
+
 
 #endif /* DART__BASE__INTERNAL__DOMAIN_LOCALITY_H__ */
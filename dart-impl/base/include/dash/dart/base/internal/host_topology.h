@@ -40,15 +40,22 @@ dart_host_topology_t;
 
 
 /**
- * Resolve the host topology from the unit's host names in a specified
- * team.
- * Expects host names in array ordered by unit rank such that the jth entry
- * in the array contains the host name of unit j.
+ * Resolve the host topology of all units in a unit mapping, every node
+ * in the mapping is represented by one host.
+ * Expects the locality of all units in the mapping to be resolved.
  */
 dart_ret_t dart__base__host_topology__create(
   dart_unit_mapping_t   * unit_mapping,
   dart_host_topology_t ** topo);
 
+/**
+ * Resolve the host topology of the units at the calling unit's node in
+ * a unit mapping.
+ */
+dart_ret_t dart__base__host_topology__create_node(
+  dart_unit_mapping_t   * unit_mapping,
+  dart_host_topology_t ** topo);
+
 dart_ret_t dart__base__host_topology__destruct(
   dart_host_topology_t  * topo);
 
@@ -73,8 +80,8 @@ dart_ret_t dart__base__host_topology__node_module(
   int                     module_index,
   const char           ** module_hostname);
 
-/* Also includes units in sub-modules, e.g. a query for host name
- * "some-node" would also include units from "sub-node-*":
+/* Also includes units in modules of the node, i.e. hosts with the node
+ * as parent:
  *
  * NOTE: Array returned in output parameter `units` is allocated in
  *       this function and must be deallocated by the caller.
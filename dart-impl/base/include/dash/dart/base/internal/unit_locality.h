@@ -5,24 +5,86 @@
 #define DART__BASE__INTERNAL__UNIT_LOCALITY_H__
 
 #include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <stdbool.h>
 
 typedef struct
 {
+  /* Locality records of the units at the calling unit's node */
   dart_unit_locality_t  * unit_localities;
+  /* Locality records of all units in the team, NULL until the mapping
+   * is resolved */
+  dart_unit_locality_t  * remote_localities;
   size_t                  num_units;
   dart_team_t             team;
+  /* Node index of every unit in the team, nodes are numbered in the
+   * order of their leader units */
+  int                   * node_ids;
+  int                     num_nodes;
+  /* Units in the team located at the calling unit's node */
+  dart_team_unit_t      * node_units;
+  int                     num_node_units;
+  /* Global ids of the units in the team */
+  dart_global_unit_t    * global_ids;
+  /* Allocation in DART_TEAM_ALL holding the published locality record
+   * of every unit */
+  dart_gptr_t             gptr;
+  bool                    resolved;
 } dart_unit_mapping_t;
 
+/**
+ * Collect locality information of the units in the specified team.
+ *
+ * For \c DART_TEAM_ALL, the locality records of all units are published
+ * in a team allocation. Only records of units at the calling unit's node
+ * are exchanged, records of remote units are fetched on demand in
+ * \c dart__base__unit_locality__resolve.
+ *
+ * For other teams, locality records are read from the allocation of
+ * the mapping \c all_mapping of \c DART_TEAM_ALL.
+ *
+ * \note
+ * This is a collective operation for \c DART_TEAM_ALL and a local
+ * operation for other teams.
+ */
 dart_ret_t dart__base__unit_locality__create(
-  dart_team_t             team,
-  dart_unit_mapping_t  ** unit_mapping);
+  dart_team_t                 team,
+  const dart_unit_mapping_t * all_mapping,
+  dart_unit_mapping_t      ** unit_mapping);
 
+/**
+ * Release a unit mapping.
+ *
+ * \note
+ * This is a collective operation for \c DART_TEAM_ALL as it releases
+ * the allocation of the published locality records.
+ */
 dart_ret_t dart__base__unit_locality__destruct(
   dart_unit_mapping_t   * unit_mapping);
 
+/**
+ * Fetch the locality records of all units in the mapping's team.
+ *
+ * Records at the calling unit's node are reset to their published
+ * values.
+ *
+ * \note
+ * This is a one-sided, non-collective operation.
+ */
+dart_ret_t dart__base__unit_locality__resolve(
+  dart_unit_mapping_t   * unit_mapping);
+
 dart_ret_t dart__base__unit_locality__at(
   dart_unit_mapping_t   * unit_mapping,
   dart_team_unit_t        unit,
   dart_unit_locality_t ** loc);
 
+/**
+ * Whether the specified unit is located at the calling unit's node.
+ */
+bool dart__base__unit_locality__is_node_unit(
+  const dart_unit_mapping_t * unit_mapping,
+  dart_team_unit_t            unit);
+
 #endif /* DART__BASE__INTERNAL__UNIT_LOCALITY_H__ */
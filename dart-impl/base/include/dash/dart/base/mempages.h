@@ -0,0 +1,47 @@
+/**
+ * \file dash/dart/base/mempages.h
+ *
+ * Private anonymous memory mappings backed by huge pages.
+ */
+#ifndef DART__BASE__MEMPAGES_H__
+#define DART__BASE__MEMPAGES_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <stddef.h>
+
+/**
+ * Maps \c nbytes of private memory backed by pages of the kind requested
+ * in \c pages.
+ *
+ * Explicit huge pages fall back from 1 GiB to 2 MiB pages and to
+ * transparent huge pages if the huge page pool of the requested size is
+ * exhausted or not configured. Transparent huge pages are only used if
+ * enabled in the system configuration, otherwise the mapping is backed
+ * by pages of the default size.
+ *
+ * \param[in,out] pages  Kind of pages requested, set to the kind of pages
+ *                       of the mapping.
+ *
+ * \returns  Address of the mapping aligned to the size of its pages,
+ *           or \c NULL if the mapping failed or \c nbytes is 0.
+ *
+ * \threadsafe
+ */
+void * dart__base__mempages_map(
+  size_t            nbytes,
+  dart_mempages_t * pages);
+
+/**
+ * Releases a mapping created by \c dart__base__mempages_map.
+ *
+ * \returns  \c DART_ERR_INVAL if \c addr is not the address of a mapping
+ *           created by \c dart__base__mempages_map.
+ *
+ * \threadsafe
+ */
+dart_ret_t dart__base__mempages_unmap(
+  void            * addr);
+
+#endif /* DART__BASE__MEMPAGES_H__ */
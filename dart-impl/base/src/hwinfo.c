@@ -77,15 +77,11 @@ dart_ret_t dart_hwinfo_init(
   hw->max_cpu_mhz         = -1;
   hw->min_threads         = -1;
   hw->max_threads         = -1;
-  hw->cache_ids[0]        = -1;
-  hw->cache_ids[1]        = -1;
-  hw->cache_ids[2]        = -1;
-  hw->cache_sizes[0]      = -1;
-  hw->cache_sizes[1]      = -1;
-  hw->cache_sizes[2]      = -1;
-  hw->cache_line_sizes[0] = -1;
-  hw->cache_line_sizes[1] = -1;
-  hw->cache_line_sizes[2] = -1;
+  for (int l = 0; l < DART_LOCALITY_MAX_CACHE_LEVELS; l++) {
+    hw->cache_ids[l]        = -1;
+    hw->cache_sizes[l]      = -1;
+    hw->cache_line_sizes[l] = -1;
+  }
   hw->max_shmem_mbps      = -1;
   hw->system_memory_bytes = -1;
   hw->numa_memory_bytes   = -1;
@@ -101,79 +97,17 @@ dart_ret_t dart_hwinfo_init(
   return DART_OK;
 }
 
-dart_ret_t dart_hwinfo(
-  dart_hwinfo_t * hwinfo)
-{
-  DART_LOG_DEBUG("dart_hwinfo()");
-
-  dart_hwinfo_t hw;
-  dart_hwinfo_init(&hw);
-
-  char * max_shmem_mbps_str = getenv("DASH_MAX_SHMEM_MBPS");
-  if (NULL != max_shmem_mbps_str) {
-    hw.max_shmem_mbps = (int)(atoi(max_shmem_mbps_str));
-    DART_LOG_TRACE("dart_hwinfo: DASH_MAX_SHMEM_MBPS set: %d",
-                   hw.max_shmem_mbps);
-  } else {
-    DART_LOG_TRACE("dart_hwinfo: DASH_MAX_SHMEM_MBPS not set");
-  }
-  if (hw.max_shmem_mbps <= 0) {
-    /* TODO: Intermediate workaround for load balancing, use -1
-     *       instead: */
-    hw.max_shmem_mbps = 1235;
-  }
-
-  gethostname(hw.host, DART_LOCALITY_HOST_MAX_SIZE);
-  for(int i = 0; i < DART_LOCALITY_HOST_MAX_SIZE; ++i) {
-    if(hw.host[i] == '.')
-      hw.host[i] = '\0';
-  }
-
-#ifdef DART_ENABLE_LIKWID
-  DART_LOG_TRACE("dart_hwinfo: using likwid");
-  /*
-   * see likwid API documentation:
-   * https://rrze-hpc.github.io/likwid/Doxygen/C-likwidAPI-code.html
-   */
-  int likwid_ret = topology_init();
-  if (likwid_ret < 0) {
-    DART_LOG_ERROR("dart_hwinfo: "
-                   "likwid: topology_init failed, returned %d", likwid_ret);
-  } else {
-    CpuInfo_t     info = get_cpuInfo();
-    CpuTopology_t topo = get_cpuTopology();
-    if (hw.min_cpu_mhz < 0 || hw.max_cpu_mhz < 0) {
-      hw.min_cpu_mhz = info->clock;
-      hw.max_cpu_mhz = info->clock;
-    }
-    if (hw.num_numa < 0) {
-      hw.num_numa    = hw.num_sockets;
-    }
-    if (hw.num_cores < 0) {
-      hw.num_cores   = topo->numCoresPerSocket * hw.num_sockets;
-    }
-    topology_finalize();
-    DART_LOG_TRACE("dart_hwinfo: likwid: "
-                   "num_sockets: %d num_numa: %d num_cores: %d",
-                   hw.num_sockets, hw.num_numa, hw.num_cores);
-  }
-#endif /* DART_ENABLE_LIKWID */
-
 #ifdef DART_ENABLE_HWLOC
-  DART_LOG_TRACE("dart_hwinfo: using hwloc");
-
-  hwloc_topology_t topology;
-  hwloc_topology_init(&topology);
-  hwloc_topology_set_flags(topology,
-#if HWLOC_API_VERSION < 0x00020000
-                             HWLOC_TOPOLOGY_FLAG_IO_DEVICES
-                           | HWLOC_TOPOLOGY_FLAG_IO_BRIDGES
-  /*                       | HWLOC_TOPOLOGY_FLAG_WHOLE_IO  */
-#else
-                             HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM
-#endif
-                          );
-  hwloc_topology_load(topology);
+/**
+ * Resolve hardware locality information of the CPU with the specified
+ * physical index in a loaded hwloc topology.
+ */
+static void dart__base__hwinfo__hwloc_cpu(
+  hwloc_topology_t   topology,
+  int                cpu_os_id,
+  dart_hwinfo_t    * hwinfo)
+{
+  dart_hwinfo_t hw = *hwinfo;
 
   /* hwloc can resolve the physical index (os_index) of the active unit,
    * not the logical index.
@@ -182,16 +116,6 @@ dart_ret_t dart_hwinfo(
    * CPU object that has a matching physical index.
    */
 
-  /* Get PU of active thread: */
-  hwloc_cpuset_t cpuset = hwloc_bitmap_alloc();
-  int flags     = 0; // HWLOC_CPUBIND_PROCESS;
-  int cpu_os_id = -1;
-  int ret       = hwloc_get_last_cpu_location(topology, cpuset, flags);
-  if (!ret) {
-    cpu_os_id = hwloc_bitmap_first(cpuset);
-  }
-  hwloc_bitmap_free(cpuset);
-
   hwloc_obj_t cpu_obj;
   for (cpu_obj =
          hwloc_get_obj_by_type(topology, HWLOC_OBJ_PU, 0);
@@ -325,116 +249,250 @@ dart_ret_t dart_hwinfo(
     }
   }
 
-  hwloc_topology_destroy(topology);
   DART_LOG_TRACE("dart_hwinfo: hwloc: "
                  "num_numa:%d numa_id:%d "
                  "num_cores:%d core_id:%d cpu_id:%d",
                  hw.num_numa, hw.numa_id,
                  hw.num_cores, hw.core_id, hw.cpu_id);
+  *hwinfo = hw;
+}
 #endif /* DART_ENABLE_HWLOC */
 
-#ifdef DART_ENABLE_PAPI
-  DART_LOG_TRACE("dart_hwinfo: using PAPI");
+int dart_hwinfo_cpu_os_id()
+{
+#ifdef DART__PLATFORM__LINUX
+  return sched_getcpu();
+#else
+  return -1;
+#endif
+}
 
-  const PAPI_hw_info_t * papi_hwinfo = NULL;
-  if (dart__base__locality__papi_init(&papi_hwinfo) == DART_OK) {
+dart_ret_t dart_hwinfo(
+  dart_hwinfo_t * hwinfo)
+{
+  int cpu_os_id = -1;
+  return dart_hwinfo_cpus(&cpu_os_id, 1, hwinfo);
+}
+
+dart_ret_t dart_hwinfo_cpus(
+  const int     * cpu_os_ids,
+  int             num_cpus,
+  dart_hwinfo_t * hwinfos)
+{
+  DART_LOG_DEBUG("dart_hwinfo_cpus() num_cpus:%d", num_cpus);
+
+  /*
+   * Properties of the host system are resolved once and shared by all
+   * CPUs:
+   */
+  dart_hwinfo_t hw;
+  dart_hwinfo_init(&hw);
+
+  char * max_shmem_mbps_str = getenv("DASH_MAX_SHMEM_MBPS");
+  if (NULL != max_shmem_mbps_str) {
+    hw.max_shmem_mbps = (int)(atoi(max_shmem_mbps_str));
+    DART_LOG_TRACE("dart_hwinfo: DASH_MAX_SHMEM_MBPS set: %d",
+                   hw.max_shmem_mbps);
+  } else {
+    DART_LOG_TRACE("dart_hwinfo: DASH_MAX_SHMEM_MBPS not set");
+  }
+  if (hw.max_shmem_mbps <= 0) {
+    /* TODO: Intermediate workaround for load balancing, use -1
+     *       instead: */
+    hw.max_shmem_mbps = 1235;
+  }
+
+  gethostname(hw.host, DART_LOCALITY_HOST_MAX_SIZE);
+  for(int i = 0; i < DART_LOCALITY_HOST_MAX_SIZE; ++i) {
+    if(hw.host[i] == '.')
+      hw.host[i] = '\0';
+  }
+
+#ifdef DART_ENABLE_LIKWID
+  DART_LOG_TRACE("dart_hwinfo: using likwid");
+  /*
+   * see likwid API documentation:
+   * https://rrze-hpc.github.io/likwid/Doxygen/C-likwidAPI-code.html
+   */
+  int likwid_ret = topology_init();
+  if (likwid_ret < 0) {
+    DART_LOG_ERROR("dart_hwinfo: "
+                   "likwid: topology_init failed, returned %d", likwid_ret);
+  } else {
+    CpuInfo_t     info = get_cpuInfo();
+    CpuTopology_t topo = get_cpuTopology();
+    if (hw.min_cpu_mhz < 0 || hw.max_cpu_mhz < 0) {
+      hw.min_cpu_mhz = info->clock;
+      hw.max_cpu_mhz = info->clock;
+    }
     if (hw.num_numa < 0) {
-      hw.num_numa    = papi_hwinfo->nnodes;
+      hw.num_numa    = hw.num_sockets;
     }
     if (hw.num_cores < 0) {
-      int num_sockets      = papi_hwinfo->sockets;
-      int cores_per_socket = papi_hwinfo->cores;
-      hw.num_cores   = num_sockets * cores_per_socket;
+      hw.num_cores   = topo->numCoresPerSocket * hw.num_sockets;
     }
-    if (hw.min_cpu_mhz < 0 || hw.max_cpu_mhz < 0) {
-      hw.min_cpu_mhz = papi_hwinfo->cpu_min_mhz;
-      hw.max_cpu_mhz = papi_hwinfo->cpu_max_mhz;
+    topology_finalize();
+    DART_LOG_TRACE("dart_hwinfo: likwid: "
+                   "num_sockets: %d num_numa: %d num_cores: %d",
+                   hw.num_sockets, hw.num_numa, hw.num_cores);
+  }
+#endif /* DART_ENABLE_LIKWID */
+
+  for (int c = 0; c < num_cpus; c++) {
+    hwinfos[c] = hw;
+  }
+
+#ifdef DART_ENABLE_HWLOC
+  DART_LOG_TRACE("dart_hwinfo: using hwloc");
+
+  hwloc_topology_t topology;
+  hwloc_topology_init(&topology);
+  hwloc_topology_set_flags(topology,
+#if HWLOC_API_VERSION < 0x00020000
+                             HWLOC_TOPOLOGY_FLAG_IO_DEVICES
+                           | HWLOC_TOPOLOGY_FLAG_IO_BRIDGES
+  /*                       | HWLOC_TOPOLOGY_FLAG_WHOLE_IO  */
+#else
+                             HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM
+#endif
+                          );
+  hwloc_topology_load(topology);
+
+  for (int c = 0; c < num_cpus; c++) {
+    int cpu_os_id = cpu_os_ids[c];
+    if (cpu_os_id < 0) {
+      /* Get PU of active thread: */
+      hwloc_cpuset_t cpuset = hwloc_bitmap_alloc();
+      int flags = 0; // HWLOC_CPUBIND_PROCESS;
+      int ret   = hwloc_get_last_cpu_location(topology, cpuset, flags);
+      if (!ret) {
+        cpu_os_id = hwloc_bitmap_first(cpuset);
+      }
+      hwloc_bitmap_free(cpuset);
+    }
+    dart__base__hwinfo__hwloc_cpu(topology, cpu_os_id, &hwinfos[c]);
+  }
+
+  hwloc_topology_destroy(topology);
+#endif /* DART_ENABLE_HWLOC */
+
+#ifdef DART_ENABLE_PAPI
+  DART_LOG_TRACE("dart_hwinfo: using PAPI");
+
+  const PAPI_hw_info_t * papi_hwinfo = NULL;
+  if (dart__base__locality__papi_init(&papi_hwinfo) == DART_OK) {
+    for (int c = 0; c < num_cpus; c++) {
+      dart_hwinfo_t * hwc = &hwinfos[c];
+      if (hwc->num_numa < 0) {
+        hwc->num_numa    = papi_hwinfo->nnodes;
+      }
+      if (hwc->num_cores < 0) {
+        int num_sockets      = papi_hwinfo->sockets;
+        int cores_per_socket = papi_hwinfo->cores;
+        hwc->num_cores   = num_sockets * cores_per_socket;
+      }
+      if (hwc->min_cpu_mhz < 0 || hwc->max_cpu_mhz < 0) {
+        hwc->min_cpu_mhz = papi_hwinfo->cpu_min_mhz;
+        hwc->max_cpu_mhz = papi_hwinfo->cpu_max_mhz;
+      }
     }
     DART_LOG_TRACE("dart_hwinfo: PAPI: num_numa:%d num_cores:%d",
-                   hw.num_numa, hw.num_cores);
+                   hwinfos[0].num_numa, hwinfos[0].num_cores);
   }
 #endif /* DART_ENABLE_PAPI */
 
+#ifdef DART__PLATFORM__POSIX
+  /*
+   * NOTE: includes hyperthreading
+   */
+  int  posix_num_cpus    = sysconf(_SC_NPROCESSORS_ONLN);
+  long posix_pages       = sysconf(_SC_AVPHYS_PAGES);
+  long posix_page_size   = sysconf(_SC_PAGE_SIZE);
+#endif
+#ifdef DART_ENABLE_NUMA
+  DART_LOG_TRACE("dart_hwinfo: using numalib");
+  int  numa_num_nodes    = numa_max_node() + 1;
+#endif
+
+  for (int c = 0; c < num_cpus; c++) {
+    dart_hwinfo_t * hwc = &hwinfos[c];
+
 #ifdef DART__PLATFORM__LINUX
-  if (hw.cpu_id < 0) {
-    hw.cpu_id = sched_getcpu();
-  }
+    if (hwc->cpu_id < 0) {
+      hwc->cpu_id = (cpu_os_ids[c] >= 0) ? cpu_os_ids[c] : sched_getcpu();
+    }
 #else
-  DART_LOG_ERROR("dart_hwinfo: "
-                 "HWLOC or PAPI required if not running on a Linux platform");
-  return DART_ERR_OTHER;
+    DART_LOG_ERROR("dart_hwinfo: "
+                   "HWLOC or PAPI required if not running on a Linux "
+                   "platform");
+    return DART_ERR_OTHER;
 #endif
 
 #ifdef DART__ARCH__IS_MIC
-  /*
-   * Hardware information for Intel MIC can be hard-coded as hardware
-   * specs of MIC model variants are invariant:
-   */
-  DART_LOG_TRACE("dart_hwinfo: MIC architecture");
+    /*
+     * Hardware information for Intel MIC can be hard-coded as hardware
+     * specs of MIC model variants are invariant:
+     */
+    DART_LOG_TRACE("dart_hwinfo: MIC architecture");
 
-  if (hw.num_numa    < 0) { hw.num_numa    =  1; }
-  if (hw.num_cores   < 0) { hw.num_cores   = 60; }
-  if (hw.min_cpu_mhz < 0 || hw.max_cpu_mhz < 0) {
-    hw.min_cpu_mhz = 1100;
-    hw.max_cpu_mhz = 1100;
-  }
-  if (hw.min_threads < 0 || hw.max_threads < 0) {
-    hw.min_threads = 4;
-    hw.max_threads = 4;
-  }
-  if (hw.numa_id < 0) {
-    hw.numa_id = 0;
-  }
+    if (hwc->num_numa    < 0) { hwc->num_numa    =  1; }
+    if (hwc->num_cores   < 0) { hwc->num_cores   = 60; }
+    if (hwc->min_cpu_mhz < 0 || hwc->max_cpu_mhz < 0) {
+      hwc->min_cpu_mhz = 1100;
+      hwc->max_cpu_mhz = 1100;
+    }
+    if (hwc->min_threads < 0 || hwc->max_threads < 0) {
+      hwc->min_threads = 4;
+      hwc->max_threads = 4;
+    }
+    if (hwc->numa_id < 0) {
+      hwc->numa_id = 0;
+    }
 #endif
 
 #ifdef DART__PLATFORM__POSIX
-  if (hw.num_cores < 0) {
-		/*
-     * NOTE: includes hyperthreading
-     */
-    int posix_ret = sysconf(_SC_NPROCESSORS_ONLN);
-    hw.num_cores = (posix_ret > 0) ? posix_ret : hw.num_cores;
-		DART_LOG_TRACE(
-      "dart_hwinfo: POSIX: hw.num_cores = %d",
-      hw.num_cores);
-  }
-
-	if(hw.system_memory_bytes < 0) {
-	  long pages     = sysconf(_SC_AVPHYS_PAGES);
-	  long page_size = sysconf(_SC_PAGE_SIZE);
-    if (pages > 0 && page_size > 0) {
-      hw.system_memory_bytes = (int) ((pages * page_size) / BYTES_PER_MB);
+    if (hwc->num_cores < 0) {
+      hwc->num_cores = (posix_num_cpus > 0) ? posix_num_cpus
+                                            : hwc->num_cores;
+      DART_LOG_TRACE(
+        "dart_hwinfo: POSIX: hw.num_cores = %d",
+        hwc->num_cores);
     }
-  }
 
+    if (hwc->system_memory_bytes < 0) {
+      if (posix_pages > 0 && posix_page_size > 0) {
+        hwc->system_memory_bytes = (int) ((posix_pages * posix_page_size) /
+                                          BYTES_PER_MB);
+      }
+    }
 #endif
 
 #ifdef DART_ENABLE_NUMA
-  DART_LOG_TRACE("dart_hwinfo: using numalib");
-  if (hw.num_numa < 0) {
-    hw.num_numa = numa_max_node() + 1;
-  }
-  if (hw.numa_id < 0 && hw.cpu_id >= 0) {
-    hw.numa_id = numa_node_of_cpu(hw.cpu_id);
-  }
+    if (hwc->num_numa < 0) {
+      hwc->num_numa = numa_num_nodes;
+    }
+    if (hwc->numa_id < 0 && hwc->cpu_id >= 0) {
+      hwc->numa_id = numa_node_of_cpu(hwc->cpu_id);
+    }
 #endif
 
-  if (hw.num_scopes < 1) {
-    /* No domain hierarchy could be resolved.
-     * Use flat topology, with all units assigned to domains in CORE scope: */
-    hw.num_scopes = 1;
-    hw.scopes[0].scope = DART_LOCALITY_SCOPE_CORE;
-    hw.scopes[0].index = (hw.core_id >= 0) ? hw.core_id : hw.cpu_id;
-  }
-
-  DART_LOG_TRACE("dart_hwinfo: finished: "
-                 "num_numa:%d numa_id:%d cpu_id:%d, num_cores:%d "
-                 "min_threads:%d max_threads:%d",
-                 hw.num_numa, hw.numa_id, hw.cpu_id, hw.num_cores,
-                 hw.min_threads, hw.max_threads);
+    if (hwc->num_scopes < 1) {
+      /* No domain hierarchy could be resolved.
+       * Use flat topology, with all units assigned to domains in CORE
+       * scope: */
+      hwc->num_scopes = 1;
+      hwc->scopes[0].scope = DART_LOCALITY_SCOPE_CORE;
+      hwc->scopes[0].index = (hwc->core_id >= 0) ? hwc->core_id
+                                                 : hwc->cpu_id;
+    }
 
-  *hwinfo = hw;
+    DART_LOG_TRACE("dart_hwinfo: finished: "
+                   "num_numa:%d numa_id:%d cpu_id:%d, num_cores:%d "
+                   "min_threads:%d max_threads:%d",
+                   hwc->num_numa, hwc->numa_id, hwc->cpu_id,
+                   hwc->num_cores, hwc->min_threads, hwc->max_threads);
+  }
 
-  DART_LOG_DEBUG("dart_hwinfo >");
+  DART_LOG_DEBUG("dart_hwinfo_cpus >");
   return DART_OK;
 }
@@ -35,11 +35,6 @@
  * Private Functions: Declarations                                    *
  * ================================================================== */
 
-dart_ret_t dart__base__locality__domain__create_node_subdomains(
-  dart_domain_locality_t         * node_domain,
-  dart_host_topology_t           * host_topology,
-  dart_unit_mapping_t            * unit_mapping);
-
 dart_ret_t dart__base__locality__domain__create_module_subdomains(
   dart_domain_locality_t         * module_domain,
   dart_host_topology_t           * host_topology,
@@ -768,11 +763,6 @@ dart_ret_t dart__base__locality__domain__create_node_subdomains(
     "node_domain { host:%s, domain_tag:%s, num_units:%d }",
     node_domain->host, node_domain->domain_tag,
     node_domain->num_units);
-  /*
-   * TODO: Should only be performed by node leader units and the
-   *       result broadcasted to units located on the node.
-   */
-
   int num_modules;
   DART_ASSERT_RETURNS(
     dart__base__host_topology__num_node_modules(
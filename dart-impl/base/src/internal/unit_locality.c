@@ -8,6 +8,7 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_locality.h>
 #include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
 #include <dash/dart/if/dart_team_group.h>
 
 #include <unistd.h>
@@ -54,91 +55,117 @@
 dart_ret_t dart__base__unit_locality__init(
   dart_unit_locality_t  * loc);
 
-dart_ret_t dart__base__unit_locality__local_unit_new(
-  dart_team_t             team,
-  dart_unit_locality_t  * loc);
+static dart_ret_t dart__base__unit_locality__get_records(
+  const dart_unit_mapping_t * unit_mapping,
+  const dart_team_unit_t    * units,
+  int                         num_units,
+  dart_unit_locality_t      * records);
+
+static dart_ret_t dart__base__unit_locality__publish(
+  dart_unit_mapping_t       * unit_mapping);
+
+static dart_ret_t dart__base__unit_locality__from_all(
+  dart_unit_mapping_t       * unit_mapping,
+  const dart_unit_mapping_t * all_mapping);
+
+static dart_ret_t dart__base__unit_locality__node_hwinfo(
+  const dart_unit_mapping_t * unit_mapping);
+
+static int dart__base__unit_locality__node_index(
+  const dart_unit_mapping_t * unit_mapping,
+  dart_team_unit_t            unit);
 
 /* ======================================================================== *
  * Init / Finalize                                                          *
  * ======================================================================== */
 
 /**
- * Exchange and collect all locality information of all units in the
- * specified team in an array of \c dart_unit_mapping_t objects.
+ * Collect locality information of the units in the specified team.
+ *
+ * Outline for \c DART_TEAM_ALL:
+ *
+ * 1. Resolve the units at the calling unit's node from the team's
+ *    shared memory communicator and exchange the id of every node's
+ *    leader unit (one integer per unit) to number the nodes.
+ *
+ * 2. Every unit initializes its record in a team allocation. Node
+ *    leaders resolve the hardware locality of all units at their node
+ *    in a single query and write it to the units' records.
+ *
+ * 3. Every unit reads the records of the units at its node.
+ *
+ * Records of units at other nodes are not transferred until they are
+ * requested in \c dart__base__unit_locality__resolve.
+ *
+ * Other teams number nodes from the mapping of \c DART_TEAM_ALL and read
+ * the records of their units from its allocation.
  *
  * Note that locality information does not contain the units' locality
  * domain tags.
- *
- * \note
- * This is a collective N-to-N (allgather) operation.
  */
 dart_ret_t dart__base__unit_locality__create(
-  dart_team_t             team,
-  dart_unit_mapping_t  ** unit_mapping)
+  dart_team_t                 team,
+  const dart_unit_mapping_t * all_mapping,
+  dart_unit_mapping_t      ** unit_mapping)
 {
-  dart_ret_t  ret;
-  dart_team_unit_t myid = DART_UNDEFINED_TEAM_UNIT_ID;
-  size_t      nunits = 0;
-  *unit_mapping      = NULL;
-  DART_LOG_DEBUG("dart__base__unit_locality__create()");
+  dart_ret_t ret;
+  size_t     nunits = 0;
+  *unit_mapping     = NULL;
+  DART_LOG_DEBUG("dart__base__unit_locality__create() team: %d", team);
 
-  DART_ASSERT_RETURNS(dart_team_myid(team, &myid),   DART_OK);
   DART_ASSERT_RETURNS(dart_team_size(team, &nunits), DART_OK);
 
-  size_t nbytes = sizeof(dart_unit_locality_t);
+  dart_unit_mapping_t * mapping = calloc(1, sizeof(dart_unit_mapping_t));
+  mapping->num_units            = nunits;
+  mapping->team                 = team;
+  mapping->gptr                 = DART_GPTR_NULL;
+  mapping->resolved             = false;
 
-  /* get local unit's locality information: */
-  dart_unit_locality_t * uloc = malloc(sizeof(dart_unit_locality_t));
-  ret  = dart__base__unit_locality__local_unit_new(team, uloc);
+  /* Units at the calling unit's node, ordered by their id in the team
+   * such that the first unit is the node's leader: */
+  ret = dart_team_node_units(
+          team, &mapping->num_node_units, &mapping->node_units);
   if (ret != DART_OK) {
     DART_LOG_ERROR("dart__base__unit_locality__create ! "
-                   "dart__base__unit_locality__local_unit_new failed: %d",
-                   ret);
-    free(uloc);
+                   "dart_team_node_units failed: %d", ret);
+    free(mapping);
     return ret;
   }
-  DART_LOG_TRACE("dart__base__unit_locality__create: unit %d of %ld: "
-                 "sending %ld bytes: "
-                 "host:'%s' core_id:%d numa_id:%d nthreads:%d",
-                 myid.id, nunits, nbytes,
-                 uloc->hwinfo.host,
-                 uloc->hwinfo.cpu_id, uloc->hwinfo.numa_id,
-                 uloc->hwinfo.max_threads);
-
-  dart_unit_mapping_t * mapping = malloc(sizeof(dart_unit_mapping_t));
-  mapping->num_units            = nunits;
-  mapping->team                 = team;
-  mapping->unit_localities      = malloc(nunits *
-                                          sizeof(dart_unit_locality_t));
-  dart_barrier(team);
-
-  /* all-to-all exchange of locality data across all units:
-   * (send, recv, nbytes, team) */
-  DART_LOG_DEBUG("dart__base__unit_locality__create: dart_allgather");
-  ret = dart_allgather(uloc,
-                       mapping->unit_localities,
-                       nbytes,
-                       DART_TYPE_BYTE,
-                       team);
 
-  dart_barrier(team);
-  free(uloc);
+  if (team == DART_TEAM_ALL) {
+    ret = dart__base__unit_locality__publish(mapping);
+  } else {
+    DART_ASSERT_MSG(NULL != all_mapping,
+                    "Locality of DART_TEAM_ALL is not initialized");
+    ret = dart__base__unit_locality__from_all(mapping, all_mapping);
+  }
+  if (ret != DART_OK) {
+    dart__base__unit_locality__destruct(mapping);
+    return ret;
+  }
 
+  /* Records of units at the calling unit's node: */
+  mapping->unit_localities = malloc(mapping->num_node_units *
+                                    sizeof(dart_unit_locality_t));
+  ret = dart__base__unit_locality__get_records(
+          mapping, mapping->node_units, mapping->num_node_units,
+          mapping->unit_localities);
   if (ret != DART_OK) {
     DART_LOG_ERROR("dart__base__unit_locality__create ! "
-                   "dart_allgather failed: %d", ret);
-    free(mapping);
+                   "dart__base__unit_locality__get_records failed: %d",
+                   ret);
+    dart__base__unit_locality__destruct(mapping);
     return ret;
   }
 #ifdef DART_ENABLE_LOGGING
-  for (size_t u = 0; u < nunits; ++u) {
-    dart_unit_locality_t * ulm_u = &mapping->unit_localities[u];
+  for (int nu = 0; nu < mapping->num_node_units; ++nu) {
+    dart_unit_locality_t * ulm_u = &mapping->unit_localities[nu];
     DART_LOG_TRACE("dart__base__unit_locality__create: unit[%d]: "
                    "unit:%d host:'%s' "
                    "num_cores:%d core_id:%d cpu_id:%d "
                    "num_numa:%d numa_id:%d "
                    "nthreads:%d",
-                   (int)(u), ulm_u->unit.id,
+                   mapping->node_units[nu].id, ulm_u->unit.id,
                    ulm_u->hwinfo.host,
                    ulm_u->hwinfo.num_cores, ulm_u->hwinfo.core_id,
                    ulm_u->hwinfo.cpu_id,
@@ -156,25 +183,78 @@ dart_ret_t dart__base__unit_locality__create(
 dart_ret_t dart__base__unit_locality__destruct(
   dart_unit_mapping_t   * unit_mapping)
 {
+  if (NULL == unit_mapping) {
+    return DART_OK;
+  }
   DART_LOG_DEBUG("dart__base__unit_locality__destruct() team: %d",
                  unit_mapping->team);
 
-  if (NULL != unit_mapping) {
-    if (NULL != unit_mapping->unit_localities) {
-      free(unit_mapping->unit_localities);
-      unit_mapping->unit_localities = NULL;
+  dart_ret_t ret = DART_OK;
+  if (unit_mapping->team == DART_TEAM_ALL &&
+      !DART_GPTR_ISNULL(unit_mapping->gptr)) {
+    ret = dart_team_memfree(unit_mapping->gptr);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart__base__unit_locality__destruct ! "
+                     "dart_team_memfree failed: %d", ret);
     }
-    free(unit_mapping);
   }
+  free(unit_mapping->unit_localities);
+  free(unit_mapping->remote_localities);
+  free(unit_mapping->node_ids);
+  free(unit_mapping->node_units);
+  free(unit_mapping->global_ids);
+  free(unit_mapping);
 
   DART_LOG_DEBUG("dart__base__unit_locality__destruct >");
-  return DART_OK;
+  return ret;
 }
 
 /* ======================================================================== *
  * Lookup                                                                   *
  * ======================================================================== */
 
+/**
+ * Fetch the locality records of all units in the mapping's team.
+ */
+dart_ret_t dart__base__unit_locality__resolve(
+  dart_unit_mapping_t   * unit_mapping)
+{
+  if (unit_mapping->resolved) {
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart__base__unit_locality__resolve() team: %d",
+                 unit_mapping->team);
+
+  size_t             nunits  = unit_mapping->num_units;
+  dart_team_unit_t * units   = malloc(nunits * sizeof(dart_team_unit_t));
+  dart_unit_locality_t * all = malloc(nunits * sizeof(dart_unit_locality_t));
+  for (size_t u = 0; u < nunits; ++u) {
+    units[u] = DART_TEAM_UNIT_ID(u);
+  }
+  dart_ret_t ret = dart__base__unit_locality__get_records(
+                     unit_mapping, units, nunits, all);
+  free(units);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart__base__unit_locality__resolve ! "
+                   "dart__base__unit_locality__get_records failed: %d",
+                   ret);
+    free(all);
+    return ret;
+  }
+  /* Records of node units keep their address as they may have been
+   * referenced already, their values are reset such that all records
+   * are in the same state: */
+  for (int nu = 0; nu < unit_mapping->num_node_units; ++nu) {
+    unit_mapping->unit_localities[nu] =
+      all[unit_mapping->node_units[nu].id];
+  }
+  unit_mapping->remote_localities = all;
+  unit_mapping->resolved          = true;
+
+  DART_LOG_DEBUG("dart__base__unit_locality__resolve >");
+  return DART_OK;
+}
+
 /**
  * Get the specified unit's locality information from a set of unit
  * mappings.
@@ -184,72 +264,257 @@ dart_ret_t dart__base__unit_locality__at(
   dart_team_unit_t        unit,
   dart_unit_locality_t ** loc)
 {
-  if ((size_t)(unit.id) >= unit_mapping->num_units) {
+  if (unit.id < 0 || (size_t)(unit.id) >= unit_mapping->num_units) {
     DART_LOG_ERROR("dart__base__unit_locality__get ! "
                    "unit id %d out of bounds, team size: %zu",
                    unit.id, unit_mapping->num_units);
     return DART_ERR_INVAL;
   }
-  *loc = &(unit_mapping->unit_localities[unit.id]);
+  int node_index = dart__base__unit_locality__node_index(unit_mapping, unit);
+  if (node_index >= 0) {
+    *loc = &(unit_mapping->unit_localities[node_index]);
+  } else if (unit_mapping->resolved) {
+    *loc = &(unit_mapping->remote_localities[unit.id]);
+  } else {
+    DART_LOG_ERROR("dart__base__unit_locality__get ! "
+                   "locality of unit %d in team %d is not resolved",
+                   unit.id, unit_mapping->team);
+    return DART_ERR_NOTINIT;
+  }
   return DART_OK;
 }
 
+bool dart__base__unit_locality__is_node_unit(
+  const dart_unit_mapping_t * unit_mapping,
+  dart_team_unit_t            unit)
+{
+  return dart__base__unit_locality__node_index(unit_mapping, unit) >= 0;
+}
+
 /* ======================================================================== *
  * Private Functions                                                        *
  * ======================================================================== */
 
 /**
- * Initialize unit locality information from HW locality.
+ * Number the nodes of units in \c DART_TEAM_ALL and publish the locality
+ * records of all units in a team allocation.
  */
-dart_ret_t dart__base__unit_locality__local_unit_new(
-  dart_team_t             team,
-  dart_unit_locality_t  * uloc)
+static dart_ret_t dart__base__unit_locality__publish(
+  dart_unit_mapping_t       * unit_mapping)
 {
-  DART_LOG_DEBUG("dart__base__unit_locality__local_unit_new() loc(%p)",
-                 (void *)uloc);
-  if (uloc == NULL) {
-    DART_LOG_ERROR("dart__base__unit_locality__local_unit_new ! null");
-    return DART_ERR_INVAL;
-  }
+  dart_ret_t       ret;
+  dart_team_t      team   = unit_mapping->team;
+  size_t           nunits = unit_mapping->num_units;
   dart_team_unit_t myid;
+  DART_ASSERT_RETURNS(dart_team_myid(team, &myid), DART_OK);
 
+  /* Number nodes in the order of their leader units: */
+  int   node_leader  = unit_mapping->node_units[0].id;
+  int * node_leaders = malloc(nunits * sizeof(int));
+  ret = dart_allgather(&node_leader, node_leaders, 1, DART_TYPE_INT, team);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart__base__unit_locality__publish ! "
+                   "dart_allgather failed: %d", ret);
+    free(node_leaders);
+    return ret;
+  }
+  unit_mapping->node_ids  = malloc(nunits * sizeof(int));
+  unit_mapping->num_nodes = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    DART_ASSERT(node_leaders[u] >= 0 && (size_t)(node_leaders[u]) <= u);
+    if ((size_t)(node_leaders[u]) == u) {
+      unit_mapping->node_ids[u] = unit_mapping->num_nodes++;
+    } else {
+      unit_mapping->node_ids[u] = unit_mapping->node_ids[node_leaders[u]];
+    }
+  }
+  free(node_leaders);
+  DART_LOG_TRACE("dart__base__unit_locality__publish: "
+                 "nodes:%d node units:%d node leader:%d",
+                 unit_mapping->num_nodes, unit_mapping->num_node_units,
+                 node_leader);
+
+  /* Initialize the calling unit's record in the team allocation: */
   DART_ASSERT_RETURNS(
-    dart__base__unit_locality__init(uloc),
-    DART_OK);
-  DART_ASSERT_RETURNS(
-    dart_team_myid(team, &myid),
+    dart_team_memalloc_aligned(
+      team, sizeof(dart_unit_locality_t), DART_TYPE_BYTE,
+      &unit_mapping->gptr),
     DART_OK);
+  dart_gptr_t uloc_gptr = unit_mapping->gptr;
+  dart_unit_locality_t * uloc;
+  DART_ASSERT_RETURNS(dart_gptr_setunit(&uloc_gptr, myid), DART_OK);
+  DART_ASSERT_RETURNS(dart_gptr_getaddr(uloc_gptr, (void **)&uloc), DART_OK);
+  DART_ASSERT_RETURNS(dart__base__unit_locality__init(uloc), DART_OK);
+  uloc->unit = myid;
+  uloc->team = team;
+
+  /* Node leaders resolve the hardware locality of all units at their
+   * node from the units' CPUs. If the CPU of units cannot be determined,
+   * every unit resolves its hardware locality instead: */
+  uloc->hwinfo.cpu_id = dart_hwinfo_cpu_os_id();
+  if (uloc->hwinfo.cpu_id < 0) {
+    DART_ASSERT_RETURNS(dart_hwinfo(&uloc->hwinfo), DART_OK);
+  }
+  DART_ASSERT_RETURNS(dart_barrier(team), DART_OK);
+  if (myid.id == node_leader && uloc->hwinfo.cpu_id >= 0) {
+    ret = dart__base__unit_locality__node_hwinfo(unit_mapping);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart__base__unit_locality__publish ! "
+                     "dart__base__unit_locality__node_hwinfo failed: %d",
+                     ret);
+      return ret;
+    }
+  }
+  DART_ASSERT_RETURNS(dart_barrier(team), DART_OK);
+  return DART_OK;
+}
 
-  dart_hwinfo_t hwinfo;
-  DART_ASSERT_RETURNS(dart_hwinfo(&hwinfo), DART_OK);
-
-#if 1 || __TODO__CLARIFY__
-  /* Is this call required? */
-  dart_domain_locality_t * tloc;
+/**
+ * Number the nodes of units in a team from the mapping of
+ * \c DART_TEAM_ALL.
+ */
+static dart_ret_t dart__base__unit_locality__from_all(
+  dart_unit_mapping_t       * unit_mapping,
+  const dart_unit_mapping_t * all_mapping)
+{
+  size_t       nunits = unit_mapping->num_units;
+  dart_group_t group;
   DART_ASSERT_RETURNS(
-    dart_domain_team_locality(team, ".", &tloc),
-    DART_OK);
-#endif
+    dart_team_get_group(unit_mapping->team, &group), DART_OK);
+  unit_mapping->global_ids = malloc(nunits * sizeof(dart_global_unit_t));
+  dart_ret_t ret = dart_group_getmembers(group, unit_mapping->global_ids);
+  dart_group_destroy(&group);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart__base__unit_locality__from_all ! "
+                   "dart_group_getmembers failed: %d", ret);
+    return ret;
+  }
 
-  uloc->unit   = myid;
-  uloc->team   = team;
-  uloc->hwinfo = hwinfo;
-
-#if defined(DART__BASE__LOCALITY__SIMULATE_MICS)
-  /* Assigns every second unit to a MIC host name.
-   * Useful for simulating a heterogeneous node-level topology
-   * for debugging.
-   */
-  if (myid % 3 == 1) {
-    strncat(uloc->hwinfo.host, "-mic0", 5);
+  /* Number nodes in the order of their first unit in the team: */
+  int * team_node_ids = malloc(all_mapping->num_nodes * sizeof(int));
+  for (int n = 0; n < all_mapping->num_nodes; ++n) {
+    team_node_ids[n] = -1;
   }
-#endif
+  unit_mapping->node_ids  = malloc(nunits * sizeof(int));
+  unit_mapping->num_nodes = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    int all_node_id = all_mapping->node_ids[
+                        unit_mapping->global_ids[u].id];
+    if (team_node_ids[all_node_id] < 0) {
+      team_node_ids[all_node_id] = unit_mapping->num_nodes++;
+    }
+    unit_mapping->node_ids[u] = team_node_ids[all_node_id];
+  }
+  free(team_node_ids);
 
-  DART_LOG_DEBUG("dart__base__unit_locality__local_unit_new > loc(%p)",
-                 (void *)uloc);
+  unit_mapping->gptr = all_mapping->gptr;
   return DART_OK;
 }
 
+/**
+ * Read the published locality records of the specified units.
+ */
+static dart_ret_t dart__base__unit_locality__get_records(
+  const dart_unit_mapping_t * unit_mapping,
+  const dart_team_unit_t    * units,
+  int                         num_units,
+  dart_unit_locality_t      * records)
+{
+  dart_ret_t      ret     = DART_OK;
+  dart_handle_t * handles = malloc(num_units * sizeof(dart_handle_t));
+  int             nissued = 0;
+  for (; nissued < num_units; ++nissued) {
+    /* Records are indexed by global unit id: */
+    dart_team_unit_t record_unit = units[nissued];
+    if (NULL != unit_mapping->global_ids) {
+      record_unit.id = unit_mapping->global_ids[units[nissued].id].id;
+    }
+    dart_gptr_t gptr = unit_mapping->gptr;
+    dart_gptr_setunit(&gptr, record_unit);
+    ret = dart_get_handle(&records[nissued], gptr,
+                          sizeof(dart_unit_locality_t),
+                          DART_TYPE_BYTE, DART_TYPE_BYTE,
+                          &handles[nissued]);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart__base__unit_locality__get_records ! "
+                     "dart_get_handle failed for unit %d: %d",
+                     units[nissued].id, ret);
+      break;
+    }
+  }
+  dart_ret_t wait_ret = dart_waitall(handles, nissued);
+  free(handles);
+  for (int u = 0; u < nissued; ++u) {
+    records[u].unit = units[u];
+    records[u].team = unit_mapping->team;
+  }
+  return (ret != DART_OK) ? ret : wait_ret;
+}
+
+/**
+ * Resolve the hardware locality of all units at the calling unit's node
+ * from the CPU ids in their records and write it to the records.
+ *
+ * Called by node leader units only.
+ */
+static dart_ret_t dart__base__unit_locality__node_hwinfo(
+  const dart_unit_mapping_t * unit_mapping)
+{
+  int                    nunits  = unit_mapping->num_node_units;
+  dart_unit_locality_t * records = malloc(nunits *
+                                          sizeof(dart_unit_locality_t));
+  dart_hwinfo_t        * hwinfos = malloc(nunits * sizeof(dart_hwinfo_t));
+  int                  * cpu_ids = malloc(nunits * sizeof(int));
+
+  dart_ret_t ret = dart__base__unit_locality__get_records(
+                     unit_mapping, unit_mapping->node_units, nunits,
+                     records);
+  if (ret == DART_OK) {
+    for (int nu = 0; nu < nunits; ++nu) {
+      cpu_ids[nu] = records[nu].hwinfo.cpu_id;
+    }
+    ret = dart_hwinfo_cpus(cpu_ids, nunits, hwinfos);
+  }
+  for (int nu = 0; ret == DART_OK && nu < nunits; ++nu) {
+    dart_gptr_t gptr = unit_mapping->gptr;
+    dart_gptr_setunit(&gptr, unit_mapping->node_units[nu]);
+    records[nu].hwinfo = hwinfos[nu];
+    ret = dart_put_blocking(gptr, &records[nu],
+                            sizeof(dart_unit_locality_t),
+                            DART_TYPE_BYTE, DART_TYPE_BYTE);
+  }
+  free(cpu_ids);
+  free(hwinfos);
+  free(records);
+  return ret;
+}
+
+/**
+ * Index of the specified unit in the units at the calling unit's node,
+ * or -1 if the unit is located at another node.
+ */
+static int dart__base__unit_locality__node_index(
+  const dart_unit_mapping_t * unit_mapping,
+  dart_team_unit_t            unit)
+{
+  /* Node units are ordered by unit id: */
+  int lo = 0;
+  int hi = unit_mapping->num_node_units;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (unit_mapping->node_units[mid].id < unit.id) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < unit_mapping->num_node_units &&
+      unit_mapping->node_units[lo].id == unit.id) {
+    return lo;
+  }
+  return -1;
+}
+
 /**
  * Default constructor of dart_unit_locality_t.
  */
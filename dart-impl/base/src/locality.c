@@ -63,6 +63,13 @@ dart_ret_t dart__base__locality__group_subdomains(
   int                              num_group_subdomain_tags,
   char                           * group_domain_tag_out);
 
+static dart_ret_t dart__base__locality__node_domain_tags(
+  dart_unit_mapping_t            * unit_mapping);
+
+static dart_ret_t dart__base__locality__global_domain(
+  dart_team_t                      team,
+  dart_domain_locality_t        ** domain_out);
+
 /* ====================================================================== *
  * Init / Finalize                                                        *
  * ====================================================================== */
@@ -79,7 +86,10 @@ dart_ret_t dart__base__locality__init()
 
 dart_ret_t dart__base__locality__finalize()
 {
-  for (dart_team_t t = 0; t < DART__BASE__LOCALITY__MAX_TEAM_DOMAINS; ++t) {
+  /* Locality data of DART_TEAM_ALL is referenced by other teams and
+   * deleted last: */
+  for (dart_team_t t = DART__BASE__LOCALITY__MAX_TEAM_DOMAINS - 1;
+       t >= 0; --t) {
     dart__base__locality__delete(t);
   }
 
@@ -92,8 +102,7 @@ dart_ret_t dart__base__locality__finalize()
  * ====================================================================== */
 
 /**
- * Exchange and collect locality information of all units in the specified
- * team.
+ * Collect locality information of all units in the specified team.
  *
  * The team's unit locality information is stored in private array
  * \c dart__base__locality__unit_mapping_[team] with a capacity for
@@ -101,18 +110,21 @@ dart_ret_t dart__base__locality__finalize()
  *
  * Outline of the locality initialization procedure:
  *
- * 1. All units collect their local hardware locality information
+ * 1. Units at every node resolve their hardware locality in a single
+ *    query of the node's leader unit
  *    -> dart_hwinfo_t
  *
- * 2. All-to-all exchange of hardware locality data
+ * 2. Exchange of hardware locality data between units at the same node,
+ *    teams other than \c DART_TEAM_ALL read the data published for
+ *    \c DART_TEAM_ALL
  *    -> dart_unit_mapping_t { unit, team, hwinfo, domain }
  *
- * 3. Construct host topology from unit mapping data
- *    -> dart_host_topology_t
+ * 3. Construct the locality domain of the calling unit's node to assign
+ *    domain tags to the units at the node
  *
- * 4. Initialize locality domain hierarchy from unit mapping data and
- *    host topology
- *    -> dart_domain_locality_t
+ * The host topology and the locality domain hierarchy of all nodes are
+ * constructed on first request, see
+ * \c dart__base__locality__global_domain.
  */
 dart_ret_t dart__base__locality__create(
   dart_team_t team)
@@ -130,84 +142,18 @@ dart_ret_t dart__base__locality__create(
     "dash__base__locality__create(): "
     "locality data of team is already initialized");
 
-  dart_domain_locality_t * team_global_domain =
-    malloc(sizeof(dart_domain_locality_t));
-  dart__base__locality__global_domain_[team] =
-    team_global_domain;
-
-  /* Initialize the global domain as the root entry in the locality
-   * hierarchy:
-   */
-  team_global_domain->scope          = DART_LOCALITY_SCOPE_GLOBAL;
-  team_global_domain->level          = 0;
-  team_global_domain->relative_index = 0;
-  team_global_domain->team           = team;
-  team_global_domain->parent         = NULL;
-  team_global_domain->num_domains    = 0;
-  team_global_domain->children       = NULL;
-  team_global_domain->num_units      = 0;
-  team_global_domain->host[0]        = '\0';
-  team_global_domain->domain_tag[0]  = '.';
-  team_global_domain->domain_tag[1]  = '\0';
-
-  size_t num_units = 0;
-  DART_ASSERT_RETURNS(dart_team_size(team, &num_units), DART_OK);
-  team_global_domain->num_units = num_units;
-  team_global_domain->unit_ids  = malloc(num_units *
-                                         sizeof(dart_global_unit_t));
-  for (size_t u = 0; u < num_units; ++u) {
-    dart_team_unit_t luid = { u };
-    DART_ASSERT_RETURNS(
-      dart_team_unit_l2g(team, luid, &team_global_domain->unit_ids[u]),
-      DART_OK);
-  }
-
-  /* Exchange unit locality information between all units:
-   */
+  /* Locality of units in other teams is read from the locality data
+   * of DART_TEAM_ALL: */
   dart_unit_mapping_t * unit_mapping;
   DART_ASSERT_RETURNS(
-    dart__base__unit_locality__create(team, &unit_mapping),
+    dart__base__unit_locality__create(
+      team, dart__base__locality__unit_mapping_[DART_TEAM_ALL],
+      &unit_mapping),
     DART_OK);
   dart__base__locality__unit_mapping_[team] = unit_mapping;
 
-  /* Resolve host topology from the unit's host names:
-   */
-  dart_host_topology_t * topo;
   DART_ASSERT_RETURNS(
-    dart__base__host_topology__create(unit_mapping, &topo),
-    DART_OK);
-  dart__base__locality__host_topology_[team] = topo;
-  size_t num_nodes = topo->num_nodes;
-  DART_LOG_TRACE("dart__base__locality__create: nodes: %ld", num_nodes);
-
-  team_global_domain->num_nodes = num_nodes;
-
-#ifdef DART_ENABLE_LOGGING
-  for (int h = 0; h < topo->num_hosts; ++h) {
-    dart_host_units_t  * node_units  = &topo->host_units[h];
-    dart_host_domain_t * node_domain = &topo->host_domains[h];
-    char * hostname = topo->host_names[h];
-    DART_LOG_TRACE("dart__base__locality__create: "
-                   "host %s: units:%d level:%d parent:%s", hostname,
-                   node_units->num_units,
-                   node_domain->level, node_domain->parent);
-    for (int u = 0; u < node_units->num_units; ++u) {
-      DART_LOG_TRACE("dart__base__locality__create: %s unit[%d]: %d",
-                     hostname, u, node_units->units[u].id);
-    }
-  }
-#endif
-
-  DART_LOG_DEBUG("dart__base__locality__create: "
-                 "constructing domain hierarchy");
-  /* Recursively create locality information of the global domain's
-   * sub-domains:
-   */
-  DART_ASSERT_RETURNS(
-    dart__base__locality__domain__create_subdomains(
-      dart__base__locality__global_domain_[team],
-      dart__base__locality__host_topology_[team],
-      dart__base__locality__unit_mapping_[team]),
+    dart__base__locality__node_domain_tags(unit_mapping),
     DART_OK);
 
   DART_LOG_DEBUG("dart__base__locality__create >");
@@ -278,9 +224,11 @@ dart_ret_t dart__base__locality__team_domain(
   dart_ret_t ret = DART_ERR_NOTFOUND;
 
   *domain_out = NULL;
-  dart_domain_locality_t * domain =
-    dart__base__locality__global_domain_[team];
-
+  dart_domain_locality_t * domain;
+  ret = dart__base__locality__global_domain(team, &domain);
+  if (ret != DART_OK) {
+    return ret;
+  }
   ret = dart__base__locality__domain(domain, ".", domain_out);
 
   DART_LOG_DEBUG("dart__base__locality__team_domain > "
@@ -828,10 +776,25 @@ dart_ret_t dart__base__locality__unit(
                  team, unit.id);
   *locality = NULL;
 
+  dart_unit_mapping_t * unit_mapping =
+    dart__base__locality__unit_mapping_[team];
+  if (NULL == unit_mapping) {
+    DART_LOG_ERROR("dart__base__locality__unit ! "
+                   "locality of team %d is not initialized", team);
+    return DART_ERR_NOTINIT;
+  }
+  dart_ret_t ret;
+  if (!dart__base__unit_locality__is_node_unit(unit_mapping, unit)) {
+    /* Domain tags of units at other nodes are assigned in the
+     * construction of the global domain hierarchy: */
+    dart_domain_locality_t * global_domain;
+    ret = dart__base__locality__global_domain(team, &global_domain);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
   dart_unit_locality_t * uloc;
-  dart_ret_t ret = dart__base__unit_locality__at(
-                     dart__base__locality__unit_mapping_[team], unit,
-                     &uloc);
+  ret = dart__base__unit_locality__at(unit_mapping, unit, &uloc);
   if (ret != DART_OK) {
     DART_LOG_ERROR("dart_unit_locality: "
                    "dart__base__locality__unit(team:%d unit:%d) "
@@ -1200,3 +1163,147 @@ dart_ret_t dart__base__locality__scope_domains_rec(
   return DART_OK;
 }
 
+/**
+ * Assign domain tags to the units at the calling unit's node from the
+ * locality domain of the node.
+ */
+static dart_ret_t dart__base__locality__node_domain_tags(
+  dart_unit_mapping_t              * unit_mapping)
+{
+  DART_LOG_DEBUG("dart__base__locality__node_domain_tags() team(%d)",
+                 unit_mapping->team);
+
+  dart_host_topology_t * node_topo;
+  DART_ASSERT_RETURNS(
+    dart__base__host_topology__create_node(unit_mapping, &node_topo),
+    DART_OK);
+
+  /* Same node domain as in the global domain hierarchy: */
+  int node_id = unit_mapping->node_ids[unit_mapping->node_units[0].id];
+  dart_domain_locality_t node_domain;
+  dart__base__locality__domain__init(&node_domain);
+  node_domain.scope            = DART_LOCALITY_SCOPE_NODE;
+  node_domain.level            = 1;
+  node_domain.shared_mem_bytes = -1;
+  node_domain.global_index     = node_id;
+  node_domain.relative_index   = node_id;
+  node_domain.team             = unit_mapping->team;
+  node_domain.num_units        = 0;
+  sprintf(node_domain.domain_tag, ".%d", node_id);
+  strncpy(node_domain.host, node_topo->host_names[0],
+          DART_LOCALITY_HOST_MAX_SIZE);
+
+  dart_ret_t ret = dart__base__locality__domain__create_node_subdomains(
+                     &node_domain, node_topo, unit_mapping);
+
+  dart__base__locality__domain__destruct(&node_domain);
+  dart__base__host_topology__destruct(node_topo);
+  free(node_topo);
+
+  DART_LOG_DEBUG("dart__base__locality__node_domain_tags >");
+  return ret;
+}
+
+/**
+ * The global locality domain of the specified team, constructed from the
+ * locality information of all units in the team on first request.
+ *
+ * Locality information of units at other nodes is read from their
+ * published records, so the construction does not require
+ * participation of other units.
+ */
+static dart_ret_t dart__base__locality__global_domain(
+  dart_team_t                        team,
+  dart_domain_locality_t          ** domain_out)
+{
+  *domain_out = dart__base__locality__global_domain_[team];
+  if (NULL != *domain_out) {
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart__base__locality__global_domain() team(%d)", team);
+
+  dart_unit_mapping_t * unit_mapping =
+    dart__base__locality__unit_mapping_[team];
+  if (NULL == unit_mapping) {
+    DART_LOG_ERROR("dart__base__locality__global_domain ! "
+                   "locality of team %d is not initialized", team);
+    return DART_ERR_NOTINIT;
+  }
+  DART_ASSERT_RETURNS(
+    dart__base__unit_locality__resolve(unit_mapping),
+    DART_OK);
+
+  dart_domain_locality_t * team_global_domain =
+    malloc(sizeof(dart_domain_locality_t));
+
+  /* Initialize the global domain as the root entry in the locality
+   * hierarchy:
+   */
+  team_global_domain->scope          = DART_LOCALITY_SCOPE_GLOBAL;
+  team_global_domain->level          = 0;
+  team_global_domain->relative_index = 0;
+  team_global_domain->team           = team;
+  team_global_domain->parent         = NULL;
+  team_global_domain->num_domains    = 0;
+  team_global_domain->children       = NULL;
+  team_global_domain->num_units      = 0;
+  team_global_domain->host[0]        = '\0';
+  team_global_domain->domain_tag[0]  = '.';
+  team_global_domain->domain_tag[1]  = '\0';
+
+  size_t num_units = unit_mapping->num_units;
+  team_global_domain->num_units = num_units;
+  team_global_domain->unit_ids  = malloc(num_units *
+                                         sizeof(dart_global_unit_t));
+  for (size_t u = 0; u < num_units; ++u) {
+    dart_team_unit_t luid = { u };
+    DART_ASSERT_RETURNS(
+      dart_team_unit_l2g(team, luid, &team_global_domain->unit_ids[u]),
+      DART_OK);
+  }
+
+  /* Resolve host topology from the unit's nodes:
+   */
+  dart_host_topology_t * topo;
+  DART_ASSERT_RETURNS(
+    dart__base__host_topology__create(unit_mapping, &topo),
+    DART_OK);
+  size_t num_nodes = topo->num_nodes;
+  DART_LOG_TRACE("dart__base__locality__global_domain: nodes: %ld",
+                 num_nodes);
+
+  team_global_domain->num_nodes = num_nodes;
+
+#ifdef DART_ENABLE_LOGGING
+  for (int h = 0; h < topo->num_hosts; ++h) {
+    dart_host_units_t  * node_units  = &topo->host_units[h];
+    dart_host_domain_t * node_domain = &topo->host_domains[h];
+    char * hostname = topo->host_names[h];
+    DART_LOG_TRACE("dart__base__locality__global_domain: "
+                   "host %s: units:%d level:%d parent:%s", hostname,
+                   node_units->num_units,
+                   node_domain->level, node_domain->parent);
+    for (int u = 0; u < node_units->num_units; ++u) {
+      DART_LOG_TRACE("dart__base__locality__global_domain: %s unit[%d]: %d",
+                     hostname, u, node_units->units[u].id);
+    }
+  }
+#endif
+
+  DART_LOG_DEBUG("dart__base__locality__global_domain: "
+                 "constructing domain hierarchy");
+  /* Recursively create locality information of the global domain's
+   * sub-domains:
+   */
+  DART_ASSERT_RETURNS(
+    dart__base__locality__domain__create_subdomains(
+      team_global_domain, topo, unit_mapping),
+    DART_OK);
+
+  dart__base__locality__host_topology_[team] = topo;
+  dart__base__locality__global_domain_[team] = team_global_domain;
+  *domain_out = team_global_domain;
+
+  DART_LOG_DEBUG("dart__base__locality__global_domain >");
+  return DART_OK;
+}
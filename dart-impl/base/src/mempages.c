@@ -0,0 +1,182 @@
+/**
+ * \file dart/base/mempages.c
+ *
+ */
+#include <dash/dart/base/config.h>
+#ifdef DART__PLATFORM__LINUX
+/* _GNU_SOURCE required for MAP_HUGETLB and MADV_HUGEPAGE */
+#  define _GNU_SOURCE
+#endif
+#include <dash/dart/base/mempages.h>
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
+
+#include <dash/dart/if/dart_types.h>
+
+#include <sys/mman.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define DART_MEMPAGES_SIZE_2M ((size_t)1 << 21)
+#define DART_MEMPAGES_SIZE_1G ((size_t)1 << 30)
+
+/* Mappings created by dart__base__mempages_map */
+typedef struct dart_mempages_mapping_s {
+  void                           * addr;
+  size_t                           size;
+  struct dart_mempages_mapping_s * next;
+} dart_mempages_mapping_t;
+
+static dart_mempages_mapping_t * mappings       = NULL;
+static dart_mutex_t              mappings_mutex = DART_MUTEX_INITIALIZER;
+
+static inline size_t round_up(size_t n, size_t m)
+{
+  return ((n + m - 1) / m) * m;
+}
+
+static void * map_hugetlb(
+  size_t   nbytes,
+  size_t   page_size,
+  size_t * size)
+{
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+  int    shift = (page_size == DART_MEMPAGES_SIZE_1G) ? 30 : 21;
+  size_t len   = round_up(nbytes, page_size);
+  void * addr  = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                      (shift << MAP_HUGE_SHIFT),
+                      -1, 0);
+  if (addr == MAP_FAILED) {
+    DART_LOG_DEBUG("dart__base__mempages_map: "
+                   "no %zu KiB huge pages available for %zu bytes",
+                   page_size >> 10, nbytes);
+    return NULL;
+  }
+  *size = len;
+  return addr;
+#else
+  (void)nbytes;
+  (void)page_size;
+  (void)size;
+  return NULL;
+#endif
+}
+
+/*
+ * Mapping of pages of the default size, aligned to the huge page size
+ * and advised to be backed by transparent huge pages if requested.
+ */
+static void * map_default(
+  size_t   nbytes,
+  bool     huge,
+  size_t * size)
+{
+  size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  if (!huge) {
+    size_t len  = round_up(nbytes, page_size);
+    void * addr = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+      return NULL;
+    }
+    *size = len;
+    return addr;
+  }
+  /* Transparent huge pages are only used for aligned ranges of 2 MiB,
+   * map an additional huge page to align the mapping: */
+  size_t len    = round_up(nbytes, DART_MEMPAGES_SIZE_2M);
+  size_t maplen = len + DART_MEMPAGES_SIZE_2M;
+  char * map    = mmap(NULL, maplen, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (map == MAP_FAILED) {
+    return NULL;
+  }
+  char * addr   = (char *)round_up((uintptr_t)map, DART_MEMPAGES_SIZE_2M);
+  if (addr > map) {
+    munmap(map, addr - map);
+  }
+  if (map + maplen > addr + len) {
+    munmap(addr + len, (map + maplen) - (addr + len));
+  }
+#ifdef MADV_HUGEPAGE
+  if (madvise(addr, len, MADV_HUGEPAGE) != 0) {
+    DART_LOG_DEBUG("dart__base__mempages_map: "
+                   "transparent huge pages not available");
+  }
+#endif
+  *size = len;
+  return addr;
+}
+
+void * dart__base__mempages_map(
+  size_t            nbytes,
+  dart_mempages_t * pages)
+{
+  void * addr = NULL;
+  size_t size = 0;
+
+  if (nbytes == 0) {
+    return NULL;
+  }
+  if (*pages == DART_MEMPAGES_HUGE_1G) {
+    addr = map_hugetlb(nbytes, DART_MEMPAGES_SIZE_1G, &size);
+    if (addr == NULL) {
+      *pages = DART_MEMPAGES_HUGE_2M;
+    }
+  }
+  if (addr == NULL && *pages == DART_MEMPAGES_HUGE_2M) {
+    addr = map_hugetlb(nbytes, DART_MEMPAGES_SIZE_2M, &size);
+    if (addr == NULL) {
+      *pages = DART_MEMPAGES_HUGE;
+    }
+  }
+  if (addr == NULL) {
+    addr = map_default(nbytes, (*pages == DART_MEMPAGES_HUGE), &size);
+  }
+  if (addr == NULL) {
+    DART_LOG_ERROR("dart__base__mempages_map ! mmap of %zu bytes failed",
+                   nbytes);
+    return NULL;
+  }
+
+  dart_mempages_mapping_t * mapping =
+    malloc(sizeof(dart_mempages_mapping_t));
+  mapping->addr = addr;
+  mapping->size = size;
+  dart__base__mutex_lock(&mappings_mutex);
+  mapping->next = mappings;
+  mappings      = mapping;
+  dart__base__mutex_unlock(&mappings_mutex);
+
+  DART_LOG_DEBUG("dart__base__mempages_map > addr:%p size:%zu pages:%d",
+                 addr, size, *pages);
+  return addr;
+}
+
+dart_ret_t dart__base__mempages_unmap(
+  void * addr)
+{
+  dart_mempages_mapping_t *  mapping = NULL;
+  dart_mempages_mapping_t ** pred;
+
+  dart__base__mutex_lock(&mappings_mutex);
+  for (pred = &mappings; *pred != NULL; pred = &(*pred)->next) {
+    if ((*pred)->addr == addr) {
+      mapping = *pred;
+      *pred   = mapping->next;
+      break;
+    }
+  }
+  dart__base__mutex_unlock(&mappings_mutex);
+
+  if (mapping == NULL) {
+    DART_LOG_ERROR("dart__base__mempages_unmap ! unknown mapping %p", addr);
+    return DART_ERR_INVAL;
+  }
+  int ret = munmap(mapping->addr, mapping->size);
+  free(mapping);
+  return (ret == 0) ? DART_OK : DART_ERR_OTHER;
+}
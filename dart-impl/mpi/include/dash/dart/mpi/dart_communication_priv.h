@@ -65,6 +65,9 @@ typedef struct dart_datatype_struct {
       int            * offsets;
       /// the number of blocks
       int              num_blocks;
+      /// the extent of the type in number of elements, i.e. the distance
+      /// between the first elements of consecutive instances
+      int              extent;
     } indexed;
   };
 } dart_datatype_struct_t;
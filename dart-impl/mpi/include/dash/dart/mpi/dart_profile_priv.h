@@ -0,0 +1,190 @@
+/**
+ * \file dart_profile_priv.h
+ *
+ * Instrumentation of DART communication operations, see
+ * \ref dart_profile.h.
+ *
+ * Without \c DART_ENABLE_PROFILING all macros in this file expand to
+ * nothing so instrumented operations are unchanged.
+ */
+#ifndef DART__MPI__PROFILE_PRIV_H__
+#define DART__MPI__PROFILE_PRIV_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_profile.h>
+
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
+
+#include <stdint.h>
+
+#if defined(DART_ENABLE_PROFILING)
+
+#if defined(__x86_64__) || defined(__aarch64__)
+/**
+ * Timestamps are read from the timestamp counter of the processor and
+ * converted to nanoseconds when operations are recorded.
+ */
+#  define DART_PROFILE_HAS_TSC
+#endif
+
+#ifndef DART_PROFILE_SAMPLE_PERIOD
+/**
+ * The latency of every \c DART_PROFILE_SAMPLE_PERIOD-th one-sided
+ * operation of a thread is measured, all operations are counted. Must be
+ * a power of two, \c 1 to measure all one-sided operations.
+ */
+#  define DART_PROFILE_SAMPLE_PERIOD (16)
+#endif
+
+/**
+ * Number of one-sided operations started by the calling thread.
+ */
+extern __thread uint32_t dart__profile__nstarted DART_INTERNAL;
+
+/**
+ * Monotonic clock time in nanoseconds.
+ */
+uint64_t dart__profile__clock_ns() DART_INTERNAL;
+
+/**
+ * Timestamp of the start or end of an operation, in ticks of the
+ * timestamp counter if \c DART_PROFILE_HAS_TSC is defined, otherwise
+ * in nanoseconds.
+ */
+DART_INLINE
+uint64_t dart__profile__now()
+{
+#if defined(__x86_64__)
+  uint32_t lo, hi;
+  __asm__ volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  __asm__ volatile ("mrs %0, cntvct_el0" : "=r" (ticks));
+  return ticks;
+#else
+  return dart__profile__clock_ns();
+#endif
+}
+
+/**
+ * Timestamp of the start of a one-sided operation if its latency is
+ * sampled, otherwise \c 0.
+ */
+DART_INLINE
+uint64_t dart__profile__sample()
+{
+  if (dart__unlikely(
+        (dart__profile__nstarted++ & (DART_PROFILE_SAMPLE_PERIOD - 1))
+        == 0)) {
+    return dart__profile__now();
+  }
+  return 0;
+}
+
+/**
+ * Number of bytes in \c nelem elements of \c dtype.
+ */
+DART_INLINE
+uint64_t dart__profile__bytes(dart_datatype_t dtype, size_t nelem)
+{
+  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(
+                                  dart__mpi__datatype_base(dtype));
+  return (uint64_t)dts->basic.size * nelem;
+}
+
+/**
+ * Number of bytes in \c nunits blocks of \c dtype with element counts
+ * \c counts.
+ */
+DART_INLINE
+uint64_t dart__profile__bytes_v(
+  dart_datatype_t dtype, const size_t * counts, int nunits)
+{
+  size_t nelem = 0;
+  for (int u = 0; u < nunits; ++u) {
+    nelem += counts[u];
+  }
+  return dart__profile__bytes(dtype, nelem);
+}
+
+/**
+ * Record a one-sided operation \c op started at \c ts_start targeting
+ * \c unitid in \c team_data. The latency of the operation is only
+ * recorded if \c ts_start is not \c 0.
+ */
+void dart__profile__rma(
+  dart_profile_op_t        op,
+  uint64_t                 ts_start,
+  const dart_team_data_t * team_data,
+  dart_team_unit_t         unitid,
+  int16_t                  segid,
+  uint64_t                 bytes) DART_INTERNAL;
+
+/**
+ * Record an operation \c op started at \c ts_start that does not
+ * target a segment. The latency of the operation is only recorded if
+ * \c ts_start is not \c 0.
+ */
+void dart__profile__op(
+  dart_profile_op_t        op,
+  uint64_t                 ts_start,
+  uint64_t                 bytes) DART_INTERNAL;
+
+/**
+ * Create the translation of team-local to global unit ids of the
+ * team in \c team_data, called once the team's communicator is set.
+ * For \c DART_TEAM_ALL, also measures the rate of the timestamp
+ * counter before any operation is recorded.
+ */
+dart_ret_t dart__profile__team_init(
+  dart_team_data_t       * team_data) DART_INTERNAL;
+
+/**
+ * Release the profiling resources of the team in \c team_data.
+ */
+void dart__profile__team_fini(
+  dart_team_data_t       * team_data) DART_INTERNAL;
+
+#define DART_PROFILE_START(ts_) \
+  uint64_t ts_ = dart__profile__now()
+
+#define DART_PROFILE_START_RMA(ts_) \
+  uint64_t ts_ = dart__profile__sample()
+
+#define DART_PROFILE_RMA(op_, ts_, team_data_, unitid_, segid_, bytes_) \
+  dart__profile__rma((op_), (ts_), (team_data_), (unitid_), (segid_), \
+                     (bytes_))
+
+#define DART_PROFILE_OP(op_, ts_, bytes_) \
+  dart__profile__op((op_), (ts_), (bytes_))
+
+#define DART_PROFILE_BYTES(dtype_, nelem_) \
+  dart__profile__bytes((dtype_), (nelem_))
+
+#define DART_PROFILE_BYTES_V(dtype_, counts_, nunits_) \
+  dart__profile__bytes_v((dtype_), (counts_), (nunits_))
+
+#define DART_PROFILE_TEAM_INIT(team_data_) \
+  dart__profile__team_init(team_data_)
+
+#define DART_PROFILE_TEAM_FINI(team_data_) \
+  dart__profile__team_fini(team_data_)
+
+#else /* !DART_ENABLE_PROFILING */
+
+#define DART_PROFILE_START(ts_)
+#define DART_PROFILE_START_RMA(ts_)
+#define DART_PROFILE_RMA(op_, ts_, team_data_, unitid_, segid_, bytes_)
+#define DART_PROFILE_OP(op_, ts_, bytes_)
+#define DART_PROFILE_BYTES(dtype_, nelem_) 0
+#define DART_PROFILE_BYTES_V(dtype_, counts_, nunits_) 0
+#define DART_PROFILE_TEAM_INIT(team_data_)
+#define DART_PROFILE_TEAM_FINI(team_data_)
+
+#endif /* DART_ENABLE_PROFILING */
+
+#endif /* DART__MPI__PROFILE_PRIV_H__ */
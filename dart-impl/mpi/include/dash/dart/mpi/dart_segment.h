@@ -28,6 +28,8 @@ typedef struct
   uint16_t     flags;       /* 16 bit flags */
   dart_segid_t segid;       /* ID of the segment, globally unique in a team */
   bool         is_dynamic;  /* whether this is a shared memory segment */
+  bool         is_mapped;   /* whether selfbaseptr has been mapped by
+                               dart__base__mempages_map */
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
@@ -171,6 +171,8 @@ typedef struct dart_team_data {
   /**
    * @brief Store the sub-communicator with regard to certain node, where the units can
    * communicate via shared memory.
+   * Created in the first collective allocation in the team, \c MPI_COMM_NULL
+   * before.
    */
   MPI_Comm sharedmem_comm;
 
@@ -192,6 +194,14 @@ typedef struct dart_team_data {
 
   dart_team_t teamid;
 
+#if defined(DART_ENABLE_PROFILING)
+  /**
+   * @brief Global unit ids of the team's units, used to account
+   * communication to target units.
+   */
+  dart_global_unit_t *global_units;
+#endif // defined(DART_ENABLE_PROFILING)
+
 } dart_team_data_t;
 
 /* @brief Initiate the free-team-list and allocated-team-list.
@@ -233,12 +243,55 @@ dart_adapt_teamlist_get(dart_team_t teamid) DART_INTERNAL;
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
- * Allocate shared memory communicator for the given \c team_data.
- * Shared between \c dart_initialize and \c dart_team_create.
+ * Allocate shared memory communicator for the given \c team_data unless
+ * it has been allocated already.
+ * Called in \c dart_initialize and in the collective allocation of
+ * global memory, so teams never used for allocations do not split their
+ * communicator.
  */
 dart_ret_t dart_allocate_shared_comm(
   dart_team_data_t *team_data) DART_INTERNAL;
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/**
+ * Id of the team whose communicator is cached for the group with the
+ * given global unit ids in the order of their rank, or \c DART_TEAM_NULL
+ * if no communicator of the group is cached or caching is disabled at
+ * the calling unit.
+ */
+dart_team_t dart_adapt_teamcache_find(
+  const int * global_ids,
+  int         size) DART_INTERNAL;
+
+/**
+ * Move the cached communicators and window of the team with id
+ * \c cached_teamid to \c team_data and remove them from the cache.
+ */
+dart_ret_t dart_adapt_teamcache_take(
+  dart_team_t        cached_teamid,
+  dart_team_data_t * team_data) DART_INTERNAL;
+
+/**
+ * Release the communicators and window of a destroyed team. They are
+ * kept for reuse in a team of the same group unless the cache of any
+ * unit in the team is full or already holds communicators of the group.
+ * Collective operation on the team.
+ */
+dart_ret_t dart_adapt_teamcache_release(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
+/**
+ * Free all cached communicators and windows, called in \c dart_exit.
+ */
+dart_ret_t dart_adapt_teamcache_destroy() DART_INTERNAL;
+
+/**
+ * Global unit ids of the units in \c group in the order of their rank,
+ * the returned array must be freed by the caller.
+ */
+int * dart_adapt_group_global_ids(
+  MPI_Group   group,
+  int       * size) DART_INTERNAL;
+
 #endif /*DART_ADAPT_TEAMNODE_H_INCLUDED*/
 
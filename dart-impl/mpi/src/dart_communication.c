@@ -12,6 +12,7 @@
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_config.h>
 
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_team_private.h>
@@ -19,6 +20,7 @@
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_profile_priv.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
@@ -27,6 +29,7 @@
 #include <mpi.h>
 #include <string.h>
 #include <limits.h>
+#include <stdint.h>
 #include <math.h>
 #include <alloca.h>
 
@@ -157,6 +160,187 @@ static dart_ret_t put_shared_mem(
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/**
+ * Position in the sequence of contiguous blocks described by a DART data
+ * type, in number of elements of its base type.
+ */
+typedef struct {
+  const dart_datatype_struct_t * dts;
+  /// index of the current block, counting the blocks of all instances
+  size_t                         block;
+  /// number of elements already consumed in the current block
+  size_t                         pos;
+} dart_dtype_cursor_t;
+
+/**
+ * Element offset and remaining length of the current block of the data
+ * type at the cursor position, skipping empty blocks of indexed types.
+ * The block of a basic type is unbounded.
+ */
+static inline void
+dtype_cursor_block(
+  dart_dtype_cursor_t * cursor,
+  size_t              * offset,
+  size_t              * len)
+{
+  const dart_datatype_struct_t * dts = cursor->dts;
+  switch (dts->kind) {
+    case DART_KIND_STRIDED:
+      *offset = cursor->block * dts->strided.stride + cursor->pos;
+      *len    = dts->num_elem - cursor->pos;
+      break;
+    case DART_KIND_INDEXED:
+      for (;;) {
+        size_t instance = cursor->block / dts->indexed.num_blocks;
+        size_t block    = cursor->block % dts->indexed.num_blocks;
+        *offset = instance * dts->indexed.extent +
+                  dts->indexed.offsets[block] + cursor->pos;
+        *len    = dts->indexed.blocklens[block] - cursor->pos;
+        if (*len > 0) break;
+        cursor->block++;
+        cursor->pos = 0;
+      }
+      break;
+    default:
+      *offset = cursor->pos;
+      *len    = SIZE_MAX;
+      break;
+  }
+}
+
+static inline void
+dtype_cursor_advance(
+  dart_dtype_cursor_t * cursor,
+  size_t                nelem,
+  size_t                len)
+{
+  if (nelem == len) {
+    cursor->block++;
+    cursor->pos = 0;
+  } else {
+    cursor->pos += nelem;
+  }
+}
+
+/**
+ * Copies a block of \c nbytes, letting the compiler inline copies of
+ * single elements.
+ */
+static inline void
+copy_block(
+  char       * dst,
+  const char * src,
+  size_t       nbytes)
+{
+  switch (nbytes) {
+    case 1:  memcpy(dst, src, 1);      break;
+    case 2:  memcpy(dst, src, 2);      break;
+    case 4:  memcpy(dst, src, 4);      break;
+    case 8:  memcpy(dst, src, 8);      break;
+    case 16: memcpy(dst, src, 16);     break;
+    default: memcpy(dst, src, nbytes); break;
+  }
+}
+
+/**
+ * Copies \c nelem elements from \c src described by \c src_type to
+ * \c dst described by \c dst_type, both in local or shared memory.
+ *
+ * Gathers from strided into contiguous memory, scatters from contiguous
+ * into strided memory and copies between strided types of identical block
+ * size in a single loop, any other combination of types is copied block by
+ * block by walking both type descriptors.
+ */
+static void
+dart__mpi__copy_dtype(
+  char            * dst,
+  dart_datatype_t   dst_type,
+  const char      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem)
+{
+  const dart_datatype_struct_t * src_dts = dart__mpi__datatype_struct(
+                                             src_type);
+  const dart_datatype_struct_t * dst_dts = dart__mpi__datatype_struct(
+                                             dst_type);
+  const size_t esize = dart__mpi__datatype_sizeof(
+                         dart__mpi__datatype_base(src_type));
+
+  if (src_dts->kind == DART_KIND_STRIDED &&
+      (dst_dts->kind == DART_KIND_BASIC ||
+       (dst_dts->kind == DART_KIND_STRIDED &&
+        dst_dts->num_elem == src_dts->num_elem))) {
+    const size_t blocklen   = src_dts->num_elem;
+    const size_t num_blocks = nelem / blocklen;
+    const size_t src_stride = src_dts->strided.stride * esize;
+    const size_t dst_stride = (dst_dts->kind == DART_KIND_STRIDED)
+                              ? dst_dts->strided.stride * esize
+                              : blocklen * esize;
+    for (size_t b = 0; b < num_blocks; ++b) {
+      copy_block(dst + b * dst_stride, src + b * src_stride,
+                 blocklen * esize);
+    }
+    return;
+  }
+  if (src_dts->kind == DART_KIND_BASIC &&
+      dst_dts->kind == DART_KIND_STRIDED) {
+    const size_t blocklen   = dst_dts->num_elem;
+    const size_t num_blocks = nelem / blocklen;
+    const size_t dst_stride = dst_dts->strided.stride * esize;
+    for (size_t b = 0; b < num_blocks; ++b) {
+      copy_block(dst + b * dst_stride, src + b * blocklen * esize,
+                 blocklen * esize);
+    }
+    return;
+  }
+
+  dart_dtype_cursor_t src_cursor = { src_dts, 0, 0 };
+  dart_dtype_cursor_t dst_cursor = { dst_dts, 0, 0 };
+  while (nelem > 0) {
+    size_t src_offset, src_len, dst_offset, dst_len;
+    dtype_cursor_block(&src_cursor, &src_offset, &src_len);
+    dtype_cursor_block(&dst_cursor, &dst_offset, &dst_len);
+    size_t n = nelem;
+    if (src_len < n) n = src_len;
+    if (dst_len < n) n = dst_len;
+    copy_block(dst + dst_offset * esize, src + src_offset * esize,
+               n * esize);
+    dtype_cursor_advance(&src_cursor, n, src_len);
+    dtype_cursor_advance(&dst_cursor, n, dst_len);
+    nelem -= n;
+  }
+}
+
+/**
+ * Returns the base address of the memory of unit \c team_unit_id in the
+ * given segment if it is directly accessible, or \c NULL otherwise.
+ * Only used for strided and indexed data types, can be disabled in
+ * \c dart_config_t.
+ */
+static inline char *
+dart__mpi__shmem_dtype_baseptr(
+  const dart_team_data_t    * team_data,
+  dart_team_unit_t            team_unit_id,
+  const dart_segment_info_t * seginfo)
+{
+  dart_config_t * config;
+  dart_config(&config);
+  if (!config->shmem_dtype_copy) {
+    return NULL;
+  }
+  if (team_data->unitid == team_unit_id.id) {
+    return seginfo->selfbaseptr;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 &&
+      team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
+    dart_team_unit_t luid = team_data->sharedmem_tab[team_unit_id.id];
+    return seginfo->baseptr[luid.id];
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return NULL;
+}
+
 /**
  * Internal implementations of put/get with and without handles for
  * basic data types and complex data types.
@@ -282,6 +466,7 @@ dart__mpi__get_basic(
 static inline
 dart_ret_t
 dart__mpi__get_complex(
+  const dart_team_data_t    * team_data,
   dart_team_unit_t            team_unit_id,
   const dart_segment_info_t * seginfo,
   void                      * dest,
@@ -296,6 +481,15 @@ dart__mpi__get_complex(
 
   CHECK_TYPE_CONSTRAINTS(src_type, dst_type, nelem);
 
+  char * baseptr = dart__mpi__shmem_dtype_baseptr(
+                     team_data, team_unit_id, seginfo);
+  if (baseptr != NULL) {
+    DART_LOG_DEBUG("dart_get: copying derived type from shared memory "
+                   "in segment %d", seginfo->segid);
+    dart__mpi__copy_dtype(dest, dst_type, baseptr + offset, src_type, nelem);
+    return DART_OK;
+  }
+
   MPI_Win win     = seginfo->win;
   char * dest_ptr = (char*) dest;
   offset         += dart_segment_disp(seginfo, team_unit_id);
@@ -421,6 +615,7 @@ dart__mpi__put_basic(
 static inline
 dart_ret_t
 dart__mpi__put_complex(
+  const dart_team_data_t    * team_data,
   dart_team_unit_t            team_unit_id,
   const dart_segment_info_t * seginfo,
   const void                * src,
@@ -435,9 +630,20 @@ dart__mpi__put_complex(
   if (flush_required_ptr) *flush_required_ptr = true;
   if (num_reqs) *num_reqs = 0;
 
-  // slow path for derived types
   CHECK_TYPE_CONSTRAINTS(src_type, dst_type, nelem);
 
+  char * baseptr = dart__mpi__shmem_dtype_baseptr(
+                     team_data, team_unit_id, seginfo);
+  if (baseptr != NULL) {
+    DART_LOG_DEBUG("dart_put: copying derived type to shared memory "
+                   "in segment %d", seginfo->segid);
+    if (flush_required_ptr) *flush_required_ptr = false;
+    dart__mpi__copy_dtype(baseptr + offset, dst_type, src, src_type, nelem);
+    return DART_OK;
+  }
+
+  // slow path for derived types
+
   MPI_Win win            = seginfo->win;
   const char * src_ptr   = (const char*) src;
   offset                += dart_segment_disp(seginfo, team_unit_id);
@@ -491,6 +697,7 @@ dart_ret_t dart_get(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   uint64_t         offset       = gptr.addr_or_offs.offset;
   int16_t          seg_id       = gptr.segid;
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
@@ -525,11 +732,13 @@ dart_ret_t dart_get(
                                offset, nelem, src_type, NULL, NULL);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
                                  offset, nelem, src_type, dst_type, NULL, NULL);
   }
 
   DART_LOG_DEBUG("dart_get > finished");
+  DART_PROFILE_RMA(DART_PROFILE_OP_GET, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(src_type, nelem));
   return ret;
 }
 
@@ -540,6 +749,7 @@ dart_ret_t dart_put(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   uint64_t         offset       = gptr.addr_or_offs.offset;
   int16_t          seg_id       = gptr.segid;
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
@@ -574,11 +784,13 @@ dart_ret_t dart_put(
                                NULL, NULL, NULL);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  NULL, NULL, NULL);
   }
 
+  DART_PROFILE_RMA(DART_PROFILE_OP_PUT, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(src_type, nelem));
   return ret;
 }
 
@@ -589,6 +801,7 @@ dart_ret_t dart_accumulate(
   dart_datatype_t  dtype,
   dart_operation_t op)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t    offset = gptr.addr_or_offs.offset;
   int16_t     seg_id = gptr.segid;
@@ -664,6 +877,8 @@ dart_ret_t dart_accumulate(
   }
 
   DART_LOG_DEBUG("dart_accumulate > finished");
+  DART_PROFILE_RMA(DART_PROFILE_OP_ACCUMULATE, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -675,6 +890,7 @@ dart_ret_t dart_accumulate_blocking_local(
   dart_datatype_t  dtype,
   dart_operation_t op)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t    offset = gptr.addr_or_offs.offset;
   int16_t     seg_id = gptr.segid;
@@ -756,6 +972,8 @@ dart_ret_t dart_accumulate_blocking_local(
   MPI_Waitall(num_reqs, reqs, MPI_STATUSES_IGNORE);
 
   DART_LOG_DEBUG("dart_accumulate > finished");
+  DART_PROFILE_RMA(DART_PROFILE_OP_ACCUMULATE, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -767,6 +985,7 @@ dart_ret_t dart_fetch_and_op(
   dart_datatype_t  dtype,
   dart_operation_t op)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   MPI_Datatype mpi_dtype;
   MPI_Op       mpi_op;
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
@@ -815,6 +1034,8 @@ dart_ret_t dart_fetch_and_op(
     "MPI_Fetch_and_op");
 
   DART_LOG_DEBUG("dart_fetch_and_op > finished");
+  DART_PROFILE_RMA(DART_PROFILE_OP_FETCH_AND_OP, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(dtype, 1));
   return DART_OK;
 }
 
@@ -825,6 +1046,7 @@ dart_ret_t dart_compare_and_swap(
   void           * result,
   dart_datatype_t  dtype)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t    offset = gptr.addr_or_offs.offset;
   int16_t     seg_id = gptr.segid;
@@ -871,6 +1093,8 @@ dart_ret_t dart_compare_and_swap(
         win),
     "MPI_Compare_and_swap");
   DART_LOG_DEBUG("dart_compare_and_swap > finished");
+  DART_PROFILE_RMA(DART_PROFILE_OP_COMPARE_AND_SWAP, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(dtype, 1));
   return DART_OK;
 }
 
@@ -884,6 +1108,7 @@ dart_ret_t dart_get_handle(
   dart_datatype_t dst_type,
   dart_handle_t * handleptr)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t         offset = gptr.addr_or_offs.offset;
   int16_t          seg_id = gptr.segid;
@@ -931,7 +1156,7 @@ dart_ret_t dart_get_handle(
                                handle->reqs, &handle->num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
                                  offset, nelem, src_type, dst_type,
                                  handle->reqs, &handle->num_reqs);
   }
@@ -945,6 +1170,8 @@ dart_ret_t dart_get_handle(
 
   DART_LOG_TRACE("dart_get_handle > handle(%p) dest:%d",
                  (void*)(handle), team_unit_id.id);
+  DART_PROFILE_RMA(DART_PROFILE_OP_GET, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(src_type, nelem));
   return ret;
 }
 
@@ -956,6 +1183,7 @@ dart_ret_t dart_put_handle(
   dart_datatype_t   dst_type,
   dart_handle_t   * handleptr)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t     offset   = gptr.addr_or_offs.offset;
   int16_t      seg_id   = gptr.segid;
@@ -1002,7 +1230,7 @@ dart_ret_t dart_put_handle(
                                &handle->needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  handle->reqs,
                                  &handle->num_reqs,
@@ -1019,6 +1247,8 @@ dart_ret_t dart_put_handle(
   DART_LOG_TRACE("dart_put_handle > handle(%p) dest:%d",
                  (void*)(handle), team_unit_id.id);
 
+  DART_PROFILE_RMA(DART_PROFILE_OP_PUT, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(src_type, nelem));
   return ret;
 }
 
@@ -1034,6 +1264,7 @@ dart_ret_t dart_put_blocking(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t          offset       = gptr.addr_or_offs.offset;
   int16_t           seg_id       = gptr.segid;
@@ -1074,7 +1305,7 @@ dart_ret_t dart_put_blocking(
                                NULL, NULL, &needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  NULL, NULL, &needs_flush);
   }
@@ -1085,6 +1316,8 @@ dart_ret_t dart_put_blocking(
   }
 
   DART_LOG_DEBUG("dart_put_blocking > finished");
+  DART_PROFILE_RMA(DART_PROFILE_OP_PUT, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(src_type, nelem));
   return ret;
 }
 
@@ -1098,6 +1331,7 @@ dart_ret_t dart_get_blocking(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type)
 {
+  DART_PROFILE_START_RMA(ts_profile);
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t          offset       = gptr.addr_or_offs.offset;
   int16_t           seg_id       = gptr.segid;
@@ -1141,7 +1375,7 @@ dart_ret_t dart_get_blocking(
                                reqs, &num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
                                  offset, nelem, src_type, dst_type,
                                  reqs, &num_reqs);
   }
@@ -1152,6 +1386,8 @@ dart_ret_t dart_get_blocking(
   }
 
   DART_LOG_DEBUG("dart_get_blocking > finished");
+  DART_PROFILE_RMA(DART_PROFILE_OP_GET, ts_profile, team_data,
+                   team_unit_id, seg_id, DART_PROFILE_BYTES(src_type, nelem));
   return DART_OK;
 }
 
@@ -1160,6 +1396,7 @@ dart_ret_t dart_get_blocking(
 dart_ret_t dart_flush(
   dart_gptr_t gptr)
 {
+  DART_PROFILE_START(ts_profile);
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   int16_t          seg_id       = gptr.segid;
   dart_team_t      teamid       = gptr.teamid;
@@ -1201,12 +1438,14 @@ dart_ret_t dart_flush(
     "MPI_Iprobe");
 
   DART_LOG_DEBUG("dart_flush > finished");
+  DART_PROFILE_OP(DART_PROFILE_OP_FLUSH, ts_profile, 0);
   return DART_OK;
 }
 
 dart_ret_t dart_flush_all(
   dart_gptr_t gptr)
 {
+  DART_PROFILE_START(ts_profile);
   int16_t     seg_id = gptr.segid;
   dart_team_t teamid = gptr.teamid;
 
@@ -1246,12 +1485,14 @@ dart_ret_t dart_flush_all(
     "MPI_Iprobe");
 
   DART_LOG_DEBUG("dart_flush_all > finished");
+  DART_PROFILE_OP(DART_PROFILE_OP_FLUSH, ts_profile, 0);
   return DART_OK;
 }
 
 dart_ret_t dart_flush_local(
   dart_gptr_t gptr)
 {
+  DART_PROFILE_START(ts_profile);
   int16_t     seg_id = gptr.segid;
   dart_team_t teamid = gptr.teamid;
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
@@ -1291,12 +1532,14 @@ dart_ret_t dart_flush_local(
     "MPI_Iprobe");
 
   DART_LOG_DEBUG("dart_flush_local > finished");
+  DART_PROFILE_OP(DART_PROFILE_OP_FLUSH, ts_profile, 0);
   return DART_OK;
 }
 
 dart_ret_t dart_flush_local_all(
   dart_gptr_t gptr)
 {
+  DART_PROFILE_START(ts_profile);
   int16_t     seg_id = gptr.segid;
   dart_team_t teamid = gptr.teamid;
   DART_LOG_DEBUG("dart_flush_local_all() gptr: "
@@ -1332,12 +1575,14 @@ dart_ret_t dart_flush_local_all(
     "MPI_Iprobe");
 
   DART_LOG_DEBUG("dart_flush_local_all > finished");
+  DART_PROFILE_OP(DART_PROFILE_OP_FLUSH, ts_profile, 0);
   return DART_OK;
 }
 
 dart_ret_t dart_wait_local(
   dart_handle_t * handleptr)
 {
+  DART_PROFILE_START(ts_profile);
   DART_LOG_DEBUG("dart_wait_local() handle:%p", (void*)(handleptr));
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
     dart_handle_t handle = *handleptr;
@@ -1358,12 +1603,14 @@ dart_ret_t dart_wait_local(
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait_local > finished");
+  DART_PROFILE_OP(DART_PROFILE_OP_FLUSH, ts_profile, 0);
   return DART_OK;
 }
 
 dart_ret_t dart_wait(
   dart_handle_t * handleptr)
 {
+  DART_PROFILE_START(ts_profile);
   DART_LOG_DEBUG("dart_wait() handle:%p", (void*)(handleptr));
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
     dart_handle_t handle = *handleptr;
@@ -1390,6 +1637,7 @@ dart_ret_t dart_wait(
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait > finished");
+  DART_PROFILE_OP(DART_PROFILE_OP_FLUSH, ts_profile, 0);
   return DART_OK;
 }
 
@@ -1397,6 +1645,7 @@ dart_ret_t dart_waitall_local(
   dart_handle_t handles[],
   size_t        num_handles)
 {
+  DART_PROFILE_START(ts_profile);
   dart_ret_t ret = DART_OK;
 
   DART_LOG_DEBUG("dart_waitall_local()");
@@ -1460,6 +1709,7 @@ dart_ret_t dart_waitall_local(
     FREE_TMP(2 * num_handles * sizeof(MPI_Request), mpi_req);
   }
   DART_LOG_DEBUG("dart_waitall_local > %d", ret);
+  DART_PROFILE_OP(DART_PROFILE_OP_FLUSH, ts_profile, 0);
   return ret;
 }
 
@@ -1488,6 +1738,7 @@ dart_ret_t dart_waitall(
   dart_handle_t handles[],
   size_t        n)
 {
+  DART_PROFILE_START(ts_profile);
   DART_LOG_DEBUG("dart_waitall()");
   if (n == 0) {
     DART_LOG_DEBUG("dart_waitall > number of handles = 0");
@@ -1580,6 +1831,7 @@ dart_ret_t dart_waitall(
     FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
   }
   DART_LOG_DEBUG("dart_waitall > finished");
+  DART_PROFILE_OP(DART_PROFILE_OP_FLUSH, ts_profile, 0);
   return DART_OK;
 }
 
@@ -1813,6 +2065,7 @@ static int _dart_barrier_count = 0;
 dart_ret_t dart_barrier(
   dart_team_t teamid)
 {
+  DART_PROFILE_START(ts_profile);
   DART_LOG_DEBUG("dart_barrier() barrier count: %d", _dart_barrier_count);
 
   if (dart__unlikely(teamid == DART_UNDEFINED_TEAM_ID)) {
@@ -1833,6 +2086,7 @@ dart_ret_t dart_barrier(
     MPI_Barrier(team_data->comm), "MPI_Barrier");
 
   DART_LOG_DEBUG("dart_barrier > MPI_Barrier finished");
+  DART_PROFILE_OP(DART_PROFILE_OP_BARRIER, ts_profile, 0);
   return DART_OK;
 }
 
@@ -1843,6 +2097,7 @@ dart_ret_t dart_bcast(
   dart_team_unit_t    root,
   dart_team_t         teamid)
 {
+  DART_PROFILE_START(ts_profile);
   DART_LOG_TRACE("dart_bcast() root:%d team:%d nelem:%"PRIu64"",
                  root.id, teamid, nelem);
 
@@ -1879,6 +2134,8 @@ dart_ret_t dart_bcast(
 
   DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu finished",
                  root.id, teamid, nelem);
+  DART_PROFILE_OP(DART_PROFILE_OP_BCAST, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -1890,6 +2147,7 @@ dart_ret_t dart_scatter(
   dart_team_unit_t    root,
   dart_team_t         teamid)
 {
+  DART_PROFILE_START(ts_profile);
   CHECK_IS_BASICTYPE(dtype);
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
@@ -1940,6 +2198,8 @@ dart_ret_t dart_scatter(
       "MPI_Scatter");
   }
 
+  DART_PROFILE_OP(DART_PROFILE_OP_SCATTER, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -1951,6 +2211,7 @@ dart_ret_t dart_gather(
   dart_team_unit_t     root,
   dart_team_t          teamid)
 {
+  DART_PROFILE_START(ts_profile);
   DART_LOG_TRACE("dart_gather() team:%d nelem:%"PRIu64"",
                  teamid, nelem);
 
@@ -2004,6 +2265,8 @@ dart_ret_t dart_gather(
       "MPI_Gather");
   }
 
+  DART_PROFILE_OP(DART_PROFILE_OP_GATHER, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -2014,6 +2277,7 @@ dart_ret_t dart_allgather(
   dart_datatype_t   dtype,
   dart_team_t       teamid)
 {
+  DART_PROFILE_START(ts_profile);
   DART_LOG_TRACE("dart_allgather() team:%d nelem:%"PRIu64"",
                  teamid, nelem);
 
@@ -2069,6 +2333,8 @@ dart_ret_t dart_allgather(
 
   DART_LOG_TRACE("dart_allgather > team:%d nelem:%"PRIu64"",
                  teamid, nelem);
+  DART_PROFILE_OP(DART_PROFILE_OP_ALLGATHER, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -2081,6 +2347,7 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid)
 {
+  DART_PROFILE_START(ts_profile);
   DART_LOG_TRACE("dart_allgatherv() team:%d nsendelem:%"PRIu64"",
                  teamid, nsendelem);
 
@@ -2145,6 +2412,79 @@ dart_ret_t dart_allgatherv(
   free(irecvdispls);
   DART_LOG_TRACE("dart_allgatherv > team:%d nsendelem:%"PRIu64"",
                  teamid, nsendelem);
+  DART_PROFILE_OP(DART_PROFILE_OP_ALLGATHERV, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nsendelem));
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  DART_PROFILE_START(ts_profile);
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  MPI_Comm comm      = team_data->comm;
+  int      comm_size = team_data->size;
+
+  /*
+   * MPI uses offset type int, convert counts and displacements:
+   */
+  int *icounts = malloc(sizeof(int) * comm_size * 4);
+  int *isendcounts = icounts;
+  int *isenddispls = icounts + comm_size;
+  int *irecvcounts = icounts + comm_size * 2;
+  int *irecvdispls = icounts + comm_size * 3;
+  for (int i = 0; i < comm_size; i++) {
+    if (nsendcounts[i] > MAX_CONTIG_ELEMENTS ||
+        senddispls[i]  > MAX_CONTIG_ELEMENTS ||
+        nrecvcounts[i] > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i]  > MAX_CONTIG_ELEMENTS)
+    {
+      DART_LOG_ERROR(
+        "dart_alltoallv ! failed: counts or displacements for unit %i "
+        "exceed INT_MAX", i);
+      free(icounts);
+      return DART_ERR_INVAL;
+    }
+    isendcounts[i] = nsendcounts[i];
+    isenddispls[i] = senddispls[i];
+    irecvcounts[i] = nrecvcounts[i];
+    irecvdispls[i] = recvdispls[i];
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  if (MPI_Alltoallv(
+           sendbuf,
+           isendcounts,
+           isenddispls,
+           mpi_dtype,
+           recvbuf,
+           irecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    free(icounts);
+    return DART_ERR_INVAL;
+  }
+  free(icounts);
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  DART_PROFILE_OP(DART_PROFILE_OP_ALLTOALLV, ts_profile,
+                  DART_PROFILE_BYTES_V(dtype, nsendcounts, comm_size));
   return DART_OK;
 }
 
@@ -2156,6 +2496,7 @@ dart_ret_t dart_allreduce(
   dart_operation_t   op,
   dart_team_t        team)
 {
+  DART_PROFILE_START(ts_profile);
 
   CHECK_IS_BASICTYPE(dtype);
 
@@ -2185,6 +2526,8 @@ dart_ret_t dart_allreduce(
            mpi_op,    // reduce operation
            comm),
     "MPI_Allreduce");
+  DART_PROFILE_OP(DART_PROFILE_OP_ALLREDUCE, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -2197,6 +2540,7 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team)
 {
+  DART_PROFILE_START(ts_profile);
   MPI_Comm     comm;
   CHECK_IS_BASICTYPE(dtype);
   MPI_Op       mpi_op    = dart__mpi__op(op);
@@ -2228,6 +2572,8 @@ dart_ret_t dart_reduce(
            root.id,
            comm),
     "MPI_Reduce");
+  DART_PROFILE_OP(DART_PROFILE_OP_REDUCE, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -2238,6 +2584,7 @@ dart_ret_t dart_send(
   int                  tag,
   dart_global_unit_t   unit)
 {
+  DART_PROFILE_START(ts_profile);
   MPI_Comm comm;
   CHECK_IS_BASICTYPE(dtype);
   MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
@@ -2270,6 +2617,8 @@ dart_ret_t dart_send(
         tag,
         comm),
     "MPI_Send");
+  DART_PROFILE_OP(DART_PROFILE_OP_SEND, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -2280,6 +2629,7 @@ dart_ret_t dart_recv(
   int                   tag,
   dart_global_unit_t    unit)
 {
+  DART_PROFILE_START(ts_profile);
   MPI_Comm comm;
   CHECK_IS_BASICTYPE(dtype);
   MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
@@ -2313,6 +2663,8 @@ dart_ret_t dart_recv(
         comm,
         MPI_STATUS_IGNORE),
     "MPI_Recv");
+  DART_PROFILE_OP(DART_PROFILE_OP_RECV, ts_profile,
+                  DART_PROFILE_BYTES(dtype, nelem));
   return DART_OK;
 }
 
@@ -2328,6 +2680,7 @@ dart_ret_t dart_sendrecv(
   int                  recv_tag,
   dart_global_unit_t   src)
 {
+  DART_PROFILE_START(ts_profile);
   MPI_Comm comm;
   CHECK_IS_BASICTYPE(send_dtype);
   CHECK_IS_BASICTYPE(recv_dtype);
@@ -2372,5 +2725,8 @@ dart_ret_t dart_sendrecv(
         comm,
         MPI_STATUS_IGNORE),
     "MPI_Sendrecv");
+  DART_PROFILE_OP(DART_PROFILE_OP_SENDRECV, ts_profile,
+                  DART_PROFILE_BYTES(send_dtype, send_nelem) +
+                  DART_PROFILE_BYTES(recv_dtype, recv_nelem));
   return DART_OK;
 }
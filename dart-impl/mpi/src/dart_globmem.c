@@ -10,6 +10,7 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/atomic.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/mempages.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -64,6 +65,51 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
   return DART_OK;
 }
 
+dart_ret_t dart_gptr_getaddr_shared(const dart_gptr_t gptr, void **addr)
+{
+  int16_t  segid  = gptr.segid;
+  uint64_t offset = gptr.addr_or_offs.offset;
+
+  *addr = NULL;
+
+  if (DART_GPTR_ISNULL(gptr)) {
+    return DART_OK;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown team %i",
+                   gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (gptr.unitid < 0 || gptr.unitid >= team_data->size) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Invalid unit %i in team %i",
+                   gptr.unitid, gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (team_data->unitid == gptr.unitid) {
+    return dart_gptr_getaddr(gptr, addr);
+  }
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (segid >= 0 && team_data->sharedmem_tab[gptr.unitid].id >= 0) {
+    dart_segment_info_t *seginfo = dart_segment_get_info(
+                                     &(team_data->segdata), segid);
+    if (seginfo == NULL) {
+      DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown segment %i", segid);
+      return DART_ERR_INVAL;
+    }
+    if (seginfo->baseptr != NULL) {
+      dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+      *addr = seginfo->baseptr[luid.id] + offset;
+    }
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return DART_OK;
+}
+
 dart_ret_t dart_gptr_setaddr(dart_gptr_t* gptr, void* addr)
 {
   int16_t segid = gptr->segid;
@@ -194,6 +240,10 @@ dart_team_memalloc_aligned_dynamic(
     return DART_ERR_INVAL;
   }
 
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  dart_allocate_shared_comm(team_data);
+#endif
+
   MPI_Comm  comm = team_data->comm;
 
   dart_segment_info_t *segment = dart_segment_alloc(
@@ -396,6 +446,10 @@ dart_team_memalloc_aligned_full(
     return DART_ERR_INVAL;
   }
 
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  dart_allocate_shared_comm(team_data);
+#endif
+
   MPI_Comm  comm = team_data->comm;
 
   dart_segment_info_t *segment = dart_segment_alloc(
@@ -440,6 +494,120 @@ dart_team_memalloc_aligned_full(
   return DART_OK;
 }
 
+/*
+ * Collective allocation of local memory mapped by every unit with the
+ * specified kind of pages instead of in a shared memory window.
+ * Uses a registered segment ID, so accesses of units at the same node
+ * are not performed in shared memory.
+ */
+static dart_ret_t
+dart_team_memalloc_aligned_mapped(
+  dart_team_t       teamid,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_mempages_t   pages,
+  dart_gptr_t     * gptr)
+{
+  dart_unit_t gptr_unitid = 0; // the team-local ID 0 has the beginning
+  int         dtype_size  = dart__mpi__datatype_sizeof(dtype);
+  size_t      nbytes      = nelem * dtype_size;
+  char      * sub_mem     = NULL;
+  *gptr = DART_GPTR_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR(
+        "dart_team_memalloc_aligned_mapped ! Unknown team %i", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_info_t *segment = dart_segment_alloc(
+                                &team_data->segdata, DART_SEGMENT_REGISTER);
+  if (segment == NULL) {
+    DART_LOG_ERROR(
+        "dart_team_memalloc_aligned_mapped: bytes:%zu "
+        "Allocation of segment data failed", nbytes);
+    return DART_ERR_OTHER;
+  }
+
+  int mapped = 1;
+  if (nbytes > 0) {
+    sub_mem = dart__base__mempages_map(nbytes, &pages);
+    mapped  = (sub_mem != NULL);
+  }
+  // The allocation fails at all units if mapping failed at any unit:
+  MPI_Allreduce(MPI_IN_PLACE, &mapped, 1, MPI_INT, MPI_LAND,
+                team_data->comm);
+  if (!mapped) {
+    DART_LOG_ERROR("dart_team_memalloc_aligned_mapped: bytes:%zu "
+                   "mapping failed", nbytes);
+    if (sub_mem != NULL) {
+      dart__base__mempages_unmap(sub_mem);
+    }
+    dart_segment_free(&team_data->segdata, segment->segid);
+    return DART_ERR_OTHER;
+  }
+
+#ifdef DART_MPI_ENABLE_DYNAMIC_WINDOWS
+  size_t   team_size;
+  MPI_Aint disp = 0;
+  dart_team_size(teamid, &team_size);
+  /* Calling MPI_Win_attach with nbytes == 0 leads to errors, see #239 */
+  if (nbytes > 0) {
+    MPI_Win_attach(team_data->window, sub_mem, nbytes);
+    MPI_Get_address(sub_mem, &disp);
+  }
+  if (segment->disp == NULL) {
+    segment->disp = malloc(team_size * sizeof(MPI_Aint));
+  }
+  MPI_Allgather(&disp, 1, MPI_AINT, segment->disp, 1, MPI_AINT,
+                team_data->comm);
+  segment->win        = team_data->window;
+  segment->is_dynamic = true;
+#else
+  MPI_Win win = MPI_WIN_NULL;
+  if (MPI_Win_create(sub_mem, nbytes, 1, MPI_INFO_NULL,
+                     team_data->comm, &win) != MPI_SUCCESS ||
+      MPI_Win_lock_all(0, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_team_memalloc_aligned_mapped: "
+                   "MPI_Win_create failed");
+    if (win != MPI_WIN_NULL) {
+      MPI_Win_free(&win);
+    }
+    if (sub_mem != NULL) {
+      dart__base__mempages_unmap(sub_mem);
+    }
+    dart_segment_free(&team_data->segdata, segment->segid);
+    return DART_ERR_OTHER;
+  }
+  if (segment->disp != NULL) {
+    free(segment->disp);
+    segment->disp = NULL;
+  }
+  segment->win        = win;
+  segment->is_dynamic = false;
+#endif
+
+  segment->size        = nbytes;
+  segment->flags       = 0;
+  segment->shmwin      = MPI_WIN_NULL;
+  segment->selfbaseptr = sub_mem;
+  segment->is_mapped   = true;
+
+  gptr->segid  = segment->segid;
+  gptr->unitid = gptr_unitid;
+  gptr->teamid = teamid;
+  gptr->flags  = 0;
+  gptr->addr_or_offs.offset = 0;
+
+  DART_LOG_DEBUG(
+    "dart_team_memalloc_aligned_mapped: bytes:%zu pages:%d "
+    "baseptr:%p segid:%i across team %d",
+    nbytes, pages, sub_mem, segment->segid, teamid);
+
+  return DART_OK;
+}
+
 dart_ret_t
 dart_team_memalloc_aligned(
   dart_team_t       teamid,
@@ -455,6 +623,45 @@ dart_team_memalloc_aligned(
 #endif
 }
 
+dart_ret_t
+dart_team_memalloc_aligned_pages(
+  dart_team_t       teamid,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_mempages_t   pages,
+  dart_gptr_t     * gptr)
+{
+  CHECK_IS_BASICTYPE(dtype);
+  if (pages == DART_MEMPAGES_DEFAULT) {
+    return dart_team_memalloc_aligned(teamid, nelem, dtype, gptr);
+  }
+  return dart_team_memalloc_aligned_mapped(teamid, nelem, dtype, pages, gptr);
+}
+
+dart_ret_t
+dart_memmap_pages(
+  size_t            nbytes,
+  dart_mempages_t   pages,
+  void           ** addr)
+{
+  *addr = NULL;
+  if (nbytes == 0) {
+    return DART_OK;
+  }
+  *addr = dart__base__mempages_map(nbytes, &pages);
+  return (*addr != NULL) ? DART_OK : DART_ERR_OTHER;
+}
+
+dart_ret_t
+dart_memunmap_pages(
+  void            * addr)
+{
+  if (addr == NULL) {
+    return DART_OK;
+  }
+  return dart__base__mempages_unmap(addr);
+}
+
 dart_ret_t dart_team_memfree(
   dart_gptr_t gptr)
 {
@@ -493,25 +700,27 @@ dart_ret_t dart_team_memfree(
     }
 
 	/* Free the window's associated sub-memory */
+    if (!seginfo->is_mapped) {
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-    MPI_Win sharedmem_win;
-    if (dart_segment_get_shmwin(
-          &team_data->segdata,
-          segid,
-          &sharedmem_win) != DART_OK) {
-      return DART_ERR_OTHER;
-    }
-    if (MPI_Win_free(&sharedmem_win) != MPI_SUCCESS) {
-      DART_LOG_ERROR("dart_team_memfree: MPI_Win_free failed");
-      return DART_ERR_OTHER;
-    }
+      MPI_Win sharedmem_win;
+      if (dart_segment_get_shmwin(
+            &team_data->segdata,
+            segid,
+            &sharedmem_win) != DART_OK) {
+        return DART_ERR_OTHER;
+      }
+      if (MPI_Win_free(&sharedmem_win) != MPI_SUCCESS) {
+        DART_LOG_ERROR("dart_team_memfree: MPI_Win_free failed");
+        return DART_ERR_OTHER;
+      }
 
 #else
-    if (MPI_Free_mem(sub_mem) != MPI_SUCCESS) {
-      DART_LOG_ERROR("dart_team_memfree: MPI_Free_mem failed");
-      return DART_ERR_OTHER;
-    }
+      if (MPI_Free_mem(sub_mem) != MPI_SUCCESS) {
+        DART_LOG_ERROR("dart_team_memfree: MPI_Free_mem failed");
+        return DART_ERR_OTHER;
+      }
 #endif
+    }
   } else {
     // full allocation
     if (MPI_Win_unlock_all(seginfo->win) != MPI_SUCCESS) {
@@ -524,6 +733,15 @@ dart_ret_t dart_team_memfree(
     }
   }
 
+  /* Release local memory mapped with huge pages after it has been detached
+   * or its window has been freed */
+  if (seginfo->is_mapped && seginfo->selfbaseptr != NULL) {
+    if (dart__base__mempages_unmap(seginfo->selfbaseptr) != DART_OK) {
+      DART_LOG_ERROR("dart_team_memfree: unmapping local memory failed");
+      return DART_ERR_OTHER;
+    }
+    seginfo->selfbaseptr = NULL;
+  }
 
 #if defined(DART_ENABLE_LOGGING)
   dart_team_unit_t unitid;
@@ -618,7 +836,6 @@ dart_team_memregister(
    dart_gptr_t     * gptr)
 {
   CHECK_IS_BASICTYPE(dtype);
-  int    nil;
   size_t size;
   int    dtype_size = dart__mpi__datatype_sizeof(dtype);
   size_t nbytes     = nelem * dtype_size;
@@ -627,11 +844,6 @@ dart_team_memregister(
 
   *gptr = DART_GPTR_NULL;
 
-  if (nbytes == 0) {
-    // Attaching empty memory region, set sendbuf to valid dummy pointer:
-    addr = (void*)(&nil);
-  }
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
     DART_LOG_ERROR("dart_team_memregister ! failed: Unknown team %i!", teamid);
@@ -654,8 +866,15 @@ dart_team_memregister(
   MPI_Aint * disp_set = segment->disp;
   MPI_Comm   comm     = team_data->comm;
   MPI_Win    win      = team_data->window;
-  MPI_Win_attach(win, addr, nbytes);
-  MPI_Get_address(addr, &disp);
+  if (nbytes > 0) {
+    MPI_Win_attach(win, addr, nbytes);
+    MPI_Get_address(addr, &disp);
+  } else {
+    // Empty memory regions are not attached, there is nothing to access
+    // and distinct empty regions might share the same base address:
+    addr = NULL;
+    disp = 0;
+  }
   MPI_Allgather(&disp, 1, MPI_AINT, disp_set, 1, MPI_AINT, comm);
 
   segment->size   = nbytes;
@@ -710,7 +929,9 @@ dart_team_memderegister(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win_detach(win, sub_mem);
+  if (sub_mem != NULL) {
+    MPI_Win_detach(win, sub_mem);
+  }
   if (dart_segment_free(&team_data->segdata, segid) != DART_OK) {
     return DART_ERR_INVAL;
   }
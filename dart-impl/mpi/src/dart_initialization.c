@@ -19,6 +19,7 @@
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_profile_priv.h>
 
 #define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
 
@@ -169,6 +170,8 @@ dart_ret_t do_init()
   MPI_Comm_rank(team_data->comm, &team_data->unitid);
   MPI_Comm_size(team_data->comm, &team_data->size);
 
+  DART_PROFILE_TEAM_INIT(team_data);
+
   ret = create_local_alloc(team_data);
   if (ret != DART_OK) {
     return ret;
@@ -317,12 +320,14 @@ dart_ret_t dart_exit()
 
   dart_segment_fini(&team_data->segdata);
   dart_buddy_delete(dart_localpool);
+  DART_PROFILE_TEAM_FINI(team_data);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 //  free(team_data->sharedmem_tab);
 //  free(dart_sharedmem_local_baseptr_set);
 #endif
 
   dart_adapt_teamlist_destroy();
+  dart_adapt_teamcache_destroy();
 
   MPI_Comm_free(&dart_comm_world);
 
@@ -10,6 +10,8 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
+#include <stdio.h>
+
 
 dart_ret_t dart__io__hdf5__prep_mpio(
     hid_t plist_id,
@@ -33,6 +35,47 @@ dart_ret_t dart__io__hdf5__prep_mpio(
   return DART_OK;
 }
 
+dart_ret_t dart__io__hdf5__prep_mpio_aggregated(
+    hid_t       plist_id,
+    dart_team_t teamid,
+    int         aggregators_per_node)
+{
+  MPI_Comm comm;
+  MPI_Info info;
+  char     cb_config_list[32];
+  DART_LOG_TRACE("dart__io__hdf5__prep_mpio_aggregated() team:%d "
+                 "aggregators_per_node:%d", teamid, aggregators_per_node);
+
+  if (aggregators_per_node <= 0) {
+    return dart__io__hdf5__prep_mpio(plist_id, teamid);
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart__io__hdf5__prep_mpio_aggregated ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  comm = team_data->comm;
+  // Collective buffering restricted to the given number of aggregator
+  // processes per node, all other units ship their data to the node's
+  // aggregators instead of accessing the file system directly.
+  // Hints unknown to the MPI-IO implementation are silently ignored.
+  snprintf(cb_config_list, sizeof(cb_config_list), "*:%d",
+           aggregators_per_node);
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "romio_cb_write",  "enable");
+  MPI_Info_set(info, "romio_cb_read",   "enable");
+  MPI_Info_set(info, "cb_config_list",  cb_config_list);
+  herr_t status = H5Pset_fapl_mpio(plist_id, comm, info);
+  MPI_Info_free(&info);
+  if(status < 0){
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
 #else // DART_ENABLE_HDF5
 
 const int dart__io__hdf5__disabled = 1;
@@ -8,6 +8,7 @@
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_initialization.h>
+#include <dash/dart/if/dart_config.h>
 #include <dash/dart/base/logging.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 
@@ -103,6 +104,15 @@ dart__mpi__datatype_init()
   init_basic_datatype(DART_TYPE_DOUBLE,       MPI_DOUBLE);
   init_basic_datatype(DART_TYPE_LONG_DOUBLE,  MPI_LONG_DOUBLE);
 
+  // strided and indexed types are copied directly between units sharing
+  // memory unless disabled in the environment
+  const char * shmem_dtype_copy = getenv("DART_SHMEM_DTYPE_COPY");
+  if (shmem_dtype_copy != NULL && strcmp(shmem_dtype_copy, "0") == 0) {
+    dart_config_t * config;
+    dart_config(&config);
+    config->shmem_dtype_copy = 0;
+  }
+
   return DART_OK;
 }
 
@@ -260,6 +270,8 @@ dart_type_create_indexed(
   }
 
   MPI_Type_commit(&new_mpi_dtype);
+  MPI_Aint mpi_lb, mpi_extent;
+  MPI_Type_get_extent(new_mpi_dtype, &mpi_lb, &mpi_extent);
   dart_datatype_struct_t *new_struct;
   new_struct = malloc(sizeof(struct dart_datatype_struct));
   new_struct->base_type = basetype;
@@ -269,6 +281,7 @@ dart_type_create_indexed(
   new_struct->indexed.blocklens  = mpi_blocklen;
   new_struct->indexed.offsets    = mpi_disps;
   new_struct->indexed.num_blocks = count;
+  new_struct->indexed.extent     = mpi_extent / basetype_struct->basic.size;
 
   *newtype = (dart_datatype_t)new_struct;
 
@@ -0,0 +1,581 @@
+/**
+ * \file dart_profile.c
+ *
+ * Implementation of the DART communication profiler.
+ *
+ * Every thread records operations in its own table that is linked into
+ * a global list on the thread's first operation. Counters are only
+ * modified by the owning thread using atomic loads and stores without
+ * read-modify-write operations, readers in other threads may observe
+ * counters that are updated concurrently.
+ * Tables of exited threads are kept so their operations are still
+ * reported.
+ */
+#if defined(DART_ENABLE_PROFILING)
+/* _POSIX_C_SOURCE required for clock_gettime() */
+#  define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#include <mpi.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_team_group.h>
+#include <dash/dart/if/dart_profile.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_profile_priv.h>
+
+/**
+ * Number of segments accounted separately per thread, operations on
+ * further segments are accounted to the last slot.
+ */
+#define DART_PROFILE_SEGMENT_SLOTS (256)
+
+/**
+ * Interval in nanoseconds over which the rate of the timestamp counter
+ * is measured in \c dart_init.
+ */
+#define DART_PROFILE_CALIBRATION_NS (1000000)
+
+static const char * const dart_profile_op_names[DART_PROFILE_NUM_OPS] = {
+  "get",
+  "put",
+  "accumulate",
+  "fetch_and_op",
+  "compare_and_swap",
+  "flush",
+  "barrier",
+  "bcast",
+  "scatter",
+  "gather",
+  "allgather",
+  "allgatherv",
+  "alltoallv",
+  "allreduce",
+  "reduce",
+  "send",
+  "recv",
+  "sendrecv"
+};
+
+const char * dart_profile_op_name(dart_profile_op_t op)
+{
+  if (op < 0 || op >= DART_PROFILE_NUM_OPS) {
+    return "unknown";
+  }
+  return dart_profile_op_names[op];
+}
+
+#if defined(DART_ENABLE_PROFILING)
+
+typedef struct {
+  /* set once the entry's key is valid */
+  int                          used;
+  dart_profile_segment_stats_t stats;
+} dart_profile_segment_entry_t;
+
+typedef struct dart_profile_thread_data {
+  struct dart_profile_thread_data * next;
+  dart_profile_op_stats_t           ops[DART_PROFILE_NUM_OPS];
+  /* one-sided operations per global unit */
+  dart_profile_counts_t           * targets;
+  int                               ntargets;
+  /* open addressing hash table, the last slot is the overflow slot */
+  dart_profile_segment_entry_t      segments[DART_PROFILE_SEGMENT_SLOTS];
+} dart_profile_thread_data_t;
+
+static dart_profile_thread_data_t * _profile_threads = NULL;
+
+static __thread dart_profile_thread_data_t * _profile_tdata = NULL;
+
+/* set in dart_init before operations are recorded */
+static double _profile_ns_per_tick = 1.0;
+
+__thread uint32_t dart__profile__nstarted = 0;
+
+static inline void profile_add(uint64_t * counter, uint64_t value)
+{
+  __atomic_store_n(counter,
+                   __atomic_load_n(counter, __ATOMIC_RELAXED) + value,
+                   __ATOMIC_RELAXED);
+}
+
+static inline uint64_t profile_load(const uint64_t * counter)
+{
+  return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+static inline void profile_clear(uint64_t * counter)
+{
+  __atomic_store_n(counter, 0, __ATOMIC_RELAXED);
+}
+
+static inline int profile_hist_bin(uint64_t ns)
+{
+  int bin = 63 - __builtin_clzll(ns | 1);
+  return (bin < DART_PROFILE_HIST_BINS) ? bin : DART_PROFILE_HIST_BINS - 1;
+}
+
+static dart_profile_thread_data_t * profile_thread_register()
+{
+  dart_profile_thread_data_t * tdata = calloc(
+                                         1, sizeof(dart_profile_thread_data_t));
+  int size = 0;
+  MPI_Comm_size(DART_COMM_WORLD, &size);
+  tdata->targets  = calloc(size, sizeof(dart_profile_counts_t));
+  tdata->ntargets = size;
+  tdata->next     = __atomic_load_n(&_profile_threads, __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n(&_profile_threads, &tdata->next, tdata,
+                                      false, __ATOMIC_RELEASE,
+                                      __ATOMIC_RELAXED)) { }
+  _profile_tdata = tdata;
+  return tdata;
+}
+
+static inline dart_profile_thread_data_t * profile_thread_data()
+{
+  if (dart__likely(_profile_tdata != NULL)) {
+    return _profile_tdata;
+  }
+  return profile_thread_register();
+}
+
+static inline dart_profile_thread_data_t * profile_thread_list()
+{
+  return __atomic_load_n(&_profile_threads, __ATOMIC_ACQUIRE);
+}
+
+uint64_t dart__profile__clock_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Measure the rate of the timestamp counter against the monotonic
+ * clock.
+ */
+static void profile_calibrate()
+{
+#if defined(DART_PROFILE_HAS_TSC)
+  uint64_t ns_start    = dart__profile__clock_ns();
+  uint64_t ticks_start = dart__profile__now();
+  uint64_t ns_end;
+  do {
+    ns_end = dart__profile__clock_ns();
+  } while (ns_end - ns_start < DART_PROFILE_CALIBRATION_NS);
+  uint64_t ticks_end   = dart__profile__now();
+  if (ticks_end > ticks_start) {
+    _profile_ns_per_tick = (double)(ns_end - ns_start) /
+                           (double)(ticks_end - ticks_start);
+  }
+  DART_LOG_DEBUG("dart__profile: %.4f ns per timestamp counter tick",
+                 _profile_ns_per_tick);
+#endif
+}
+
+static inline uint64_t profile_elapsed_ns(uint64_t ts_start)
+{
+  return (uint64_t)((double)(dart__profile__now() - ts_start) *
+                    _profile_ns_per_tick);
+}
+
+static inline void profile_record(
+  dart_profile_op_stats_t * stats,
+  uint64_t                  ts_start,
+  uint64_t                  bytes)
+{
+  profile_add(&stats->count, 1);
+  profile_add(&stats->bytes, bytes);
+  if (ts_start != 0) {
+    uint64_t ns = profile_elapsed_ns(ts_start);
+    profile_add(&stats->timed, 1);
+    profile_add(&stats->time_ns, ns);
+    profile_add(&stats->hist[profile_hist_bin(ns)], 1);
+  }
+}
+
+static dart_profile_segment_stats_t * profile_segment(
+  dart_profile_thread_data_t * tdata,
+  dart_team_t                  teamid,
+  int16_t                      segid)
+{
+  const int nslots = DART_PROFILE_SEGMENT_SLOTS - 1;
+  int slot = (int)(((uint32_t)teamid * 31u + (uint16_t)segid) % nslots);
+  for (int probe = 0; probe < nslots; ++probe) {
+    dart_profile_segment_entry_t * entry = &tdata->segments[slot];
+    if (!entry->used) {
+      entry->stats.teamid = teamid;
+      entry->stats.segid  = segid;
+      __atomic_store_n(&entry->used, 1, __ATOMIC_RELEASE);
+      return &entry->stats;
+    }
+    if (entry->stats.teamid == teamid && entry->stats.segid == segid) {
+      return &entry->stats;
+    }
+    slot = (slot + 1) % nslots;
+  }
+  dart_profile_segment_entry_t * overflow = &tdata->segments[nslots];
+  if (!overflow->used) {
+    overflow->stats.teamid = DART_TEAM_NULL;
+    overflow->stats.segid  = 0;
+    __atomic_store_n(&overflow->used, 1, __ATOMIC_RELEASE);
+  }
+  return &overflow->stats;
+}
+
+/**
+ * Whether the segment \c segid of team \c teamid has been accessed by
+ * the thread owning \c tdata.
+ */
+static int profile_segment_find(
+  const dart_profile_thread_data_t * tdata,
+  dart_team_t                        teamid,
+  int16_t                            segid)
+{
+  for (int s = 0; s < DART_PROFILE_SEGMENT_SLOTS; ++s) {
+    const dart_profile_segment_entry_t * entry = &tdata->segments[s];
+    if (__atomic_load_n(&entry->used, __ATOMIC_ACQUIRE) &&
+        entry->stats.teamid == teamid && entry->stats.segid == segid) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void dart__profile__rma(
+  dart_profile_op_t        op,
+  uint64_t                 ts_start,
+  const dart_team_data_t * team_data,
+  dart_team_unit_t         unitid,
+  int16_t                  segid,
+  uint64_t                 bytes)
+{
+  dart_profile_thread_data_t * tdata = profile_thread_data();
+
+  profile_record(&tdata->ops[op], ts_start, bytes);
+
+  if (team_data->global_units != NULL) {
+    int target = team_data->global_units[unitid.id].id;
+    if (target >= 0 && target < tdata->ntargets) {
+      profile_add(&tdata->targets[target].count, 1);
+      profile_add(&tdata->targets[target].bytes, bytes);
+    }
+  }
+
+  dart_profile_segment_stats_t * seg = profile_segment(
+                                         tdata, team_data->teamid, segid);
+  profile_add(&seg->ops[op].count, 1);
+  profile_add(&seg->ops[op].bytes, bytes);
+}
+
+void dart__profile__op(
+  dart_profile_op_t        op,
+  uint64_t                 ts_start,
+  uint64_t                 bytes)
+{
+  profile_record(&profile_thread_data()->ops[op], ts_start, bytes);
+}
+
+dart_ret_t dart__profile__team_init(
+  dart_team_data_t       * team_data)
+{
+  MPI_Group group;
+  MPI_Group world_group;
+  int       size = team_data->size;
+  int     * ranks;
+  int     * world_ranks;
+
+  if (team_data->teamid == DART_TEAM_ALL) {
+    profile_calibrate();
+  }
+
+  team_data->global_units = malloc(size * sizeof(dart_global_unit_t));
+  ranks                   = malloc(size * sizeof(int));
+  world_ranks             = malloc(size * sizeof(int));
+  for (int i = 0; i < size; ++i) {
+    ranks[i] = i;
+  }
+  MPI_Comm_group(team_data->comm, &group);
+  MPI_Comm_group(DART_COMM_WORLD, &world_group);
+  MPI_Group_translate_ranks(group, size, ranks, world_group, world_ranks);
+  for (int i = 0; i < size; ++i) {
+    team_data->global_units[i].id = (world_ranks[i] == MPI_UNDEFINED)
+                                    ? DART_UNDEFINED_UNIT_ID
+                                    : world_ranks[i];
+  }
+  MPI_Group_free(&group);
+  MPI_Group_free(&world_group);
+  free(ranks);
+  free(world_ranks);
+  return DART_OK;
+}
+
+void dart__profile__team_fini(
+  dart_team_data_t       * team_data)
+{
+  free(team_data->global_units);
+  team_data->global_units = NULL;
+}
+
+bool dart_profile_enabled()
+{
+  return true;
+}
+
+dart_ret_t dart_profile_reset()
+{
+  for (dart_profile_thread_data_t * tdata = profile_thread_list();
+       tdata != NULL; tdata = tdata->next) {
+    for (int op = 0; op < DART_PROFILE_NUM_OPS; ++op) {
+      dart_profile_op_stats_t * stats = &tdata->ops[op];
+      profile_clear(&stats->count);
+      profile_clear(&stats->bytes);
+      profile_clear(&stats->timed);
+      profile_clear(&stats->time_ns);
+      for (int bin = 0; bin < DART_PROFILE_HIST_BINS; ++bin) {
+        profile_clear(&stats->hist[bin]);
+      }
+    }
+    for (int t = 0; t < tdata->ntargets; ++t) {
+      profile_clear(&tdata->targets[t].count);
+      profile_clear(&tdata->targets[t].bytes);
+    }
+    for (int s = 0; s < DART_PROFILE_SEGMENT_SLOTS; ++s) {
+      __atomic_store_n(&tdata->segments[s].used, 0, __ATOMIC_RELAXED);
+      memset(&tdata->segments[s].stats, 0,
+             sizeof(dart_profile_segment_stats_t));
+    }
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_op_stats(
+  dart_profile_op_t         op,
+  dart_profile_op_stats_t * stats)
+{
+  if (stats == NULL || op < 0 || op >= DART_PROFILE_NUM_OPS) {
+    return DART_ERR_INVAL;
+  }
+  memset(stats, 0, sizeof(dart_profile_op_stats_t));
+  for (dart_profile_thread_data_t * tdata = profile_thread_list();
+       tdata != NULL; tdata = tdata->next) {
+    const dart_profile_op_stats_t * tstats = &tdata->ops[op];
+    stats->count   += profile_load(&tstats->count);
+    stats->bytes   += profile_load(&tstats->bytes);
+    stats->timed   += profile_load(&tstats->timed);
+    stats->time_ns += profile_load(&tstats->time_ns);
+    for (int bin = 0; bin < DART_PROFILE_HIST_BINS; ++bin) {
+      stats->hist[bin] += profile_load(&tstats->hist[bin]);
+    }
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_targets(
+  dart_profile_counts_t * targets)
+{
+  if (targets == NULL) {
+    return DART_ERR_INVAL;
+  }
+  int size = 0;
+  MPI_Comm_size(DART_COMM_WORLD, &size);
+  memset(targets, 0, size * sizeof(dart_profile_counts_t));
+  for (dart_profile_thread_data_t * tdata = profile_thread_list();
+       tdata != NULL; tdata = tdata->next) {
+    for (int t = 0; t < tdata->ntargets && t < size; ++t) {
+      targets[t].count += profile_load(&tdata->targets[t].count);
+      targets[t].bytes += profile_load(&tdata->targets[t].bytes);
+    }
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_segments(
+  dart_profile_segment_stats_t * segments,
+  size_t                         max_segments,
+  size_t                       * num_segments)
+{
+  if (num_segments == NULL || (segments == NULL && max_segments > 0)) {
+    return DART_ERR_INVAL;
+  }
+  dart_profile_thread_data_t * threads = profile_thread_list();
+  size_t num = 0;
+  for (dart_profile_thread_data_t * tdata = threads;
+       tdata != NULL; tdata = tdata->next) {
+    for (int s = 0; s < DART_PROFILE_SEGMENT_SLOTS; ++s) {
+      const dart_profile_segment_entry_t * entry = &tdata->segments[s];
+      if (!__atomic_load_n(&entry->used, __ATOMIC_ACQUIRE)) {
+        continue;
+      }
+      dart_team_t teamid = entry->stats.teamid;
+      int16_t     segid  = entry->stats.segid;
+      // segments accessed by threads listed before are merged:
+      int merged = 0;
+      for (dart_profile_thread_data_t * prev = threads;
+           prev != tdata && !merged; prev = prev->next) {
+        merged = profile_segment_find(prev, teamid, segid);
+      }
+      size_t idx = 0;
+      if (merged) {
+        size_t nstored = (num < max_segments) ? num : max_segments;
+        while (idx < nstored && (segments[idx].teamid != teamid ||
+                                 segments[idx].segid  != segid)) {
+          ++idx;
+        }
+        if (idx == nstored) {
+          continue;
+        }
+      } else {
+        idx = num++;
+        if (idx >= max_segments) {
+          continue;
+        }
+        memset(&segments[idx], 0, sizeof(dart_profile_segment_stats_t));
+        segments[idx].teamid = teamid;
+        segments[idx].segid  = segid;
+      }
+      for (int op = 0; op < DART_PROFILE_NUM_RMA_OPS; ++op) {
+        segments[idx].ops[op].count +=
+          profile_load(&entry->stats.ops[op].count);
+        segments[idx].ops[op].bytes +=
+          profile_load(&entry->stats.ops[op].bytes);
+      }
+    }
+  }
+  *num_segments = num;
+  return DART_OK;
+}
+
+#else /* !DART_ENABLE_PROFILING */
+
+bool dart_profile_enabled()
+{
+  return false;
+}
+
+dart_ret_t dart_profile_reset()
+{
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_op_stats(
+  dart_profile_op_t         op,
+  dart_profile_op_stats_t * stats)
+{
+  if (stats == NULL || op < 0 || op >= DART_PROFILE_NUM_OPS) {
+    return DART_ERR_INVAL;
+  }
+  memset(stats, 0, sizeof(dart_profile_op_stats_t));
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_targets(
+  dart_profile_counts_t * targets)
+{
+  if (targets == NULL) {
+    return DART_ERR_INVAL;
+  }
+  size_t size = 0;
+  dart_size(&size);
+  memset(targets, 0, size * sizeof(dart_profile_counts_t));
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_segments(
+  dart_profile_segment_stats_t * segments,
+  size_t                         max_segments,
+  size_t                       * num_segments)
+{
+  (void)segments;
+  (void)max_segments;
+  if (num_segments == NULL) {
+    return DART_ERR_INVAL;
+  }
+  *num_segments = 0;
+  return DART_OK;
+}
+
+#endif /* DART_ENABLE_PROFILING */
+
+static void profile_dump_counts(
+  FILE                        * file,
+  const dart_profile_counts_t * counts)
+{
+  fprintf(file, "{\"count\":%" PRIu64 ",\"bytes\":%" PRIu64 "}",
+          counts->count, counts->bytes);
+}
+
+dart_ret_t dart_profile_dump(FILE * file)
+{
+  if (file == NULL) {
+    return DART_ERR_INVAL;
+  }
+  dart_global_unit_t myid;
+  size_t             size = 0;
+  dart_myid(&myid);
+  dart_size(&size);
+
+  fprintf(file, "{\"unit\":%d,\"enabled\":%s,\"ops\":{",
+          myid.id, dart_profile_enabled() ? "true" : "false");
+  for (int op = 0; op < DART_PROFILE_NUM_OPS; ++op) {
+    dart_profile_op_stats_t stats;
+    dart_profile_op_stats(op, &stats);
+    fprintf(file, "%s\"%s\":{\"count\":%" PRIu64 ",\"bytes\":%" PRIu64
+                  ",\"timed\":%" PRIu64 ",\"time_ns\":%" PRIu64
+                  ",\"hist\":[",
+            (op > 0) ? "," : "", dart_profile_op_name(op),
+            stats.count, stats.bytes, stats.timed, stats.time_ns);
+    for (int bin = 0; bin < DART_PROFILE_HIST_BINS; ++bin) {
+      fprintf(file, "%s%" PRIu64, (bin > 0) ? "," : "", stats.hist[bin]);
+    }
+    fprintf(file, "]}");
+  }
+  fprintf(file, "},\"targets\":[");
+
+  dart_profile_counts_t * targets = calloc(size, sizeof(dart_profile_counts_t));
+  dart_profile_targets(targets);
+  int first = 1;
+  for (size_t t = 0; t < size; ++t) {
+    if (targets[t].count == 0) {
+      continue;
+    }
+    fprintf(file, "%s{\"unit\":%zu,\"ops\":", first ? "" : ",", t);
+    profile_dump_counts(file, &targets[t]);
+    fprintf(file, "}");
+    first = 0;
+  }
+  free(targets);
+  fprintf(file, "],\"segments\":[");
+
+  size_t num_segments = 0;
+  dart_profile_segments(NULL, 0, &num_segments);
+  size_t max_segments  = num_segments;
+  dart_profile_segment_stats_t * segments =
+    calloc(max_segments + 1, sizeof(dart_profile_segment_stats_t));
+  dart_profile_segments(segments, max_segments, &num_segments);
+  if (num_segments > max_segments) {
+    num_segments = max_segments;
+  }
+  for (size_t s = 0; s < num_segments; ++s) {
+    fprintf(file, "%s{\"team\":%d,\"segid\":%d",
+            (s > 0) ? "," : "", segments[s].teamid, segments[s].segid);
+    for (int op = 0; op < DART_PROFILE_NUM_RMA_OPS; ++op) {
+      fprintf(file, ",\"%s\":", dart_profile_op_name(op));
+      profile_dump_counts(file, &segments[s].ops[op]);
+    }
+    fprintf(file, "}");
+  }
+  free(segments);
+  fprintf(file, "]}\n");
+  return DART_OK;
+}
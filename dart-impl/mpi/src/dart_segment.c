@@ -324,7 +324,8 @@ dart_ret_t dart_segment_free(
         DART_ASSERT(segid != 0);
       }
       // set the segment ID again
-      elem->data.segid = segid;
+      elem->data.segid     = segid;
+      elem->data.is_mapped = false;
       return DART_OK;
     }
 
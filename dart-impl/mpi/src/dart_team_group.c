@@ -18,6 +18,7 @@
 
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_group_priv.h>
+#include <dash/dart/mpi/dart_profile_priv.h>
 
 #include <limits.h>
 
@@ -572,6 +573,10 @@ dart_ret_t dart_team_get_group(
  * Create a team as child of the specified team with units in
  * given group.
  *
+ * The communicator and window of a previously destroyed team of the same
+ * group are reused if all units in the group have cached them. The shared
+ * memory communicator of the team is created in its first collective
+ * allocation.
  */
 dart_ret_t dart_team_create(
   dart_team_t          teamid,
@@ -580,7 +585,6 @@ dart_ret_t dart_team_create(
 {
   MPI_Comm    comm;
   MPI_Comm    subcomm;
-  MPI_Win     win;
   dart_team_t max_teamid = -1;
 
   *newteam = DART_TEAM_NULL;
@@ -604,20 +608,41 @@ dart_ret_t dart_team_create(
   comm = parent_team_data->comm;
   subcomm = MPI_COMM_NULL;
 
-  MPI_Comm_create(comm, group->mpi_group, &subcomm);
+  int group_rank;
+  MPI_Group_rank(group->mpi_group, &group_rank);
+  dart_team_t cached_teamid = DART_TEAM_NULL;
+  /* Units in the group contribute the id of the team whose communicator
+   * they have cached for the group (and its negation), INT_MAX if they
+   * have not cached a communicator. Units not in the group do not
+   * contribute. */
+  int cache_ids[3] = { dart_next_availteamid, INT_MIN, INT_MIN };
+  if (group_rank != MPI_UNDEFINED) {
+    int   size;
+    int * global_ids = dart_adapt_group_global_ids(group->mpi_group, &size);
+    cached_teamid    = dart_adapt_teamcache_find(global_ids, size);
+    free(global_ids);
+    cache_ids[1] = (cached_teamid == DART_TEAM_NULL)
+                   ? INT_MAX :  cached_teamid;
+    cache_ids[2] = (cached_teamid == DART_TEAM_NULL)
+                   ? INT_MAX : -cached_teamid;
+  }
 
   /* Get the maximum next_availteamid among all the units belonging to
-   * the parent team specified by 'teamid'. */
-  MPI_Allreduce(
-    &dart_next_availteamid,
-    &max_teamid,
-    1,
-    MPI_INT16_T,
-    MPI_MAX,
-    comm);
+   * the parent team specified by 'teamid' and whether all units in the
+   * group have cached the same communicator. */
+  int max_ids[3];
+  MPI_Allreduce(cache_ids, max_ids, 3, MPI_INT, MPI_MAX, comm);
+  max_teamid = max_ids[0];
   dart_next_availteamid = max_teamid + 1;
 
-  if (subcomm != MPI_COMM_NULL) {
+  int cache_hit = max_ids[1] != INT_MIN && max_ids[1] != INT_MAX &&
+                  max_ids[1] == -max_ids[2];
+  if (!cache_hit) {
+    MPI_Comm_create(comm, group->mpi_group, &subcomm);
+  }
+
+  if (subcomm != MPI_COMM_NULL ||
+      (cache_hit && group_rank != MPI_UNDEFINED)) {
     dart_ret_t result = dart_adapt_teamlist_alloc(max_teamid);
     if (result != DART_OK) {
       return DART_ERR_OTHER;
@@ -625,23 +650,29 @@ dart_ret_t dart_team_create(
     /* max_teamid is thought to be the new created team ID. */
     *newteam = max_teamid;
     dart_team_data_t *team_data = dart_adapt_teamlist_get(max_teamid);
-    team_data->comm = subcomm;
-    MPI_Win_create_dynamic(MPI_INFO_NULL, subcomm, &win);
-    team_data->window = win;
+    if (cache_hit) {
+      dart_adapt_teamcache_take(cached_teamid, team_data);
+    } else {
+      team_data->comm = subcomm;
+      /* The window is not created on first use as windows of disjoint
+       * teams would then be created concurrently, which is not supported
+       * by all MPI implementations (Open MPI's osc/rdma names shared
+       * segments by communicator id). */
+      MPI_Win_create_dynamic(MPI_INFO_NULL, subcomm, &team_data->window);
+      MPI_Win_lock_all(0, team_data->window);
+    }
 
     int rank;
     MPI_Comm_rank(team_data->comm, &rank);
     team_data->unitid = rank;
     MPI_Comm_size(team_data->comm, &team_data->size);
 
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-    dart_allocate_shared_comm(team_data);
-#endif
-    MPI_Win_lock_all(0, win);
-    DART_LOG_DEBUG("TEAMCREATE - create team %d from parent team %d",
-                   *newteam, teamid);
-    DART_LOG_TRACE("TEAMCREATE - team:%d comm:%p win:%p subcomm:%p",
-                   *newteam, team_data->comm, team_data->window, subcomm);
+    DART_PROFILE_TEAM_INIT(team_data);
+
+    DART_LOG_DEBUG("TEAMCREATE - create team %d from parent team %d%s",
+                   *newteam, teamid, cache_hit ? " (cached comm)" : "");
+    DART_LOG_TRACE("TEAMCREATE - team:%d comm:%p win:%p",
+                   *newteam, team_data->comm, team_data->window);
   }
 
   return DART_OK;
@@ -650,9 +681,6 @@ dart_ret_t dart_team_create(
 dart_ret_t dart_team_destroy(
   dart_team_t * teamid)
 {
-  MPI_Comm    comm;
-  MPI_Win     win;
-
   DART_LOG_DEBUG("dart_team_destroy() teamid:%d", *teamid);
 
   if (*teamid == DART_TEAM_NULL) {
@@ -664,20 +692,11 @@ dart_ret_t dart_team_destroy(
     return DART_ERR_INVAL;
   }
 
-  comm = team_data->comm;
-
-  // free(dart_unit_mapping[index]);
-
-  // MPI_Win_free (&(sharedmem_win_list[index]));
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-  free(team_data->sharedmem_tab);
-#endif
-  win = team_data->window;
-  MPI_Win_unlock_all(win);
-  MPI_Win_free(&win);
+  DART_PROFILE_TEAM_FINI(team_data);
+  dart_segment_fini(&team_data->segdata);
 
-  /* -- Release the communicator associated with teamid -- */
-  MPI_Comm_free(&comm);
+  /* -- Release the communicator and window associated with teamid -- */
+  dart_adapt_teamcache_release(team_data);
 
   dart_adapt_teamlist_dealloc(*teamid);
 
@@ -762,6 +781,73 @@ dart_ret_t dart_team_size(
   return ret;
 }
 
+dart_ret_t dart_team_node_units(
+  dart_team_t         teamid,
+  int               * num_units,
+  dart_team_unit_t ** units)
+{
+  *num_units = 0;
+  *units     = NULL;
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_node_units ! unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  /* Units at the node are selected using the shared memory communicator
+   * of DART_TEAM_ALL so no communicator is split for the team: */
+  dart_team_data_t *all_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  MPI_Group team_group;
+  int       team_size;
+  MPI_Comm_group(team_data->comm, &team_group);
+  int * global_ids = dart_adapt_group_global_ids(team_group, &team_size);
+  MPI_Group_free(&team_group);
+
+  int node_size = 0;
+  *units = malloc(all_data->sharedmem_nodesize * sizeof(dart_team_unit_t));
+  for (int r = 0; r < team_size; r++) {
+    if (all_data->sharedmem_tab[global_ids[r]].id >= 0) {
+      (*units)[node_size++] = DART_TEAM_UNIT_ID(r);
+    }
+  }
+  *num_units = node_size;
+  free(global_ids);
+#else
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(
+    team_data->comm, MPI_COMM_TYPE_SHARED, 1, MPI_INFO_NULL, &node_comm);
+  int node_size;
+  MPI_Comm_size(node_comm, &node_size);
+
+  /* Units are ranked in the node communicator in the order of their
+   * rank in the team: */
+  MPI_Group node_group, team_group;
+  MPI_Comm_group(node_comm, &node_group);
+  MPI_Comm_group(team_data->comm, &team_group);
+  int * node_ranks = malloc(node_size * sizeof(int));
+  int * team_ranks = malloc(node_size * sizeof(int));
+  for (int r = 0; r < node_size; r++) {
+    node_ranks[r] = r;
+  }
+  MPI_Group_translate_ranks(
+    node_group, node_size, node_ranks, team_group, team_ranks);
+  MPI_Group_free(&node_group);
+  MPI_Group_free(&team_group);
+  MPI_Comm_free(&node_comm);
+
+  *units = malloc(node_size * sizeof(dart_team_unit_t));
+  for (int r = 0; r < node_size; r++) {
+    (*units)[r] = DART_TEAM_UNIT_ID(team_ranks[r]);
+  }
+  *num_units = node_size;
+  free(node_ranks);
+  free(team_ranks);
+#endif
+  DART_LOG_TRACE("dart_team_node_units > team:%d num_units:%d",
+                 teamid, node_size);
+  return DART_OK;
+}
+
 dart_ret_t dart_team_unit_l2g(
   dart_team_t          teamid,
   dart_team_unit_t     localid,
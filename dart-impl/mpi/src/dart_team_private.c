@@ -3,12 +3,35 @@
  *  @brief Implementations for the operations on teamlist.
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_config.h>
 #include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
 #define DART_TEAM_HASH_SIZE (256)
 
+/* Communicators and window of a destroyed team kept for reuse */
+typedef struct dart_team_cache_entry {
+  struct dart_team_cache_entry * next;
+  /* Global ids of the units in the order of their rank in comm */
+  int                          * global_ids;
+  int                            size;
+  /* Id of the team the communicators have been created for */
+  dart_team_t                    teamid;
+  MPI_Comm                       comm;
+  MPI_Win                        window;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  MPI_Comm                       sharedmem_comm;
+  dart_team_unit_t             * sharedmem_tab;
+  int                            sharedmem_nodesize;
+#endif
+} dart_team_cache_entry_t;
+
+static dart_team_cache_entry_t * dart_team_cache      = NULL;
+static int                       dart_team_cache_size = 0;
+
 dart_team_t dart_next_availteamid = (DART_TEAM_ALL + 1);
 
 MPI_Comm dart_comm_world;
@@ -183,6 +206,13 @@ dart_adapt_teamlist_init()
 {
   memset(dart_team_data, 0, sizeof(dart_team_data_t*) * DART_TEAM_HASH_SIZE);
 
+  const char * cache_size = getenv("DART_TEAM_CACHE_SIZE");
+  if (cache_size != NULL) {
+    dart_config_t * config;
+    dart_config(&config);
+    config->team_cache_size = atoi(cache_size);
+  }
+
   return DART_OK;
 }
 
@@ -202,24 +232,19 @@ dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid)
 {
   int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = dart_team_data[slot];
-  dart_team_data_t **prev = NULL;
+  dart_team_data_t **prev = &dart_team_data[slot];
 
-  while (res != NULL && res->teamid == teamid) {
-    prev = &res;
-    res = res->next;
+  while (*prev != NULL && (*prev)->teamid != teamid) {
+    prev = &(*prev)->next;
   }
 
   // not found!
-  if (res == NULL) {
+  if (*prev == NULL) {
     return DART_ERR_INVAL;
   }
 
-  if (prev == NULL) {
-    dart_team_data[slot] = res->next;
-  } else {
-    (*prev)->next = res->next;
-  }
+  dart_team_data_t *res = *prev;
+  *prev = res->next;
 
   res->next = NULL;
   free(res);
@@ -233,6 +258,10 @@ dart_adapt_teamlist_alloc(dart_team_t teamid)
   dart_team_data_t *res = calloc(1, sizeof(dart_team_data_t));
   res->teamid = teamid;
   res->unitid = DART_UNDEFINED_UNIT_ID;
+  res->window = MPI_WIN_NULL;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  res->sharedmem_comm = MPI_COMM_NULL;
+#endif
   res->next = dart_team_data[slot];
   dart_team_data[slot] = res;
   dart_segment_init(&(res->segdata), teamid);
@@ -260,6 +289,10 @@ dart_ret_t dart_allocate_shared_comm(dart_team_data_t *team_data)
 {
   int size;
 
+  if (team_data->sharedmem_comm != MPI_COMM_NULL) {
+    return DART_OK;
+  }
+
   MPI_Comm_size(team_data->comm, &size);
 
   MPI_Comm sharedmem_comm;
@@ -310,3 +343,158 @@ dart_ret_t dart_allocate_shared_comm(dart_team_data_t *team_data)
   return DART_OK;
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+int * dart_adapt_group_global_ids(
+  MPI_Group   group,
+  int       * size)
+{
+  MPI_Group group_all;
+  MPI_Group_size(group, size);
+  MPI_Comm_group(DART_COMM_WORLD, &group_all);
+  int * ranks      = malloc(*size * sizeof(int));
+  int * global_ids = malloc(*size * sizeof(int));
+  for (int r = 0; r < *size; r++) {
+    ranks[r] = r;
+  }
+  MPI_Group_translate_ranks(group, *size, ranks, group_all, global_ids);
+  MPI_Group_free(&group_all);
+  free(ranks);
+  return global_ids;
+}
+
+dart_team_t dart_adapt_teamcache_find(
+  const int * global_ids,
+  int         size)
+{
+  dart_config_t * config;
+  dart_config(&config);
+  if (config->team_cache_size <= 0) {
+    return DART_TEAM_NULL;
+  }
+  for (dart_team_cache_entry_t *entry = dart_team_cache;
+       entry != NULL; entry = entry->next) {
+    if (entry->size == size &&
+        memcmp(entry->global_ids, global_ids, size * sizeof(int)) == 0) {
+      return entry->teamid;
+    }
+  }
+  return DART_TEAM_NULL;
+}
+
+dart_ret_t dart_adapt_teamcache_take(
+  dart_team_t        cached_teamid,
+  dart_team_data_t * team_data)
+{
+  dart_team_cache_entry_t **prev = &dart_team_cache;
+  while (*prev != NULL && (*prev)->teamid != cached_teamid) {
+    prev = &(*prev)->next;
+  }
+  if (*prev == NULL) {
+    DART_LOG_ERROR("dart_adapt_teamcache_take ! team %d not cached",
+                   cached_teamid);
+    return DART_ERR_INVAL;
+  }
+  dart_team_cache_entry_t *entry = *prev;
+  *prev = entry->next;
+  dart_team_cache_size--;
+
+  team_data->comm               = entry->comm;
+  team_data->window             = entry->window;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  team_data->sharedmem_comm     = entry->sharedmem_comm;
+  team_data->sharedmem_tab      = entry->sharedmem_tab;
+  team_data->sharedmem_nodesize = entry->sharedmem_nodesize;
+#endif
+  free(entry->global_ids);
+  free(entry);
+  return DART_OK;
+}
+
+static void free_team_resources(
+  MPI_Comm         * comm,
+  MPI_Win          * window,
+  MPI_Comm         * sharedmem_comm,
+  dart_team_unit_t * sharedmem_tab)
+{
+  MPI_Win_unlock_all(*window);
+  MPI_Win_free(window);
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (*sharedmem_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(sharedmem_comm);
+  }
+  free(sharedmem_tab);
+#else
+  (void)sharedmem_comm;
+  (void)sharedmem_tab;
+#endif
+  MPI_Comm_free(comm);
+}
+
+dart_ret_t dart_adapt_teamcache_release(
+  dart_team_data_t * team_data)
+{
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  MPI_Comm         * sharedmem_comm = &team_data->sharedmem_comm;
+  dart_team_unit_t * sharedmem_tab  = team_data->sharedmem_tab;
+#else
+  MPI_Comm         * sharedmem_comm = NULL;
+  dart_team_unit_t * sharedmem_tab  = NULL;
+#endif
+  dart_config_t * config;
+  dart_config(&config);
+  MPI_Group group;
+  int       size;
+  MPI_Comm_group(team_data->comm, &group);
+  int * global_ids = dart_adapt_group_global_ids(group, &size);
+  MPI_Group_free(&group);
+  /* The window is freed collectively, all units in the team must agree
+   * to cache it. Only a single entry is cached per group so units agree
+   * on the cached communicator to reuse. */
+  int cacheable = dart_team_cache_size < config->team_cache_size &&
+                  dart_adapt_teamcache_find(global_ids, size)
+                    == DART_TEAM_NULL;
+  MPI_Allreduce(
+    MPI_IN_PLACE, &cacheable, 1, MPI_INT, MPI_MIN, team_data->comm);
+  if (!cacheable) {
+    free(global_ids);
+    free_team_resources(&team_data->comm, &team_data->window,
+                        sharedmem_comm, sharedmem_tab);
+    return DART_OK;
+  }
+
+  dart_team_cache_entry_t *entry = malloc(sizeof(dart_team_cache_entry_t));
+  entry->global_ids         = global_ids;
+  entry->size               = size;
+  entry->teamid             = team_data->teamid;
+  entry->comm               = team_data->comm;
+  entry->window             = team_data->window;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  entry->sharedmem_comm     = team_data->sharedmem_comm;
+  entry->sharedmem_tab      = team_data->sharedmem_tab;
+  entry->sharedmem_nodesize = team_data->sharedmem_nodesize;
+#endif
+  entry->next               = dart_team_cache;
+  dart_team_cache           = entry;
+  dart_team_cache_size++;
+  DART_LOG_DEBUG("dart_adapt_teamcache_release: cached comm of team %d",
+                 team_data->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_adapt_teamcache_destroy()
+{
+  while (dart_team_cache != NULL) {
+    dart_team_cache_entry_t *entry = dart_team_cache;
+    dart_team_cache = entry->next;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+    free_team_resources(&entry->comm, &entry->window,
+                        &entry->sharedmem_comm, entry->sharedmem_tab);
+#else
+    free_team_resources(&entry->comm, &entry->window, NULL, NULL);
+#endif
+    free(entry->global_ids);
+    free(entry);
+  }
+  dart_team_cache_size = 0;
+  return DART_OK;
+}
@@ -0,0 +1,445 @@
+
+#include "Benchmark.h"
+
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fnmatch.h>
+
+
+namespace dash {
+namespace bench {
+
+namespace {
+
+/**
+ * Minimal JSON document model, sufficient to read reports written by
+ * \c write_json.
+ */
+struct JsonValue {
+  enum class Type { null, boolean, number, string, array, object };
+
+  Type                                     type   = Type::null;
+  double                                   number = 0;
+  std::string                              str;
+  std::vector<JsonValue>                   array;
+  std::vector<std::pair<std::string, JsonValue>> object;
+
+  const JsonValue * member(const std::string & key) const
+  {
+    for (const auto & kv : object) {
+      if (kv.first == key) {
+        return &kv.second;
+      }
+    }
+    return nullptr;
+  }
+};
+
+class JsonParser
+{
+public:
+  explicit JsonParser(const std::string & text)
+  : _text(text)
+  { }
+
+  bool parse(JsonValue & value)
+  {
+    return parse_value(value) && (skip_ws(), _pos == _text.size());
+  }
+
+private:
+  void skip_ws()
+  {
+    while (_pos < _text.size() && std::isspace(_text[_pos])) {
+      ++_pos;
+    }
+  }
+
+  bool consume(char c)
+  {
+    skip_ws();
+    if (_pos < _text.size() && _text[_pos] == c) {
+      ++_pos;
+      return true;
+    }
+    return false;
+  }
+
+  bool parse_string(std::string & str)
+  {
+    if (!consume('"')) {
+      return false;
+    }
+    while (_pos < _text.size() && _text[_pos] != '"') {
+      if (_text[_pos] == '\\' && _pos + 1 < _text.size()) {
+        ++_pos;
+      }
+      str += _text[_pos++];
+    }
+    return consume('"');
+  }
+
+  bool parse_value(JsonValue & value)
+  {
+    skip_ws();
+    if (_pos >= _text.size()) {
+      return false;
+    }
+    char c = _text[_pos];
+    if (c == '{') {
+      value.type = JsonValue::Type::object;
+      ++_pos;
+      if (consume('}')) {
+        return true;
+      }
+      do {
+        std::string key;
+        JsonValue   member;
+        if (!parse_string(key) || !consume(':') || !parse_value(member)) {
+          return false;
+        }
+        value.object.push_back(std::make_pair(key, std::move(member)));
+      } while (consume(','));
+      return consume('}');
+    }
+    if (c == '[') {
+      value.type = JsonValue::Type::array;
+      ++_pos;
+      if (consume(']')) {
+        return true;
+      }
+      do {
+        JsonValue element;
+        if (!parse_value(element)) {
+          return false;
+        }
+        value.array.push_back(std::move(element));
+      } while (consume(','));
+      return consume(']');
+    }
+    if (c == '"') {
+      value.type = JsonValue::Type::string;
+      return parse_string(value.str);
+    }
+    for (const char * literal : { "true", "false", "null" }) {
+      std::string lit(literal);
+      if (_text.compare(_pos, lit.size(), lit) == 0) {
+        value.type = (lit == "null") ? JsonValue::Type::null
+                                     : JsonValue::Type::boolean;
+        value.number = (lit == "true") ? 1 : 0;
+        _pos += lit.size();
+        return true;
+      }
+    }
+    const char * begin = _text.c_str() + _pos;
+    char       * end   = nullptr;
+    value.type   = JsonValue::Type::number;
+    value.number = std::strtod(begin, &end);
+    if (end == begin) {
+      return false;
+    }
+    _pos += end - begin;
+    return true;
+  }
+
+private:
+  const std::string & _text;
+  size_t              _pos = 0;
+};
+
+void write_stats_json(std::ostream & out, const BenchmarkStats & stats)
+{
+  out << "{\"count\":" << stats.count
+      << ",\"min\":"   << stats.min
+      << ",\"mean\":"  << stats.mean
+      << ",\"p50\":"   << stats.p50
+      << ",\"p90\":"   << stats.p90
+      << ",\"p99\":"   << stats.p99
+      << ",\"max\":"   << stats.max
+      << "}";
+}
+
+std::string result_status(
+  const BenchmarkConfig & config,
+  const BenchmarkResult & result)
+{
+  double ratio = result.baseline_ratio();
+  if (ratio == 0) {
+    return "";
+  }
+  if (ratio > 1 + config.threshold) {
+    return "regression";
+  }
+  if (ratio < 1 - config.threshold) {
+    return "improvement";
+  }
+  return "ok";
+}
+
+} // namespace
+
+BenchmarkStats benchmark_stats(std::vector<double> samples)
+{
+  BenchmarkStats stats;
+  stats.count = samples.size();
+  if (samples.empty()) {
+    return stats;
+  }
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&](double p) {
+    size_t rank = static_cast<size_t>(std::ceil(p * samples.size()));
+    return samples[std::max<size_t>(rank, 1) - 1];
+  };
+  double sum = 0;
+  for (double sample : samples) {
+    sum += sample;
+  }
+  stats.min  = samples.front();
+  stats.max  = samples.back();
+  stats.mean = sum / samples.size();
+  stats.p50  = percentile(0.50);
+  stats.p90  = percentile(0.90);
+  stats.p99  = percentile(0.99);
+  return stats;
+}
+
+BenchmarkRegistry & BenchmarkRegistry::instance()
+{
+  static BenchmarkRegistry registry;
+  return registry;
+}
+
+void BenchmarkRegistry::add(const BenchmarkCase & bench_case)
+{
+  _cases.push_back(bench_case);
+}
+
+std::vector<BenchmarkCase> BenchmarkRegistry::cases() const
+{
+  std::vector<BenchmarkCase> cases(_cases);
+  std::stable_sort(cases.begin(), cases.end(),
+                   [](const BenchmarkCase & a, const BenchmarkCase & b) {
+                     return a.group < b.group;
+                   });
+  return cases;
+}
+
+std::vector<BenchmarkResult> run_benchmarks(const BenchmarkConfig & config)
+{
+  std::vector<BenchmarkResult> results;
+  auto & team   = dash::Team::All();
+  auto   nunits = team.size();
+
+  for (const auto & bench_case : BenchmarkRegistry::instance().cases()) {
+    std::string name = bench_case.qualified_name();
+    if (fnmatch(config.filter.c_str(), name.c_str(), 0) != 0) {
+      continue;
+    }
+    for (auto size : bench_case.sizes) {
+      if (config.max_size > 0 && size > config.max_size) {
+        continue;
+      }
+      BenchmarkRun run(config, size, team);
+      bench_case.run(run);
+
+      BenchmarkResult result;
+      result.name         = name;
+      result.size         = size;
+      result.bytes_per_op = run.bytes_per_op();
+      result.skip_reason  = run.skip_reason();
+      if (!result.skip_reason.empty()) {
+        results.push_back(result);
+        continue;
+      }
+      // Every unit has the same number of samples:
+      std::vector<double> samples(run.samples());
+      samples.resize(config.reps);
+      std::vector<double> team_samples(team.myid() == 0
+                                       ? config.reps * nunits : 0);
+      DASH_ASSERT_RETURNS(
+        dart_gather(samples.data(), team_samples.data(), config.reps,
+                    DART_TYPE_DOUBLE, dash::team_unit_t(0), team.dart_id()),
+        DART_OK);
+      if (team.myid() == 0) {
+        result.team = benchmark_stats(team_samples);
+        for (size_t unit = 0; unit < nunits; ++unit) {
+          auto unit_samples_begin = team_samples.begin()
+                                    + unit * config.reps;
+          result.units.push_back(benchmark_stats(
+            std::vector<double>(unit_samples_begin,
+                                unit_samples_begin + config.reps)));
+        }
+      }
+      results.push_back(result);
+    }
+  }
+  return results;
+}
+
+bool read_baseline(
+  const std::string            & filename,
+  std::vector<BenchmarkResult> & results)
+{
+  std::ifstream in(filename);
+  if (!in) {
+    return false;
+  }
+  std::stringstream text;
+  text << in.rdbuf();
+  std::string json = text.str();
+  JsonValue report;
+  if (!JsonParser(json).parse(report)) {
+    return false;
+  }
+  auto baseline_results = report.member("results");
+  auto baseline_units   = report.member("units");
+  if (baseline_results == nullptr || baseline_units == nullptr) {
+    return false;
+  }
+  // Results of a different number of units are not comparable:
+  if (static_cast<size_t>(baseline_units->number) != dash::size()) {
+    return false;
+  }
+  std::map<std::pair<std::string, size_t>, double> baseline;
+  for (const auto & entry : baseline_results->array) {
+    auto name = entry.member("name");
+    auto size = entry.member("size");
+    auto team = entry.member("team");
+    auto p50  = team != nullptr ? team->member("p50") : nullptr;
+    if (name == nullptr || size == nullptr || p50 == nullptr) {
+      continue;
+    }
+    baseline[std::make_pair(name->str,
+                            static_cast<size_t>(size->number))]
+      = p50->number;
+  }
+  for (auto & result : results) {
+    auto it = baseline.find(std::make_pair(result.name, result.size));
+    if (it != baseline.end()) {
+      result.baseline_p50 = it->second;
+    }
+  }
+  return true;
+}
+
+size_t num_regressions(
+  const BenchmarkConfig              & config,
+  const std::vector<BenchmarkResult> & results)
+{
+  return std::count_if(results.begin(), results.end(),
+                       [&](const BenchmarkResult & result) {
+                         return result_status(config, result)
+                                == "regression";
+                       });
+}
+
+void write_table(
+  std::ostream                       & out,
+  const BenchmarkConfig              & config,
+  const std::vector<BenchmarkResult> & results)
+{
+  std::ostringstream os;
+  os << std::setw(32) << "case"     << ","
+     << std::setw(9)  << "size"     << ","
+     << std::setw(11) << "p50.us"   << ","
+     << std::setw(11) << "p90.us"   << ","
+     << std::setw(11) << "p99.us"   << ","
+     << std::setw(11) << "max.p50"  << ","
+     << std::setw(10) << "MB/s"     << ","
+     << std::setw(9)  << "baseline" << ","
+     << std::setw(12) << "status"
+     << std::endl;
+  os << std::fixed << std::setprecision(3);
+  for (const auto & result : results) {
+    os << std::setw(32) << result.name << ","
+       << std::setw(9)  << result.size << ",";
+    if (!result.skip_reason.empty()) {
+      os << " skipped: " << result.skip_reason << std::endl;
+      continue;
+    }
+    // Median of the slowest unit:
+    double max_unit_p50 = 0;
+    for (const auto & unit_stats : result.units) {
+      max_unit_p50 = std::max(max_unit_p50, unit_stats.p50);
+    }
+    os << std::setw(11) << result.team.p50  << ","
+       << std::setw(11) << result.team.p90  << ","
+       << std::setw(11) << result.team.p99  << ","
+       << std::setw(11) << max_unit_p50     << ","
+       << std::setw(10) << std::setprecision(1)
+       << result.bandwidth_mbs()            << ","
+       << std::setw(9)  << std::setprecision(3);
+    if (result.baseline_p50 > 0) {
+      os << result.baseline_ratio();
+    } else {
+      os << "-";
+    }
+    os << ","
+       << std::setw(12) << result_status(config, result)
+       << std::endl;
+  }
+  out << os.str();
+}
+
+void write_json(
+  std::ostream                       & out,
+  const BenchmarkConfig              & config,
+  const std::vector<BenchmarkResult> & results)
+{
+  std::ostringstream os;
+  os << std::setprecision(6)
+     << "{\n"
+     << "  \"benchmark\": \"dash-bench\",\n"
+     << "  \"units\": "   << dash::size()  << ",\n"
+     << "  \"warmup\": "  << config.warmup << ",\n"
+     << "  \"reps\": "    << config.reps   << ",\n"
+     << "  \"results\": [";
+  for (size_t r = 0; r < results.size(); ++r) {
+    const auto & result = results[r];
+    os << (r > 0 ? "," : "")
+       << "\n    {\"name\":\"" << result.name << "\""
+       << ",\"size\":"         << result.size
+       << ",\"bytes\":"        << result.bytes_per_op;
+    if (!result.skip_reason.empty()) {
+      os << ",\"skipped\":\"" << result.skip_reason << "\"}";
+      continue;
+    }
+    os << ",\"bandwidth_mbs\":" << result.bandwidth_mbs()
+       << ",\n     \"team\":";
+    write_stats_json(os, result.team);
+    os << ",\n     \"units\":[";
+    for (size_t unit = 0; unit < result.units.size(); ++unit) {
+      os << (unit > 0 ? "," : "");
+      write_stats_json(os, result.units[unit]);
+    }
+    os << "]";
+    if (result.baseline_p50 > 0) {
+      os << ",\n     \"baseline\":{\"p50\":" << result.baseline_p50
+         << ",\"ratio\":"    << result.baseline_ratio()
+         << ",\"status\":\"" << result_status(config, result) << "\"}";
+    }
+    os << "}";
+  }
+  os << "\n  ]\n"
+     << "}" << std::endl;
+  out << os.str();
+}
+
+} // namespace bench
+} // namespace dash
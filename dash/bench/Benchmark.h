@@ -0,0 +1,331 @@
+#ifndef DASH__BENCH__BENCHMARK_H_
+#define DASH__BENCH__BENCHMARK_H_
+
+#include <dash/Team.h>
+#include <dash/util/Timer.h>
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+
+namespace dash {
+namespace bench {
+
+/**
+ * Settings of a benchmark suite run.
+ */
+struct BenchmarkConfig {
+  /// Repetitions before measurements start
+  size_t      warmup     = 3;
+  /// Measured repetitions
+  size_t      reps       = 20;
+  /// Only run cases whose qualified name matches this glob pattern
+  std::string filter     = "*";
+  /// Cases with a larger size parameter are skipped
+  size_t      max_size   = 0;
+  /// Relative deviation of the median from the baseline that is
+  /// reported as regression or improvement
+  double      threshold  = 0.1;
+};
+
+/**
+ * Statistics of the latencies of one operation in microseconds.
+ */
+struct BenchmarkStats {
+  size_t count  = 0;
+  double min    = 0;
+  double mean   = 0;
+  double p50    = 0;
+  double p90    = 0;
+  double p99    = 0;
+  double max    = 0;
+};
+
+/**
+ * Statistics of a sample set, percentiles use the nearest-rank method.
+ */
+BenchmarkStats benchmark_stats(std::vector<double> samples);
+
+/**
+ * Measurement of a benchmark case for one size parameter, passed to the
+ * case function.
+ *
+ * The case function sets up its data, calls \c measure once with the
+ * operation to benchmark and releases its data. All units of the team
+ * must call \c measure with the same arguments.
+ */
+class BenchmarkRun
+{
+public:
+  typedef dash::util::Timer<dash::util::TimeMeasure::Clock> timer_t;
+
+  /// Whether units are synchronized before every repetition
+  enum class Sync {
+    none,
+    barrier
+  };
+
+public:
+  BenchmarkRun(
+    const BenchmarkConfig & config,
+    size_t                  size,
+    dash::Team            & team = dash::Team::All())
+  : _config(config),
+    _size(size),
+    _team(team)
+  { }
+
+  /**
+   * Size parameter of the case, the meaning depends on the case.
+   */
+  inline size_t size() const
+  {
+    return _size;
+  }
+
+  inline dash::Team & team() const
+  {
+    return _team;
+  }
+
+  /**
+   * Number of bytes transferred by every unit in one operation, used to
+   * report bandwidths.
+   */
+  inline void set_bytes_per_op(size_t bytes)
+  {
+    _bytes_per_op = bytes;
+  }
+
+  inline size_t bytes_per_op() const
+  {
+    return _bytes_per_op;
+  }
+
+  /**
+   * Skip the case, e.g. if it requires more units.
+   */
+  inline void skip(const std::string & reason)
+  {
+    _skip_reason = reason;
+  }
+
+  inline const std::string & skip_reason() const
+  {
+    return _skip_reason;
+  }
+
+  /**
+   * Run the configured warmup and measured repetitions of \c ops_per_rep
+   * invocations of \c op.
+   *
+   * Every measured repetition contributes one sample, the mean latency
+   * of an invocation in the repetition.
+   */
+  template <class Operation>
+  void measure(
+    Operation && op,
+    size_t       ops_per_rep = 1,
+    Sync         sync        = Sync::barrier)
+  {
+    _samples_us.clear();
+    _samples_us.reserve(_config.reps);
+    for (size_t rep = 0; rep < _config.warmup + _config.reps; ++rep) {
+      if (sync == Sync::barrier) {
+        _team.barrier();
+      }
+      auto ts_start = timer_t::Now();
+      for (size_t i = 0; i < ops_per_rep; ++i) {
+        op();
+      }
+      double elapsed_us = timer_t::ElapsedSince(ts_start);
+      if (rep >= _config.warmup) {
+        _samples_us.push_back(elapsed_us / ops_per_rep);
+      }
+    }
+    _team.barrier();
+  }
+
+  /**
+   * Latencies of the measured repetitions of the calling unit in
+   * microseconds.
+   */
+  inline const std::vector<double> & samples() const
+  {
+    return _samples_us;
+  }
+
+private:
+  const BenchmarkConfig & _config;
+  size_t                  _size;
+  dash::Team            & _team;
+  size_t                  _bytes_per_op = 0;
+  std::string             _skip_reason;
+  std::vector<double>     _samples_us;
+};
+
+/**
+ * A benchmark case, run once for every size parameter.
+ */
+struct BenchmarkCase {
+  typedef std::function<void(BenchmarkRun &)> function_t;
+
+  std::string         group;
+  std::string         name;
+  std::vector<size_t> sizes;
+  function_t          run;
+
+  inline std::string qualified_name() const
+  {
+    return group + "." + name;
+  }
+};
+
+/**
+ * Result of a benchmark case for one size parameter.
+ */
+struct BenchmarkResult {
+  std::string                 name;
+  size_t                      size          = 0;
+  size_t                      bytes_per_op  = 0;
+  std::string                 skip_reason;
+  /// Statistics of the samples of all units
+  BenchmarkStats              team;
+  /// Statistics of the samples of every unit
+  std::vector<BenchmarkStats> units;
+  /// Median of the baseline, 0 if the baseline has no such result
+  double                      baseline_p50  = 0;
+
+  /**
+   * Bandwidth of a unit at the median latency in MB/s.
+   */
+  inline double bandwidth_mbs() const
+  {
+    return team.p50 > 0 ? bytes_per_op / team.p50 : 0;
+  }
+
+  /**
+   * Median latency relative to the baseline.
+   */
+  inline double baseline_ratio() const
+  {
+    return baseline_p50 > 0 ? team.p50 / baseline_p50 : 0;
+  }
+};
+
+/**
+ * Registry of all benchmark cases.
+ */
+class BenchmarkRegistry
+{
+public:
+  static BenchmarkRegistry & instance();
+
+  void add(const BenchmarkCase & bench_case);
+
+  /**
+   * Cases in order of their group, cases of a group in order of their
+   * registration.
+   */
+  std::vector<BenchmarkCase> cases() const;
+
+private:
+  std::vector<BenchmarkCase> _cases;
+};
+
+/**
+ * Registers a benchmark case during static initialization.
+ */
+class BenchmarkRegistrar
+{
+public:
+  BenchmarkRegistrar(
+    const char                    * group,
+    const char                    * name,
+    std::vector<size_t>             sizes,
+    BenchmarkCase::function_t       run)
+  {
+    BenchmarkRegistry::instance().add(
+      BenchmarkCase { group, name, std::move(sizes), std::move(run) });
+  }
+};
+
+/**
+ * Run all cases matching the configuration.
+ *
+ * Collective operation, results are only complete at unit 0.
+ */
+std::vector<BenchmarkResult> run_benchmarks(const BenchmarkConfig & config);
+
+/**
+ * Set the baseline medians of \c results from a report written by
+ * \c write_json.
+ *
+ * \returns  false if the baseline could not be read or has been
+ *           measured with a different number of units.
+ */
+bool read_baseline(
+  const std::string            & filename,
+  std::vector<BenchmarkResult> & results);
+
+/**
+ * Number of results with a median exceeding the baseline by more than
+ * the configured threshold.
+ */
+size_t num_regressions(
+  const BenchmarkConfig              & config,
+  const std::vector<BenchmarkResult> & results);
+
+/**
+ * Write results as table.
+ */
+void write_table(
+  std::ostream                       & out,
+  const BenchmarkConfig              & config,
+  const std::vector<BenchmarkResult> & results);
+
+/**
+ * Write results as JSON report.
+ */
+void write_json(
+  std::ostream                       & out,
+  const BenchmarkConfig              & config,
+  const std::vector<BenchmarkResult> & results);
+
+} // namespace bench
+} // namespace dash
+
+#define DASH_BENCH__CASE_FUN(group_, name_) \
+  dash_bench__##group_##__##name_
+
+/**
+ * Define a benchmark case that is run with every size parameter in the
+ * variadic arguments.
+ *
+ * \code
+ *   DASH_BENCHMARK_SIZES(dart, put_blocking, 8, 1024)
+ *   {
+ *     // ... set up data for size run.size() ...
+ *     run.measure([&]() { ... });
+ *   }
+ * \endcode
+ */
+#define DASH_BENCHMARK_SIZES(group_, name_, ...) \
+  static void DASH_BENCH__CASE_FUN(group_, name_)( \
+    dash::bench::BenchmarkRun & run); \
+  static dash::bench::BenchmarkRegistrar \
+    DASH_BENCH__CASE_FUN(group_, name_##__registrar)( \
+      #group_, #name_, { __VA_ARGS__ }, &DASH_BENCH__CASE_FUN(group_, name_)); \
+  static void DASH_BENCH__CASE_FUN(group_, name_)( \
+    dash::bench::BenchmarkRun & run)
+
+/**
+ * Define a benchmark case without size parameter.
+ */
+#define DASH_BENCHMARK(group_, name_) \
+  DASH_BENCHMARK_SIZES(group_, name_, 0)
+
+#endif // DASH__BENCH__BENCHMARK_H_
@@ -0,0 +1,52 @@
+
+#include "../Benchmark.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/ForEach.h>
+#include <dash/algorithm/MinMax.h>
+#include <dash/algorithm/Transform.h>
+
+#include <functional>
+
+
+// Size parameters are elements per unit.
+
+DASH_BENCHMARK_SIZES(algorithm, fill, 1024, 1048576)
+{
+  dash::Array<double> array(run.size() * dash::size());
+  run.set_bytes_per_op(run.size() * sizeof(double));
+  run.measure([&]() { dash::fill(array.begin(), array.end(), 1.0); });
+}
+
+DASH_BENCHMARK_SIZES(algorithm, for_each, 1024, 1048576)
+{
+  dash::Array<double> array(run.size() * dash::size());
+  run.set_bytes_per_op(run.size() * sizeof(double));
+  run.measure([&]() {
+                dash::for_each(array.begin(), array.end(),
+                               [](double & v) { v += 1.0; });
+              });
+}
+
+DASH_BENCHMARK_SIZES(algorithm, min_element, 1024, 1048576)
+{
+  dash::Array<double> array(run.size() * dash::size());
+  dash::fill(array.begin(), array.end(), 1.0);
+  run.set_bytes_per_op(run.size() * sizeof(double));
+  run.measure([&]() { dash::min_element(array.begin(), array.end()); });
+}
+
+DASH_BENCHMARK_SIZES(algorithm, transform, 1024, 1048576)
+{
+  dash::Array<double> array_a(run.size() * dash::size());
+  dash::Array<double> array_b(run.size() * dash::size());
+  dash::fill(array_a.begin(), array_a.end(), 1.0);
+  dash::fill(array_b.begin(), array_b.end(), 2.0);
+  run.set_bytes_per_op(2 * run.size() * sizeof(double));
+  run.measure([&]() {
+                dash::transform(array_a.begin(), array_a.end(),
+                                array_b.begin(), array_b.begin(),
+                                dash::plus<double>());
+              });
+}
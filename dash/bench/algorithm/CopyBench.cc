@@ -0,0 +1,74 @@
+#include "../Benchmark.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/algorithm/Copy.h>
+
+#include <numeric>
+#include <vector>
+
+
+// Size parameters are elements per unit.
+
+DASH_BENCHMARK_SIZES(copy, global_to_local, 1024, 1048576)
+{
+  dash::Array<double> array(run.size() * dash::size());
+  std::vector<double> local_copy(array.size());
+  run.set_bytes_per_op(array.size() * sizeof(double));
+  run.measure([&]() {
+                dash::copy(array.begin(), array.end(), local_copy.data());
+              });
+}
+
+// Sub-matrix of 64 columns in the center of a tiled matrix with 256
+// columns and size / 256 rows per unit.
+DASH_BENCHMARK_SIZES(copy, submatrix_to_local, 16384, 1048576)
+{
+  typedef dash::TilePattern<2> pattern_t;
+  const size_t ncols = 256;
+  const size_t nrows = run.size() / ncols * dash::size();
+  pattern_t pattern(
+    dash::SizeSpec<2>(nrows, ncols),
+    dash::DistributionSpec<2>(dash::TILE(16), dash::TILE(16)));
+  dash::Matrix<double, 2, dash::default_index_t, pattern_t> matrix(pattern);
+  auto submatrix = matrix.sub<0>(nrows / 4, nrows / 2)
+                         .sub<1>(ncols / 2 - 32, 64);
+  std::vector<double> local_copy(nrows / 2 * 64);
+  run.set_bytes_per_op(local_copy.size() * sizeof(double));
+  run.measure([&]() {
+                dash::copy(submatrix.begin(), submatrix.end(),
+                           local_copy.data());
+              });
+}
+
+// Copy between arrays with blocked and block-cyclic pattern, using a
+// copy plan created once.
+DASH_BENCHMARK_SIZES(copy, global_to_global, 1024, 1048576)
+{
+  dash::Array<double> src(run.size() * dash::size(), dash::BLOCKED);
+  dash::Array<double> dst(run.size() * dash::size(), dash::BLOCKCYCLIC(256));
+  auto plan = dash::make_copy_plan(src.begin(), src.end(), dst.begin());
+  run.set_bytes_per_op(run.size() * sizeof(double));
+  run.measure([&]() {
+                dash::copy(src.begin(), src.end(), dst.begin(), plan);
+              });
+}
+
+// Global-to-local copy in chunks of 64 KB with 4 chunks in flight,
+// reducing every chunk on arrival.
+DASH_BENCHMARK_SIZES(copy, stream_to_local, 1024, 1048576)
+{
+  dash::Array<double> array(run.size() * dash::size());
+  std::vector<double> local_copy(array.size());
+  dash::CopyStreamConfig config;
+  double sum = 0;
+  run.set_bytes_per_op(array.size() * sizeof(double));
+  run.measure([&]() {
+                dash::copy_chunked(
+                  array.begin(), array.end(), local_copy.data(),
+                  [&](double * first, double * last) {
+                    sum = std::accumulate(first, last, sum);
+                  },
+                  config);
+              });
+}
@@ -0,0 +1,63 @@
+
+#include "../Benchmark.h"
+
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/Vector.h>
+
+
+// Size parameters are elements per unit.
+
+DASH_BENCHMARK_SIZES(container, array_alloc, 1024, 1048576)
+{
+  run.set_bytes_per_op(run.size() * sizeof(double));
+  run.measure([&]() {
+                dash::Array<double> array(run.size() * dash::size());
+              });
+}
+
+DASH_BENCHMARK(container, array_remote_read)
+{
+  dash::Array<double> array(dash::size());
+  auto neighbor = (dash::myid().id + 1) % dash::size();
+  double value  = 0;
+  run.set_bytes_per_op(sizeof(double));
+  run.measure([&]() { value += static_cast<double>(array[neighbor]); },
+              100);
+}
+
+// Reads of a lookup table in the memory of the neighbor unit, without
+// barriers between repetitions that would invalidate the cache.
+DASH_BENCHMARK_SIZES(container, array_cached_read, 1024)
+{
+  dash::Array<double> array(run.size() * dash::size());
+  dash::ReadCacheConfig config;
+  // Units in benchmark runs on a single node would bypass the cache:
+  config.node_local = true;
+  array.enable_read_cache(config);
+  auto   neighbor = (dash::myid().id + 1) % dash::size();
+  auto   offset   = neighbor * run.size();
+  size_t idx      = 0;
+  double value    = 0;
+  run.set_bytes_per_op(sizeof(double));
+  run.measure([&]() {
+                value += static_cast<double>(array[offset + idx]);
+                idx    = (idx + 7) % run.size();
+              },
+              100, dash::bench::BenchmarkRun::Sync::none);
+}
+
+DASH_BENCHMARK(container, array_remote_write)
+{
+  dash::Array<double> array(dash::size());
+  auto neighbor = (dash::myid().id + 1) % dash::size();
+  run.set_bytes_per_op(sizeof(double));
+  run.measure([&]() { array[neighbor] = 1.0; }, 100);
+}
+
+DASH_BENCHMARK(container, vector_lpush_back)
+{
+  dash::Vector<double> vec;
+  run.set_bytes_per_op(sizeof(double));
+  run.measure([&]() { vec.lpush_back(1.0); }, 1000);
+}
@@ -0,0 +1,60 @@
+
+#include "../Benchmark.h"
+
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <vector>
+
+
+DASH_BENCHMARK(dart, barrier)
+{
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(dart_barrier(DART_TEAM_ALL), DART_OK);
+              },
+              10, dash::bench::BenchmarkRun::Sync::none);
+}
+
+DASH_BENCHMARK_SIZES(dart, bcast, 8, 65536)
+{
+  std::vector<char> buffer(run.size());
+  run.set_bytes_per_op(run.size());
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_bcast(buffer.data(), run.size(), DART_TYPE_BYTE,
+                             dash::team_unit_t(0), DART_TEAM_ALL),
+                  DART_OK);
+              },
+              10);
+}
+
+DASH_BENCHMARK_SIZES(dart, allreduce, 8, 65536)
+{
+  size_t              nelem = run.size() / sizeof(double);
+  std::vector<double> values(nelem, 1.0);
+  std::vector<double> result(nelem);
+  run.set_bytes_per_op(run.size());
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_allreduce(values.data(), result.data(), nelem,
+                                 DART_TYPE_DOUBLE, DART_OP_SUM,
+                                 DART_TEAM_ALL),
+                  DART_OK);
+              },
+              10);
+}
+
+DASH_BENCHMARK_SIZES(dart, allgather, 8, 65536)
+{
+  std::vector<char> values(run.size());
+  std::vector<char> result(run.size() * dash::size());
+  run.set_bytes_per_op(run.size());
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_allgather(values.data(), result.data(), run.size(),
+                                 DART_TYPE_BYTE, DART_TEAM_ALL),
+                  DART_OK);
+              },
+              10);
+}
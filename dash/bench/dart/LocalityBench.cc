@@ -0,0 +1,111 @@
+#include "../Benchmark.h"
+
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <cstdlib>
+#include <vector>
+
+/*
+ * Phases of the locality discovery in dart_init:
+ *
+ * - locality.node_units:   units at the calling unit's node
+ * - locality.team_init:    locality data and domain tags of the units at
+ *                          every node, hardware locality is resolved in
+ *                          dart_init only
+ * - locality.team_domain:  team_init and the domain hierarchy of all
+ *                          units, resolved on first request
+ * - locality.allgather:    exchange of the locality data of all units,
+ *                          for reference
+ */
+
+namespace {
+
+/**
+ * Team of all units whose locality data is initialized and released in
+ * every repetition.
+ */
+class LocalityTeam
+{
+public:
+  LocalityTeam()
+  {
+    dart_group_t group;
+    DASH_ASSERT_RETURNS(dart_team_get_group(DART_TEAM_ALL, &group), DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_team_create(DART_TEAM_ALL, group, &_team), DART_OK);
+    DASH_ASSERT_RETURNS(dart_group_destroy(&group), DART_OK);
+  }
+
+  ~LocalityTeam()
+  {
+    dart_team_destroy(&_team);
+  }
+
+  dart_team_t dart_id() const
+  {
+    return _team;
+  }
+
+private:
+  dart_team_t _team = DART_TEAM_NULL;
+};
+
+} // namespace
+
+DASH_BENCHMARK(locality, node_units)
+{
+  run.measure([&]() {
+                int                num_units;
+                dart_team_unit_t * units;
+                DASH_ASSERT_RETURNS(
+                  dart_team_node_units(DART_TEAM_ALL, &num_units, &units),
+                  DART_OK);
+                free(units);
+              },
+              1);
+}
+
+DASH_BENCHMARK(locality, team_init)
+{
+  LocalityTeam team;
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_team_locality_init(team.dart_id()), DART_OK);
+                DASH_ASSERT_RETURNS(
+                  dart_team_locality_finalize(team.dart_id()), DART_OK);
+              },
+              1);
+}
+
+DASH_BENCHMARK(locality, team_domain)
+{
+  LocalityTeam team;
+  run.measure([&]() {
+                dart_domain_locality_t * domain;
+                DASH_ASSERT_RETURNS(
+                  dart_team_locality_init(team.dart_id()), DART_OK);
+                DASH_ASSERT_RETURNS(
+                  dart_domain_team_locality(team.dart_id(), ".", &domain),
+                  DART_OK);
+                DASH_ASSERT_RETURNS(
+                  dart_team_locality_finalize(team.dart_id()), DART_OK);
+              },
+              1);
+}
+
+DASH_BENCHMARK(locality, allgather)
+{
+  std::vector<dart_unit_locality_t> recv(dash::size());
+  dart_unit_locality_t              send;
+  run.set_bytes_per_op(sizeof(dart_unit_locality_t));
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_allgather(&send, recv.data(),
+                                 sizeof(dart_unit_locality_t),
+                                 DART_TYPE_BYTE, DART_TEAM_ALL),
+                  DART_OK);
+              },
+              1);
+}
@@ -0,0 +1,108 @@
+
+#include "../Benchmark.h"
+
+#include <dash/Array.h>
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace {
+
+/**
+ * Operations per repetition so repetitions of small transfers take
+ * long enough for the timer resolution.
+ */
+size_t ops_per_rep(size_t nbytes)
+{
+  return std::max<size_t>(1, std::min<size_t>(100, (1 << 16) / nbytes));
+}
+
+/**
+ * Global memory of \c nbytes at every unit, transfers target the block
+ * of the right neighbor.
+ */
+struct NeighborBlock {
+  explicit NeighborBlock(size_t nbytes)
+  : mem(nbytes * dash::size()),
+    buffer(nbytes, 1)
+  {
+    auto neighbor = (dash::myid().id + 1) % dash::size();
+    gptr          = (mem.begin() + neighbor * nbytes).dart_gptr();
+  }
+
+  dash::Array<char> mem;
+  std::vector<char> buffer;
+  dart_gptr_t       gptr;
+};
+
+} // namespace
+
+DASH_BENCHMARK_SIZES(dart, put_blocking, 8, 1024, 65536, 1048576)
+{
+  NeighborBlock block(run.size());
+  run.set_bytes_per_op(run.size());
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_put_blocking(block.gptr, block.buffer.data(),
+                                    run.size(), DART_TYPE_BYTE,
+                                    DART_TYPE_BYTE),
+                  DART_OK);
+              },
+              ops_per_rep(run.size()));
+}
+
+DASH_BENCHMARK_SIZES(dart, get_blocking, 8, 1024, 65536, 1048576)
+{
+  NeighborBlock block(run.size());
+  run.set_bytes_per_op(run.size());
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_get_blocking(block.buffer.data(), block.gptr,
+                                    run.size(), DART_TYPE_BYTE,
+                                    DART_TYPE_BYTE),
+                  DART_OK);
+              },
+              ops_per_rep(run.size()));
+}
+
+DASH_BENCHMARK_SIZES(dart, put_flush, 8, 1024, 65536, 1048576)
+{
+  NeighborBlock block(run.size());
+  run.set_bytes_per_op(run.size());
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_put(block.gptr, block.buffer.data(), run.size(),
+                           DART_TYPE_BYTE, DART_TYPE_BYTE),
+                  DART_OK);
+                DASH_ASSERT_RETURNS(dart_flush(block.gptr), DART_OK);
+              },
+              ops_per_rep(run.size()));
+}
+
+/**
+ * Blocking put followed by a blocking get of small blocks, the latency
+ * of single transfers is most sensitive to per-operation overheads in
+ * DART such as communication profiling.
+ */
+DASH_BENCHMARK_SIZES(dart, put_get_latency, 8, 64)
+{
+  NeighborBlock block(run.size());
+  run.set_bytes_per_op(2 * run.size());
+  run.measure([&]() {
+                DASH_ASSERT_RETURNS(
+                  dart_put_blocking(block.gptr, block.buffer.data(),
+                                    run.size(), DART_TYPE_BYTE,
+                                    DART_TYPE_BYTE),
+                  DART_OK);
+                DASH_ASSERT_RETURNS(
+                  dart_get_blocking(block.buffer.data(), block.gptr,
+                                    run.size(), DART_TYPE_BYTE,
+                                    DART_TYPE_BYTE),
+                  DART_OK);
+              },
+              ops_per_rep(run.size()));
+}
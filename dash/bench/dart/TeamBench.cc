@@ -0,0 +1,102 @@
+#include "../Benchmark.h"
+
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <vector>
+
+/*
+ * Creation and destruction of teams:
+ *
+ * - team.split:        split of all units into two teams that are
+ *                      destroyed without communicating
+ * - team.split_alloc:  split and a collective allocation in the new team
+ * - team.clone:        clone of the team of all units
+ */
+
+namespace {
+
+/**
+ * Groups of a split of all units into \c n groups.
+ */
+class SplitGroups
+{
+public:
+  explicit SplitGroups(size_t n)
+  : _groups(n, nullptr)
+  {
+    dart_group_t group;
+    size_t       nout;
+    DASH_ASSERT_RETURNS(dart_team_get_group(DART_TEAM_ALL, &group), DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_group_split(group, n, &nout, _groups.data()), DART_OK);
+    DASH_ASSERT_RETURNS(dart_group_destroy(&group), DART_OK);
+  }
+
+  ~SplitGroups()
+  {
+    for (auto & group : _groups) {
+      dart_group_destroy(&group);
+    }
+  }
+
+  /**
+   * Create a team for every group, returns the team of the calling unit.
+   */
+  dart_team_t create_teams() const
+  {
+    dart_team_t myteam = DART_TEAM_NULL;
+    for (const auto & group : _groups) {
+      dart_team_t team;
+      DASH_ASSERT_RETURNS(
+        dart_team_create(DART_TEAM_ALL, group, &team), DART_OK);
+      if (team != DART_TEAM_NULL) {
+        myteam = team;
+      }
+    }
+    return myteam;
+  }
+
+private:
+  std::vector<dart_group_t> _groups;
+};
+
+} // namespace
+
+DASH_BENCHMARK(team, split)
+{
+  SplitGroups groups(2);
+  run.measure([&]() {
+                dart_team_t team = groups.create_teams();
+                DASH_ASSERT_RETURNS(dart_team_destroy(&team), DART_OK);
+              },
+              1);
+}
+
+DASH_BENCHMARK(team, split_alloc)
+{
+  SplitGroups groups(2);
+  run.measure([&]() {
+                dart_team_t team = groups.create_teams();
+                dart_gptr_t gptr;
+                DASH_ASSERT_RETURNS(
+                  dart_team_memalloc_aligned(team, 1024, DART_TYPE_BYTE,
+                                             &gptr),
+                  DART_OK);
+                DASH_ASSERT_RETURNS(dart_team_memfree(gptr), DART_OK);
+                DASH_ASSERT_RETURNS(dart_team_destroy(&team), DART_OK);
+              },
+              1);
+}
+
+DASH_BENCHMARK(team, clone)
+{
+  run.measure([&]() {
+                dart_team_t team;
+                DASH_ASSERT_RETURNS(
+                  dart_team_clone(DART_TEAM_ALL, &team), DART_OK);
+                DASH_ASSERT_RETURNS(dart_team_destroy(&team), DART_OK);
+              },
+              1);
+}
@@ -0,0 +1,43 @@
+
+#include "../Benchmark.h"
+
+#include <dash/Matrix.h>
+#include <dash/TeamSpec.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/halo/HaloMatrixWrapper.h>
+
+
+namespace {
+
+typedef dash::Pattern<2>                           pattern_t;
+typedef typename pattern_t::index_type             index_t;
+typedef dash::NArray<double, 2, index_t, pattern_t> matrix_t;
+typedef dash::StencilPoint<2>                      stencil_point_t;
+typedef dash::StencilSpec<stencil_point_t, 4>      stencil_spec_t;
+typedef dash::HaloMatrixWrapper<matrix_t>          halo_wrapper_t;
+
+} // namespace
+
+// Size parameters are local extents of every dimension.
+
+DASH_BENCHMARK_SIZES(halo, update_4point, 64, 512)
+{
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  dash::SizeSpec<2> sizespec(run.size() * teamspec.extent(0),
+                             run.size() * teamspec.extent(1));
+  dash::DistributionSpec<2> distspec(dash::BLOCKED, dash::BLOCKED);
+  pattern_t pattern(sizespec, distspec, teamspec);
+
+  matrix_t matrix(pattern);
+  dash::fill(matrix.begin(), matrix.end(), 1.0);
+
+  stencil_spec_t stencil_spec(
+    stencil_point_t(-1, 0), stencil_point_t(1, 0),
+    stencil_point_t( 0,-1), stencil_point_t(0, 1));
+  halo_wrapper_t halo(matrix, stencil_spec);
+
+  // Rows and columns received from the four neighbors:
+  run.set_bytes_per_op(4 * run.size() * sizeof(double));
+  run.measure([&]() { halo.update(); });
+}
@@ -0,0 +1,158 @@
+/**
+ * Benchmark suite of DASH and DART primitives.
+ *
+ * Usage:
+ *
+ *   mpirun -n 4 dash-bench-mpi [-f filter] [-r reps] [-w warmup]
+ *                              [-s max. size] [-o report.json]
+ *                              [-b baseline.json] [-t threshold] [-l]
+ *
+ * Runs all registered cases with qualified name matching the glob
+ * pattern \c filter. The report written with \c -o can be passed as
+ * baseline with \c -b in a later run, medians exceeding the baseline
+ * by more than \c threshold (default 0.1) are reported as regressions
+ * and fail the run. The run also fails if the baseline cannot be read.
+ */
+
+#include "Benchmark.h"
+
+#include <libdash.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using std::cout;
+using std::cerr;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef struct benchmark_params_t {
+  dash::bench::BenchmarkConfig config;
+  std::string                  report_file;
+  std::string                  baseline_file;
+  bool                         list = false;
+} benchmark_params;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  benchmark_params params = parse_args(argc, argv);
+
+  if (params.list) {
+    if (dash::myid() == 0) {
+      for (const auto & bench_case :
+             dash::bench::BenchmarkRegistry::instance().cases()) {
+        cout << bench_case.qualified_name() << endl;
+      }
+    }
+    dash::finalize();
+    return EXIT_SUCCESS;
+  }
+
+  dash::util::BenchmarkParams bench_params("dash-bench");
+  bench_params.print_header();
+  bench_params.print_pinning();
+  print_params(bench_params, params);
+
+  auto results = dash::bench::run_benchmarks(params.config);
+
+  // Number of regressions and whether a requested baseline could not
+  // be read:
+  int status[2] = { 0, 0 };
+  int & num_regressions = status[0];
+  int & baseline_failed = status[1];
+  if (dash::myid() == 0) {
+    if (!params.baseline_file.empty() &&
+        !dash::bench::read_baseline(params.baseline_file, results)) {
+      cerr << "Could not read baseline " << params.baseline_file
+           << " for " << dash::size() << " units" << endl;
+      baseline_failed = 1;
+    }
+    num_regressions = dash::bench::num_regressions(params.config, results);
+
+    dash::bench::write_table(cout, params.config, results);
+    if (!params.report_file.empty()) {
+      std::ofstream report(params.report_file);
+      dash::bench::write_json(report, params.config, results);
+    }
+    if (num_regressions > 0) {
+      cout << num_regressions << " regressions" << endl;
+    }
+    cout << "Benchmark finished" << endl;
+  }
+  DASH_ASSERT_RETURNS(
+    dart_bcast(status, 2, DART_TYPE_INT, dash::team_unit_t(0),
+               DART_TEAM_ALL),
+    DART_OK);
+
+  dash::finalize();
+  return (num_regressions > 0 || baseline_failed) ? EXIT_FAILURE
+                                                  : EXIT_SUCCESS;
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-l") {
+      params.list = true;
+      --i;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-f") {
+      params.config.filter    = argv[i+1];
+    } else if (flag == "-r") {
+      params.config.reps      = std::max(1, atoi(argv[i+1]));
+    } else if (flag == "-w") {
+      params.config.warmup    = atoi(argv[i+1]);
+    } else if (flag == "-s") {
+      params.config.max_size  = strtoull(argv[i+1], nullptr, 10);
+    } else if (flag == "-t") {
+      params.config.threshold = atof(argv[i+1]);
+    } else if (flag == "-o") {
+      params.report_file      = argv[i+1];
+    } else if (flag == "-b") {
+      params.baseline_file    = argv[i+1];
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-f", "filter",         params.config.filter);
+  bench_cfg.print_param("-r", "repetitions",    params.config.reps);
+  bench_cfg.print_param("-w", "warmup",         params.config.warmup);
+  bench_cfg.print_param("-s", "max. size",      params.config.max_size);
+  bench_cfg.print_param("-t", "threshold",      params.config.threshold);
+  bench_cfg.print_param("-o", "report",         params.report_file);
+  bench_cfg.print_param("-b", "baseline",       params.baseline_file);
+  bench_cfg.print_section_end();
+}
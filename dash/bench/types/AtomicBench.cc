@@ -0,0 +1,31 @@
+
+#include "../Benchmark.h"
+
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/Shared.h>
+
+
+DASH_BENCHMARK(atomic, fetch_add_contended)
+{
+  // All units update a counter at unit 0:
+  dash::Shared<dash::Atomic<int64_t>> counter;
+  run.set_bytes_per_op(sizeof(int64_t));
+  run.measure([&]() { counter.get().fetch_add(1); }, 100);
+}
+
+DASH_BENCHMARK(atomic, fetch_add_neighbor)
+{
+  dash::Array<dash::Atomic<int64_t>> counters(dash::size());
+  auto neighbor = (dash::myid().id + 1) % dash::size();
+  run.set_bytes_per_op(sizeof(int64_t));
+  run.measure([&]() { counters[neighbor].fetch_add(1); }, 100);
+}
+
+DASH_BENCHMARK(atomic, load_neighbor)
+{
+  dash::Array<dash::Atomic<int64_t>> counters(dash::size());
+  auto neighbor = (dash::myid().id + 1) % dash::size();
+  run.set_bytes_per_op(sizeof(int64_t));
+  run.measure([&]() { counters[neighbor].load(); }, 100);
+}
@@ -0,0 +1,26 @@
+
+#include "../Benchmark.h"
+
+#include <dash/Mutex.h>
+
+
+DASH_BENCHMARK(mutex, lock_unlock)
+{
+  dash::Mutex mutex;
+  run.measure([&]() {
+                mutex.lock();
+                mutex.unlock();
+              },
+              10);
+}
+
+DASH_BENCHMARK(mutex, try_lock)
+{
+  dash::Mutex mutex;
+  run.measure([&]() {
+                if (mutex.try_lock()) {
+                  mutex.unlock();
+                }
+              },
+              10);
+}
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <iomanip>
+#include <cstdlib>
 #include <libdash.h>
 
 #include "../bench.h"
@@ -6,59 +8,119 @@
 using namespace std;
 
 template<typename T>
-bool init_array(size_t lelem);
+double init_array(size_t lelem, dash::MemoryPlacement placement,
+                  size_t nread, double * read_secs);
 
 template<typename T>
-void perform_test(size_t nlelem, size_t repeat);
+void perform_test(size_t nlelem, size_t repeat,
+                  dash::MemoryPlacement placement);
 
-#define REPEAT 100
+#define REPEAT 10
+#define NREAD  10
 
 int main(int argc, char * argv[])
 {
   dash::init(&argc, &argv);
 
-  perform_test<int>(1024 * 1024, 100);
+  size_t nlelem = (argc > 1) ? atol(argv[1]) : 4 * 1024 * 1024;
+
+  if (dash::myid() == 0) {
+    cout << setw(22) << "placement"  << ", "
+         << setw(5)  << "units"      << ", "
+         << setw(8)  << "MB/unit"    << ", "
+         << setw(10) << "init ms"    << ", "
+         << setw(10) << "init MB/s"  << ", "
+         << setw(10) << "read MB/s"
+         << endl;
+  }
+
+  const dash::MemoryPlacement placements[] = {
+    dash::MemoryPlacement::system,
+    dash::MemoryPlacement::first_touch_parallel,
+    dash::MemoryPlacement::interleaved,
+    dash::MemoryPlacement::unit_domain
+  };
+  for (auto placement : placements) {
+    perform_test<int>(nlelem, REPEAT, placement);
+  }
 
   dash::finalize();
 }
 
 template<typename T>
-void perform_test(size_t nlelem, size_t repeat)
+void perform_test(size_t nlelem, size_t repeat,
+                  dash::MemoryPlacement placement)
 {
-  double tstart, tstop;
+  double tinit = 0, tread = 0;
 
-  TIMESTAMP(tstart);
-  for (int i = 0; i < repeat; i++ ) {
-    init_array<T>(nlelem);
+  for (size_t i = 0; i < repeat; i++ ) {
+    double read_secs;
+    tinit += init_array<T>(nlelem, placement, NREAD, &read_secs);
+    tread += read_secs;
   }
-  TIMESTAMP(tstop);
 
   double lsize = (double)nlelem * sizeof(T) / ((double)(1024 * 1024));
-  double gsize = lsize * (double)dash::size();
 
   if (dash::myid() == 0 ) {
-    cout << dash::size() << ", " << lsize << ", "
-         << 1000.0 * (tstop - tstart) / repeat
-         << endl
-         << "Initialized " << gsize << " MB on "
-         << dash::size() << " unit(s) = "
-         << lsize << " MB per unit "
+    cout << setw(22) << placement     << ", "
+         << setw(5)  << dash::size()  << ", "
+         << setw(8)  << fixed << setprecision(1)
+                     << lsize         << ", "
+         << setw(10) << setprecision(3)
+                     << 1000.0 * tinit / repeat << ", "
+         << setw(10) << setprecision(1)
+                     << lsize * repeat / tinit  << ", "
+         << setw(10) << lsize * repeat * NREAD / tread
          << endl;
   }
 }
 
-
+/**
+ * Allocates and initializes an array with the given placement of local
+ * memory, local elements are initialized and read in parallel loops like
+ * in an OpenMP application.
+ *
+ * Returns the time of allocation and initialization at unit 0 in seconds,
+ * the time of reading local elements \c nread times in \c read_secs.
+ */
 template<typename T>
-bool init_array(size_t nlelem)
+double init_array(size_t nlelem, dash::MemoryPlacement placement,
+                  size_t nread, double * read_secs)
 {
-  dash::Array<T> arr(nlelem * dash::size());
+  double tstart, tinit, tstop;
 
-  for (int i = 0; i < arr.lsize(); i++) {
-    arr.local[i] = 42;
+  dash::barrier();
+  TIMESTAMP(tstart);
+
+  dash::Array<T> arr;
+  arr.set_memory_placement(placement);
+  arr.allocate(nlelem * dash::size(), dash::BLOCKED);
+
+  T    * lbegin = arr.lbegin();
+  long   lsize  = arr.lsize();
+  #pragma omp parallel for schedule(static)
+  for (long i = 0; i < lsize; i++) {
+    lbegin[i] = 42;
   }
 
   dash::barrier();
+  TIMESTAMP(tinit);
+
+  long long sum = 0;
+  for (size_t r = 0; r < nread; r++) {
+    #pragma omp parallel for schedule(static) reduction(+:sum)
+    for (long i = 0; i < lsize; i++) {
+      sum += lbegin[i];
+    }
+  }
 
-  return true;
-}
+  dash::barrier();
+  TIMESTAMP(tstop);
+
+  if (sum != 42LL * lsize * nread) {
+    cerr << "Unit " << dash::myid() << ": invalid sum " << sum << endl;
+  }
 
+  *read_secs = tstop - tinit;
+  return tinit - tstart;
+}
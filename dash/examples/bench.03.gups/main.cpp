@@ -16,6 +16,7 @@
 #include <stdint.h>
 
 #include <iostream>
+#include <string>
 
 #include <libdash.h>
 
@@ -45,6 +46,7 @@ typedef struct benchmark_params_t {
   size_t num_updates;
   size_t rep_base;
   bool   verify;
+  dash::MemoryPages pages;
 } benchmark_params;
 
 using std::cout;
@@ -168,6 +170,7 @@ void perform_test(const benchmark_params & params)
   auto ts_init_start = Timer::Now();
 
   DASH_LOG_DEBUG("bench.gups", "Table.allocate()");
+  Table.set_memory_pages(params.pages);
   Table.allocate(params.size_base, dash::BLOCKED);
 
   if(dash::myid() == 0) {
@@ -183,6 +186,7 @@ void perform_test(const benchmark_params & params)
 #endif
     cout << setw(6)  << "units"     << ","
          << setw(12) << "size"      << ","
+         << setw(9)  << "pages"     << ","
          << setw(9)  << "mpi.impl"  << ","
          << setw(12) << "mb.total"  << ","
          << setw(12) << "mb.unit"   << ","
@@ -196,6 +200,7 @@ void perform_test(const benchmark_params & params)
          << endl;
     cout << setw(6)  << nunits           << ","
          << setw(12) << params.size_base << ","
+         << setw(9)  << params.pages     << ","
          << setw(9)  << mpi_impl         << ","
          << setw(12) << std::fixed << std::setprecision(2) << mb_total  << ","
          << setw(12) << std::fixed << std::setprecision(2) << mb_unit   << ","
@@ -283,6 +288,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.num_updates = NUPDATE;
   params.rep_base    = 1;
   params.verify      = false;
+  params.pages       = dash::MemoryPages::system;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -293,6 +299,12 @@ benchmark_params parse_args(int argc, char * argv[])
     } else if (flag == "-verify") {
       params.verify    = true;
       --i;
+    } else if (flag == "-pages") {
+      std::string pages = argv[i+1];
+      params.pages     = (pages == "huge")     ? dash::MemoryPages::huge
+                       : (pages == "huge_2mb") ? dash::MemoryPages::huge_2mb
+                       : (pages == "huge_1gb") ? dash::MemoryPages::huge_1gb
+                       : dash::MemoryPages::system;
     }
   }
   return params;
@@ -310,6 +322,7 @@ void print_params(
   bench_cfg.print_param("-sb",     "size base",    params.size_base);
   bench_cfg.print_param("-rb",     "rep. base",    params.rep_base);
   bench_cfg.print_param("-verify", "verification", params.verify);
+  bench_cfg.print_param("-pages",  "memory pages", params.pages);
   bench_cfg.print_section_end();
 }
 
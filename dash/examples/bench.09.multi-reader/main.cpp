@@ -34,7 +34,8 @@ void print_header() {
     cout<<setw(8)  << "REPEAT; ";
     cout<<setw(14) << "unit0 [sec]; ";
     cout<<setw(14) << "local [sec]; ";
-    cout<<setw(14) << "neigh [sec]";
+    cout<<setw(14) << "neigh [sec]; ";
+    cout<<setw(14) << "cached [sec]";
 		cout<<endl;
   }
 
@@ -49,6 +50,7 @@ void perform_test(size_t REPEAT)
   double duration_unit0;
   double duration_local;
   double duration_neigh;
+  double duration_cached;
 
   auto myid = dash::myid();
   auto size = dash::size();
@@ -86,12 +88,25 @@ void perform_test(size_t REPEAT)
   arr.barrier();
   duration_neigh = Timer::ElapsedSince(ts_start);
 
+  // Read-mostly access, remote values are fetched once:
+  arr.enable_read_cache();
+  arr.barrier();
+  ts_start = Timer::Now();
+  for (auto i = 0; i < REPEAT; i++) {
+    auto val = arr[(myid + 1) % size];
+    sum += val;
+  }
+  duration_cached = Timer::ElapsedSince(ts_start);
+  arr.barrier();
+  arr.disable_read_cache();
+
   if (dash::myid() == 0) {
     cout << setw(8)  << size   << ";";
     cout << setw(8)  << REPEAT << ";";
     cout << setw(14) << 1.0e-6 * duration_unit0 << ";";
     cout << setw(14) << 1.0e-6 * duration_local << ";";
-    cout << setw(14) << 1.0e-6 * duration_neigh << endl;
+    cout << setw(14) << 1.0e-6 * duration_neigh << ";";
+    cout << setw(14) << 1.0e-6 * duration_cached << endl;
   }
 }
 
@@ -93,6 +93,7 @@ typedef std::vector< std::pair< std::string, std::string > >
 
 typedef struct benchmark_params_t {
   std::string variant;
+  std::vector<dash::gemm_backend> gemm_backends;
   extent_t    size_base;
   extent_t    tilesize_base;
   bool        tilesize_fixed;
@@ -253,7 +254,16 @@ int main(int argc, char* argv[])
         repeats = 1;
       }
 
-      perform_test(variant, extent_run, exp, repeats, params);
+      if (variant == "dash") {
+        // Measure SUMMA with every selected local GEMM backend:
+        for (auto backend : params.gemm_backends) {
+          dash::util::Config::set("DASH_GEMM_BACKEND",
+                                  dash::gemm_backend_name(backend));
+          perform_test(variant, extent_run, exp, repeats, params);
+        }
+      } else {
+        perform_test(variant, extent_run, exp, repeats, params);
+      }
 
       repeats /= rep_base;
       if      (exp < 1) extent_base += 1;
@@ -287,6 +297,10 @@ void perform_test(
   auto   myid       = dash::myid();
   auto   num_units  = dash::size();
   auto   variant_id = variant;
+  if (variant == "dash") {
+    variant_id += std::string(".") +
+                  dash::gemm_backend_name(dash::summa_gemm_backend());
+  }
   double gflop      = static_cast<double>(n * n * n * 2) * 1.0e-9;
 
   dash::SizeSpec<2, extent_t> size_spec(n, n);
@@ -334,7 +348,9 @@ void perform_test(
   }
 
   if (myid == 0) {
-    if (iteration == 0) {
+    static bool header_printed = false;
+    if (!header_printed) {
+      header_printed = true;
       cout << "-- Pattern: " << dash::typestr(pattern) << endl
            << "--" << endl;
       // Print data set column headers:
@@ -347,7 +363,7 @@ void perform_test(
            << setw(11) << "tile"    << ", "
            << setw(6)  << "mem.mb"  << ", "
            << setw(10) << "mpi"     << ", "
-           << setw(10) << "impl"    << ", "
+           << setw(12) << "impl"    << ", "
            << setw(10) << "gflop/r" << ", "
            << setw(7)  << "peak.gf" << ", "
            << setw(7)  << "repeats" << ", "
@@ -388,7 +404,7 @@ void perform_test(
          << setw(11) << tilesize       << ", "
          << setw(6)  << mem_total_mb   << ", "
          << setw(10) << mpi_impl       << ", "
-         << setw(10) << variant_id     << ", "
+         << setw(12) << variant_id     << ", "
          << setw(10) << std::fixed << std::setprecision(2)
                      << gflop          << ", "
          << setw(7)  << gflops_peak    << ", "
@@ -1060,6 +1076,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.cpu_gflops_peak    = 41.4;
   params.mkl_dyn            = false;
   params.verify             = false;
+  std::string gemm_backend  = "all";
 
   extent_t size_base        = 0;
   extent_t num_units_inc    = 0;
@@ -1099,8 +1116,25 @@ benchmark_params parse_args(int argc, char * argv[])
       params.tilesize_base = static_cast<extent_t>(atoi(argv[i+1]));
     } else if (flag == "-tf") {
       params.tilesize_fixed = !!(atoi(argv[i+1]));
+    } else if (flag == "-gemm") {
+      gemm_backend    = argv[i+1];
+    }
+  }
+  for (auto backend : { dash::gemm_backend::builtin,
+                        dash::gemm_backend::blas }) {
+    if (!dash::gemm_backend_available(backend)) {
+      continue;
+    }
+    if (gemm_backend == "all" ||
+        gemm_backend == dash::gemm_backend_name(backend)) {
+      params.gemm_backends.push_back(backend);
     }
   }
+  if (params.variant == "dash" && params.gemm_backends.empty()) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "Local GEMM backend not available: -gemm " << gemm_backend);
+  }
   if (size_base == 0 && max_units > 0 && num_units_inc > 0) {
     size_base = num_units_inc;
     // Simple integer factorization by trial division:
@@ -1162,6 +1196,12 @@ void print_params(
 
   conf.print_section_start("Runtime arguments");
   conf.print_param("-s",      "variant",            params.variant);
+  std::string gemm_backends;
+  for (auto backend : params.gemm_backends) {
+    gemm_backends += std::string(gemm_backends.empty() ? "" : ",") +
+                     dash::gemm_backend_name(backend);
+  }
+  conf.print_param("-gemm",   "local GEMM",         gemm_backends);
   conf.print_param("-sb",     "size base",          params.size_base);
   conf.print_param("-tb",     "tilesize base",      params.tilesize_base);
   conf.print_param("-tf",     "fixed tilesize",     params.tilesize_fixed);
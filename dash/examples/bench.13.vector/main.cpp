@@ -1,83 +1,203 @@
-int main() {
-	return 0;
-}
-/*
-#include <chrono>
-#include <iostream>
+/**
+ * Measures the append throughput of dash::Vector for local and global
+ * push_back and the time to redistribute elements with
+ * dash::Vector::balance().
+ *
+ * Elements are appended in rounds of increasing size, every round ends
+ * with a commit of cached elements which grows the vector's capacity.
+ */
 
 #include <libdash.h>
 
-template <template<class> container_t>
-void nbody(unsigned int body_count, unsigned int step_count) {
-	struct vec3 {
-		double x,y,z;
-	};
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef int                         value_t;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef struct benchmark_params_t {
+  size_t   size_base;
+  size_t   exp_max;
+  unsigned repeat;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string op;
+  size_t      nelem;
+  double      time_append_us;
+  double      time_commit_us;
+  double      time_balance_us;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(const measurement & mes);
+
+measurement evaluate(
+  const std::string      & op,
+  size_t                   nelem,
+  const benchmark_params & params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
 
-	struct body_t {
-		vec3 pos;
-		double mass;
-	};
+  dash::util::BenchmarkParams bench_params("bench.13.vector");
+  bench_params.print_header();
+  bench_params.print_pinning();
 
-	container_t<body_t> bodies;
-	container_t<vec3> forces;
+  benchmark_params params = parse_args(argc, argv);
+  print_params(bench_params, params);
+  print_measurement_header();
 
-	for(unsigned int i = 0; i < body_count) {
-		bodys.lpush_back(body_t());
-		forces.lpush_back(vec3());
-	}
+  for (size_t exp = 0; exp <= params.exp_max; ++exp) {
+    size_t nelem = params.size_base * (1 << exp);
 
-	bodys.barrier();
+    print_measurement_record(evaluate("lpush_back", nelem, params));
+    print_measurement_record(evaluate("push_back",  nelem, params));
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+/**
+ * Appends \c nelem elements per unit, committing every time the local
+ * capacity is exhausted, then balances the vector.
+ * Times are averaged over repetitions, in microseconds.
+ */
+measurement evaluate(
+  const std::string      & op,
+  size_t                   nelem,
+  const benchmark_params & params)
+{
+  measurement mes;
+  mes.op              = op;
+  mes.nelem           = nelem;
+  mes.time_append_us  = 0;
+  mes.time_commit_us  = 0;
+  mes.time_balance_us = 0;
+
+  bool global = (op == "push_back");
+
+  for (unsigned r = 0; r < params.repeat; ++r) {
+    dash::Vector<value_t> vec;
+    dash::barrier();
+
+    auto ts_start = Timer::Now();
+    for (size_t i = 0; i < nelem; ++i) {
+      if (global) {
+        vec.push_back(static_cast<value_t>(i));
+      } else {
+        vec.lpush_back(static_cast<value_t>(i));
+      }
+    }
+    mes.time_append_us += Timer::ElapsedSince(ts_start);
+
+    ts_start = Timer::Now();
+    vec.commit();
+    vec.barrier();
+    mes.time_commit_us += Timer::ElapsedSince(ts_start);
+
+    ts_start = Timer::Now();
+    vec.balance();
+    mes.time_balance_us += Timer::ElapsedSince(ts_start);
+  }
+  mes.time_append_us  /= params.repeat;
+  mes.time_commit_us  /= params.repeat;
+  mes.time_balance_us /= params.repeat;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw(10) << "op"         << ","
+         << std::setw(10) << "nelem"      << ","
+         << std::setw(12) << "append.us"  << ","
+         << std::setw(12) << "commit.us"  << ","
+         << std::setw(12) << "balance.us" << ","
+         << std::setw(10) << "mops"
+         << endl;
+  }
+}
+
+void print_measurement_record(const measurement & mes)
+{
+  if (dash::myid() == 0) {
+    double time_us = mes.time_append_us + mes.time_commit_us;
+    double mops    = static_cast<double>(mes.nelem) * dash::size()
+                     / time_us;
+    cout << std::right
+         << std::setw( 5) << dash::size() << ","
+         << std::setw(10) << mes.op       << ","
+         << std::setw(10) << mes.nelem    << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.time_append_us
+         << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.time_commit_us
+         << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.time_balance_us
+         << ","
+         << std::fixed << setprecision(2) << setw(10) << mops
+         << endl;
+  }
+}
 
-	for(auto foce : forces.lbegin()) {
-		for(auto body : bodies) {
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base = 1024;
+  params.exp_max   = 10;
+  params.repeat    = 5;
 
-		}
-	}
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base = atoi(argv[i+1]);
+    } else if (flag == "-nmax") {
+      params.exp_max   = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat    = atoi(argv[i+1]);
+    }
+  }
+  return params;
 }
 
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
 
-int main(int argc, char* argv[]) {
-	dash::init(&argc, &argv);
-
-	auto& team = dash::Team::All();
-
-	if(team.myid() == 0) std::cout << "timing" << std::endl;
-	{
-		for(int i = 1; i < 1000000; i *= 10) {
-			dash::Vector<int> vec(1);
-			auto begin = std::chrono::high_resolution_clock::now();
-			for(int ii = 0; ii < i; ii++) {
-				if(team.myid() == 0) {
-					vec.lpush_back(ii);
-				}
-			}
-			vec.barrier();
-			auto end = std::chrono::high_resolution_clock::now();
-			if(team.myid() == 0) {
-				std::cout << "push_backs " << i << "; time " << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << "us" << std::endl;
-			}
-		}
-	}
-
-	if(team.myid() == 0) std::cout << "timing with balancing" << std::endl;
-	{
-		for(int i = 1; i < 1000000; i *= 10) {
-			dash::Vector<int> vec(1);
-			auto begin = std::chrono::high_resolution_clock::now();
-			for(int ii = 0; ii < i; ii++) {
-				if(team.myid() == 0) {
-					vec.lpush_back(ii);
-				}
-			}
-			vec.balance();
-			auto end = std::chrono::high_resolution_clock::now();
-			if(team.myid() == 0) {
-				std::cout << "push_backs " << i << "; time " << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << "us" << std::endl;
-			}
-		}
-	}
-
-	dash::finalize();
-	return 0;
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-sb",   "elements per unit base", params.size_base);
+  bench_cfg.print_param("-nmax", "max. size exponent",     params.exp_max);
+  bench_cfg.print_param("-r",    "repetitions",            params.repeat);
+  bench_cfg.print_section_end();
 }
-*/
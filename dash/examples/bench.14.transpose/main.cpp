@@ -0,0 +1,233 @@
+/**
+ * Measures the performance of distributed matrix transposition
+ * with dash::transpose.
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef double                      value_t;
+typedef dash::default_index_t       index_t;
+typedef dash::default_extent_t      extent_t;
+typedef dash::TilePattern<2>        tile_pattern_t;
+typedef dash::Pattern<2>            block_pattern_t;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef struct benchmark_params_t {
+  extent_t size_base;
+  extent_t exp_max;
+  extent_t tilesize;
+  unsigned repeat;
+  bool     verify;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string variant;
+  extent_t    size;
+  double      time_plan_s;
+  double      time_transpose_s;
+  double      gb_per_s;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(const measurement & mes);
+
+template <class SrcMatrixT, class DstMatrixT>
+measurement evaluate(
+  const std::string      & variant,
+  SrcMatrixT             & src,
+  DstMatrixT             & dst,
+  const benchmark_params & params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.14.transpose");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  dash::TeamSpec<2> teamspec(dash::size(), 1);
+  teamspec.balance_extents();
+
+  for (extent_t exp = 0; exp <= params.exp_max; ++exp) {
+    extent_t n = params.size_base * (1 << exp) *
+                 teamspec.extent(0) * teamspec.extent(1);
+    {
+      tile_pattern_t pattern(
+        dash::SizeSpec<2>(n, n),
+        dash::DistributionSpec<2>(dash::TILE(params.tilesize),
+                                  dash::TILE(params.tilesize)),
+        teamspec);
+      dash::Matrix<value_t, 2, index_t, tile_pattern_t> src(pattern);
+      dash::Matrix<value_t, 2, index_t, tile_pattern_t> dst(pattern);
+      print_measurement_record(evaluate("tile", src, dst, params));
+      print_measurement_record(evaluate("tile.inplace", src, src, params));
+    }
+    {
+      block_pattern_t pattern(
+        dash::SizeSpec<2>(n, n),
+        dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+        dash::TeamSpec<2>(dash::size(), 1));
+      dash::Matrix<value_t, 2, index_t, block_pattern_t> src(pattern);
+      dash::Matrix<value_t, 2, index_t, block_pattern_t> dst(pattern);
+      print_measurement_record(evaluate("rows", src, dst, params));
+    }
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+template <class SrcMatrixT, class DstMatrixT>
+measurement evaluate(
+  const std::string      & variant,
+  SrcMatrixT             & src,
+  DstMatrixT             & dst,
+  const benchmark_params & params)
+{
+  measurement mes;
+  mes.variant = variant;
+  mes.size    = src.extent(0);
+
+  auto & pattern = src.pattern();
+  for (extent_t l = 0; l < pattern.local_size(); ++l) {
+    src.lbegin()[l] = static_cast<value_t>(l);
+  }
+  src.barrier();
+
+  auto ts_plan = Timer::Now();
+  auto plan    = dash::make_transpose_plan(src, dst);
+  mes.time_plan_s = Timer::ElapsedSince(ts_plan) * 1.0e-6;
+
+  dash::barrier();
+  auto ts_transpose = Timer::Now();
+  for (unsigned r = 0; r < params.repeat; ++r) {
+    dash::transpose(src, dst, plan);
+  }
+  mes.time_transpose_s = Timer::ElapsedSince(ts_transpose) * 1.0e-6
+                         / params.repeat;
+  // Every element is read and written once:
+  mes.gb_per_s = 2.0 * mes.size * mes.size * sizeof(value_t)
+                 / mes.time_transpose_s * 1.0e-9;
+
+  if (params.verify && &src != &dst) {
+    // Second transposition must restore the original values
+    dash::transpose(dst, src);
+    for (extent_t l = 0; l < pattern.local_size(); ++l) {
+      if (src.lbegin()[l] != static_cast<value_t>(l)) {
+        DASH_THROW(dash::exception::RuntimeError,
+                   "bench.14.transpose: verification failed for "
+                   "local element " << l);
+      }
+    }
+  }
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"       << ","
+         << std::setw(14) << "variant"     << ","
+         << std::setw( 8) << "n"           << ","
+         << std::setw(12) << "mem.mb"      << ","
+         << std::setw(10) << "plan.s"      << ","
+         << std::setw(12) << "transpose.s" << ","
+         << std::setw(10) << "gb/s"
+         << endl;
+  }
+}
+
+void print_measurement_record(const measurement & mes)
+{
+  if (dash::myid() == 0) {
+    double mem_mb = static_cast<double>(mes.size) * mes.size *
+                    sizeof(value_t) / (1024 * 1024);
+    cout << std::right
+         << std::setw( 5) << dash::size() << ","
+         << std::setw(14) << mes.variant  << ","
+         << std::setw( 8) << mes.size     << ","
+         << std::fixed << setprecision(2) << setw(12) << mem_mb << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_plan_s
+         << ","
+         << std::fixed << setprecision(4) << setw(12)
+         << mes.time_transpose_s << ","
+         << std::fixed << setprecision(2) << setw(10) << mes.gb_per_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base = 64;
+  params.exp_max   = 4;
+  params.tilesize  = 32;
+  params.repeat    = 10;
+  params.verify    = false;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base = atoi(argv[i+1]);
+    } else if (flag == "-nmax") {
+      params.exp_max   = atoi(argv[i+1]);
+    } else if (flag == "-ts") {
+      params.tilesize  = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat    = atoi(argv[i+1]);
+    } else if (flag == "-verify") {
+      params.verify    = true;
+      --i;
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-sb",     "matrix size base per unit",
+                        params.size_base);
+  bench_cfg.print_param("-nmax",   "max. size exponent", params.exp_max);
+  bench_cfg.print_param("-ts",     "tile size",          params.tilesize);
+  bench_cfg.print_param("-r",      "repetitions",        params.repeat);
+  bench_cfg.print_param("-verify", "verification",       params.verify);
+  bench_cfg.print_section_end();
+}
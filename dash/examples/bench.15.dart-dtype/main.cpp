@@ -0,0 +1,297 @@
+/**
+ * Measures the performance of dart_get and dart_put with strided and
+ * indexed data types between units sharing memory, comparing direct
+ * copies in shared memory windows with MPI RMA.
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef double                      value_t;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef struct benchmark_params_t {
+  size_t   size_base;
+  size_t   exp_max;
+  size_t   blocklen;
+  size_t   stride;
+  unsigned repeat;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string variant;
+  std::string op;
+  size_t      nelem;
+  double      time_shm_us;
+  double      time_mpi_us;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(const measurement & mes);
+
+measurement evaluate(
+  const std::string      & variant,
+  const std::string      & op,
+  dart_gptr_t              gptr,
+  std::vector<value_t>   & buf,
+  size_t                   nelem,
+  dart_datatype_t          remote_type,
+  dart_datatype_t          local_type,
+  const benchmark_params & params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.15.dart-dtype");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  auto dtype = dash::dart_datatype<value_t>::value;
+
+  for (size_t exp = 0; exp <= params.exp_max; ++exp) {
+    size_t nblocks = params.size_base * (1 << exp);
+    size_t nelem   = nblocks * params.blocklen;
+    size_t nlocal  = nblocks * params.stride;
+
+    dart_gptr_t gptr;
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(DART_TEAM_ALL, nlocal, dtype, &gptr),
+      DART_OK);
+    value_t * lptr;
+    gptr.unitid = dash::myid();
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr(gptr, (void **)&lptr), DART_OK);
+    for (size_t i = 0; i < nlocal; ++i) {
+      lptr[i] = static_cast<value_t>(i);
+    }
+    // Access the memory of the right neighbor:
+    gptr.unitid = (dash::myid() + 1) % dash::size();
+
+    std::vector<value_t> buf(nlocal);
+
+    dart_datatype_t strided_type;
+    DASH_ASSERT_RETURNS(
+      dart_type_create_strided(dtype, params.stride, params.blocklen,
+                               &strided_type),
+      DART_OK);
+
+    // Indexed type selecting the same blocks as the strided type in
+    // reverse order:
+    std::vector<size_t> blocklens(nblocks, params.blocklen);
+    std::vector<size_t> offsets(nblocks);
+    for (size_t b = 0; b < nblocks; ++b) {
+      offsets[b] = (nblocks - b - 1) * params.stride;
+    }
+    dart_datatype_t indexed_type;
+    DASH_ASSERT_RETURNS(
+      dart_type_create_indexed(dtype, nblocks, blocklens.data(),
+                               offsets.data(), &indexed_type),
+      DART_OK);
+
+    dash::barrier();
+
+    print_measurement_record(
+      evaluate("strided", "get", gptr, buf, nelem,
+               strided_type, dtype, params));
+    print_measurement_record(
+      evaluate("strided", "put", gptr, buf, nelem,
+               strided_type, dtype, params));
+    print_measurement_record(
+      evaluate("indexed", "get", gptr, buf, nelem,
+               indexed_type, dtype, params));
+    print_measurement_record(
+      evaluate("indexed", "put", gptr, buf, nelem,
+               indexed_type, dtype, params));
+    print_measurement_record(
+      evaluate("strided2", "get", gptr, buf, nelem,
+               strided_type, strided_type, params));
+
+    dash::barrier();
+
+    dart_type_destroy(&strided_type);
+    dart_type_destroy(&indexed_type);
+    gptr.unitid = 0;
+    DASH_ASSERT_RETURNS(dart_team_memfree(gptr), DART_OK);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+/**
+ * Time of a single transfer in microseconds, averaged over repetitions.
+ */
+double measure(
+  const std::string      & op,
+  dart_gptr_t              gptr,
+  std::vector<value_t>   & buf,
+  size_t                   nelem,
+  dart_datatype_t          remote_type,
+  dart_datatype_t          local_type,
+  const benchmark_params & params)
+{
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < params.repeat; ++r) {
+    if (op == "get") {
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(buf.data(), gptr, nelem, remote_type, local_type),
+        DART_OK);
+    } else {
+      DASH_ASSERT_RETURNS(
+        dart_put_blocking(gptr, buf.data(), nelem, local_type, remote_type),
+        DART_OK);
+    }
+  }
+  double elapsed = Timer::ElapsedSince(ts_start) / params.repeat;
+  dash::barrier();
+  return elapsed;
+}
+
+measurement evaluate(
+  const std::string      & variant,
+  const std::string      & op,
+  dart_gptr_t              gptr,
+  std::vector<value_t>   & buf,
+  size_t                   nelem,
+  dart_datatype_t          remote_type,
+  dart_datatype_t          local_type,
+  const benchmark_params & params)
+{
+  measurement mes;
+  mes.variant = variant;
+  mes.op      = op;
+  mes.nelem   = nelem;
+
+  dart_config_t * config;
+  dart_config(&config);
+  int shmem_dtype_copy = config->shmem_dtype_copy;
+
+  config->shmem_dtype_copy = 1;
+  mes.time_shm_us = measure(op, gptr, buf, nelem,
+                            remote_type, local_type, params);
+  config->shmem_dtype_copy = 0;
+  mes.time_mpi_us = measure(op, gptr, buf, nelem,
+                            remote_type, local_type, params);
+
+  config->shmem_dtype_copy = shmem_dtype_copy;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"    << ","
+         << std::setw(10) << "variant"  << ","
+         << std::setw( 4) << "op"       << ","
+         << std::setw(10) << "nelem"    << ","
+         << std::setw(10) << "kb"       << ","
+         << std::setw(12) << "shm.us"   << ","
+         << std::setw(12) << "mpi.us"   << ","
+         << std::setw(10) << "shm.mb/s" << ","
+         << std::setw(10) << "mpi.mb/s" << ","
+         << std::setw( 8) << "speedup"
+         << endl;
+  }
+}
+
+void print_measurement_record(const measurement & mes)
+{
+  if (dash::myid() == 0) {
+    double mb = static_cast<double>(mes.nelem) * sizeof(value_t)
+                / (1024 * 1024);
+    cout << std::right
+         << std::setw( 5) << dash::size() << ","
+         << std::setw(10) << mes.variant  << ","
+         << std::setw( 4) << mes.op       << ","
+         << std::setw(10) << mes.nelem    << ","
+         << std::fixed << setprecision(1) << setw(10) << mb * 1024 << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.time_shm_us
+         << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.time_mpi_us
+         << ","
+         << std::fixed << setprecision(1) << setw(10)
+         << mb / (mes.time_shm_us * 1.0e-6) << ","
+         << std::fixed << setprecision(1) << setw(10)
+         << mb / (mes.time_mpi_us * 1.0e-6) << ","
+         << std::fixed << setprecision(2) << setw(8)
+         << mes.time_mpi_us / mes.time_shm_us
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base = 64;
+  params.exp_max   = 10;
+  params.blocklen  = 1;
+  params.stride    = 4;
+  params.repeat    = 100;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base = atoi(argv[i+1]);
+    } else if (flag == "-nmax") {
+      params.exp_max   = atoi(argv[i+1]);
+    } else if (flag == "-bl") {
+      params.blocklen  = atoi(argv[i+1]);
+    } else if (flag == "-s") {
+      params.stride    = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat    = atoi(argv[i+1]);
+    }
+  }
+  if (params.stride < params.blocklen) {
+    params.stride = params.blocklen;
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-sb",   "number of blocks base", params.size_base);
+  bench_cfg.print_param("-nmax", "max. size exponent",    params.exp_max);
+  bench_cfg.print_param("-bl",   "block length",          params.blocklen);
+  bench_cfg.print_param("-s",    "stride",                params.stride);
+  bench_cfg.print_param("-r",    "repetitions",           params.repeat);
+  bench_cfg.print_section_end();
+}
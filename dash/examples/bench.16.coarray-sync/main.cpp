@@ -0,0 +1,211 @@
+/**
+ * Measures the latency of dash::coarray::sync_images with the left and
+ * right neighbor, comparing the one-sided implementation on event
+ * counters with two-sided synchronization over a root image.
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef struct benchmark_params_t {
+  unsigned repeat;
+  unsigned rounds;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string op;
+  double      time_onesided_us;
+  double      time_twosided_us;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(const measurement & mes);
+
+measurement evaluate_sync_images(const benchmark_params & params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.16.coarray-sync");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  // allocates the event counters of sync_images:
+  dash::coarray::sync_all();
+
+  for (unsigned r = 0; r < params.rounds; ++r) {
+    print_measurement_record(evaluate_sync_images(params));
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+/**
+ * Synchronization of the given images with two-sided messages over the
+ * image with the smallest id, the previous implementation of
+ * dash::coarray::sync_images.
+ */
+void sync_images_twosided(const std::vector<int> & image_ids)
+{
+  int  myid   = dash::myid();
+  int  root   = *std::min_element(image_ids.begin(), image_ids.end());
+  int  tag    = DART_TAG_SYNC_IMAGES;
+  char buffer = 0;
+
+  if (myid == root) {
+    for (auto el : image_ids) {
+      if (el != root) {
+        dart_recv(&buffer, 1, DART_TYPE_BYTE, tag, dash::global_unit_t{el});
+      }
+    }
+    for (auto el : image_ids) {
+      if (el != root) {
+        dart_send(&buffer, 1, DART_TYPE_BYTE, tag, dash::global_unit_t{el});
+      }
+    }
+  } else {
+    dart_send(&buffer, 1, DART_TYPE_BYTE, tag, dash::global_unit_t{root});
+    dart_recv(&buffer, 1, DART_TYPE_BYTE, tag, dash::global_unit_t{root});
+  }
+}
+
+/**
+ * Time of a single synchronization with the left and right neighbor in
+ * microseconds, averaged over repetitions.
+ * The two-sided variant synchronizes pairs of images as two images
+ * cannot be synchronized with different roots without deadlock.
+ */
+measurement evaluate_sync_images(const benchmark_params & params)
+{
+  measurement mes;
+  mes.op = "sync_images";
+
+  int myid   = dash::myid();
+  int nunits = dash::size();
+  std::vector<int> neighbors {
+    (myid + nunits - 1) % nunits,
+    myid,
+    (myid + 1) % nunits
+  };
+
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < params.repeat; ++r) {
+    dash::coarray::sync_images(neighbors);
+  }
+  mes.time_onesided_us = Timer::ElapsedSince(ts_start) / params.repeat;
+
+  // Pairs (0,1), (2,3), ... and (1,2), (3,4), ... in alternating steps,
+  // synchronizing every image with both neighbors:
+  std::vector<int> even_pair { myid - (myid % 2), myid - (myid % 2) + 1 };
+  std::vector<int> odd_pair  { myid - ((myid + 1) % 2),
+                               myid - ((myid + 1) % 2) + 1 };
+  bool has_even = even_pair[1] < nunits;
+  bool has_odd  = odd_pair[0] >= 0 && odd_pair[1] < nunits;
+
+  dash::barrier();
+  ts_start = Timer::Now();
+  for (unsigned r = 0; r < params.repeat; ++r) {
+    if (has_even) {
+      sync_images_twosided(even_pair);
+    }
+    if (has_odd) {
+      sync_images_twosided(odd_pair);
+    }
+  }
+  mes.time_twosided_us = Timer::ElapsedSince(ts_start) / params.repeat;
+  dash::barrier();
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"        << ","
+         << std::setw(12) << "op"           << ","
+         << std::setw(12) << "onesided.us"  << ","
+         << std::setw(12) << "twosided.us"  << ","
+         << std::setw( 8) << "speedup"
+         << endl;
+  }
+}
+
+void print_measurement_record(const measurement & mes)
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << dash::size() << ","
+         << std::setw(12) << mes.op       << ","
+         << std::fixed << setprecision(2) << setw(12)
+         << mes.time_onesided_us << ","
+         << std::fixed << setprecision(2) << setw(12)
+         << mes.time_twosided_us << ","
+         << std::fixed << setprecision(2) << setw(8)
+         << mes.time_twosided_us / mes.time_onesided_us
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.repeat = 1000;
+  params.rounds = 3;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.repeat = atoi(argv[i+1]);
+    } else if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r", "repetitions", params.repeat);
+  bench_cfg.print_param("-n", "rounds",      params.rounds);
+  bench_cfg.print_section_end();
+}
@@ -18,6 +18,7 @@
 #include <dash/algorithm/Transform.h>
 #include <dash/algorithm/Accumulate.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/CopyStream.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/AllOf.h>
@@ -25,6 +26,8 @@
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
 
+#include <dash/algorithm/Redistribute.h>
+#include <dash/algorithm/Transpose.h>
 #include <dash/algorithm/SUMMA.h>
 
 #endif // DASH__ALGORITHM_H_
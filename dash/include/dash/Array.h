@@ -7,6 +7,8 @@
 #include <dash/Cartesian.h>
 #include <dash/Dimensional.h>
 #include <dash/memory/GlobStaticMem.h>
+#include <dash/memory/MemoryPlacement.h>
+#include <dash/memory/ReadCache.h>
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
 #include <dash/Shared.h>
@@ -740,6 +742,12 @@ private:
   team_unit_t          m_myid;
   /// Whether or not the array was actually allocated
   bool                 m_registered = false;
+  /// Cache of remote elements read by the calling unit
+  std::unique_ptr<ReadCache> m_read_cache;
+  /// Placement policy of local memory in allocations
+  MemoryPlacement      m_placement  = MemoryPlacement::system;
+  /// Kind of pages backing local memory in allocations
+  MemoryPages          m_pages      = MemoryPages::system;
 
 public:
   /**
@@ -905,11 +913,16 @@ public:
     m_lsize(other.m_lsize),
     m_lcapacity(other.m_lcapacity),
     m_lbegin(other.m_lbegin),
-    m_lend(other.m_lend) {
+    m_lend(other.m_lend),
+    m_read_cache(std::move(other.m_read_cache)),
+    m_placement(other.m_placement),
+    m_pages(other.m_pages) {
 
     other.m_globmem = nullptr;
     other.m_lbegin  = nullptr;
     other.m_lend    = nullptr;
+    // Global iterators must refer to the pattern of this instance:
+    rebind_iterators();
     // Register deallocator of this array instance at the team
     // instance that has been used to initialized it:
     m_team->register_deallocator(
@@ -961,10 +974,15 @@ public:
     this->m_pattern   = std::move(other.m_pattern);
     this->m_size      = other.m_size;
     this->m_team      = other.m_team;
+    this->m_read_cache = std::move(other.m_read_cache);
+    this->m_placement  = other.m_placement;
+    this->m_pages      = other.m_pages;
 
     other.m_globmem = nullptr;
     other.m_lbegin  = nullptr;
     other.m_lend    = nullptr;
+    // Global iterators must refer to the pattern of this instance:
+    rebind_iterators();
 
     // Re-register deallocator of this array instance at the team
     // instance that has been used to initialized it:
@@ -1246,6 +1264,92 @@ public:
     m_globmem->flush();
   }
 
+  /**
+   * Cache remote elements read by the calling unit via global references
+   * and iterators, replaces a previously enabled cache.
+   *
+   * Local operation, elements written by other units must be published
+   * before the cache is enabled.
+   *
+   * \see  dash::ReadCache
+   */
+  void enable_read_cache(
+    const ReadCacheConfig & config = ReadCacheConfig())
+  {
+    m_read_cache.reset();
+    m_read_cache.reset(
+      new ReadCache(m_globmem->begin().dart_gptr(),
+                    m_globmem->local_size() * sizeof(value_type),
+                    config));
+  }
+
+  /**
+   * Discard the read cache of the calling unit.
+   */
+  void disable_read_cache()
+  {
+    m_read_cache.reset();
+  }
+
+  /**
+   * The read cache of the calling unit, or \c nullptr if no read cache
+   * has been enabled.
+   */
+  inline ReadCache * read_cache() const noexcept
+  {
+    return m_read_cache.get();
+  }
+
+  /**
+   * Placement policy of the pages of local memory in subsequent
+   * allocations, for delayed allocation.
+   *
+   * Example:
+   *
+   * \code
+   *   dash::Array<double> a;
+   *   a.set_memory_placement(dash::MemoryPlacement::first_touch_parallel);
+   *   a.allocate(nelem);
+   * \endcode
+   *
+   * \see  dash::MemoryPlacement
+   */
+  void set_memory_placement(MemoryPlacement placement) noexcept
+  {
+    m_placement = placement;
+  }
+
+  /**
+   * Placement policy of the pages of local memory.
+   */
+  inline MemoryPlacement memory_placement() const noexcept
+  {
+    return m_placement;
+  }
+
+  /**
+   * Kind of pages backing local memory in subsequent allocations, for
+   * delayed allocation.
+   *
+   * Huge pages reduce TLB misses of random accesses to large arrays.
+   * Local memory backed by huge pages is not allocated in shared memory
+   * windows, elements of units at the same node are accessed via MPI.
+   *
+   * \see  dash::MemoryPages
+   */
+  void set_memory_pages(MemoryPages pages) noexcept
+  {
+    m_pages = pages;
+  }
+
+  /**
+   * Kind of pages backing local memory.
+   */
+  inline MemoryPages memory_pages() const noexcept
+  {
+    return m_pages;
+  }
+
   /**
    * Complete all outstanding non-blocking operations to the specified unit
    * on the array's underlying global memory.
@@ -1378,6 +1482,9 @@ public:
       m_team->unregister_deallocator(
         this, std::bind(&Array::deallocate, this));
     }
+    // The segment id of the cached memory may be reused by subsequent
+    // allocations:
+    m_read_cache.reset();
     // Actual destruction of the array instance:
     DASH_LOG_TRACE_VAR("Array.deallocate()", m_globmem.get());
     if (m_globmem != nullptr) {
@@ -1411,7 +1518,12 @@ public:
     // Allocate local memory of identical size on every unit:
     DASH_LOG_TRACE_VAR("Array._allocate", m_lcapacity);
     DASH_LOG_TRACE_VAR("Array._allocate", m_lsize);
-    m_globmem   = PtrGlobMemType_t(new glob_mem_type(m_lcapacity, *m_team));
+    m_globmem   = PtrGlobMemType_t(
+                    (m_placement == MemoryPlacement::system &&
+                     m_pages     == MemoryPages::system)
+                    ? new glob_mem_type(m_lcapacity, *m_team)
+                    : new glob_mem_type(m_lcapacity, *m_team,
+                                        m_placement, m_pages));
     // Global iterators:
     m_begin     = iterator(m_globmem.get(), m_pattern);
     m_end       = iterator(m_begin) + m_size;
@@ -1491,6 +1603,20 @@ private:
     return true;
   }
 
+  /**
+   * Recreates global iterators after the pattern and global memory have
+   * been moved from another instance, iterators reference the pattern
+   * of the instance that created them.
+   */
+  void rebind_iterators()
+  {
+    if (m_globmem == nullptr) {
+      return;
+    }
+    m_begin = iterator(m_globmem.get(), m_pattern);
+    m_end   = iterator(m_begin) + m_size;
+  }
+
 };
 
 } // namespace dash
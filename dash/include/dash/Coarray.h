@@ -18,6 +18,7 @@
 #include <dash/Dimensional.h>
 
 #include <dash/atomic/Type_traits.h>
+#include <dash/coarray/Sync.h>
 
 /**
  * \defgroup DashCoarrayConcept  Coarray Concept
@@ -454,8 +455,13 @@ public:
   /**
    * Blocks until all team members of this container have reached the statement
    * and flushes the memory.
+   * For coarrays of \c dash::Team::All, the first call allocates the event
+   * counters used by \c dash::coarray::sync_images.
    */
   inline void sync_all() {
+    if (_storage.team() == dash::Team::All()) {
+      dash::coarray::internal::sync_init();
+    }
     _storage.barrier();
   }
 
@@ -11,9 +11,22 @@
 
 #include <dash/coarray/CoEventIter.h>
 #include <dash/coarray/CoEventRef.h>
+#include <dash/coarray/CoEventCounter.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <vector>
 
 namespace dash {
 
+template <class CoeventIter>
+CoeventIter wait_any(CoeventIter first, CoeventIter last, int count = 1);
+
+template <class CoeventIter>
+void wait_all(CoeventIter first, CoeventIter last, int count = 1);
+
 /**
  * \ingroup DashCoarrayConcept
  *
@@ -23,6 +36,10 @@ namespace dash {
  * Coevent can be used for point-to-point synchronization. Events can be posted
  * to any image. Waiting on non-local events is not supported.
  *
+ * Waiting units poll their event counter in local memory with exponential
+ * backoff, see \ref dash::coarray::CoEventBackoff. Use \ref dash::wait_any
+ * and \ref dash::wait_all to wait for events in several coevents.
+ *
  * \note Coevents might deadlock if multiple units are pinned to the same
  *       cpu-core. This is due to progress problems in MPI.
  *
@@ -91,25 +108,27 @@ public:
    * This function is thread-safe
    */
   inline void wait(int count = 1) {
-    auto gref = _event_counts.at(_team->myid().id);
-    int current;
-    do {
-#ifdef DASH_DEBUG
-      // avoid spamming the logs while busy waiting
-      DASH_LOG_DEBUG("waiting for event at gptr",
-                     static_cast<gptr_t>(_event_counts.begin()
-                                         +_team->myid().id));
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-#endif
-      current = gref.get();
-    } while (current < count);
-    // decrement the counter
-    gref.sub(count);
+    DASH_LOG_DEBUG("waiting for event at gptr",
+                   static_cast<gptr_t>(_event_counts.begin()
+                                       + _team->myid().id
+                                         * reference::num_counters));
+    coarray::internal::wait_events(lcounters(), gcounters(), count);
+  }
+
+  /**
+   * Consume a given number of incoming events if they have arrived,
+   * without waiting.
+   *
+   * \return  \c true if the events have been consumed
+   */
+  inline bool try_wait(int count = 1) {
+    int observed;
+    return try_consume(count, false, observed);
   }
 
   inline int test() {
     DASH_LOG_DEBUG("test for events on this unit");
-    return _event_counts.at(static_cast<int>(_team->myid())).load();
+    return coarray::internal::test_events(gcounters());
   }
 
   /**
@@ -119,7 +138,7 @@ public:
   inline void initialize(Team & team = dash::Team::All()) noexcept {
     if(!_is_initialized){
       _team = &team;
-      _event_counts.allocate(_team->size());
+      _event_counts.allocate(_team->size() * reference::num_counters);
       dash::fill(_event_counts.begin(), _event_counts.end(), 0);
       _event_counts.barrier();
       _is_initialized = true;
@@ -135,7 +154,8 @@ public:
    */
   inline reference operator()(const int & unit) noexcept {
     DASH_ASSERT_MSG(dash::is_initialized(), "DASH is not initialized");
-    auto ptr = static_cast<gptr_t>(_event_counts.begin() + unit);
+    auto ptr = static_cast<gptr_t>(_event_counts.begin()
+                                   + unit * reference::num_counters);
     return reference(ptr);
   }
 
@@ -146,11 +166,136 @@ public:
     return this->operator()(static_cast<int>(unit));
   }
 
+private:
+  /**
+   * Native pointer to the event counters of the calling unit.
+   */
+  inline int * lcounters() {
+    return reinterpret_cast<int *>(_event_counts.lbegin());
+  }
+
+  /**
+   * Global pointer to the event counters of the calling unit.
+   */
+  inline dart_gptr_t gcounters() {
+    return static_cast<gptr_t>(
+             _event_counts.begin()
+             + _team->myid().id * reference::num_counters).dart_gptr();
+  }
+
+  /**
+   * Consume \c count events if they have arrived.
+   *
+   * \see dash::coarray::internal::consume_events
+   */
+  inline bool try_consume(int count, bool sync, int & observed) {
+    return coarray::internal::consume_events(
+             lcounters(), gcounters(), count, sync, observed);
+  }
+
+  template <class CoeventIter>
+  friend CoeventIter wait_any(CoeventIter, CoeventIter, int);
+  template <class CoeventIter>
+  friend void wait_all(CoeventIter, CoeventIter, int);
+
 private:
   Team * _team;
   bool   _is_initialized = false;
 };
 
+/**
+ * Wait until \c count events have arrived in any of the coevents in the
+ * range \c [first, last) and consume them.
+ *
+ * \return  Iterator to the coevent whose events have been consumed
+ *
+ * \ingroup DashCoarrayConcept
+ */
+template <class CoeventIter>
+CoeventIter wait_any(CoeventIter first, CoeventIter last, int count) {
+  if (first == last) {
+    return last;
+  }
+  coarray::CoEventBackoff backoff;
+  int observed;
+  while (true) {
+    bool sync = backoff.progress();
+    for (auto it = first; it != last; ++it) {
+      Coevent & event = *it;
+      if (event.try_consume(count, sync, observed)) {
+        return it;
+      }
+    }
+    backoff.pause();
+  }
+}
+
+/**
+ * Wait until \c count events have arrived in every coevent in the range
+ * \c [first, last) and consume them.
+ * Events are consumed in every coevent as soon as they have arrived.
+ *
+ * \ingroup DashCoarrayConcept
+ */
+template <class CoeventIter>
+void wait_all(CoeventIter first, CoeventIter last, int count) {
+  std::vector<CoeventIter> pending;
+  for (auto it = first; it != last; ++it) {
+    pending.push_back(it);
+  }
+  coarray::CoEventBackoff backoff;
+  int observed;
+  while (!pending.empty()) {
+    bool sync = backoff.progress();
+    auto npending = pending.size();
+    pending.erase(
+      std::remove_if(pending.begin(), pending.end(),
+        [&](const CoeventIter & it) {
+          Coevent & event = *it;
+          return event.try_consume(count, sync, observed);
+        }),
+      pending.end());
+    if (!pending.empty() && pending.size() == npending) {
+      backoff.pause();
+    }
+  }
+}
+
+/**
+ * Wait until \c count events have arrived in any of the given coevents
+ * and consume them.
+ *
+ * Example:
+ *
+ * \code
+ * Coevent left, right;
+ * // ...
+ * auto idx = dash::wait_any({ left, right });
+ * \endcode
+ *
+ * \return  Index of the coevent whose events have been consumed
+ *
+ * \ingroup DashCoarrayConcept
+ */
+inline std::size_t wait_any(
+  std::initializer_list<std::reference_wrapper<Coevent>> events,
+  int count = 1) {
+  return static_cast<std::size_t>(
+           wait_any(events.begin(), events.end(), count) - events.begin());
+}
+
+/**
+ * Wait until \c count events have arrived in every given coevent and
+ * consume them.
+ *
+ * \ingroup DashCoarrayConcept
+ */
+inline void wait_all(
+  std::initializer_list<std::reference_wrapper<Coevent>> events,
+  int count = 1) {
+  wait_all(events.begin(), events.end(), count);
+}
+
 } // namespace dash
 
 #endif /* DASH__COEVENT_H__INCLUDED */
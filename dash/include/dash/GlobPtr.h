@@ -487,6 +487,23 @@ public:
     return nullptr;
   }
 
+  /**
+   * Conversion to a native pointer to memory of the calling unit or of
+   * a unit on the same node.
+   *
+   * \returns  A native pointer to the element referenced by this GlobPtr
+   *           instance if it can be accessed with plain loads and stores,
+   *           or \c nullptr if the referenced element is located on
+   *           another node.
+   */
+  value_type * node_local() const {
+    void *addr = 0;
+    if (dart_gptr_getaddr_shared(_rbegin_gptr, &addr) == DART_OK) {
+      return static_cast<value_type*>(addr);
+    }
+    return nullptr;
+  }
+
   /**
    * Set the global pointer's associated unit.
    */
@@ -505,6 +522,15 @@ public:
     return dash::internal::is_local(_rbegin_gptr);
   }
 
+  /**
+   * Check whether the global pointer references memory that is
+   * accessible with plain loads and stores, i.e. memory of the calling
+   * unit or of a unit on the same node.
+   */
+  bool is_node_local() const {
+    return node_local() != nullptr;
+  }
+
 private:
   void increment(size_type offs) {
     auto ptr_offset = _rbegin_gptr.addr_or_offs.offset / sizeof(value_type);
@@ -662,6 +688,14 @@ class GlobConstPtr
     return base_t::is_local();
   }
 
+  const value_type * node_local() const {
+    return base_t::node_local();
+  }
+
+  bool is_node_local() const {
+    return base_t::is_node_local();
+  }
+
   explicit constexpr operator dart_gptr_t() const noexcept
   {
     return base_t::dart_gptr();
@@ -214,8 +214,6 @@ public:
 
     DASH_LOG_TRACE_VAR("GlobRef.set()", val);
     DASH_LOG_TRACE_VAR("GlobRef.set", _gptr);
-    // TODO: Clarify if dart-call can be avoided if
-    //       _gptr->is_local()
     dash::internal::put_blocking(_gptr, &val, 1);
     DASH_LOG_TRACE_VAR("GlobRef.set >", _gptr);
   }
@@ -387,6 +385,15 @@ public:
     return _gptr.unitid == luid.id;
   }
 
+  /**
+   * Checks whether the globally referenced element is in the local
+   * memory of the calling unit or of a unit on the same node, so that
+   * it is accessed with plain loads and stores.
+   */
+  bool is_node_local() const {
+    return dash::internal::node_local_addr(_gptr) != nullptr;
+  }
+
   /**
    * Get a global ref to a member of a certain type at the
    * specified offset
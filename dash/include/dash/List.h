@@ -271,6 +271,11 @@ private:
   /// Default is 4 KB.
   size_type            _local_buffer_size
                          = 4096 / sizeof(value_type);
+  /// Elements appended by the calling unit since the last barrier.
+  std::vector<value_type> _push_back_buffer;
+  /// Number of elements removed by the calling unit since the last barrier.
+  size_type            _num_pop_back
+                         = 0;
 
 public:
   /**
@@ -353,23 +358,35 @@ public:
    * inserted element.
    * Increases the container size by one.
    *
-   * The operation takes immediate effect for the calling unit.
-   * For other units, changes will only be visible after the next call of
-   * \c barrier.
+   * Changes will only be visible after the next call of \c barrier.
    * As one-sided, non-collective allocation on remote units is not possible
-   * with most DART communication backends, the new list element is allocated
-   * locally and moved to its final position in global memory in \c barrier.
+   * with most DART communication backends, the new list element is buffered
+   * locally and moved to its final position in global memory in \c barrier,
+   * where the last unit appends the elements of all units in a single
+   * exchange.
+   * Elements appended by different units in the same epoch are ordered by
+   * unit id.
    */
   void push_back(const value_type & element)
   {
+    _push_back_buffer.push_back(element);
   }
 
   /**
    * Removes and destroys the last element in the list, reducing the
    * container size by one.
+   *
+   * Cancels the calling unit's last \c push_back of the current epoch,
+   * if any. Otherwise the element is removed in the next call of
+   * \c barrier, after the elements appended in the epoch.
    */
   void pop_back()
   {
+    if (!_push_back_buffer.empty()) {
+      _push_back_buffer.pop_back();
+    } else {
+      _num_pop_back++;
+    }
   }
 
   /**
@@ -591,8 +608,10 @@ public:
   void barrier()
   {
     DASH_LOG_TRACE_VAR("List.barrier()", _team);
-    // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
+      // Apply appends and removals of all units at the end of the list:
+      apply_back_operations();
+      // Apply changes in local memory spaces to global memory space:
       _globmem->commit();
     }
     // Accumulate local sizes of remote units:
@@ -693,9 +712,94 @@ public:
     }
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
+    _push_back_buffer.clear();
+    _num_pop_back         = 0;
     DASH_LOG_TRACE_VAR("List.deallocate >", this);
   }
 
+private:
+  /**
+   * Applies the \c push_back and \c pop_back operations of all units
+   * since the last barrier.
+   *
+   * Collective operation.
+   * Appended elements are sent to the last unit in a single all-to-all
+   * exchange and inserted there in local memory. Removals are then
+   * applied at the units holding the last elements of the list.
+   */
+  void apply_back_operations()
+  {
+    DASH_LOG_TRACE("List.apply_back_operations()");
+    auto nunits    = _team->size();
+    auto last_unit = nunits - 1;
+    // Local size, number of appended and number of removed elements of
+    // every unit:
+    std::vector<size_type> lcounts { lsize(),
+                                     _push_back_buffer.size(),
+                                     _num_pop_back };
+    std::vector<size_type> counts(3 * nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(lcounts.data(), counts.data(), 3,
+                     dash::dart_datatype<size_type>::value,
+                     _team->dart_id()),
+      DART_OK);
+
+    size_type num_push_back = 0;
+    size_type num_pop_back  = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      num_push_back += counts[3 * u + 1];
+      num_pop_back  += counts[3 * u + 2];
+    }
+    DASH_LOG_TRACE("List.apply_back_operations",
+                   "push_back:", num_push_back, "pop_back:", num_pop_back);
+
+    if (num_push_back > 0) {
+      auto nelem = dash::dart_storage<value_type>(1).nelem;
+      std::vector<size_t> nsend(nunits, 0), send_displs(nunits, 0);
+      std::vector<size_t> nrecv(nunits, 0), recv_displs(nunits, 0);
+      nsend[last_unit] = _push_back_buffer.size() * nelem;
+      std::vector<value_type> recv_buffer;
+      if (_myid == last_unit) {
+        recv_buffer.resize(num_push_back);
+        size_t displ = 0;
+        for (size_type u = 0; u < nunits; ++u) {
+          nrecv[u]       = counts[3 * u + 1] * nelem;
+          recv_displs[u] = displ;
+          displ         += nrecv[u];
+        }
+      }
+      DASH_ASSERT_RETURNS(
+        dart_alltoallv(
+          _push_back_buffer.data(), nsend.data(), send_displs.data(),
+          dash::dart_storage<value_type>::dtype,
+          recv_buffer.data(), nrecv.data(), recv_displs.data(),
+          _team->dart_id()),
+        DART_OK);
+      for (const auto & value : recv_buffer) {
+        local.push_back(value);
+      }
+      _push_back_buffer.clear();
+      counts[3 * last_unit] += num_push_back;
+    }
+
+    if (num_pop_back > 0) {
+      // Remove elements from the back, starting at the last unit:
+      size_type num_pop_remaining = num_pop_back;
+      for (auto u = static_cast<index_type>(last_unit);
+           u >= 0 && num_pop_remaining > 0; --u) {
+        auto num_pop_u     = std::min(num_pop_remaining, counts[3 * u]);
+        num_pop_remaining -= num_pop_u;
+        if (u == _myid) {
+          for (size_type i = 0; i < num_pop_u; ++i) {
+            local.pop_back();
+          }
+        }
+      }
+      _num_pop_back = 0;
+    }
+    DASH_LOG_TRACE("List.apply_back_operations >");
+  }
+
 };
 
 } // namespace dash
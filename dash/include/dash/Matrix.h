@@ -7,6 +7,8 @@
 #include <dash/Pattern.h>
 #include <dash/GlobRef.h>
 #include <dash/memory/GlobStaticMem.h>
+#include <dash/memory/MemoryPlacement.h>
+#include <dash/memory/ReadCache.h>
 #include <dash/Allocator.h>
 #include <dash/HView.h>
 #include <dash/Meta.h>
@@ -17,6 +19,7 @@
 #include <dash/matrix/MatrixRef.h>
 #include <dash/matrix/LocalMatrixRef.h>
 
+#include <memory>
 #include <type_traits>
 
 
@@ -270,6 +273,12 @@ private:
   ElementT                   * _lend;
   /// Proxy instance for applying a view, e.g. in subscript operator
   view_type<NumDimensions>     _ref;
+  /// Cache of remote elements read by the calling unit
+  std::unique_ptr<ReadCache>   _read_cache;
+  /// Placement policy of local memory in allocations
+  MemoryPlacement              _placement = MemoryPlacement::system;
+  /// Kind of pages backing local memory in allocations
+  MemoryPages                  _pages     = MemoryPages::system;
 
 public:
   /**
@@ -432,6 +441,58 @@ public:
    */
   inline void                 flush_local(dash::team_unit_t target);
 
+  /**
+   * Cache remote elements read by the calling unit via global references
+   * and iterators, replaces a previously enabled cache.
+   *
+   * Local operation, elements written by other units must be published
+   * before the cache is enabled.
+   *
+   * \see  dash::ReadCache
+   */
+  void                        enable_read_cache(
+                                const ReadCacheConfig & config
+                                  = ReadCacheConfig());
+
+  /**
+   * Discard the read cache of the calling unit.
+   */
+  inline void                 disable_read_cache();
+
+  /**
+   * The read cache of the calling unit, or \c nullptr if no read cache
+   * has been enabled.
+   */
+  inline ReadCache          * read_cache() const noexcept;
+
+  /**
+   * Placement policy of the pages of local memory in subsequent
+   * allocations, for delayed allocation.
+   *
+   * \see  dash::MemoryPlacement
+   */
+  inline void                 set_memory_placement(
+                                MemoryPlacement placement) noexcept;
+
+  /**
+   * Placement policy of the pages of local memory.
+   */
+  inline MemoryPlacement      memory_placement() const noexcept;
+
+  /**
+   * Kind of pages backing local memory in subsequent allocations, for
+   * delayed allocation.
+   *
+   * \see  dash::MemoryPages
+   */
+  inline void                 set_memory_pages(
+                                MemoryPages pages) noexcept;
+
+  /**
+   * Kind of pages backing local memory.
+   */
+  inline MemoryPages          memory_pages() const noexcept;
+
   /**
    * The pattern used to distribute matrix elements to units in its
    * associated team.
@@ -2,6 +2,7 @@
 #define DASH__ONESIDED_H__
 
 #include <dash/Team.h>
+#include <dash/memory/ReadCache.h>
 
 #include <dash/dart/if/dart.h>
 
@@ -10,6 +11,27 @@ namespace dash {
 
 namespace internal {
 
+  /**
+   * Native address of the memory location referenced by \c gptr if it
+   * can be accessed with plain loads and stores, i.e. if it is located at
+   * the calling unit or at a unit on the same node, or \c nullptr
+   * otherwise.
+   * The one-sided operations below do not resolve this address, DART
+   * copies through shared memory windows for units on the same node
+   * and records these accesses in its communication profile.
+   *
+   * \sa dart_gptr_getaddr_shared
+   */
+  inline
+  void *
+  node_local_addr(const dart_gptr_t& gptr) {
+    void * addr = nullptr;
+    if (dart_gptr_getaddr_shared(gptr, &addr) != DART_OK) {
+      return nullptr;
+    }
+    return addr;
+  }
+
   /**
    * Non-blocking write of \c nelem values from \c src to the global memory
    * location referenced by \c gptr.
@@ -20,6 +42,9 @@ namespace internal {
   inline
   void
   put(const dart_gptr_t& gptr, const T *src, size_t nelem) {
+    if (read_caches_active()) {
+      read_cache_update(gptr, src, nelem * sizeof(T));
+    }
     dash::dart_storage<T> ds(nelem);
     DASH_ASSERT_RETURNS(
       dart_put(gptr,
@@ -60,6 +85,9 @@ namespace internal {
   inline
   void
   put_blocking(const dart_gptr_t& gptr, const T *src, size_t nelem) {
+    if (read_caches_active()) {
+      read_cache_update(gptr, src, nelem * sizeof(T));
+    }
     dash::dart_storage<T> ds(nelem);
     DASH_ASSERT_RETURNS(
       dart_put_blocking(gptr,
@@ -80,6 +108,10 @@ namespace internal {
   inline
   void
   get_blocking(const dart_gptr_t& gptr, T *dst, size_t nelem) {
+    if (read_caches_active() &&
+        read_cache_get(gptr, dst, nelem * sizeof(T))) {
+      return;
+    }
     dash::dart_storage<T> ds(nelem);
     DASH_ASSERT_RETURNS(
       dart_get_blocking(dst,
@@ -105,6 +137,9 @@ namespace internal {
     const T           * src,
     size_t              nelem,
     dart_handle_t     * handle) {
+    if (read_caches_active()) {
+      read_cache_update(gptr, src, nelem * sizeof(T));
+    }
     dash::dart_storage<T> ds(nelem);
     DASH_ASSERT_RETURNS(
       dart_put_handle(gptr,
@@ -7,7 +7,10 @@
 #include <dash/Types.h>
 #include <dash/Exception.h>
 
+#include <dash/memory/ReadCache.h>
+
 #include <dash/util/Locality.h>
+#include <dash/util/Trace.h>
 
 #include <dash/internal/Logging.h>
 
@@ -258,6 +261,13 @@ public:
     }
 
     Team::All().free();
+
+    // Group of Team::All() is requested lazily and must be released
+    // before the runtime is finalized:
+    if (Team::All()._has_group) {
+      dart_group_destroy(&Team::All()._group);
+      Team::All()._has_group = false;
+    }
   }
 
   /**
@@ -461,9 +471,17 @@ public:
   inline void barrier() const
   {
     if (!is_null()) {
+      static const dash::util::TraceName trace_team("team");
+      static const dash::util::TraceName trace_barrier("barrier");
+      dash::util::Trace      trace(trace_team);
+      dash::util::TraceState trace_state(trace, trace_barrier);
       DASH_ASSERT_RETURNS(
         dart_barrier(_dartid),
         DART_OK);
+      // Values written before the barrier become visible in read caches:
+      if (dash::internal::read_caches_active()) {
+        dash::internal::read_cache_barrier(_dartid);
+      }
     }
   }
 
@@ -6,9 +6,18 @@
 #include <algorithm>
 #include <stdexcept>
 #include <cmath>
+#include <vector>
+#include <iterator>
+#include <cstdint>
+
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/Init.h>
 #include <dash/dart/if/dart.h>
+#include <dash/util/Config.h>
 #include "allocator/SymmetricAllocator.h"
 
 namespace dash {
@@ -120,11 +129,8 @@ struct Vector_iterator {
 	}
 
 	typename Vector::reference operator*() {
-		auto lcapacity = _vec.lcapacity();
-// 		std::cout << "op*" << std::endl;
-		typename Vector::reference result = *(_vec._data.begin() + _index.position * lcapacity + _index.local_index);
-// 		std::cout << "end op*" << std::endl;
-		return result;
+		return typename Vector::reference(
+			_vec.gptr_at(team_unit_t(_index.position.id), _index.local_index));
 	}
 
 	void checkIndex() {
@@ -252,7 +258,6 @@ public:
 
 	using const_reference = const T&;
 
-	using glob_mem_type = dash::GlobStaticMem<T, allocator<T>>;
  	using shared_local_sizes_mem_type = dash::GlobStaticMem<dash::Atomic<size_type>, allocator<dash::Atomic<size_type>>>;
 
 	friend Vector_iterator<self_type>;
@@ -262,8 +267,8 @@ public:
 	using pointer = T*;
 // 	using const_pointer = const_iterator;
 
-	using local_pointer = typename glob_mem_type::local_pointer;
-	using const_local_pointer = typename glob_mem_type::const_local_pointer;
+	using local_pointer = T*;
+	using const_local_pointer = const T*;
 
 	using team_type = dash::Team;
 
@@ -275,7 +280,8 @@ public:
 	);
 
 	Vector(const Vector& other) = delete;
-	Vector(Vector&& other) = default;
+	Vector(Vector&& other);
+	~Vector();
 // 	Vector( std::initializer_list<T> init, const allocator_type& alloc = allocator_type() );
 //
 // 	Vector& operator=(const Vector& other) = delete;
@@ -363,17 +369,57 @@ public:
 	void balance();
 	void commit();
 	void barrier();
+	void flush();
 
 private:
 
+	/**
+	 * Chunk of a unit's local storage attached to the team's dynamic
+	 * window. Chunks are appended on growth, elements are never moved.
+	 */
+	struct segment_t {
+		/// Global pointer to the first element of the chunk at unit 0
+		dart_gptr_t gptr;
+		/// Local index of the first element in the chunk
+		size_type loffset;
+		/// Number of elements in the chunk
+		size_type lcapacity;
+	};
+
+	/// Maximum number of chunks per unit, chunks are merged in a single
+	/// window attachment beyond this to respect MPI attachment limits.
+	static constexpr size_type max_segments = 16;
+
+	/// Default size of the virtual address range reserved for local
+	/// elements, in bytes.
+	static constexpr size_type default_reserved_bytes = size_type(1) << 34;
+
+	void reserve_address_range(size_type bytes);
+	void release_address_range();
+	void grow(size_type new_lcap);
+	void attach_segment(size_type loffset, size_type lcap);
+	void detach_segments();
+	dart_gptr_t gptr_at(team_unit_t unit, size_type lidx) const;
+	void put(team_unit_t unit, size_type lidx, const value_type* values, size_type nvalues);
+
 	allocator_type _allocator;
-// 	size_type _size;
-// 	size_type _capacity;
-	glob_mem_type _data;
-	shared_local_sizes_mem_type _local_sizes;
 	team_type& _team;
+	/// Begin of the virtual address range reserved for local elements
+	value_type* _lbegin = nullptr;
+	/// Number of elements fitting in the reserved address range
+	size_type _lreserved = 0;
+	/// Number of elements in attached chunks
+	size_type _lcapacity = 0;
+	/// Attached chunks, ordered by local offset
+	std::vector<segment_t> _segments;
+	shared_local_sizes_mem_type _local_sizes;
 	std::vector<value_type> local_queue;
 	std::vector<value_type> global_queue;
+	/// Elements appended by push_back that are not written to global
+	/// memory yet
+	std::vector<value_type> push_back_queue;
+	/// Number of elements appended by push_back in a single batch
+	size_type push_back_batch_size = std::max<size_type>(4096 / sizeof(value_type), 1);
 }; // End of class Vector
 
 template <class T, template<class> class allocator>
@@ -384,17 +430,186 @@ Vector<T,allocator>::Vector(
 	team_type& team
 ) :
 	_allocator(alloc),
-	_data(local_elements, team),
-	_local_sizes(1, team),
-	_team(team)
+	_team(team),
+	_local_sizes(1, team)
 {
+	auto reserved_bytes = default_reserved_bytes;
+	if(dash::util::Config::is_set("DASH_VECTOR_RESERVE_SIZE_BYTES")) {
+		reserved_bytes = dash::util::Config::get<size_type>("DASH_VECTOR_RESERVE_SIZE_BYTES");
+	}
+	reserve_address_range(std::max(reserved_bytes, local_elements * sizeof(value_type)));
+	grow(local_elements);
+	std::uninitialized_fill(_lbegin, _lbegin + local_elements, default_value);
 	dash::atomic::store(*(_local_sizes.begin()+_team.myid()), local_elements);
 	_team.barrier();
 }
 
+template <class T, template<class> class allocator>
+Vector<T,allocator>::Vector(Vector&& other) :
+	_allocator(std::move(other._allocator)),
+	_team(other._team),
+	_lbegin(other._lbegin),
+	_lreserved(other._lreserved),
+	_lcapacity(other._lcapacity),
+	_segments(std::move(other._segments)),
+	_local_sizes(std::move(other._local_sizes)),
+	local_queue(std::move(other.local_queue)),
+	global_queue(std::move(other.global_queue)),
+	push_back_queue(std::move(other.push_back_queue)),
+	push_back_batch_size(other.push_back_batch_size)
+{
+	other._lbegin = nullptr;
+	other._lreserved = 0;
+	other._lcapacity = 0;
+	other._segments.clear();
+}
+
+template <class T, template<class> class allocator>
+Vector<T,allocator>::~Vector() {
+	if(dash::is_initialized()) {
+		detach_segments();
+	}
+	release_address_range();
+}
+
+template <class T, template<class> class allocator>
+void Vector<T,allocator>::reserve_address_range(size_type bytes) {
+	// Reserve address space only, inaccessible pages are not committed so
+	// reservations do not fail with strict overcommit accounting. Chunks
+	// are made accessible when attached:
+	auto addr = mmap(nullptr, bytes, PROT_NONE,
+	                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if(addr == MAP_FAILED) {
+		DASH_THROW(dash::exception::RuntimeError,
+		           "dash::Vector: failed to reserve " << bytes << " bytes "
+		           "of address space, set DASH_VECTOR_RESERVE_SIZE");
+	}
+	_lbegin = static_cast<value_type*>(addr);
+	_lreserved = bytes / sizeof(value_type);
+}
+
+template <class T, template<class> class allocator>
+void Vector<T,allocator>::release_address_range() {
+	if(_lbegin != nullptr) {
+		munmap(_lbegin, _lreserved * sizeof(value_type));
+		_lbegin = nullptr;
+		_lreserved = 0;
+	}
+}
+
+template <class T, template<class> class allocator>
+void Vector<T,allocator>::attach_segment(size_type loffset, size_type lcap) {
+	if(lcap > 0) {
+		// Make the pages spanned by the chunk accessible, the first page may
+		// be shared with the preceding chunk:
+		const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+		auto begin = reinterpret_cast<uintptr_t>(_lbegin + loffset);
+		auto end = reinterpret_cast<uintptr_t>(_lbegin + loffset + lcap);
+		begin -= begin % page_size;
+		end = ((end + page_size - 1) / page_size) * page_size;
+		if(mprotect(reinterpret_cast<void*>(begin), end - begin, PROT_READ | PROT_WRITE) != 0) {
+			DASH_THROW(dash::exception::RuntimeError,
+			           "dash::Vector: failed to commit " << (end - begin) << " bytes "
+			           "of local memory");
+		}
+	}
+	dash::dart_storage<value_type> ds(lcap);
+	segment_t segment { DART_GPTR_NULL, loffset, lcap };
+	DASH_ASSERT_RETURNS(
+		dart_team_memregister(_team.dart_id(), ds.nelem, ds.dtype, _lbegin + loffset, &segment.gptr),
+		DART_OK);
+	_segments.push_back(segment);
+}
+
+template <class T, template<class> class allocator>
+void Vector<T,allocator>::detach_segments() {
+	for(auto& segment : _segments) {
+		DASH_ASSERT_RETURNS(dart_team_memderegister(segment.gptr), DART_OK);
+	}
+	_segments.clear();
+}
+
+/**
+ * Extends the local capacity of every unit to \c new_lcap elements.
+ * Collective operation, \c new_lcap must be identical at all units.
+ *
+ * The local address range is reserved in advance, growing attaches the
+ * memory following the existing chunks to the team's dynamic window
+ * without moving elements.
+ * Only if the reserved range is exhausted, elements are moved to a new,
+ * larger range.
+ */
+template <class T, template<class> class allocator>
+void Vector<T,allocator>::grow(size_type new_lcap) {
+	if(new_lcap <= _lcapacity) return;
+
+	if(new_lcap > _lreserved) {
+		const auto old_lbegin = _lbegin;
+		const auto old_lreserved = _lreserved;
+		const auto old_lsize = std::min(lsize(), _lcapacity);
+		reserve_address_range(std::max(2 * _lreserved, new_lcap) * sizeof(value_type));
+		detach_segments();
+		attach_segment(0, new_lcap);
+		_lcapacity = new_lcap;
+		std::uninitialized_copy(
+			std::make_move_iterator(old_lbegin),
+			std::make_move_iterator(old_lbegin + old_lsize),
+			_lbegin);
+		for(size_type i = 0; i < old_lsize; ++i) {
+			old_lbegin[i].~value_type();
+		}
+		munmap(old_lbegin, old_lreserved * sizeof(value_type));
+		return;
+	}
+	if(_segments.size() >= max_segments) {
+		detach_segments();
+		_lcapacity = 0;
+	}
+	attach_segment(_lcapacity, new_lcap - _lcapacity);
+	_lcapacity = new_lcap;
+}
+
+template <class T, template<class> class allocator>
+dart_gptr_t Vector<T,allocator>::gptr_at(team_unit_t unit, size_type lidx) const {
+	if(_segments.empty()) return DART_GPTR_NULL;
+
+	auto segment = std::upper_bound(
+		_segments.begin(), _segments.end(), lidx,
+		[](size_type idx, const segment_t& seg) { return idx < seg.loffset; });
+	--segment;
+	auto gptr = segment->gptr;
+	dart_gptr_setunit(&gptr, unit);
+	gptr.addr_or_offs.offset += (lidx - segment->loffset) * sizeof(value_type);
+	return gptr;
+}
+
+template <class T, template<class> class allocator>
+void Vector<T,allocator>::put(
+	team_unit_t unit,
+	size_type lidx,
+	const value_type* values,
+	size_type nvalues
+) {
+	// Split the transfer at chunk boundaries:
+	while(nvalues > 0) {
+		auto segment = std::upper_bound(
+			_segments.begin(), _segments.end(), lidx,
+			[](size_type idx, const segment_t& seg) { return idx < seg.loffset; });
+		--segment;
+		const auto nput = std::min(nvalues, segment->loffset + segment->lcapacity - lidx);
+		dash::dart_storage<value_type> ds(nput);
+		DASH_ASSERT_RETURNS(
+			dart_put_blocking(gptr_at(unit, lidx), values, ds.nelem, ds.dtype, ds.dtype),
+			DART_OK);
+		lidx += nput;
+		values += nput;
+		nvalues -= nput;
+	}
+}
+
 template <class T, template<class> class allocator>
 typename Vector<T,allocator>::reference Vector<T,allocator>::at(size_type pos) {
-	return begin()[pos];
+	return *(begin()+pos);
 }
 
 template <class T, template<class> class allocator>
@@ -409,7 +624,7 @@ typename Vector<T,allocator>::local_reference Vector<T,allocator>::lat(size_type
 
 template <class T, template<class> class allocator>
 typename Vector<T,allocator>::reference Vector<T,allocator>::operator[](size_type pos) {
-	return begin()[pos];
+	return *(begin()+pos);
 }
 
 template <class T, template<class> class allocator>
@@ -446,13 +661,12 @@ typename Vector<T,allocator>::iterator Vector<T,allocator>::end() {
 
 template <class T, template<class> class allocator>
 typename Vector<T,allocator>::local_pointer Vector<T,allocator>::lbegin() {
-	return _data.lbegin();
+	return _lbegin;
 }
 
 template <class T, template<class> class allocator>
 typename Vector<T,allocator>::local_pointer Vector<T,allocator>::lend() {
-	return _data.lend();
-
+	return _lbegin + lsize();
 }
 
 template <class T, template<class> class allocator>
@@ -484,65 +698,75 @@ typename Vector<T, allocator>::size_type Vector<T, allocator>::max_size() const
 	return std::numeric_limits<size_type>::max();
 }
 
+/**
+ * Redistributes elements such that local sizes differ by at most one
+ * element, preserving the global order of elements.
+ * Collective operation, elements are exchanged in a single all-to-all.
+ */
 template <class T, template<class> class allocator>
 void Vector<T, allocator>::balance() {
 	_team.barrier();
 
-	const auto cap = capacity() / _team.size();
-	const auto new_size = (size() + _team.size() - 1) / _team.size(); // Ceiling of size() / _team.size()
+	const auto nunits = _team.size();
 	const auto myid = _team.myid();
-	glob_mem_type tmp(cap, _team);
-
-	using block_t = std::pair<dart_gptr_t, size_t>;
-	std::vector<block_t> blocks;
 
-	index_type begin_index = new_size * myid;
-	index_type end_index = std::max(new_size * (myid + 1), size());
-
-	index_type pos = 0;
-	index_type ls = dash::atomic::load(*(_local_sizes.begin()));
-	index_type id = 0;
-	index_type remaining = std::min(new_size, size() - myid * new_size);
-
-	while(pos + ls < begin_index) {
-		++id;
-		pos += ls;
-		ls = dash::atomic::load(*(_local_sizes.begin()+id));
+	size_type my_lsize = lsize();
+	std::vector<size_type> lsizes(nunits);
+	DASH_ASSERT_RETURNS(
+		dart_allgather(&my_lsize, lsizes.data(), 1, dash::dart_datatype<size_type>::value, _team.dart_id()),
+		DART_OK);
+
+	// Global index range of elements at every unit before and after
+	// balancing:
+	std::vector<size_type> src_begin(nunits + 1, 0);
+	for(size_type u = 0; u < nunits; ++u) {
+		src_begin[u+1] = src_begin[u] + lsizes[u];
 	}
-
-	auto loffset = (begin_index - pos);
-	index_type lsize = dash::atomic::load(*(_local_sizes.begin()+id));
-	auto tbegin = _data.begin() + (id*lcapacity() + loffset);
-	auto tsize = std::min(remaining, static_cast<index_type>(lcapacity() - loffset));
-	blocks.emplace_back(tbegin, tsize);
-
-
-	remaining -= tsize;
-	while(remaining > 0) {
-		++id;
-		lsize = dash::atomic::load(*(_local_sizes.begin()+id));
-		tbegin = _data.begin() + (id*lcapacity());
-		tsize = std::min(remaining, lsize);
-		blocks.emplace_back(tbegin, tsize);
-		remaining -= tsize;
+	const auto size = src_begin[nunits];
+	std::vector<size_type> dst_begin(nunits + 1, 0);
+	for(size_type u = 0; u < nunits; ++u) {
+		dst_begin[u+1] = dst_begin[u] + size / nunits + (u < size % nunits ? 1 : 0);
 	}
 
-	auto dest = tmp.lbegin();
-	long unsigned int my_size = 0;
-	for(auto& block : blocks) {
-		dart_get_blocking(dest, block.first, block.second, dart_datatype<T>::value, dart_datatype<T>::value);
-		dest += block.second;
-		my_size += block.second;
+	// Counts and displacements in units of the DART storage type:
+	const auto nelem = dash::dart_storage<value_type>(1).nelem;
+	std::vector<size_t> nsend(nunits, 0), send_displs(nunits, 0);
+	std::vector<size_t> nrecv(nunits, 0), recv_displs(nunits, 0);
+	for(size_type u = 0; u < nunits; ++u) {
+		auto send_begin = std::max(src_begin[myid], dst_begin[u]);
+		auto send_end = std::min(src_begin[myid + 1], dst_begin[u + 1]);
+		if(send_begin < send_end) {
+			nsend[u] = (send_end - send_begin) * nelem;
+			send_displs[u] = (send_begin - src_begin[myid]) * nelem;
+		}
+		auto recv_begin = std::max(src_begin[u], dst_begin[myid]);
+		auto recv_end = std::min(src_begin[u + 1], dst_begin[myid + 1]);
+		if(recv_begin < recv_end) {
+			nrecv[u] = (recv_end - recv_begin) * nelem;
+			recv_displs[u] = (recv_begin - dst_begin[myid]) * nelem;
+		}
 	}
 
-	_team.barrier();
-	dash::atomic::store(*(_local_sizes.begin()+myid), my_size);
-	_data = std::move(tmp);
+	const auto new_lsize = dst_begin[myid + 1] - dst_begin[myid];
+	std::vector<value_type> recv_buffer(new_lsize);
+	DASH_ASSERT_RETURNS(
+		dart_alltoallv(
+			_lbegin, nsend.data(), send_displs.data(),
+			dash::dart_storage<value_type>::dtype,
+			recv_buffer.data(), nrecv.data(), recv_displs.data(),
+			_team.dart_id()),
+		DART_OK);
+
+	grow((size + nunits - 1) / nunits); // Ceiling of size / nunits
+	std::copy(recv_buffer.begin(), recv_buffer.end(), _lbegin);
+	dash::atomic::store(*(_local_sizes.begin()+myid), new_lsize);
 	_team.barrier();
 }
 
 template <class T, template<class> class allocator>
 void Vector<T, allocator>::commit() {
+	flush();
+
 // 	if(_team.myid() == 0) std::cout << "commit() lsize = "<< lsize() << " lcapacity = " << lcapacity() << std::endl;
 
 	auto outstanding_global_writes = global_queue.size();
@@ -591,17 +815,30 @@ void Vector<T, allocator>::commit() {
 template <class T, template<class> class allocator>
 void Vector<T, allocator>::barrier() {
 // 	commit();
+	flush();
 	_team.barrier();
 }
 
+/**
+ * Writes elements appended by push_back to global memory.
+ * Reserves the range for all pending elements at the last unit with a
+ * single atomic operation and writes them in one bulk transfer.
+ * Elements exceeding the capacity are appended in the next commit.
+ */
+template <class T, template<class> class allocator>
+void Vector<T, allocator>::flush() {
+	insert(push_back_queue.begin(), push_back_queue.end());
+	push_back_queue.clear();
+}
+
 template <class T, template<class> class allocator>
 typename Vector<T, allocator>::size_type Vector<T, allocator>::lcapacity() const {
-	return _data.size() / _team.size();
+	return _lcapacity;
 }
 
 template <class T, template<class> class allocator>
 typename Vector<T, allocator>::size_type Vector<T, allocator>::capacity() const {
-	return _data.size();
+	return _lcapacity * _team.size();
 }
 
 template <class T, template<class> class allocator>
@@ -619,24 +856,8 @@ void Vector<T, allocator>::clear() {
 
 template <class T, template<class> class allocator>
 void Vector<T, allocator>::reserve(size_type new_cap) {
-// 	std::cout << "reserve " << new_cap << std::endl;
-	const auto old_cap = capacity() / _team.size();
-
-	if(new_cap > old_cap) {
-// 		if(_team.myid() == 0) std::cout << "alloc shared mem." << std::endl;
-		glob_mem_type tmp(new_cap, _team);
-		const auto i = _team.myid();
-// 		if(_team.myid() == 0) std::cout << "copy data" << std::endl;
-// 		std::copy(_data.begin() + i*old_cap, _data.begin()+(i*old_cap+lsize()), tmp.begin() + i*new_cap);
-		std::copy(_data.lbegin(), _data.lbegin()+lsize(), tmp.lbegin());
-// 		auto dest = tmp.begin() + i*new_cap;
-// 		auto gptr = static_cast<dart_gptr_t>(_data.begin() + i*old_cap);
-// 		dart_get_blocking(dest.local(), gptr, lsize(), dart_datatype<T>::value, dart_datatype<T>::value);
-		_data = std::move(tmp);
-	}
-
+	grow(new_cap);
 	_team.barrier();
-// 	if(_team.myid() == 0) std::cout << "reserved." << std::endl;
 }
 
 template <class T, template<class> class allocator>
@@ -654,7 +875,7 @@ void Vector<T, allocator>::linsert(InputIt first, InputIt last) {
 // 	if(_team.myid() == 1) std::cout << "direct_fill = " << direct_fill << std::endl;
 
 	const auto direct_fill_end = first + direct_fill;
-	std::copy(first, direct_fill_end, _data.lbegin() + lastSize);
+	std::copy(first, direct_fill_end, _lbegin + lastSize);
 
 	if(direct_fill_end != last) {
 		dash::atomic::store(*(_local_sizes.begin()+_team.myid()), lcapacity());
@@ -684,18 +905,10 @@ void Vector<T, allocator>::insert(InputIt first, InputIt last) {
 
 	const auto direct_fill_end = first + direct_fill;
 
-// 	std::copy(first, direct_fill_end, _data.begin() + (lcapacity()*(_team.size()-1) + lastSize));
-	auto gptr =_data.begin() + (lcapacity()*(_team.size()-1) + lastSize);
 	std::vector<value_type> buffer(first, direct_fill_end);
 
 	if(buffer.size() > 0) {
-		dart_put_blocking(
-			static_cast<dart_gptr_t>(gptr),
-			buffer.data(),
-			buffer.size(),
-			dart_datatype<T>::value,
-			dart_datatype<T>::value
-		);
+		put(team_unit_t(_team.size()-1), lastSize, buffer.data(), buffer.size());
 	}
 
 	// This is a unneccessary copy to get a void* from a (forward-)iterator. In order to prevent this,
@@ -715,7 +928,7 @@ void Vector<T, allocator>::insert(InputIt first, InputIt last) {
 
 	if(direct_fill_end != last) {
 		dash::atomic::store(*(_local_sizes.begin()+(_team.size()-1)), lcapacity());
-		global_queue.insert(local_queue.end(), direct_fill_end, last);
+		global_queue.insert(global_queue.end(), direct_fill_end, last);
 	}
 // 	std::cout << "id("<< _team.myid() << ") " << "done" << std::endl;
 }
@@ -751,7 +964,7 @@ void Vector<T, allocator>::lpush_back(const T& value, vector_strategy_t strategy
 
 	const auto lastSize = dash::atomic::fetch_add(*(_local_sizes.begin()+_team.myid()), static_cast<size_type>(1));
 	if(lastSize < lcapacity()) {
-		*(_data.lbegin() + lastSize) = value;
+		*(_lbegin + lastSize) = value;
 	} else {
 		if(strategy == vector_strategy_t::WRITE_THROUGH) throw std::runtime_error("Space not sufficient");
 		dash::atomic::sub(*(_local_sizes.begin()+_team.myid()), static_cast<size_type>(1));
@@ -766,19 +979,21 @@ void Vector<T, allocator>::push_back(const T& value,  vector_strategy_t strategy
 		return;
 	}
 
+	if(strategy == vector_strategy_t::HYBRID) {
+		// Appends are batched, written to global memory in flush():
+		push_back_queue.push_back(value);
+		if(push_back_queue.size() >= push_back_batch_size) {
+			flush();
+		}
+		return;
+	}
+
 	const auto lastSize = dash::atomic::fetch_add(*(_local_sizes.begin()+(_local_sizes.size()-1)), static_cast<size_type>(1));
-// 	if(_team.myid() == 0) std::cout << "push_back() lastSize = " << lastSize << " lcapacity = " << lcapacity() << std::endl;
 	if(lastSize < lcapacity()) {
-// 		std::cout << "enough space" << std::endl;
-		*(_data.begin() + lcapacity()*(_team.size()-1) + lastSize) = value;
-// 		std::cout << "written" << std::endl;
+		reference(gptr_at(team_unit_t(_team.size()-1), lastSize)) = value;
 	} else {
-// 		std::cout << "not enough space" << std::endl;
-		if(strategy == vector_strategy_t::WRITE_THROUGH) throw std::runtime_error("Space not sufficient");
-
 		dash::atomic::sub(*(_local_sizes.begin()+(_local_sizes.size()-1)), static_cast<size_type>(1));
-		global_queue.push_back(value);
-// 		std::cout << "delayed" << std::endl;
+		throw std::runtime_error("Space not sufficient");
 	}
 }
 
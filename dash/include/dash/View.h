@@ -41,6 +41,7 @@
  * <tt>dash::difference</tt> | View from difference of two domains
  * <tt>dash::combine</tt>    | Composite view of two possibply unconnected domains
  * <tt>dash::local</tt>      | Local subspace of domain
+ * <tt>dash::node_local</tt> | Local memory segments of all units on the node
  * <tt>dash::global</tt>     | Maps subspace to elements in global domain
  * <tt>dash::apply</tt>      | Obtain image of domain view (inverse of \c domain)
  * <tt>dash::domain</tt>     | Obtain domain of view image (inverse of \c apply)
@@ -78,6 +79,7 @@
 #include <dash/view/Origin.h>
 #include <dash/view/Global.h>
 #include <dash/view/Local.h>
+#include <dash/view/NodeLocal.h>
 #include <dash/view/Remote.h>
 #include <dash/view/Apply.h>
 #include <dash/view/Sub.h>
@@ -5,6 +5,11 @@
 #include <dash/Iterator.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/CopyPlan.h>
+#include <dash/algorithm/CopyStream.h>
+#include <dash/algorithm/internal/LocalCopy.h>
+#include <dash/algorithm/internal/StridedCopy.h>
+#include <dash/util/Trace.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -212,6 +217,99 @@ ValueType * copy_impl(
   return out_last;
 }
 
+// =========================================================================
+// Global to Local, Multi-dimensional View
+// =========================================================================
+
+/**
+ * Blocking implementation of \c dash::copy (global to local) of a range
+ * in a view of a multi-dimensional pattern.
+ */
+template <
+  typename ValueType,
+  class GlobInputIt >
+ValueType * copy_strided(
+  GlobInputIt   in_first,
+  GlobInputIt   in_last,
+  ValueType   * out_first,
+  std::true_type)
+{
+  static const dash::util::TraceName trace_copy("copy");
+  static const dash::util::TraceName trace_global_to_local("global_to_local");
+  dash::util::Trace      trace(trace_copy);
+  dash::util::TraceState trace_state(trace, trace_global_to_local);
+  StridedCopy<ValueType> strided_copy(in_first, in_last, out_first);
+  DASH_LOG_TRACE("dash::copy_strided", "elements:", strided_copy.size(),
+                 "units:", strided_copy.num_units());
+  strided_copy.start();
+  return strided_copy.wait();
+}
+
+/**
+ * Ranges of other global iterator types are not copied by
+ * \c copy_strided.
+ */
+template <
+  typename ValueType,
+  class GlobInputIt >
+ValueType * copy_strided(
+  GlobInputIt,
+  GlobInputIt,
+  ValueType   * out_first,
+  std::false_type)
+{
+  return out_first;
+}
+
+/**
+ * Asynchronous implementation of \c dash::copy (global to local) of a
+ * range in a view of a multi-dimensional pattern.
+ */
+template <
+  typename ValueType,
+  class GlobInputIt >
+dash::Future<ValueType *> copy_async_strided(
+  GlobInputIt   in_first,
+  GlobInputIt   in_last,
+  ValueType   * out_first,
+  std::true_type)
+{
+  auto strided_copy = std::make_shared<StridedCopy<ValueType>>(
+                        in_first, in_last, out_first);
+  strided_copy->start();
+  ValueType * out_last = out_first + strided_copy->size();
+  return dash::Future<ValueType *>(
+    // wait
+    [=]() mutable {
+      return strided_copy->wait();
+    },
+    // test
+    [=](ValueType ** out) mutable {
+      if (strided_copy->test()) {
+        *out = out_last;
+        return true;
+      }
+      return false;
+    },
+    // destroy
+    [=]() mutable {
+      strided_copy.reset();
+    }
+  );
+}
+
+template <
+  typename ValueType,
+  class GlobInputIt >
+dash::Future<ValueType *> copy_async_strided(
+  GlobInputIt,
+  GlobInputIt,
+  ValueType   * out_first,
+  std::false_type)
+{
+  return dash::Future<ValueType *>(out_first);
+}
+
 // =========================================================================
 // Local to Global
 // =========================================================================
@@ -274,19 +372,16 @@ dash::Future<ValueType *> copy_async(
   GlobInputIt   in_last,
   ValueType   * out_first)
 {
-  const auto & team = in_first.team();
-
   DASH_LOG_TRACE("dash::copy_async()", "async, global to local");
   if (in_first == in_last) {
     DASH_LOG_TRACE("dash::copy_async", "input range empty");
     return dash::Future<ValueType *>(out_first);
   }
-
-  dash::util::UnitLocality uloc(team, team.myid());
-  // Size of L2 data cache line:
-  int  l2_line_size = uloc.hwinfo().cache_line_sizes[1];
-  bool use_memcpy   = ((in_last - in_first) * sizeof(ValueType))
-                      <= l2_line_size;
+  typedef dash::internal::is_strided_copy_range<GlobInputIt> is_strided;
+  if (is_strided::value) {
+    return dash::internal::copy_async_strided(
+             in_first, in_last, out_first, is_strided());
+  }
 
   ValueType * dest_first = out_first;
   // Return value, initialize with begin of output range, indicating no values
@@ -308,23 +403,9 @@ dash::Future<ValueType *> copy_async(
   if (num_local_elem == total_copy_elem) {
     // Entire input range is local:
     DASH_LOG_TRACE("dash::copy_async", "entire input range is local");
-    ValueType * l_out_last = out_first + total_copy_elem;
     ValueType * l_in_first = in_first.local();
     ValueType * l_in_last  = l_in_first + total_copy_elem;
-
-    // Use memcpy for data ranges below 64 KB
-    if (use_memcpy) {
-      std::memcpy(out_first,        // destination
-                  in_first.local(), // source
-                  num_local_elem * sizeof(ValueType));
-      out_last = out_first + num_local_elem;
-    } else {
-      ValueType * l_in_first = in_first.local();
-      ValueType * l_in_last  = l_in_first + num_local_elem;
-      out_last = std::copy(l_in_first,
-                           l_in_last,
-                           out_first);
-    }
+    out_last = dash::internal::local_copy(l_in_first, l_in_last, out_first);
     DASH_LOG_TRACE("dash::copy_async", "finished local copy of",
                    (out_last - out_first), "elements");
     return dash::Future<ValueType *>(out_last);
@@ -430,17 +511,8 @@ dash::Future<ValueType *> copy_async(
     ValueType * local_out_first = out_first + num_prelocal_elem;
     ValueType * local_out_last  = local_out_first + num_local_elem;
 
-    // Use memcpy for data ranges below 64 KB
-    if (use_memcpy) {
-      std::memcpy(local_out_first, // destination
-                  l_in_first,      // source
-                  num_local_elem * sizeof(ValueType));
-      local_out_last = local_out_first + num_local_elem;
-    } else {
-      local_out_last = std::copy(l_in_first,
-                                 l_in_last,
-                                 local_out_first);
-    }
+    local_out_last = dash::internal::local_copy(
+                       l_in_first, l_in_last, local_out_first);
     DASH_LOG_TRACE("dash::copy_async", "<< std::shared_future >>",
                    "finished local copy of",
                    (local_out_last - local_out_first),
@@ -525,14 +597,20 @@ ValueType * copy(
   GlobInputIt   in_last,
   ValueType   * out_first)
 {
-  const auto & team = in_first.team();
-  dash::util::UnitLocality uloc(team, team.myid());
-  // Size of L2 data cache line:
-  int  l2_line_size = uloc.hwinfo().cache_line_sizes[1];
-  bool use_memcpy   = ((in_last - in_first) * sizeof(ValueType))
-                      <= l2_line_size;
+  typedef dash::internal::is_strided_copy_range<GlobInputIt> is_strided;
+  if (is_strided::value) {
+    if (in_first == in_last) {
+      return out_first;
+    }
+    return dash::internal::copy_strided(
+             in_first, in_last, out_first, is_strided());
+  }
 
   DASH_LOG_TRACE("dash::copy()", "blocking, global to local");
+  static const dash::util::TraceName trace_copy("copy");
+  static const dash::util::TraceName trace_global_to_local("global_to_local");
+  dash::util::Trace      trace(trace_copy);
+  dash::util::TraceState trace_state(trace, trace_global_to_local);
 
   ValueType * dest_first = out_first;
   // Return value, initialize with begin of output range, indicating no
@@ -554,20 +632,10 @@ ValueType * copy(
   if (num_local_elem == total_copy_elem) {
     // Entire input range is local:
     DASH_LOG_TRACE("dash::copy", "entire input range is local");
-    ValueType * out_last = out_first + total_copy_elem;
-    // Use memcpy for data ranges below 64 KB
-    if (use_memcpy) {
-      std::memcpy(out_first,        // destination
-                  in_first.local(), // source
-                  num_local_elem * sizeof(ValueType));
-      out_last = out_first + num_local_elem;
-    } else {
-      ValueType * l_in_first = in_first.local();
-      ValueType * l_in_last  = l_in_first + num_local_elem;
-      out_last = std::copy(l_in_first,
-                           l_in_last,
-                           out_first);
-    }
+    ValueType * l_in_first = in_first.local();
+    ValueType * l_in_last  = l_in_first + num_local_elem;
+    ValueType * out_last   = dash::internal::local_copy(
+                               l_in_first, l_in_last, out_first);
     DASH_LOG_TRACE("dash::copy", "finished local copy of",
                    (out_last - out_first), "elements");
     return out_last;
@@ -653,17 +721,7 @@ ValueType * copy(
 
     DASH_LOG_TRACE("dash::copy", "copy local subrange",
                    "num_copy_elem:", l_in_last - l_in_first);
-    // Use memcpy for data ranges below 64 KB
-    if (use_memcpy) {
-      std::memcpy(dest_first, // destination
-                  l_in_first, // source
-                  num_local_elem * sizeof(ValueType));
-      out_last = dest_first + num_local_elem;
-    } else {
-      out_last = std::copy(l_in_first,
-                           l_in_last,
-                           dest_first);
-    }
+    out_last = dash::internal::local_copy(l_in_first, l_in_last, dest_first);
     // Assert that all elements in local range have been copied:
     DASH_ASSERT_EQ(out_last, dest_first + num_local_elem,
                    "Expected to copy " << num_local_elem << " local elements "
@@ -799,6 +857,10 @@ GlobOutputIt copy(
   GlobOutputIt   out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, local to global");
+  static const dash::util::TraceName trace_copy("copy");
+  static const dash::util::TraceName trace_local_to_global("local_to_global");
+  dash::util::Trace      trace(trace_copy);
+  dash::util::TraceState trace_state(trace, trace_local_to_global);
   // Return value, initialize with begin of output range, indicating no values
   // have been copied:
   GlobOutputIt out_last   = out_first;
@@ -846,9 +908,10 @@ GlobOutputIt copy(
     DASH_LOG_TRACE("dash::copy", "copying local subrange");
     DASH_LOG_TRACE_VAR("dash::copy", in_first);
     DASH_ASSERT_RETURNS(
-      std::copy(in_first + l_elem_offset,
-                in_first + l_elem_offset + num_local_elem,
-                l_out_first),
+      dash::internal::local_copy(
+        in_first + l_elem_offset,
+        in_first + l_elem_offset + num_local_elem,
+        l_out_first),
       l_out_last);
     // Copy to remote elements preceding the local subrange:
     if (g_l_offset_begin > out_first.pos()) {
@@ -937,30 +1000,6 @@ copy_async(
 }
 #endif
 
-/**
- * Specialization of \c dash::copy as global-to-global blocking copy
- * operation.
- *
- * \ingroup  DashAlgorithms
- */
-template <
-  typename ValueType,
-  class GlobInputIt,
-  class GlobOutputIt >
-GlobOutputIt copy(
-  GlobInputIt   in_first,
-  GlobInputIt   in_last,
-  GlobOutputIt  out_first)
-{
-  DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
-
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
-
-  return GlobOutputIt();
-}
-
 #endif // DOXYGEN
 
 } // namespace dash
@@ -0,0 +1,597 @@
+#ifndef DASH__ALGORITHM__COPY_PLAN_H__
+#define DASH__ALGORITHM__COPY_PLAN_H__
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+#include <dash/iterator/IteratorTraits.h>
+
+#include <dash/algorithm/internal/Contiguous.h>
+#include <dash/algorithm/internal/LocalCopy.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_types.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Precomputed communication plan to copy a range of global elements to
+ * another global range, e.g. to shift a window of a \c dash::Array or to
+ * copy between containers with different patterns.
+ *
+ * The plan consists of the transfers of elements in the calling unit's
+ * local memory in the source pattern to the units owning their
+ * destination positions. Transfers to a destination unit consist of runs
+ * of elements that are contiguous in local memory of both units.
+ * Plans only depend on the patterns and the positions of the copied
+ * ranges and can be reused for repeated copies with the same geometry.
+ *
+ * \see dash::copy
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcPatternT,
+  class DstPatternT >
+class GlobalCopyPlan
+{
+private:
+  typedef GlobalCopyPlan<SrcPatternT, DstPatternT>      self_t;
+
+public:
+  typedef SrcPatternT                                   src_pattern_type;
+  typedef DstPatternT                                   dst_pattern_type;
+  typedef typename SrcPatternT::index_type              index_type;
+  typedef typename SrcPatternT::size_type               size_type;
+
+  /**
+   * Elements that are contiguous in local memory of the calling unit in
+   * the source pattern and in local memory of the destination unit.
+   */
+  typedef struct {
+    /// Offset of the first element in local memory of the calling unit
+    index_type src_offset;
+    /// Offset of the first element in local memory of the destination
+    /// unit
+    index_type dst_offset;
+    /// Number of elements
+    size_type  nelem;
+  } run_type;
+
+  /**
+   * Elements of the calling unit copied to a single destination unit.
+   */
+  typedef struct {
+    /// Unit in the destination pattern's team receiving the elements
+    team_unit_t           dst_unit;
+    /// Runs in ascending order of their source offset
+    std::vector<run_type> runs;
+    /// Number of elements in all runs
+    size_type             nelem;
+    /// Whether the destination unit is the calling unit
+    bool                  is_local;
+  } transfer_type;
+
+public:
+  /**
+   * Computes the transfers of the calling unit's local elements in the
+   * global source range \c [in_first, in_last) to the global destination
+   * range starting at \c out_first.
+   * Non-collective, only depends on the patterns, views and positions of
+   * the ranges.
+   */
+  template <
+    class GlobInputIt,
+    class GlobOutputIt >
+  GlobalCopyPlan(
+    const GlobInputIt  & in_first,
+    const GlobInputIt  & in_last,
+    const GlobOutputIt & out_first)
+  : _src_pattern(in_first.pattern()),
+    _dst_pattern(out_first.pattern()),
+    _in_begin(in_first.gpos()),
+    _in_end(in_first.gpos() + dash::distance(in_first, in_last)),
+    _out_begin(out_first.gpos()),
+    _nelem_total(dash::distance(in_first, in_last))
+  {
+    DASH_LOG_DEBUG("GlobalCopyPlan()",
+                   "in:",  _in_begin, "-", _in_end,
+                   "out:", _out_begin);
+    if (!GlobOutputIt::has_view::value &&
+        _out_begin + _nelem_total >
+          static_cast<index_type>(_dst_pattern.size())) {
+      DASH_THROW(
+        dash::exception::OutOfRange,
+        "GlobalCopyPlan: destination range exceeds pattern size, " <<
+        "begin: " << _out_begin << " elements: " << _nelem_total);
+    }
+    _unit_transfer_idx.resize(_dst_pattern.team().size(), -1);
+    if (_src_pattern.team().is_member(dash::myid())) {
+      init_transfers(
+        in_first, out_first,
+        std::integral_constant<
+          bool,
+          GlobInputIt::has_view::value || GlobOutputIt::has_view::value
+        >());
+    }
+    DASH_LOG_DEBUG("GlobalCopyPlan >",
+                   "transfers:", _transfers.size(),
+                   "elements:",  _nelem);
+  }
+
+  /**
+   * Pattern of the source range.
+   */
+  constexpr const SrcPatternT & src_pattern() const noexcept {
+    return _src_pattern;
+  }
+
+  /**
+   * Pattern of the destination range.
+   */
+  constexpr const DstPatternT & dst_pattern() const noexcept {
+    return _dst_pattern;
+  }
+
+  /**
+   * Number of elements in the copied range.
+   */
+  constexpr size_type size() const noexcept {
+    return _nelem_total;
+  }
+
+  /**
+   * Transfers of the calling unit's local elements in the source range.
+   */
+  constexpr const std::vector<transfer_type> & transfers() const noexcept {
+    return _transfers;
+  }
+
+  /**
+   * Number of the calling unit's local elements in the source range.
+   */
+  constexpr size_type num_local_elements() const noexcept {
+    return _nelem;
+  }
+
+  /**
+   * Whether the plan copies between the given ranges.
+   */
+  template <
+    class GlobInputIt,
+    class GlobOutputIt >
+  bool matches(
+    const GlobInputIt  & in_first,
+    const GlobInputIt  & in_last,
+    const GlobOutputIt & out_first) const
+  {
+    return _in_begin    == in_first.gpos()                         &&
+           _nelem_total == dash::distance(in_first, in_last)       &&
+           _out_begin   == out_first.gpos()                        &&
+           _src_pattern == in_first.pattern()                      &&
+           _dst_pattern == out_first.pattern();
+  }
+
+private:
+  /**
+   * Whether the \c n local elements of the calling unit starting at local
+   * offset \c l_offset are contiguous in global index space.
+   */
+  bool src_contiguous(
+    index_type l_offset,
+    index_type g_index,
+    index_type n) const
+  {
+    return n <= 1 ||
+           _src_pattern.global(l_offset + n - 1) == g_index + n - 1;
+  }
+
+  /**
+   * Whether the \c n elements starting at global index \c g_index in the
+   * destination pattern are contiguous in local memory of a single unit.
+   */
+  bool dst_contiguous(
+    index_type                                     g_index,
+    const typename DstPatternT::local_index_t    & dst_index,
+    index_type                                     n) const
+  {
+    if (n <= 1) {
+      return true;
+    }
+    auto dst_last = _dst_pattern.local(g_index + n - 1);
+    return dst_last.unit  == dst_index.unit &&
+           dst_last.index == dst_index.index + n - 1;
+  }
+
+  /**
+   * Splits the calling unit's local memory in the source pattern into
+   * segments that are contiguous in global index space, intersects them
+   * with the source range and splits the intersections at block
+   * boundaries of the destination pattern.
+   */
+  template <
+    class GlobInputIt,
+    class GlobOutputIt >
+  void init_transfers(
+    const GlobInputIt  &,
+    const GlobOutputIt &,
+    std::false_type)
+  {
+    auto l_size   = static_cast<index_type>(_src_pattern.local_size());
+    auto dst_myid = _dst_pattern.team().is_member(dash::myid())
+                    ? _dst_pattern.team().myid()
+                    : UNDEFINED_TEAM_UNIT_ID;
+    for (index_type l_offset = 0; l_offset < l_size; ) {
+      index_type g_index = _src_pattern.global(l_offset);
+      index_type nseg    = internal::max_contiguous(
+                             l_size - l_offset,
+                             [&](index_type n) {
+                               return src_contiguous(l_offset, g_index, n);
+                             });
+      // Intersection of the segment with the source range:
+      index_type g_first = std::max(g_index, _in_begin);
+      index_type g_last  = std::min(g_index + nseg, _in_end);
+      for (index_type g = g_first; g < g_last; ) {
+        index_type g_out     = _out_begin + (g - _in_begin);
+        auto       dst_index = _dst_pattern.local(g_out);
+        index_type nelem     = internal::max_contiguous(
+                                 g_last - g,
+                                 [&](index_type n) {
+                                   return dst_contiguous(
+                                            g_out, dst_index, n);
+                                 });
+        add_run(dst_index.unit, l_offset + (g - g_index),
+                dst_index.index, nelem, dst_index.unit == dst_myid);
+        g += nelem;
+      }
+      l_offset += nseg;
+    }
+  }
+
+  /**
+   * Maps the elements in ranges in views element-wise, as positions in
+   * views are not contiguous in global index space.
+   */
+  template <
+    class GlobInputIt,
+    class GlobOutputIt >
+  void init_transfers(
+    const GlobInputIt  & in_first,
+    const GlobOutputIt & out_first,
+    std::true_type)
+  {
+    auto src_myid = _src_pattern.team().myid();
+    auto dst_myid = _dst_pattern.team().is_member(dash::myid())
+                    ? _dst_pattern.team().myid()
+                    : UNDEFINED_TEAM_UNIT_ID;
+    for (index_type i = 0; i < _nelem_total; ++i) {
+      auto src_index = (in_first + i).lpos();
+      if (src_index.unit != src_myid) {
+        continue;
+      }
+      auto dst_index = (out_first + i).lpos();
+      add_run(dst_index.unit, src_index.index, dst_index.index, 1,
+              dst_index.unit == dst_myid);
+    }
+  }
+
+  void add_run(
+    team_unit_t dst_unit,
+    index_type  src_offset,
+    index_type  dst_offset,
+    index_type  nelem,
+    bool        is_local)
+  {
+    _nelem += nelem;
+    auto & ti = _unit_transfer_idx[dst_unit.id];
+    if (ti < 0) {
+      ti = _transfers.size();
+      transfer_type t;
+      t.dst_unit = dst_unit;
+      t.nelem    = 0;
+      t.is_local = is_local;
+      _transfers.push_back(t);
+    }
+    auto & t = _transfers[ti];
+    t.nelem += nelem;
+    if (!t.runs.empty()) {
+      auto & prev = t.runs.back();
+      if (prev.src_offset + static_cast<index_type>(prev.nelem)
+            == src_offset &&
+          prev.dst_offset + static_cast<index_type>(prev.nelem)
+            == dst_offset) {
+        prev.nelem += nelem;
+        return;
+      }
+    }
+    t.runs.push_back(run_type { src_offset, dst_offset,
+                                static_cast<size_type>(nelem) });
+  }
+
+private:
+  SrcPatternT                _src_pattern;
+  DstPatternT                _dst_pattern;
+  index_type                 _in_begin;
+  index_type                 _in_end;
+  index_type                 _out_begin;
+  index_type                 _nelem_total;
+  std::vector<transfer_type> _transfers;
+  /// Index of a destination unit's transfer in _transfers, -1 if the
+  /// calling unit copies no elements to the unit
+  std::vector<int>           _unit_transfer_idx;
+  size_type                  _nelem = 0;
+};
+
+/**
+ * Creates a plan to copy the global range \c [in_first, in_last) to the
+ * global range starting at \c out_first.
+ *
+ * \see dash::GlobalCopyPlan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+GlobalCopyPlan<
+  typename GlobInputIt::pattern_type,
+  typename GlobOutputIt::pattern_type >
+make_copy_plan(
+  const GlobInputIt  & in_first,
+  const GlobInputIt  & in_last,
+  const GlobOutputIt & out_first)
+{
+  return GlobalCopyPlan<
+           typename GlobInputIt::pattern_type,
+           typename GlobOutputIt::pattern_type >(
+             in_first, in_last, out_first);
+}
+
+namespace internal {
+
+/**
+ * Synchronizes the units in the given teams.
+ * Units call barriers of all teams they are member of in the same order.
+ */
+inline void copy_barrier(
+  dash::Team & src_team,
+  dash::Team & dst_team)
+{
+  if (src_team.dart_id() == dst_team.dart_id()) {
+    src_team.barrier();
+    return;
+  }
+  if (src_team.is_member(dash::myid())) {
+    src_team.barrier();
+  }
+  if (dst_team.is_member(dash::myid())) {
+    dst_team.barrier();
+  }
+}
+
+} // namespace internal
+
+/**
+ * Copies the elements in the global range \c [in_first, in_last) to the
+ * global range starting at \c out_first, using a precomputed plan.
+ *
+ * Every unit puts its local elements in the source range directly to
+ * the units owning their destination positions, elements of a
+ * destination unit are transferred in a single operation. Source and
+ * destination range may overlap, e.g. to shift a window in a container.
+ *
+ * Collective operation on the teams of source and destination range.
+ *
+ * \returns  The output iterator past the final copied element.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class PlanT >
+typename std::enable_if<
+  dash::iterator_traits<GlobInputIt>::is_global_iterator::value &&
+  dash::iterator_traits<GlobOutputIt>::is_global_iterator::value,
+  GlobOutputIt >::type
+copy(
+  GlobInputIt          in_first,
+  GlobInputIt          in_last,
+  GlobOutputIt         out_first,
+  const PlanT        & plan)
+{
+  typedef typename GlobOutputIt::value_type value_t;
+  static_assert(
+    std::is_same<value_t,
+                 typename std::remove_const<
+                   typename GlobInputIt::value_type>::type>::value,
+    "dash::copy: global ranges differ in value type");
+  typedef dash::dart_storage<value_t> storage_t;
+
+  DASH_LOG_DEBUG("dash::copy()", "global to global",
+                 "transfers:", plan.transfers().size());
+  if (!plan.matches(in_first, in_last, out_first)) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::copy: plan has not been created for the given ranges");
+  }
+  auto & src_team = in_first.pattern().team();
+  auto & dst_team = out_first.pattern().team();
+  auto & src_mem  = in_first.globmem();
+  auto & dst_mem  = out_first.globmem();
+  const value_t * src_lbegin = src_mem.lbegin();
+  // Source and destination range in the same global memory may overlap,
+  // elements must be read before any unit writes to the destination:
+  bool aliased = static_cast<const void *>(&src_mem)
+                 == static_cast<const void *>(&dst_mem);
+  std::vector<value_t> send_buffer;
+
+  // Wait for pending writes to the source range
+  internal::copy_barrier(src_team, dst_team);
+  if (aliased && plan.num_local_elements() > 0) {
+    send_buffer.reserve(plan.num_local_elements());
+    for (const auto & t : plan.transfers()) {
+      for (const auto & run : t.runs) {
+        send_buffer.insert(send_buffer.end(),
+                           src_lbegin + run.src_offset,
+                           src_lbegin + run.src_offset + run.nelem);
+      }
+    }
+  }
+  if (aliased) {
+    internal::copy_barrier(src_team, dst_team);
+  }
+
+  std::vector<dart_handle_t> handles;
+  size_t                     buffer_offset = 0;
+  for (const auto & t : plan.transfers()) {
+    if (t.is_local) {
+      value_t * dst_lbegin = dst_mem.lbegin();
+      for (const auto & run : t.runs) {
+        const value_t * src = aliased
+                              ? send_buffer.data() + buffer_offset
+                              : src_lbegin + run.src_offset;
+        dash::internal::local_copy(
+          src, src + run.nelem, dst_lbegin + run.dst_offset);
+        buffer_offset += run.nelem;
+      }
+      continue;
+    }
+    auto dst_gptr = dst_mem.at(t.dst_unit, 0).dart_gptr();
+    dart_handle_t handle;
+    if (t.runs.size() == 1) {
+      const auto & run = t.runs.front();
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&dst_gptr, run.dst_offset * sizeof(value_t)),
+        DART_OK);
+      dash::internal::put_handle(
+        dst_gptr,
+        aliased ? send_buffer.data() + buffer_offset
+                : src_lbegin + run.src_offset,
+        run.nelem, &handle);
+    } else {
+      // Runs in local memory or in the send buffer and in destination
+      // memory as indexed types, in units of the DART storage type
+      std::vector<size_t> blocklens;
+      std::vector<size_t> src_offsets;
+      std::vector<size_t> dst_offsets;
+      blocklens.reserve(t.runs.size());
+      src_offsets.reserve(t.runs.size());
+      dst_offsets.reserve(t.runs.size());
+      size_t packed_offset = 0;
+      for (const auto & run : t.runs) {
+        blocklens.push_back(storage_t(run.nelem).nelem);
+        src_offsets.push_back(
+          storage_t(aliased ? packed_offset : run.src_offset).nelem);
+        dst_offsets.push_back(storage_t(run.dst_offset).nelem);
+        packed_offset += run.nelem;
+      }
+      dart_datatype_t dst_type;
+      DASH_ASSERT_RETURNS(
+        dart_type_create_indexed(
+          storage_t::dtype, t.runs.size(),
+          blocklens.data(), dst_offsets.data(), &dst_type),
+        DART_OK);
+      dart_datatype_t src_type = storage_t::dtype;
+      const value_t * src      = send_buffer.data() + buffer_offset;
+      if (!aliased) {
+        DASH_ASSERT_RETURNS(
+          dart_type_create_indexed(
+            storage_t::dtype, t.runs.size(),
+            blocklens.data(), src_offsets.data(), &src_type),
+          DART_OK);
+        src = src_lbegin;
+      }
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(
+          dst_gptr, src, storage_t(t.nelem).nelem,
+          src_type, dst_type, &handle),
+        DART_OK);
+      // Types may be destroyed while operations are pending
+      if (!aliased) {
+        dart_type_destroy(&src_type);
+      }
+      dart_type_destroy(&dst_type);
+    }
+    buffer_offset += t.nelem;
+    if (handle != DART_HANDLE_NULL) {
+      handles.push_back(handle);
+    }
+  }
+  if (handles.size() > 0) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(handles.data(), handles.size()),
+      DART_OK);
+  }
+  // Elements in the destination range are complete when all units
+  // completed their transfers
+  internal::copy_barrier(src_team, dst_team);
+  DASH_LOG_DEBUG("dash::copy >", "global to global");
+  return out_first + plan.size();
+}
+
+/**
+ * Specialization of \c dash::copy as global-to-global blocking copy
+ * operation.
+ *
+ * Creates a copy plan on every call, use \c dash::make_copy_plan to
+ * reuse plans for repeated copies with identical geometry.
+ *
+ * Collective operation on the teams of source and destination range.
+ *
+ * \returns  The output iterator past the final copied element.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+typename std::enable_if<
+  dash::iterator_traits<GlobInputIt>::is_global_iterator::value &&
+  dash::iterator_traits<GlobOutputIt>::is_global_iterator::value,
+  GlobOutputIt >::type
+copy(
+  GlobInputIt          in_first,
+  GlobInputIt          in_last,
+  GlobOutputIt         out_first)
+{
+  auto plan = dash::make_copy_plan(in_first, in_last, out_first);
+  return dash::copy(in_first, in_last, out_first, plan);
+}
+
+/**
+ * Variant of the global-to-global \c dash::copy with explicit value type.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class GlobInputIt,
+  class GlobOutputIt >
+typename std::enable_if<
+  dash::iterator_traits<GlobInputIt>::is_global_iterator::value &&
+  dash::iterator_traits<GlobOutputIt>::is_global_iterator::value,
+  GlobOutputIt >::type
+copy(
+  GlobInputIt          in_first,
+  GlobInputIt          in_last,
+  GlobOutputIt         out_first)
+{
+  static_assert(
+    std::is_same<ValueType, typename GlobOutputIt::value_type>::value,
+    "dash::copy: value type differs from global output range");
+  auto plan = dash::make_copy_plan(in_first, in_last, out_first);
+  return dash::copy(in_first, in_last, out_first, plan);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__COPY_PLAN_H__
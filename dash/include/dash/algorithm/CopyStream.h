@@ -0,0 +1,506 @@
+#ifndef DASH__ALGORITHM__COPY_STREAM_H__
+#define DASH__ALGORITHM__COPY_STREAM_H__
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+#include <dash/iterator/IteratorTraits.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Contiguous.h>
+#include <dash/algorithm/internal/LocalCopy.h>
+#include <dash/algorithm/internal/StridedCopy.h>
+#include <dash/memory/ReadCache.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Configuration of a \c dash::CopyStream.
+ */
+struct CopyStreamConfig {
+  /// Maximum size of a chunk in bytes
+  size_t chunk_size    = 64 * 1024;
+  /// Maximum number of chunks in flight
+  size_t max_in_flight = 4;
+};
+
+namespace internal {
+
+/**
+ * Calls \c fn(unit, local_offset, offset, nelem) for every segment of the
+ * global range \c [first, last) that is contiguous in local memory of a
+ * unit, with \c offset as the position of the segment's first element in
+ * the range.
+ */
+template <
+  class GlobInputIt,
+  class SegmentFun >
+void for_each_local_segment(
+  GlobInputIt   first,
+  GlobInputIt   last,
+  SegmentFun    fn,
+  std::false_type)
+{
+  typedef typename GlobInputIt::pattern_type pattern_t;
+  typedef typename pattern_t::index_type     index_t;
+
+  const auto & pattern = first.pattern();
+  index_t      nelem   = dash::distance(first, last);
+  // Input iterators could be relative to a one-dimensional view, map to
+  // global index range:
+  index_t      g_first = first.global().pos();
+  for (index_t offset = 0; offset < nelem; ) {
+    auto   l_pos  = pattern.local(g_first + offset);
+    auto contiguous = [&](index_t n) {
+                        auto l_last = pattern.local(g_first + offset + n - 1);
+                        return l_last.unit  == l_pos.unit &&
+                               l_last.index == l_pos.index + n - 1;
+                      };
+    index_t n = max_contiguous(nelem - offset, contiguous);
+    fn(team_unit_t(l_pos.unit), l_pos.index, offset, n);
+    offset += n;
+  }
+}
+
+/**
+ * Ranges in views of multi-dimensional patterns are mapped element-wise.
+ */
+template <
+  class GlobInputIt,
+  class SegmentFun >
+void for_each_local_segment(
+  GlobInputIt   first,
+  GlobInputIt   last,
+  SegmentFun    fn,
+  std::true_type)
+{
+  typedef typename GlobInputIt::pattern_type pattern_t;
+  typedef typename pattern_t::index_type     index_t;
+
+  index_t nelem = dash::distance(first, last);
+  for (index_t offset = 0; offset < nelem; ) {
+    auto    l_pos = (first + offset).lpos();
+    index_t n     = 1;
+    while (offset + n < nelem) {
+      auto l_next = (first + offset + n).lpos();
+      if (l_next.unit != l_pos.unit || l_next.index != l_pos.index + n) {
+        break;
+      }
+      ++n;
+    }
+    fn(team_unit_t(l_pos.unit), l_pos.index, offset, n);
+    offset += n;
+  }
+}
+
+} // namespace internal
+
+/**
+ * Global-to-local copy of a range in chunks of bounded size with a
+ * bounded number of chunks in flight.
+ *
+ * Completed chunks are returned in their order of arrival, processing of
+ * a chunk can start while transfers of subsequent chunks are pending:
+ *
+ * \code
+ *   dash::CopyStreamConfig config;
+ *   config.chunk_size    = 1 << 20;
+ *   config.max_in_flight = 2;
+ *   auto stream = dash::copy_stream(array.begin(), array.end(),
+ *                                   buffer.data(), config);
+ *   dash::LocalRange<double> chunk;
+ *   while (stream.next(chunk)) {
+ *     process(chunk.begin, chunk.end);
+ *   }
+ * \endcode
+ *
+ * Elements in the calling unit's local memory are copied directly.
+ *
+ * \see dash::copy_stream
+ * \see dash::copy_chunked
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <typename ValueType>
+class CopyStream
+{
+private:
+  typedef CopyStream<ValueType> self_t;
+
+  struct chunk_t {
+    dart_gptr_t  gptr;
+    /// Offset of the first element in the destination range
+    size_t       dest_offset;
+    size_t       nelem;
+  };
+
+  struct transfer_t {
+    size_t        chunk;
+    dart_handle_t handle;
+  };
+
+public:
+  typedef dash::LocalRange<ValueType> chunk_range;
+
+public:
+  template <class GlobInputIt>
+  CopyStream(
+    GlobInputIt              in_first,
+    GlobInputIt              in_last,
+    ValueType              * out_first,
+    const CopyStreamConfig & config = CopyStreamConfig())
+  : _out_first(out_first),
+    _config(config)
+  {
+    if (_config.chunk_size == 0 || _config.max_in_flight == 0) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "CopyStream requires chunk size and chunks in flight > 0");
+    }
+    size_t chunk_nelem = std::max<size_t>(
+                           1, _config.chunk_size / sizeof(ValueType));
+    auto & globmem     = in_first.globmem();
+    auto   myid        = in_first.pattern().team().myid();
+    auto   lbegin      = globmem.lbegin();
+    _nelem             = dash::distance(in_first, in_last);
+    internal::for_each_local_segment(
+      in_first, in_last,
+      [&](team_unit_t unit, size_t l_offset, size_t offset, size_t n) {
+        if (unit == myid) {
+          // Local segments are copied when the stream is created:
+          dash::internal::local_copy(
+            lbegin + l_offset, lbegin + l_offset + n, _out_first + offset);
+          _ready.push_back(chunk_range { _out_first + offset,
+                                         _out_first + offset + n });
+          return;
+        }
+        auto gptr = globmem.at(unit, l_offset).dart_gptr();
+        for (size_t c = 0; c < n; c += chunk_nelem) {
+          chunk_t chunk;
+          chunk.gptr        = gptr;
+          chunk.dest_offset = offset + c;
+          chunk.nelem       = std::min(chunk_nelem, n - c);
+          DASH_ASSERT_RETURNS(
+            dart_gptr_incaddr(&chunk.gptr, c * sizeof(ValueType)),
+            DART_OK);
+          _chunks.push_back(chunk);
+        }
+      },
+      typename internal::is_strided_copy_range<GlobInputIt>::type());
+    DASH_LOG_DEBUG("CopyStream()",
+                   "elements:",     _nelem,
+                   "chunks:",       _chunks.size(),
+                   "local chunks:", _ready.size());
+    issue();
+  }
+
+  CopyStream(const self_t &)             = delete;
+  self_t & operator=(const self_t &)     = delete;
+
+  CopyStream(self_t && other)            = default;
+
+  /**
+   * Waits for the transfers in flight of this stream before taking over
+   * the state of \c other.
+   */
+  self_t & operator=(self_t && other)
+  {
+    if (this != &other) {
+      wait_in_flight();
+      _out_first  = other._out_first;
+      _config     = other._config;
+      _nelem      = other._nelem;
+      _chunks     = std::move(other._chunks);
+      _next_chunk = other._next_chunk;
+      _in_flight  = std::move(other._in_flight);
+      _ready      = std::move(other._ready);
+      other._in_flight.clear();
+    }
+    return *this;
+  }
+
+  /**
+   * Waits for transfers in flight, the destination range must remain
+   * valid until the stream is destroyed.
+   */
+  ~CopyStream()
+  {
+    wait_in_flight();
+  }
+
+  /**
+   * Number of elements in the copied range.
+   */
+  inline size_t size() const noexcept
+  {
+    return _nelem;
+  }
+
+  /**
+   * Number of chunks transferred from remote units.
+   */
+  inline size_t num_chunks() const noexcept
+  {
+    return _chunks.size();
+  }
+
+  /**
+   * Number of chunks currently in flight.
+   */
+  inline size_t num_in_flight() const noexcept
+  {
+    return _in_flight.size();
+  }
+
+  /**
+   * Whether all chunks have been returned by \c next or \c test.
+   */
+  inline bool done() const noexcept
+  {
+    return _ready.empty() && _in_flight.empty() &&
+           _next_chunk == _chunks.size();
+  }
+
+  /**
+   * Waits for the next completed chunk.
+   *
+   * \returns  false if all chunks have been returned.
+   */
+  bool next(chunk_range & chunk)
+  {
+    while (_ready.empty()) {
+      if (_in_flight.empty() && _next_chunk == _chunks.size()) {
+        return false;
+      }
+      progress();
+    }
+    chunk = _ready.front();
+    _ready.pop_front();
+    return true;
+  }
+
+  /**
+   * Returns a completed chunk if available, does not wait for pending
+   * transfers.
+   *
+   * \returns  false if no chunk has completed.
+   */
+  bool test(chunk_range & chunk)
+  {
+    if (_ready.empty()) {
+      progress();
+    }
+    if (_ready.empty()) {
+      return false;
+    }
+    chunk = _ready.front();
+    _ready.pop_front();
+    return true;
+  }
+
+  /**
+   * Waits for completion of all chunks that have not been returned yet.
+   *
+   * \returns  Pointer past the final element in the destination range.
+   */
+  ValueType * wait()
+  {
+    chunk_range chunk;
+    while (next(chunk)) { }
+    return _out_first + _nelem;
+  }
+
+private:
+  /**
+   * Start transfers of chunks until the maximum number of chunks is in
+   * flight.
+   */
+  void issue()
+  {
+    while (_in_flight.size() < _config.max_in_flight &&
+           _next_chunk < _chunks.size()) {
+      const auto & chunk = _chunks[_next_chunk];
+      dart_handle_t handle;
+      dash::internal::get_handle(
+        chunk.gptr, _out_first + chunk.dest_offset, chunk.nelem, &handle);
+      if (handle == DART_HANDLE_NULL) {
+        // Completed immediately, e.g. in shared memory:
+        complete(_next_chunk);
+      } else {
+        _in_flight.push_back(transfer_t { _next_chunk, handle });
+      }
+      ++_next_chunk;
+    }
+  }
+
+  /**
+   * Test chunks in flight in order of their start and refill the window.
+   */
+  void progress()
+  {
+    for (auto it = _in_flight.begin(); it != _in_flight.end(); ) {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(dart_test_local(&it->handle, &flag), DART_OK);
+      if (flag) {
+        complete(it->chunk);
+        it = _in_flight.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    issue();
+  }
+
+  void complete(size_t chunk_idx)
+  {
+    const auto & chunk = _chunks[chunk_idx];
+    _ready.push_back(chunk_range {
+                       _out_first + chunk.dest_offset,
+                       _out_first + chunk.dest_offset + chunk.nelem });
+  }
+
+  /**
+   * Wait for all transfers in flight without returning their chunks.
+   */
+  void wait_in_flight()
+  {
+    for (auto & transfer : _in_flight) {
+      dart_wait_local(&transfer.handle);
+    }
+    _in_flight.clear();
+  }
+
+private:
+  ValueType                * _out_first;
+  CopyStreamConfig           _config;
+  size_t                     _nelem      = 0;
+  std::vector<chunk_t>       _chunks;
+  /// Index of the next chunk to transfer
+  size_t                     _next_chunk = 0;
+  std::vector<transfer_t>    _in_flight;
+  /// Completed chunks that have not been returned yet
+  std::deque<chunk_range>    _ready;
+};
+
+/**
+ * Creates a \c dash::CopyStream copying the global range
+ * \c [in_first, in_last) to local memory at \c out_first in chunks.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class GlobInputIt >
+CopyStream<ValueType> copy_stream(
+  GlobInputIt              in_first,
+  GlobInputIt              in_last,
+  ValueType              * out_first,
+  const CopyStreamConfig & config = CopyStreamConfig())
+{
+  return CopyStream<ValueType>(in_first, in_last, out_first, config);
+}
+
+/**
+ * Copies the global range \c [in_first, in_last) to local memory at
+ * \c out_first in chunks and calls \c chunk_fn(first, last) for every
+ * completed chunk in order of arrival.
+ *
+ * \returns  Pointer past the final element in the destination range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class GlobInputIt,
+  class ChunkFun >
+ValueType * copy_chunked(
+  GlobInputIt              in_first,
+  GlobInputIt              in_last,
+  ValueType              * out_first,
+  ChunkFun                 chunk_fn,
+  const CopyStreamConfig & config = CopyStreamConfig())
+{
+  CopyStream<ValueType> stream(in_first, in_last, out_first, config);
+  typename CopyStream<ValueType>::chunk_range chunk;
+  while (stream.next(chunk)) {
+    chunk_fn(chunk.begin, chunk.end);
+  }
+  return out_first + stream.size();
+}
+
+/**
+ * Hint that the elements in the global range \c [first, last) will be
+ * read soon.
+ *
+ * Starts fetching remote elements into the read cache of the range's
+ * container without waiting for completion, subsequent reads of the
+ * elements wait for their transfer.
+ * Without an enabled read cache, the hint has no effect.
+ *
+ * \returns  true if any elements of the range are prefetched.
+ *
+ * \see dash::ReadCache
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobInputIt>
+typename std::enable_if<
+  dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
+  bool >::type
+prefetch(
+  GlobInputIt first,
+  GlobInputIt last)
+{
+  typedef typename GlobInputIt::value_type value_t;
+  if (!dash::internal::read_caches_active() || first == last) {
+    return false;
+  }
+  auto & globmem    = first.globmem();
+  auto   myid       = first.pattern().team().myid();
+  bool   prefetched = false;
+  internal::for_each_local_segment(
+    first, last,
+    [&](team_unit_t unit, size_t l_offset, size_t, size_t n) {
+      if (unit == myid) {
+        return;
+      }
+      prefetched |= dash::internal::read_cache_prefetch(
+                      globmem.at(unit, l_offset).dart_gptr(),
+                      n * sizeof(value_t));
+    },
+    typename internal::is_strided_copy_range<GlobInputIt>::type());
+  return prefetched;
+}
+
+/**
+ * Hint that the elements in the given view or container will be read
+ * soon.
+ *
+ * \see dash::prefetch(GlobInputIt, GlobInputIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class ViewType>
+typename std::enable_if<
+  dash::iterator_traits<
+    decltype(std::declval<ViewType>().begin())
+  >::is_global_iterator::value,
+  bool >::type
+prefetch(const ViewType & view)
+{
+  return dash::prefetch(view.begin(), view.end());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__COPY_STREAM_H__
@@ -8,7 +8,7 @@
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 
-#include <dash/util/UnitLocality.h>
+#include <dash/util/Locality.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -49,8 +49,7 @@ void fill(
   value_t * llast       = index_range.end;
 
 #ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
+  auto n_threads = dash::util::Locality::NumUnitDomainThreads();
   auto nlocal    = llast - lfirst;
   DASH_LOG_DEBUG("dash::fill", "thread capacity:",  n_threads);
   #pragma omp parallel for num_threads(n_threads)
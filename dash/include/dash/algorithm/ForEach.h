@@ -3,6 +3,7 @@
 
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/util/Trace.h>
 
 #include <algorithm>
 
@@ -46,15 +47,23 @@ void for_each(
   auto lbegin_index = index_range.begin;
   auto lend_index   = index_range.end;
   auto & team       = first.pattern().team();
+  static const dash::util::TraceName trace_for_each("for_each");
+  static const dash::util::TraceName trace_local("local");
+  static const dash::util::TraceName trace_barrier("barrier");
+  dash::util::Trace trace(trace_for_each);
   if (lbegin_index != lend_index) {
+    trace.enter_state(trace_local);
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
     // Local range to native pointers:
     auto lrange_begin = (first + pattern.global(lbegin_index)).local();
     auto lrange_end   = lrange_begin + lend_index;
     std::for_each(lrange_begin, lrange_end, func);
+    trace.exit_state(trace_local);
   }
+  trace.enter_state(trace_barrier);
   team.barrier();
+  trace.exit_state(trace_barrier);
 }
 
 /**
@@ -95,7 +104,13 @@ void for_each_with_index(
   auto lbegin_index = index_range.begin;
   auto lend_index   = index_range.end;
   auto & team       = first.pattern().team();
+  static const dash::util::TraceName trace_for_each_with_index(
+                                       "for_each_with_index");
+  static const dash::util::TraceName trace_local("local");
+  static const dash::util::TraceName trace_barrier("barrier");
+  dash::util::Trace trace(trace_for_each_with_index);
   if (lbegin_index != lend_index) {
+    trace.enter_state(trace_local);
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
     auto first_offset = first.pos();
@@ -107,8 +122,11 @@ void for_each_with_index(
       auto element_it   = first + (gindex - first_offset);
       func(*(element_it.local()), gindex);
     }
+    trace.exit_state(trace_local);
   }
+  trace.enter_state(trace_barrier);
   team.barrier();
+  trace.exit_state(trace_barrier);
 }
 
 } // namespace dash
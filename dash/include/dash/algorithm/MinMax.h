@@ -9,7 +9,7 @@
 
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
-#include <dash/util/UnitLocality.h>
+#include <dash/util/Locality.h>
 
 #include <dash/iterator/GlobIter.h>
 #include <dash/internal/Logging.h>
@@ -55,8 +55,7 @@ const ElementType * min_element(
 {
 #ifdef DASH_ENABLE_OPENMP
   typedef typename std::decay<ElementType>::type      value_t;
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
+  auto n_threads = dash::util::Locality::NumUnitDomainThreads();
   DASH_LOG_DEBUG("dash::min_element", "thread capacity:",  n_threads);
 
   // TODO: Should also restrict on elements/units > ~10240.
@@ -69,7 +68,7 @@ const ElementType * min_element(
     typedef struct min_pos_t { value_t val; size_t idx; } min_pos;
 
     DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
-    int       align_bytes      = uloc.cache_line_size(0);
+    int       align_bytes      = dash::util::Locality::CacheLineSize(0);
     size_t    min_vals_t_size  = n_threads + 1 +
                                  (align_bytes / sizeof(min_pos));
     size_t    min_vals_t_bytes = min_vals_t_size * sizeof(min_pos);
@@ -173,7 +172,11 @@ GlobInputIt min_element(
     return last;
   }
 
-  dash::util::Trace trace("min_element");
+  static const dash::util::TraceName trace_min_element("min_element");
+  static const dash::util::TraceName trace_local("local");
+  static const dash::util::TraceName trace_barrier("barrier");
+  static const dash::util::TraceName trace_allgather("allgather");
+  dash::util::Trace trace(trace_min_element);
 
   auto & pattern = first.pattern();
   auto & team    = pattern.team();
@@ -192,7 +195,7 @@ GlobInputIt min_element(
     // local range is empty
     DASH_LOG_DEBUG("dash::min_element", "local range empty");
   } else {
-    trace.enter_state("local");
+    trace.enter_state(trace_local);
 
     // Pointer to first element in local memory:
     const value_t * lbegin        = first.globmem().lbegin();
@@ -208,16 +211,16 @@ GlobInputIt min_element(
       l_idx_lmin = lmin - lbegin;
     }
 
-    trace.exit_state("local");
+    trace.exit_state(trace_local);
   }
   DASH_LOG_TRACE("dash::min_element",
                  "local index of local minimum:", l_idx_lmin);
   DASH_LOG_TRACE("dash::min_element",
                  "waiting for local min of other units");
 
-  trace.enter_state("barrier");
+  trace.enter_state(trace_barrier);
   team.barrier();
-  trace.exit_state("barrier");
+  trace.exit_state(trace_barrier);
 
   typedef struct {
     value_t  value;
@@ -241,7 +244,7 @@ GlobInputIt min_element(
                  "g.index:", local_min.g_index, "}");
 
   DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
+  trace.enter_state(trace_allgather);
   DASH_ASSERT_RETURNS(
     dart_allgather(
       &local_min,
@@ -250,7 +253,7 @@ GlobInputIt min_element(
       DART_TYPE_BYTE,
       team.dart_id()),
     DART_OK);
-  trace.exit_state("allgather");
+  trace.exit_state(trace_allgather);
 
 #ifdef DASH_ENABLE_LOGGING
   for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
@@ -0,0 +1,482 @@
+#ifndef DASH__ALGORITHM__REDISTRIBUTE_H__
+#define DASH__ALGORITHM__REDISTRIBUTE_H__
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+
+#include <dash/algorithm/internal/Contiguous.h>
+#include <dash/algorithm/internal/LocalCopy.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_types.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Precomputed communication plan to redistribute the elements of a
+ * container with pattern \c SrcPatternT to a container with pattern
+ * \c DstPatternT.
+ *
+ * The plan consists of the transfers required to fill the calling unit's
+ * local memory in the destination pattern. Every transfer is a
+ * contiguous or strided range in local memory of a single unit in the
+ * source pattern.
+ * Plans only depend on the patterns and can be reused for any pair of
+ * containers with identical patterns, e.g. in iterative solvers.
+ *
+ * Source and destination patterns may be allocated in different teams.
+ *
+ * \see dash::redistribute
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcPatternT,
+  class DstPatternT >
+class RedistributionPlan
+{
+  static_assert(SrcPatternT::ndim() == DstPatternT::ndim(),
+                "Patterns of redistribution differ in dimensions");
+
+private:
+  typedef RedistributionPlan<SrcPatternT, DstPatternT>  self_t;
+
+  static constexpr dim_t NumDimensions = DstPatternT::ndim();
+
+public:
+  typedef SrcPatternT                                   src_pattern_type;
+  typedef DstPatternT                                   dst_pattern_type;
+  typedef typename DstPatternT::index_type              index_type;
+  typedef typename DstPatternT::size_type               size_type;
+
+  /**
+   * Transfer of \c count blocks of \c nelem elements from the local
+   * memory of unit \c src_unit in the source pattern to the local memory
+   * of the calling unit in the destination pattern.
+   */
+  typedef struct {
+    /// Unit in the source pattern's team holding the elements
+    team_unit_t src_unit;
+    /// Offset of the first element in the source unit's local memory
+    index_type  src_offset;
+    /// Offset of the first element in local memory of the destination
+    index_type  dst_offset;
+    /// Number of contiguous elements in every block
+    size_type   nelem;
+    /// Number of blocks
+    size_type   count;
+    /// Distance of the blocks in source local memory
+    size_type   src_stride;
+    /// Distance of the blocks in destination local memory
+    size_type   dst_stride;
+    /// Whether the source unit is the calling unit
+    bool        is_local;
+  } transfer_type;
+
+public:
+  /**
+   * Computes the transfers to redistribute the calling unit's local
+   * elements in the destination pattern.
+   * Non-collective, only depends on the patterns.
+   */
+  RedistributionPlan(
+    const SrcPatternT & src_pattern,
+    const DstPatternT & dst_pattern)
+  : _src_pattern(src_pattern),
+    _dst_pattern(dst_pattern)
+  {
+    DASH_LOG_DEBUG("RedistributionPlan()");
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      if (src_pattern.extent(d) != dst_pattern.extent(d)) {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "RedistributionPlan: extents of source and destination "
+          "pattern differ in dimension " << d);
+      }
+    }
+    if (dst_pattern.team().is_member(dash::myid())) {
+      init_transfers();
+    }
+    DASH_LOG_DEBUG("RedistributionPlan >",
+                   "transfers:", _transfers.size(),
+                   "local elements:", _num_local_elements);
+  }
+
+  /**
+   * Pattern of the redistributed container.
+   */
+  constexpr const SrcPatternT & src_pattern() const noexcept {
+    return _src_pattern;
+  }
+
+  /**
+   * Pattern of the container receiving the redistributed elements.
+   */
+  constexpr const DstPatternT & dst_pattern() const noexcept {
+    return _dst_pattern;
+  }
+
+  /**
+   * Transfers to fill the calling unit's local memory.
+   */
+  constexpr const std::vector<transfer_type> & transfers() const noexcept {
+    return _transfers;
+  }
+
+  /**
+   * Number of elements copied from the calling unit's own local memory
+   * in the source pattern.
+   */
+  constexpr size_type num_local_elements() const noexcept {
+    return _num_local_elements;
+  }
+
+  /**
+   * Whether the plan redistributes between the given patterns.
+   */
+  bool matches(
+    const SrcPatternT & src_pattern,
+    const DstPatternT & dst_pattern) const
+  {
+    return _src_pattern == src_pattern &&
+           _dst_pattern == dst_pattern;
+  }
+
+private:
+  typedef std::array<index_type, NumDimensions> coords_t;
+
+  /**
+   * Whether the next \c n elements starting at the given local
+   * coordinates in the destination pattern are contiguous in local
+   * memory, in global index space and in local memory of the source
+   * unit.
+   */
+  bool is_contiguous(
+    const coords_t                                   & l_coords,
+    const coords_t                                   & g_coords,
+    index_type                                         dst_offset,
+    const typename SrcPatternT::local_index_t        & src_index,
+    index_type                                         n) const
+  {
+    if (n <= 1) {
+      return true;
+    }
+    coords_t l_last = l_coords;
+    l_last[NumDimensions-1] += n - 1;
+    if (_dst_pattern.local_at(l_last) != dst_offset + n - 1) {
+      return false;
+    }
+    coords_t g_last = _dst_pattern.global(l_last);
+    coords_t g_exp  = g_coords;
+    g_exp[NumDimensions-1] += n - 1;
+    if (g_last != g_exp) {
+      return false;
+    }
+    auto src_last = _src_pattern.local_index(g_last);
+    return src_last.unit  == src_index.unit &&
+           src_last.index == src_index.index + n - 1;
+  }
+
+  /**
+   * Splits the calling unit's local rows in the destination pattern into
+   * segments located at a single source unit and merges segments with
+   * constant strides into strided transfers.
+   */
+  void init_transfers()
+  {
+    auto l_extents = _dst_pattern.local_extents();
+    auto row_len   = static_cast<index_type>(l_extents[NumDimensions-1]);
+    if (_dst_pattern.local_size() == 0 || row_len == 0) {
+      return;
+    }
+    index_type nrows = 1;
+    for (dim_t d = 0; d < NumDimensions - 1; ++d) {
+      nrows *= l_extents[d];
+    }
+    auto src_myid = _src_pattern.team().is_member(dash::myid())
+                    ? _src_pattern.team().myid()
+                    : UNDEFINED_TEAM_UNIT_ID;
+    // Index of the most recent transfer starting at a local column,
+    // candidates for extension to a strided transfer:
+    std::map<index_type, std::size_t> open_transfers;
+
+    coords_t l_coords {{ }};
+    for (index_type row = 0; row < nrows; ++row) {
+      index_type r = row;
+      for (dim_t d = NumDimensions - 1; d > 0; --d) {
+        l_coords[d-1] = r % l_extents[d-1];
+        r            /= l_extents[d-1];
+      }
+      index_type col = 0;
+      while (col < row_len) {
+        l_coords[NumDimensions-1] = col;
+        auto g_coords   = _dst_pattern.global(l_coords);
+        auto dst_offset = _dst_pattern.local_at(l_coords);
+        auto src_index  = _src_pattern.local_index(g_coords);
+        index_type nelem = internal::max_contiguous(
+                             row_len - col,
+                             [&](index_type n) {
+                               return is_contiguous(l_coords, g_coords,
+                                                    dst_offset, src_index,
+                                                    n);
+                             });
+        add_segment(open_transfers, col, src_index.unit,
+                    src_index.index, dst_offset, nelem,
+                    src_index.unit == src_myid);
+        col += nelem;
+      }
+    }
+  }
+
+  void add_segment(
+    std::map<index_type, std::size_t> & open_transfers,
+    index_type                          col,
+    team_unit_t                         src_unit,
+    index_type                          src_offset,
+    index_type                          dst_offset,
+    index_type                          nelem,
+    bool                                is_local)
+  {
+    if (is_local) {
+      _num_local_elements += nelem;
+    }
+    auto open = open_transfers.find(col);
+    if (open != open_transfers.end()) {
+      auto & t = _transfers[open->second];
+      auto src_last = t.src_offset + (t.count - 1) * t.src_stride;
+      auto dst_last = t.dst_offset + (t.count - 1) * t.dst_stride;
+      if (t.src_unit == src_unit &&
+          static_cast<index_type>(t.nelem) == nelem &&
+          src_offset > src_last && dst_offset > dst_last) {
+        size_type src_stride = src_offset - src_last;
+        size_type dst_stride = dst_offset - dst_last;
+        if (src_stride < t.nelem || dst_stride < t.nelem) {
+          // blocks would overlap
+        } else if (t.count == 1) {
+          t.src_stride = src_stride;
+          t.dst_stride = dst_stride;
+          t.count      = 2;
+          return;
+        } else if (t.src_stride == src_stride &&
+                   t.dst_stride == dst_stride) {
+          t.count++;
+          return;
+        }
+      }
+    }
+    transfer_type t;
+    t.src_unit   = src_unit;
+    t.src_offset = src_offset;
+    t.dst_offset = dst_offset;
+    t.nelem      = nelem;
+    t.count      = 1;
+    t.src_stride = nelem;
+    t.dst_stride = nelem;
+    t.is_local   = is_local;
+    open_transfers[col] = _transfers.size();
+    _transfers.push_back(t);
+  }
+
+private:
+  SrcPatternT                _src_pattern;
+  DstPatternT                _dst_pattern;
+  std::vector<transfer_type> _transfers;
+  size_type                  _num_local_elements = 0;
+};
+
+/**
+ * Creates a plan to redistribute the elements of container \c src to
+ * the distribution of container \c dst.
+ *
+ * \see dash::RedistributionPlan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcContainerT,
+  class DstContainerT >
+RedistributionPlan<
+  typename SrcContainerT::pattern_type,
+  typename DstContainerT::pattern_type >
+make_redistribution_plan(
+  const SrcContainerT & src,
+  const DstContainerT & dst)
+{
+  return RedistributionPlan<
+           typename SrcContainerT::pattern_type,
+           typename DstContainerT::pattern_type >(
+             src.pattern(), dst.pattern());
+}
+
+namespace internal {
+
+/**
+ * Synchronizes the units in the teams of the given containers.
+ * Units call barriers of all teams they are member of in the same order.
+ */
+template <
+  class SrcContainerT,
+  class DstContainerT >
+void redistribute_barrier(
+  const SrcContainerT & src,
+  const DstContainerT & dst)
+{
+  auto & src_team = src.team();
+  auto & dst_team = dst.team();
+  if (src_team.dart_id() == dst_team.dart_id()) {
+    src_team.barrier();
+    return;
+  }
+  if (src_team.is_member(dash::myid())) {
+    src_team.barrier();
+  }
+  if (dst_team.is_member(dash::myid())) {
+    dst_team.barrier();
+  }
+}
+
+} // namespace internal
+
+/**
+ * Copies all elements of container \c src to container \c dst with
+ * identical extents but different pattern, using a precomputed plan.
+ *
+ * Every unit reads its local elements in \c dst from the source units in
+ * a single one-sided epoch. Elements in the unit's own local memory of
+ * \c src are copied directly.
+ *
+ * Collective operation on the teams of \c src and \c dst.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcContainerT,
+  class DstContainerT,
+  class PlanT >
+void redistribute(
+  /// Container to redistribute
+  const SrcContainerT & src,
+  /// Container receiving the elements of \c src
+  DstContainerT       & dst,
+  /// Redistribution plan created for the patterns of \c src and \c dst
+  const PlanT         & plan)
+{
+  typedef typename DstContainerT::value_type value_t;
+  static_assert(
+    std::is_same<value_t,
+                 typename std::remove_const<
+                   typename SrcContainerT::value_type>::type>::value,
+    "dash::redistribute: containers differ in value type");
+
+  DASH_LOG_DEBUG("dash::redistribute()",
+                 "transfers:", plan.transfers().size());
+  if (!plan.matches(src.pattern(), dst.pattern())) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::redistribute: plan has not been created for the patterns of "
+      "source and destination container");
+  }
+  // Wait for pending writes to the source container
+  internal::redistribute_barrier(src, dst);
+
+  auto         & src_mem = src.begin().globmem();
+  const value_t* src_lbegin = src.lbegin();
+  value_t      * dst_lbegin = dst.lbegin();
+
+  typedef dash::dart_storage<value_t> storage_t;
+
+  std::vector<dart_handle_t> handles;
+  for (const auto & t : plan.transfers()) {
+    if (t.is_local) {
+      for (std::size_t b = 0; b < t.count; ++b) {
+        auto src_first = src_lbegin + t.src_offset + b * t.src_stride;
+        dash::internal::local_copy(
+          src_first, src_first + t.nelem,
+          dst_lbegin + t.dst_offset + b * t.dst_stride);
+      }
+      continue;
+    }
+    auto src_gptr = src_mem.at(t.src_unit, t.src_offset).dart_gptr();
+    dart_handle_t handle;
+    if (t.count == 1) {
+      dash::internal::get_handle(
+        src_gptr, dst_lbegin + t.dst_offset, t.nelem, &handle);
+    } else {
+      // Strided transfer, strides and block lengths in units of the
+      // DART storage type
+      storage_t block(t.nelem);
+      storage_t src_stride(t.src_stride);
+      storage_t dst_stride(t.dst_stride);
+      storage_t total(t.nelem * t.count);
+      dart_datatype_t src_type;
+      dart_datatype_t dst_type;
+      DASH_ASSERT_RETURNS(
+        dart_type_create_strided(
+          storage_t::dtype, src_stride.nelem, block.nelem, &src_type),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_type_create_strided(
+          storage_t::dtype, dst_stride.nelem, block.nelem, &dst_type),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_get_handle(
+          dst_lbegin + t.dst_offset, src_gptr, total.nelem,
+          src_type, dst_type, &handle),
+        DART_OK);
+      // Types may be destroyed while operations are pending
+      dart_type_destroy(&src_type);
+      dart_type_destroy(&dst_type);
+    }
+    if (handle != DART_HANDLE_NULL) {
+      handles.push_back(handle);
+    }
+  }
+  if (handles.size() > 0) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall_local(handles.data(), handles.size()),
+      DART_OK);
+  }
+  // Elements of the source container must not be modified before all
+  // units completed their transfers
+  internal::redistribute_barrier(src, dst);
+  DASH_LOG_DEBUG("dash::redistribute >");
+}
+
+/**
+ * Copies all elements of container \c src to container \c dst with
+ * identical extents but different pattern.
+ *
+ * Creates a redistribution plan on every call, use
+ * \c dash::make_redistribution_plan to reuse plans for repeated
+ * redistributions between the same patterns.
+ *
+ * Collective operation on the teams of \c src and \c dst.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcContainerT,
+  class DstContainerT >
+void redistribute(
+  /// Container to redistribute
+  const SrcContainerT & src,
+  /// Container receiving the elements of \c src
+  DstContainerT       & dst)
+{
+  auto plan = dash::make_redistribution_plan(src, dst);
+  dash::redistribute(src, dst, plan);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REDISTRIBUTE_H__
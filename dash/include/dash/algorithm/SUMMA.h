@@ -7,7 +7,13 @@
 #include <dash/Future.h>
 #include <dash/algorithm/Copy.h>
 #include <dash/util/Trace.h>
+#include <dash/algorithm/internal/GEMM.h>
 
+#ifdef DASH_ENABLE_OPENMP
+#include <dash/util/Locality.h>
+#endif
+
+#include <type_traits>
 #include <utility>
 
 // Prefer MKL if available:
@@ -29,65 +35,143 @@ extern "C"
 
 namespace dash {
 
+/**
+ * Backends of the local matrix multiplication of matrix blocks in
+ * \c dash::summa.
+ */
+enum class gemm_backend : int {
+  /// Built-in cache-blocked GEMM kernel, always available.
+  builtin = 0,
+  /// CBLAS interface of the BLAS library DASH has been built with, e.g.
+  /// MKL, OpenBLAS or BLIS.
+  blas
+};
+
+/**
+ * Whether the given local GEMM backend is available in the current
+ * build configuration.
+ */
+bool gemm_backend_available(
+  dash::gemm_backend backend);
+
+/**
+ * The local GEMM backend used by \c dash::summa.
+ *
+ * Selected by the configuration key \c DASH_GEMM_BACKEND, either set as
+ * environment variable or via \c dash::util::Config.
+ * Accepted values are \c "builtin" and \c "blas", defaults to the BLAS
+ * backend if available.
+ * Falls back to the built-in backend if the requested backend is not
+ * available.
+ *
+ * \see dash::util::Config
+ */
+dash::gemm_backend summa_gemm_backend();
+
+/**
+ * Name of the given local GEMM backend, the name of the BLAS library
+ * for \c dash::gemm_backend::blas.
+ */
+const char * gemm_backend_name(
+  dash::gemm_backend backend);
+
 namespace internal {
 
 #if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 /**
- * Matrix multiplication for local multiplication of matrix blocks via MKL.
+ * Matrix multiplication for local multiplication of matrix blocks via
+ * CBLAS, specialized for \c float and \c double.
  */
-template<typename  ValueType>
-void mmult_local(
-  /// Matrix to multiply, m rows by k columns.
+void mmult_local_blas(
+  const float     * A,
+  const float     * B,
+  float           * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage);
+
+void mmult_local_blas(
+  const double    * A,
+  const double    * B,
+  double          * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage);
+
+template<typename ValueType>
+struct has_blas_gemm
+: std::integral_constant<bool,
+    std::is_same<ValueType, float>::value ||
+    std::is_same<ValueType, double>::value>
+{ };
+
+template<typename ValueType>
+inline bool mmult_local_blas_dispatch(
   const ValueType * A,
-  /// Matrix to multiply, k rows by n columns.
   const ValueType * B,
-  /// Matrix to contain the multiplication result, m rows by n columns.
   ValueType       * C,
   long long         m,
   long long         n,
   long long         k,
-  MemArrange        storage);
-#else
+  MemArrange        storage,
+  std::true_type)
+{
+  mmult_local_blas(A, B, C, m, n, k, storage);
+  return true;
+}
+#endif // defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
+
+template<typename ValueType>
+inline bool mmult_local_blas_dispatch(
+  const ValueType *,
+  const ValueType *,
+  ValueType       *,
+  long long,
+  long long,
+  long long,
+  MemArrange,
+  std::false_type)
+{
+  return false;
+}
+
 /**
- * Naive matrix multiplication for local multiplication of matrix blocks,
- * used only for tests and where MKL is not available.
+ * Matrix multiplication C += A x B for local multiplication of matrix
+ * blocks, using the backend selected by \c dash::summa_gemm_backend.
+ *
+ * Value types not supported by the BLAS backend are multiplied by the
+ * built-in kernel.
  */
 template<typename ValueType>
 void mmult_local(
-  /// Matrix to multiply, extents n x m
+  /// Matrix to multiply, m rows by k columns.
   const ValueType * A,
-  /// Matrix to multiply, extents m x p
+  /// Matrix to multiply, k rows by n columns.
   const ValueType * B,
-  /// Matrix to contain the multiplication result, extents n x p
+  /// Matrix to contain the multiplication result, m rows by n columns.
   ValueType       * C,
   long long         m,
   long long         n,
-  long long         p,
+  long long         k,
   MemArrange        storage)
 {
-#ifndef DEBUG
-  DASH_THROW(
-    dash::exception::RuntimeError,
-    "Called fallback implementation of DGEMM (only enabled in Debug)");
-#endif
-  ValueType c_sum = 0;
-  for (auto i = 0; i < n; ++i) {
-    // row i = 0...n
-    for (auto j = 0; j < p; ++j) {
-      // column j = 0...p
-      c_sum = C[i * p + j]; // = C[j][i]
-      for (auto k = 0; k < m; ++k) {
-        // k = 0...m
-        auto ik     = i * m + k;
-        auto kj     = k * m + j;
-        auto value  = A[ik] * B[kj];
-        c_sum      += value;
-      }
-      C[i * p + j] = c_sum; // C[j][i] = c_sum
-    }
+#if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
+  if (dash::summa_gemm_backend() == dash::gemm_backend::blas &&
+      mmult_local_blas_dispatch(A, B, C, m, n, k, storage,
+                                has_blas_gemm<ValueType>())) {
+    return;
   }
+#endif
+  int n_threads = 1;
+#ifdef DASH_ENABLE_OPENMP
+  n_threads = dash::util::Locality::NumUnitDomainThreads();
+  DASH_LOG_TRACE("dash::internal::mmult_local", "thread capacity:",
+                 n_threads);
+#endif
+  dash::internal::gemm_builtin(A, B, C, m, n, k, storage, n_threads);
 }
-#endif // defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 
 } // namespace internal
 
@@ -356,9 +440,13 @@ void summa(
                  "unit:",  block_a.begin().lpos().unit,
                  "view:",  block_a.begin().viewspec());
 
-  dash::util::Trace trace("SUMMA");
+  static const dash::util::TraceName trace_summa("SUMMA");
+  static const dash::util::TraceName trace_prefetch("prefetch");
+  static const dash::util::TraceName trace_multiply("multiply");
+  static const dash::util::TraceName trace_barrier("barrier");
+  dash::util::Trace trace(trace_summa);
 
-  trace.enter_state("prefetch");
+  trace.enter_state(trace_prefetch);
   if (block_a_lptr == nullptr) {
 #ifdef DASH_ALGORITHM_SUMMA_ASYNC_INIT_PREFETCH
     get_a = dash::copy_async(block_a.begin(), block_a.end(),
@@ -407,7 +495,7 @@ void summa(
     get_b.wait();
   }
 #endif
-  trace.exit_state("prefetch");
+  trace.exit_state(trace_prefetch);
 
   DASH_LOG_TRACE("dash::summa", "summa.block",
                  "prefetching of blocks completed");
@@ -511,7 +599,7 @@ void summa(
                      "C.local.block.comp:", lb,
                      "view:", l_block_c_comp.begin().viewspec());
 
-      trace.enter_state("multiply");
+      trace.enter_state(trace_multiply);
       dash::internal::mmult_local<value_type>(
           local_block_a_comp,
           local_block_b_comp,
@@ -520,7 +608,7 @@ void summa(
           block_size_n,
           block_size_p,
           memory_order);
-      trace.exit_state("multiply");
+      trace.exit_state(trace_multiply);
 
       if (local_block_a_comp_bac != nullptr) {
         local_block_a_comp     = local_block_a_comp_bac;
@@ -534,7 +622,7 @@ void summa(
         // -------------------------------------------------------------------
         // Wait for local copies:
         // -------------------------------------------------------------------
-        trace.enter_state("prefetch");
+        trace.enter_state(trace_prefetch);
         if (block_a_lptr == nullptr) {
           DASH_LOG_TRACE("dash::summa", "summa.prefetch.block.a.wait",
                          "waiting for prefetching of block A from unit",
@@ -549,7 +637,7 @@ void summa(
         }
         DASH_LOG_TRACE("dash::summa", "summa.prefetch.completed",
                        "local copies of next blocks received");
-        trace.exit_state("prefetch");
+        trace.exit_state(trace_prefetch);
 
         // -----------------------------------------------------------------
         // Swap communication and computation buffers:
@@ -582,9 +670,9 @@ void summa(
 #endif
 
   DASH_LOG_TRACE("dash::summa", "waiting for other units");
-  trace.enter_state("barrier");
+  trace.enter_state(trace_barrier);
   C.barrier();
-  trace.exit_state("barrier");
+  trace.exit_state(trace_barrier);
 
   DASH_LOG_TRACE("dash::summa >", "finished");
 }
@@ -11,6 +11,7 @@
 #include <dash/Iterator.h>
 
 #include <dash/internal/Config.h>
+#include <dash/util/Locality.h>
 #include <dash/util/Trace.h>
 
 #include <dash/dart/if/dart_communication.h>
@@ -231,8 +232,7 @@ GlobOutputIt transform_local(
   ValueType * lbegin_out = (out_first  + g_offset_first).local();
   // Generate output values:
 #ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
+  auto n_threads = dash::util::Locality::NumUnitDomainThreads();
   DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
   if (n_threads > 1) {
     auto l_size = lend_a - lbegin_a;
@@ -295,7 +295,11 @@ GlobOutputIt transform(
     // in_last  = in_range.end();
   }
 
-  dash::util::Trace trace("transform");
+  static const dash::util::TraceName trace_transform("transform");
+  static const dash::util::TraceName trace_local("local");
+  static const dash::util::TraceName trace_transform_blocking(
+                                       "transform_blocking");
+  dash::util::Trace trace(trace_transform);
 
   // Pattern of input ranges a and b, and output range:
   auto pattern_in_a = in_a_first.pattern();
@@ -309,7 +313,7 @@ GlobOutputIt transform(
     // Identical pattern in all ranges
     if (in_a_first.pos() == in_b_first.pos() &&
         in_a_first.pos() == out_first.pos()) {
-      trace.enter_state("local");
+      trace.enter_state(trace_local);
       // All units operate on local ranges that have identical distribution:
       auto out_last = dash::transform_local<iterator_traits::value_type>(
                         in_a_first,
@@ -317,7 +321,7 @@ GlobOutputIt transform(
                         in_b_first,
                         out_first,
                         binary_op);
-      trace.exit_state("local");
+      trace.exit_state(trace_local);
       return out_last;
     }
   }
@@ -347,13 +351,13 @@ GlobOutputIt transform(
   // Native pointer to local sub-range:
   auto l_values          = (in_a_first + global_offset).local();
   // Send accumulate message:
-  trace.enter_state("transform_blocking");
+  trace.enter_state(trace_transform_blocking);
   dash::internal::transform_blocking_impl(
       dest_gptr,
       l_values,
       num_local_elements,
       binary_op.dart_operation());
-  trace.exit_state("transform_blocking");
+  trace.exit_state(trace_transform_blocking);
 
   return out_first + global_offset + num_local_elements;
 
@@ -399,7 +403,10 @@ GlobOutputIt transform(
     in_last  = in_first + in_range.size();
   }
 
-  dash::util::Trace trace("transform");
+  static const dash::util::TraceName trace_transform("transform");
+  static const dash::util::TraceName trace_transform_blocking(
+                                       "transform_blocking");
+  dash::util::Trace trace(trace_transform);
 
   // Resolve local range from global range:
   // Number of elements in local range:
@@ -407,13 +414,13 @@ GlobOutputIt transform(
   // Global iterator to dart_gptr_t:
   dart_gptr_t dest_gptr         = out_first.dart_gptr();
   // Send accumulate message:
-  trace.enter_state("transform_blocking");
+  trace.enter_state(trace_transform_blocking);
   dash::internal::transform_blocking_impl(
       dest_gptr,
       in_first,
       num_local_elements,
       binary_op.dart_operation());
-  trace.exit_state("transform_blocking");
+  trace.exit_state(trace_transform_blocking);
   // The position past the last element transformed in global element space
   // cannot be resolved from the size of the local range if the local range
   // spans over more than one block. Otherwise, the difference of two global
@@ -0,0 +1,497 @@
+#ifndef DASH__ALGORITHM__TRANSPOSE_H__
+#define DASH__ALGORITHM__TRANSPOSE_H__
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+
+#include <dash/algorithm/Redistribute.h>
+#include <dash/pattern/PatternProperties.h>
+#include <dash/internal/Logging.h>
+#include <dash/internal/Math.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_types.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Edge length of the tiles transposed by \c transpose_local, chosen such
+ * that a tile of input and output rows fits into the L1 cache.
+ */
+constexpr std::size_t transpose_local_tile = 32;
+
+/**
+ * Cache-blocked transposition of a \c rows x \c cols block in local
+ * memory with row strides \c in_stride and \c out_stride.
+ *
+ * The inner loop writes consecutive elements of an output row and can be
+ * vectorized by the compiler.
+ */
+template <typename ValueType>
+void transpose_local(
+  /// First element of the input block
+  const ValueType * in,
+  /// Number of rows of the input block
+  std::size_t       rows,
+  /// Number of columns of the input block
+  std::size_t       cols,
+  /// Distance of rows in the input block
+  std::size_t       in_stride,
+  /// First element of the output block with extents \c cols x \c rows
+  ValueType       * out,
+  /// Distance of rows in the output block
+  std::size_t       out_stride)
+{
+  constexpr auto tile = transpose_local_tile;
+  for (std::size_t ib = 0; ib < rows; ib += tile) {
+    auto i_end = std::min(ib + tile, rows);
+    for (std::size_t jb = 0; jb < cols; jb += tile) {
+      auto j_end = std::min(jb + tile, cols);
+      for (std::size_t j = jb; j < j_end; ++j) {
+        const ValueType * in_col  = in  + j;
+        ValueType       * out_row = out + j * out_stride;
+        for (std::size_t i = ib; i < i_end; ++i) {
+          out_row[i] = in_col[i * in_stride];
+        }
+      }
+    }
+  }
+}
+
+} // namespace internal
+
+/**
+ * Precomputed communication plan to transpose a two-dimensional matrix
+ * with pattern \c SrcPatternT into a matrix with pattern \c DstPatternT.
+ *
+ * For every block of the calling unit in the destination pattern, the
+ * plan contains the intersections of the transposed block with the
+ * blocks of the source pattern. Every intersection is a rectangle in
+ * local memory of a single source unit that is fetched in a single
+ * strided transfer and transposed locally.
+ *
+ * Requires patterns with rectangular blocks.
+ *
+ * \see dash::transpose
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcPatternT,
+  class DstPatternT >
+class TransposePlan
+{
+  static_assert(SrcPatternT::ndim() == 2 && DstPatternT::ndim() == 2,
+                "dash::transpose requires two-dimensional patterns");
+  static_assert(
+    dash::pattern_partitioning_traits<SrcPatternT>::type::rectangular &&
+    dash::pattern_partitioning_traits<DstPatternT>::type::rectangular,
+    "dash::transpose requires patterns with rectangular blocks");
+
+public:
+  typedef SrcPatternT                                   src_pattern_type;
+  typedef DstPatternT                                   dst_pattern_type;
+  typedef typename DstPatternT::index_type              index_type;
+  typedef typename DstPatternT::size_type               size_type;
+
+  /**
+   * Transfer of a \c rows x \c cols block in local memory of unit
+   * \c src_unit in the source pattern, stored transposed in local memory
+   * of the calling unit in the destination pattern.
+   */
+  typedef struct {
+    /// Unit in the source pattern's team holding the block
+    team_unit_t src_unit;
+    /// Offset of the block in the source unit's local memory
+    index_type  src_offset;
+    /// Distance of the block's rows in source local memory
+    size_type   src_stride;
+    /// Offset of the transposed block in local memory of the destination
+    index_type  dst_offset;
+    /// Distance of the transposed block's rows in destination local
+    /// memory
+    size_type   dst_stride;
+    /// Number of rows of the block in the source pattern
+    size_type   rows;
+    /// Number of columns of the block in the source pattern
+    size_type   cols;
+    /// Whether the source unit is the calling unit
+    bool        is_local;
+  } transfer_type;
+
+public:
+  /**
+   * Computes the transfers to fill the calling unit's local memory in the
+   * destination pattern.
+   * Non-collective, only depends on the patterns.
+   */
+  TransposePlan(
+    const SrcPatternT & src_pattern,
+    const DstPatternT & dst_pattern)
+  : _src_pattern(src_pattern),
+    _dst_pattern(dst_pattern)
+  {
+    DASH_LOG_DEBUG("TransposePlan()");
+    if (src_pattern.extent(0) != dst_pattern.extent(1) ||
+        src_pattern.extent(1) != dst_pattern.extent(0)) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "TransposePlan: extents of destination pattern must be "
+        "transposed extents of source pattern");
+    }
+    if (dst_pattern.team().is_member(dash::myid())) {
+      init_transfers();
+    }
+    DASH_LOG_DEBUG("TransposePlan >", "transfers:", _transfers.size());
+  }
+
+  /**
+   * Pattern of the transposed matrix.
+   */
+  constexpr const SrcPatternT & src_pattern() const noexcept {
+    return _src_pattern;
+  }
+
+  /**
+   * Pattern of the matrix receiving the transposed elements.
+   */
+  constexpr const DstPatternT & dst_pattern() const noexcept {
+    return _dst_pattern;
+  }
+
+  /**
+   * Transfers to fill the calling unit's local memory.
+   */
+  constexpr const std::vector<transfer_type> & transfers() const noexcept {
+    return _transfers;
+  }
+
+  /**
+   * Number of elements received from other units.
+   */
+  constexpr size_type num_remote_elements() const noexcept {
+    return _num_remote_elements;
+  }
+
+  /**
+   * Whether the plan transposes between the given patterns.
+   */
+  bool matches(
+    const SrcPatternT & src_pattern,
+    const DstPatternT & dst_pattern) const
+  {
+    return _src_pattern == src_pattern &&
+           _dst_pattern == dst_pattern;
+  }
+
+private:
+  typedef std::array<index_type, 2> coords_t;
+
+  void init_transfers()
+  {
+    auto src_myid = _src_pattern.team().is_member(dash::myid())
+                    ? _src_pattern.team().myid()
+                    : UNDEFINED_TEAM_UNIT_ID;
+    auto dst_myid = _dst_pattern.team().myid();
+
+    size_type dst_bs[2]  = {
+                static_cast<size_type>(_dst_pattern.blocksize(0)),
+                static_cast<size_type>(_dst_pattern.blocksize(1)) };
+    size_type src_bs[2]  = {
+                static_cast<size_type>(_src_pattern.blocksize(0)),
+                static_cast<size_type>(_src_pattern.blocksize(1)) };
+    size_type dst_ext[2] = {
+                static_cast<size_type>(_dst_pattern.extent(0)),
+                static_cast<size_type>(_dst_pattern.extent(1)) };
+
+    // Blocks of the destination pattern at the calling unit
+    for (size_type bi = 0; bi < dst_ext[0]; bi += dst_bs[0]) {
+      for (size_type bj = 0; bj < dst_ext[1]; bj += dst_bs[1]) {
+        coords_t block_first {{ static_cast<index_type>(bi),
+                                static_cast<index_type>(bj) }};
+        if (_dst_pattern.unit_at(block_first) != dst_myid) {
+          continue;
+        }
+        // Transposed block in the source pattern, rows [r_first, r_last)
+        // and columns [c_first, c_last)
+        size_type r_first = bj;
+        size_type r_last  = std::min(bj + dst_bs[1], dst_ext[1]);
+        size_type c_first = bi;
+        size_type c_last  = std::min(bi + dst_bs[0], dst_ext[0]);
+        // Intersections with blocks of the source pattern
+        for (size_type r = r_first; r < r_last;) {
+          size_type r_end = std::min(r_last, (r / src_bs[0] + 1) * src_bs[0]);
+          for (size_type c = c_first; c < c_last;) {
+            size_type c_end = std::min(c_last,
+                                       (c / src_bs[1] + 1) * src_bs[1]);
+            add_transfer(r, r_end, c, c_end, src_myid);
+            c = c_end;
+          }
+          r = r_end;
+        }
+      }
+    }
+  }
+
+  void add_transfer(
+    size_type   r_first,
+    size_type   r_last,
+    size_type   c_first,
+    size_type   c_last,
+    team_unit_t src_myid)
+  {
+    coords_t src_first {{ static_cast<index_type>(r_first),
+                          static_cast<index_type>(c_first) }};
+    coords_t dst_first {{ static_cast<index_type>(c_first),
+                          static_cast<index_type>(r_first) }};
+    auto src_index = _src_pattern.local_index(src_first);
+
+    transfer_type t;
+    t.src_unit   = src_index.unit;
+    t.src_offset = src_index.index;
+    t.dst_offset = _dst_pattern.local_index(dst_first).index;
+    t.rows       = r_last - r_first;
+    t.cols       = c_last - c_first;
+    t.src_stride = t.cols;
+    t.dst_stride = t.rows;
+    t.is_local   = (src_index.unit == src_myid);
+    // Elements of a block are mapped row-wise with constant stride:
+    if (t.rows > 1) {
+      coords_t src_next {{ src_first[0] + 1, src_first[1] }};
+      t.src_stride = _src_pattern.local_index(src_next).index
+                     - t.src_offset;
+    }
+    if (t.cols > 1) {
+      coords_t dst_next {{ dst_first[0] + 1, dst_first[1] }};
+      t.dst_stride = _dst_pattern.local_index(dst_next).index
+                     - t.dst_offset;
+    }
+    if (!t.is_local) {
+      _num_remote_elements += t.rows * t.cols;
+    }
+    _transfers.push_back(t);
+  }
+
+private:
+  SrcPatternT                _src_pattern;
+  DstPatternT                _dst_pattern;
+  std::vector<transfer_type> _transfers;
+  size_type                  _num_remote_elements = 0;
+};
+
+/**
+ * Creates a plan to transpose matrix \c src into matrix \c dst.
+ *
+ * \see dash::TransposePlan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcMatrixT,
+  class DstMatrixT >
+TransposePlan<
+  typename SrcMatrixT::pattern_type,
+  typename DstMatrixT::pattern_type >
+make_transpose_plan(
+  const SrcMatrixT & src,
+  const DstMatrixT & dst)
+{
+  return TransposePlan<
+           typename SrcMatrixT::pattern_type,
+           typename DstMatrixT::pattern_type >(
+             src.pattern(), dst.pattern());
+}
+
+/**
+ * Stores the transpose of the two-dimensional matrix \c src in matrix
+ * \c dst, using a precomputed plan.
+ *
+ * Every unit fetches the blocks of the source matrix intersecting its
+ * local blocks in \c dst in a single one-sided epoch, using one strided
+ * transfer per block, and transposes them locally.
+ *
+ * If \c src and \c dst refer to the same square matrix, the matrix is
+ * transposed in place. All blocks are then fetched into temporary
+ * buffers before local memory is overwritten.
+ *
+ * Collective operation on the teams of \c src and \c dst.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcMatrixT,
+  class DstMatrixT,
+  class PlanT >
+void transpose(
+  /// Matrix to transpose
+  const SrcMatrixT & src,
+  /// Matrix receiving the transposed elements of \c src
+  DstMatrixT       & dst,
+  /// Transpose plan created for the patterns of \c src and \c dst
+  const PlanT      & plan)
+{
+  typedef typename DstMatrixT::value_type value_t;
+  static_assert(
+    std::is_same<value_t,
+                 typename std::remove_const<
+                   typename SrcMatrixT::value_type>::type>::value,
+    "dash::transpose: matrices differ in value type");
+
+  DASH_LOG_DEBUG("dash::transpose()",
+                 "transfers:", plan.transfers().size());
+  if (!plan.matches(src.pattern(), dst.pattern())) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::transpose: plan has not been created for the patterns of "
+      "source and destination matrix");
+  }
+  bool in_place = (static_cast<const void *>(&src) ==
+                   static_cast<const void *>(&dst));
+
+  // Wait for pending writes to the source matrix
+  internal::redistribute_barrier(src, dst);
+
+  auto          & src_mem    = src.begin().globmem();
+  const value_t * src_lbegin = src.lbegin();
+  value_t       * dst_lbegin = dst.lbegin();
+
+  typedef dash::dart_storage<value_t> storage_t;
+
+  // Buffers of fetched blocks, also for local blocks if transposed in
+  // place:
+  std::size_t buf_size = plan.num_remote_elements();
+  if (in_place) {
+    buf_size = dst.local_size();
+  }
+  std::unique_ptr<value_t[]> buffer(new value_t[buf_size]);
+  std::vector<const value_t *> block_buf(plan.transfers().size(), nullptr);
+  std::vector<dart_handle_t>   handles;
+
+  std::size_t buf_offset = 0;
+  for (std::size_t ti = 0; ti < plan.transfers().size(); ++ti) {
+    const auto & t = plan.transfers()[ti];
+    if (t.is_local) {
+      if (in_place) {
+        value_t * block = buffer.get() + buf_offset;
+        for (std::size_t r = 0; r < t.rows; ++r) {
+          auto row = src_lbegin + t.src_offset + r * t.src_stride;
+          std::copy(row, row + t.cols, block + r * t.cols);
+        }
+        block_buf[ti] = block;
+        buf_offset   += t.rows * t.cols;
+      }
+      continue;
+    }
+    value_t * block    = buffer.get() + buf_offset;
+    block_buf[ti]      = block;
+    buf_offset        += t.rows * t.cols;
+    auto      src_gptr = src_mem.at(t.src_unit, t.src_offset).dart_gptr();
+    dart_handle_t handle;
+    if (t.rows == 1 || t.src_stride == t.cols) {
+      dash::internal::get_handle(src_gptr, block, t.rows * t.cols, &handle);
+    } else {
+      storage_t row(t.cols);
+      storage_t stride(t.src_stride);
+      storage_t total(t.rows * t.cols);
+      dart_datatype_t src_type;
+      DASH_ASSERT_RETURNS(
+        dart_type_create_strided(
+          storage_t::dtype, stride.nelem, row.nelem, &src_type),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_get_handle(
+          block, src_gptr, total.nelem, src_type, storage_t::dtype,
+          &handle),
+        DART_OK);
+      dart_type_destroy(&src_type);
+    }
+    if (handle != DART_HANDLE_NULL) {
+      handles.push_back(handle);
+    }
+  }
+  // Transpose local blocks while remote blocks are in transit
+  if (!in_place) {
+    for (const auto & t : plan.transfers()) {
+      if (t.is_local) {
+        internal::transpose_local(
+          src_lbegin + t.src_offset, t.rows, t.cols, t.src_stride,
+          dst_lbegin + t.dst_offset, t.dst_stride);
+      }
+    }
+  }
+  if (handles.size() > 0) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall_local(handles.data(), handles.size()),
+      DART_OK);
+  }
+  if (in_place) {
+    // All units must have fetched their blocks before local memory is
+    // overwritten
+    dst.team().barrier();
+  }
+  for (std::size_t ti = 0; ti < plan.transfers().size(); ++ti) {
+    const auto & t = plan.transfers()[ti];
+    if (block_buf[ti] != nullptr) {
+      internal::transpose_local(
+        block_buf[ti], t.rows, t.cols, t.cols,
+        dst_lbegin + t.dst_offset, t.dst_stride);
+    }
+  }
+  // Elements of the source matrix must not be modified before all units
+  // completed their transfers
+  internal::redistribute_barrier(src, dst);
+  DASH_LOG_DEBUG("dash::transpose >");
+}
+
+/**
+ * Stores the transpose of the two-dimensional matrix \c src in matrix
+ * \c dst.
+ *
+ * Creates a transpose plan on every call, use \c dash::make_transpose_plan
+ * to reuse plans for repeated transpositions between the same patterns.
+ *
+ * Collective operation on the teams of \c src and \c dst.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class SrcMatrixT,
+  class DstMatrixT >
+void transpose(
+  /// Matrix to transpose
+  const SrcMatrixT & src,
+  /// Matrix receiving the transposed elements of \c src
+  DstMatrixT       & dst)
+{
+  auto plan = dash::make_transpose_plan(src, dst);
+  dash::transpose(src, dst, plan);
+}
+
+/**
+ * Transposes the square two-dimensional matrix \c matrix in place.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class MatrixT>
+void transpose(
+  /// Matrix to transpose
+  MatrixT & matrix)
+{
+  dash::transpose(static_cast<const MatrixT &>(matrix), matrix);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__TRANSPOSE_H__
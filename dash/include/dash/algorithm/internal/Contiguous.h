@@ -0,0 +1,45 @@
+#ifndef DASH__ALGORITHM__INTERNAL__CONTIGUOUS_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__CONTIGUOUS_H__INCLUDED
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Length of the longest prefix of a range of \c nmax elements for which
+ * \c contiguous holds, at least 1.
+ *
+ * Contiguity of a segment must imply contiguity of all its prefixes,
+ * so the length is found in a binary search with logarithmic number of
+ * calls of \c contiguous.
+ */
+template <
+  typename IndexType,
+  class    ContiguousFun >
+IndexType max_contiguous(
+  /// Number of elements in the range
+  IndexType     nmax,
+  /// Predicate called with a number of elements, returns true if the
+  /// range's prefix of this size is contiguous
+  ContiguousFun contiguous)
+{
+  if (contiguous(nmax)) {
+    return nmax;
+  }
+  IndexType lo = 1;
+  IndexType hi = nmax - 1;
+  while (lo < hi) {
+    IndexType mid = lo + (hi - lo + 1) / 2;
+    if (contiguous(mid)) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return lo;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__CONTIGUOUS_H__INCLUDED
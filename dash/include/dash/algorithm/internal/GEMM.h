@@ -0,0 +1,261 @@
+#ifndef DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/internal/Config.h>
+#include <dash/internal/Math.h>
+
+#include <algorithm>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Blocking parameters of the built-in GEMM kernel.
+ *
+ * The micro-kernel updates a tile of \c MR x \c NR elements of C held in
+ * registers; \c NR spans two 256-bit vector registers for 32- and 64-bit
+ * value types.
+ * A panel of \c MC x \c KC elements of A is packed to fit into the L2
+ * cache, a panel of \c KC x \c NC elements of B is shared by all threads.
+ */
+template<typename ValueType>
+struct gemm_blocking
+{
+  static constexpr long long MR = 4;
+  static constexpr long long NR = (sizeof(ValueType) <= 8)
+                                  ? 64 / sizeof(ValueType)
+                                  : 4;
+  static constexpr long long KC = 256;
+  static constexpr long long MC = 24 * MR;
+  static constexpr long long NC = 512 * NR;
+};
+
+/**
+ * Packs the block A[0:mc, 0:kc] into consecutive micro-panels of \c MR
+ * rows each, stored column by column.
+ * Rows exceeding \c mc in the last micro-panel are padded with zeros.
+ */
+template<typename ValueType>
+void gemm_pack_a(
+  const ValueType * A,
+  long long         lda,
+  long long         mc,
+  long long         kc,
+  ValueType       * packed)
+{
+  constexpr auto MR = gemm_blocking<ValueType>::MR;
+  for (long long ir = 0; ir < mc; ir += MR) {
+    auto mr = std::min(MR, mc - ir);
+    for (long long p = 0; p < kc; ++p) {
+      for (long long i = 0; i < mr; ++i) {
+        packed[i] = A[(ir + i) * lda + p];
+      }
+      for (long long i = mr; i < MR; ++i) {
+        packed[i] = ValueType();
+      }
+      packed += MR;
+    }
+  }
+}
+
+/**
+ * Packs the micro-panel B[0:kc, 0:nr] of at most \c NR columns, stored
+ * row by row.
+ * Columns exceeding \c nr are padded with zeros.
+ */
+template<typename ValueType>
+void gemm_pack_b_panel(
+  const ValueType * B,
+  long long         ldb,
+  long long         kc,
+  long long         nr,
+  ValueType       * packed)
+{
+  constexpr auto NR = gemm_blocking<ValueType>::NR;
+  for (long long p = 0; p < kc; ++p) {
+    const ValueType * b_row = B + p * ldb;
+    for (long long j = 0; j < nr; ++j) {
+      packed[j] = b_row[j];
+    }
+    for (long long j = nr; j < NR; ++j) {
+      packed[j] = ValueType();
+    }
+    packed += NR;
+  }
+}
+
+/**
+ * Micro-kernel computing C[0:mr, 0:nr] += A_p x B_p for packed
+ * micro-panels \c A_p (\c MR x \c kc) and \c B_p (\c kc x \c NR).
+ *
+ * The accumulator tile has compile-time extents so it is kept in vector
+ * registers and the inner loop is vectorized by the compiler.
+ */
+template<typename ValueType>
+inline void gemm_micro_kernel(
+  long long         kc,
+  const ValueType * a_packed,
+  const ValueType * b_packed,
+  ValueType       * C,
+  long long         ldc,
+  long long         mr,
+  long long         nr)
+{
+  constexpr auto MR = gemm_blocking<ValueType>::MR;
+  constexpr auto NR = gemm_blocking<ValueType>::NR;
+
+  ValueType acc[MR][NR];
+  for (long long i = 0; i < MR; ++i) {
+    for (long long j = 0; j < NR; ++j) {
+      acc[i][j] = ValueType();
+    }
+  }
+  for (long long p = 0; p < kc; ++p) {
+    const ValueType * a = a_packed + p * MR;
+    const ValueType * b = b_packed + p * NR;
+    for (long long i = 0; i < MR; ++i) {
+      const ValueType a_i = a[i];
+#ifdef DASH_ENABLE_OPENMP
+      #pragma omp simd
+#endif
+      for (long long j = 0; j < NR; ++j) {
+        acc[i][j] += a_i * b[j];
+      }
+    }
+  }
+  if (mr == MR && nr == NR) {
+    for (long long i = 0; i < MR; ++i) {
+      for (long long j = 0; j < NR; ++j) {
+        C[i * ldc + j] += acc[i][j];
+      }
+    }
+  } else {
+    for (long long i = 0; i < mr; ++i) {
+      for (long long j = 0; j < nr; ++j) {
+        C[i * ldc + j] += acc[i][j];
+      }
+    }
+  }
+}
+
+/**
+ * Built-in matrix multiplication C += A x B of row-major matrices with
+ * extents \c m x \c k (A), \c k x \c n (B) and \c m x \c n (C).
+ *
+ * Cache-blocked following the GotoBLAS scheme: panels of B and A are
+ * packed into contiguous buffers sized for the L3 and L2 cache,
+ * respectively, and multiplied by a register-tiled micro-kernel.
+ * Row panels of C are distributed among \c n_threads OpenMP threads if
+ * available.
+ */
+template<typename ValueType>
+void gemm_builtin(
+  const ValueType * A,
+  long long         lda,
+  const ValueType * B,
+  long long         ldb,
+  ValueType       * C,
+  long long         ldc,
+  long long         m,
+  long long         n,
+  long long         k,
+  int               n_threads = 1)
+{
+  typedef gemm_blocking<ValueType> blocking;
+  constexpr auto MR = blocking::MR;
+  constexpr auto NR = blocking::NR;
+  constexpr auto KC = blocking::KC;
+  constexpr auto MC = blocking::MC;
+  constexpr auto NC = blocking::NC;
+
+  if (m <= 0 || n <= 0 || k <= 0) {
+    return;
+  }
+  auto num_mc_blocks = dash::math::div_ceil(m, MC);
+  n_threads = std::max<int>(
+                1, std::min<long long>(n_threads, num_mc_blocks));
+
+  std::vector<ValueType> b_packed(
+    KC * dash::math::div_ceil(std::min(n, NC), NR) * NR);
+  std::vector<ValueType> a_packed(n_threads * MC * KC);
+
+  for (long long jc = 0; jc < n; jc += NC) {
+    auto nc         = std::min(NC, n - jc);
+    auto num_panels = dash::math::div_ceil(nc, NR);
+    for (long long pc = 0; pc < k; pc += KC) {
+      auto kc = std::min(KC, k - pc);
+#ifdef DASH_ENABLE_OPENMP
+      #pragma omp parallel num_threads(n_threads)
+#endif
+      {
+#ifdef DASH_ENABLE_OPENMP
+        ValueType * a_buf = a_packed.data() +
+                            omp_get_thread_num() * MC * KC;
+        #pragma omp for
+#else
+        ValueType * a_buf = a_packed.data();
+#endif
+        for (long long jp = 0; jp < num_panels; ++jp) {
+          gemm_pack_b_panel(B + pc * ldb + jc + jp * NR, ldb, kc,
+                            std::min(NR, nc - jp * NR),
+                            b_packed.data() + jp * NR * kc);
+        }
+#ifdef DASH_ENABLE_OPENMP
+        #pragma omp for schedule(dynamic)
+#endif
+        for (long long ib = 0; ib < num_mc_blocks; ++ib) {
+          auto ic = ib * MC;
+          auto mc = std::min(MC, m - ic);
+          gemm_pack_a(A + ic * lda + pc, lda, mc, kc, a_buf);
+          for (long long jr = 0; jr < nc; jr += NR) {
+            auto nr = std::min(NR, nc - jr);
+            for (long long ir = 0; ir < mc; ir += MR) {
+              auto mr = std::min(MR, mc - ir);
+              gemm_micro_kernel(kc,
+                                a_buf + ir * kc,
+                                b_packed.data() + jr * kc,
+                                C + (ic + ir) * ldc + jc + jr, ldc,
+                                mr, nr);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Built-in matrix multiplication C += A x B of matrices with extents
+ * \c m x \c k (A), \c k x \c n (B) and \c m x \c n (C), all stored
+ * contiguously in the given memory order.
+ */
+template<typename ValueType>
+void gemm_builtin(
+  const ValueType * A,
+  const ValueType * B,
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage,
+  int               n_threads = 1)
+{
+  if (storage == dash::ROW_MAJOR) {
+    gemm_builtin(A, k, B, n, C, n, m, n, k, n_threads);
+  } else {
+    // Column-major C is row-major C^T = B^T x A^T:
+    gemm_builtin(B, k, A, m, C, m, n, m, k, n_threads);
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
@@ -0,0 +1,187 @@
+#ifndef DASH__ALGORITHM__INTERNAL__LOCAL_COPY_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__LOCAL_COPY_H__INCLUDED
+
+#include <dash/util/Locality.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Size thresholds in bytes selecting the kernel of
+ * \c dash::internal::local_copy.
+ */
+typedef struct {
+  /// Copies up to this size are inlined element-wise
+  size_t small_bytes;
+  /// Copies of at least this size use non-temporal stores
+  size_t streaming_bytes;
+  /// Copies of at least this size are split among the unit's threads
+  size_t parallel_bytes;
+  /// Maximum number of threads a copy is split among
+  int    parallel_threads;
+} local_copy_thresholds_t;
+
+/**
+ * Thresholds of \c local_copy, derived from the calling unit's cache
+ * sizes and number of threads on first use.
+ * Returned by reference so they can be adjusted, e.g. in tests.
+ */
+inline local_copy_thresholds_t & local_copy_thresholds()
+{
+  static local_copy_thresholds_t thresholds = []() {
+    local_copy_thresholds_t t;
+    // Size of the last level cache, copies exceeding it would evict
+    // the entire cache:
+    size_t llc_size = 0;
+    for (int level = 0; level < DART_LOCALITY_MAX_CACHE_LEVELS; ++level) {
+      llc_size = std::max(
+                   llc_size, dash::util::Locality::CacheSize(level));
+    }
+    if (llc_size == 0) {
+      llc_size = 8 * 1024 * 1024;
+    }
+    t.small_bytes      = 4 * dash::util::Locality::CacheLineSize(0);
+    t.streaming_bytes  = llc_size;
+    t.parallel_bytes   = 4 * llc_size;
+    t.parallel_threads = dash::util::Locality::NumUnitDomainThreads();
+    return t;
+  }();
+  return thresholds;
+}
+
+/**
+ * Copies \c nbytes bytes using non-temporal stores that bypass the
+ * cache hierarchy, for copies exceeding the last level cache.
+ */
+inline void copy_streaming(
+  char       * dst,
+  const char * src,
+  size_t       nbytes)
+{
+#ifdef __SSE2__
+  // Align destination to 16 bytes:
+  size_t head = (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15;
+  head        = std::min(head, nbytes);
+  std::memcpy(dst, src, head);
+  dst        += head;
+  src        += head;
+  nbytes     -= head;
+  size_t nvec = nbytes / 64;
+  for (size_t v = 0; v < nvec; ++v) {
+    __m128i x0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 32));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 48));
+    _mm_stream_si128(reinterpret_cast<__m128i *>(dst),      x0);
+    _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 16), x1);
+    _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 32), x2);
+    _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 48), x3);
+    src += 64;
+    dst += 64;
+  }
+  std::memcpy(dst, src, nbytes - nvec * 64);
+  // Make non-temporal stores visible to subsequent loads:
+  _mm_sfence();
+#else
+  std::memcpy(dst, src, nbytes);
+#endif
+}
+
+/**
+ * Copies \c nbytes bytes, selecting the kernel by size.
+ */
+inline void copy_bytes(
+  char       * dst,
+  const char * src,
+  size_t       nbytes)
+{
+  const auto & thresholds = local_copy_thresholds();
+  if (nbytes < thresholds.streaming_bytes) {
+    std::memcpy(dst, src, nbytes);
+    return;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  int n_threads = thresholds.parallel_threads;
+  if (nbytes >= thresholds.parallel_bytes && n_threads > 1 &&
+      !omp_in_parallel()) {
+    // Chunks of at least the streaming threshold in multiples of 64 bytes:
+    n_threads = static_cast<int>(
+                  std::min<size_t>(
+                    n_threads, nbytes / thresholds.streaming_bytes));
+    #pragma omp parallel num_threads(n_threads)
+    {
+      // The runtime may provide fewer threads than requested, split by
+      // the actual number of threads:
+      size_t nchunks = omp_get_num_threads();
+      // Ceiling division so the chunks cover the entire range:
+      size_t chunk   = ((nbytes + nchunks - 1) / nchunks + 63)
+                       & ~static_cast<size_t>(63);
+      size_t offset  = omp_get_thread_num() * chunk;
+      if (offset < nbytes) {
+        copy_streaming(dst + offset, src + offset,
+                       std::min(chunk, nbytes - offset));
+      }
+    }
+    return;
+  }
+#endif
+  copy_streaming(dst, src, nbytes);
+}
+
+/**
+ * Copies the elements in the local range \c [in_first, in_last) to the
+ * non-overlapping local range starting at \c out_first.
+ *
+ * Trivially copyable elements are copied with a kernel selected by the
+ * size of the range:
+ *
+ * - small ranges element-wise in an inlined loop,
+ * - ranges below the size of the last level cache with \c memcpy,
+ * - larger ranges with non-temporal stores,
+ * - very large ranges split among the unit's threads if OpenMP is
+ *   enabled.
+ *
+ * \returns  Pointer past the final element in the destination range.
+ */
+template <typename ValueType>
+inline ValueType * local_copy(
+  const ValueType * in_first,
+  const ValueType * in_last,
+  ValueType       * out_first)
+{
+  if (!std::is_trivially_copyable<ValueType>::value) {
+    return std::copy(in_first, in_last, out_first);
+  }
+  size_t nelem  = in_last - in_first;
+  size_t nbytes = nelem * sizeof(ValueType);
+  if (nbytes <= local_copy_thresholds().small_bytes) {
+    for (size_t i = 0; i < nelem; ++i) {
+      out_first[i] = in_first[i];
+    }
+  } else {
+    copy_bytes(reinterpret_cast<char *>(out_first),
+               reinterpret_cast<const char *>(in_first),
+               nbytes);
+  }
+  return out_first + nelem;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__LOCAL_COPY_H__INCLUDED
@@ -0,0 +1,336 @@
+#ifndef DASH__ALGORITHM__INTERNAL__STRIDED_COPY_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__STRIDED_COPY_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/algorithm/internal/LocalCopy.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Whether global-to-local copies of ranges of the global iterator type
+ * are performed by \c dash::internal::StridedCopy, i.e. for iterators
+ * in views of multi-dimensional patterns.
+ */
+template <class GlobIterType>
+struct is_strided_copy_range
+: std::integral_constant<
+    bool,
+    GlobIterType::has_view::value &&
+    (GlobIterType::pattern_type::ndim() > 1) >
+{ };
+
+/**
+ * Global-to-local copy of a range in a view of a multi-dimensional
+ * pattern, e.g. a range in a sub-matrix.
+ *
+ * Elements in the range are collected in runs of elements that are
+ * contiguous in the local memory of their unit. The runs at a unit are
+ * transferred in a single operation using an indexed data type and
+ * unpacked to their position in the destination range, elements at the
+ * calling unit are copied directly.
+ *
+ * The destination range holds the elements in the iteration order of
+ * the view, i.e. in row-major order of the view's extents.
+ */
+template <typename ValueType>
+class StridedCopy
+{
+private:
+  typedef dash::dart_storage<ValueType> storage_t;
+
+  /// Elements that are contiguous in a unit's local memory
+  struct run_t {
+    /// Offset of the first element in the unit's local memory
+    size_t offset;
+    /// Offset of the first element in the destination range
+    size_t dest_offset;
+    size_t nelem;
+  };
+
+  struct unit_transfer_t {
+    team_unit_t                  unit;
+    std::vector<run_t>           runs;
+    size_t                       nelem  = 0;
+    /// Buffer receiving elements that are not contiguous in the
+    /// destination range
+    std::unique_ptr<ValueType[]> buffer;
+  };
+
+public:
+  template <class GlobInputIt>
+  StridedCopy(
+    GlobInputIt   in_first,
+    GlobInputIt   in_last,
+    ValueType   * out_first)
+  : _out_first(out_first)
+  {
+    typedef typename GlobInputIt::pattern_type pattern_t;
+    typedef typename pattern_t::index_type     index_t;
+    constexpr dim_t ndim = pattern_t::ndim();
+
+    const auto & pattern = in_first.pattern();
+    const auto   view    = in_first.viewspec();
+    auto       & globmem = in_first.globmem();
+    _nelem               = dash::distance(in_first, in_last);
+    _lbegin              = globmem.lbegin();
+    _myid                = pattern.team().myid();
+    _unit_transfer_idx.resize(pattern.team().size(), -1);
+
+    DASH_LOG_TRACE("StridedCopy()", "view:", view, "nelem:", _nelem);
+
+    index_t r_first   = in_first.rpos();
+    index_t r_last    = r_first + _nelem;
+    auto    row_ext   = view.extent(ndim - 1);
+    auto    blocksize = pattern.blocksize(ndim - 1);
+    std::array<index_t, ndim> coords;
+    for (index_t r_idx = r_first; r_idx < r_last; ) {
+      // Coordinates of the element at position r_idx in the view:
+      index_t r = r_idx;
+      for (dim_t d = ndim; d > 0; --d) {
+        coords[d-1] = view.offset(d-1) + r % view.extent(d-1);
+        r          /= view.extent(d-1);
+      }
+      index_t row_first = coords[ndim-1];
+      index_t row_last  = row_first +
+                          std::min<index_t>(
+                            row_ext - (row_first - view.offset(ndim-1)),
+                            r_last - r_idx);
+      size_t  dest      = r_idx - r_first;
+      // Split the row segment at block boundaries:
+      for (index_t col = row_first; col < row_last; ) {
+        coords[ndim-1]  = col;
+        auto lpos       = pattern.local_index(coords);
+        size_t len      = std::min<index_t>(
+                            row_last - col,
+                            blocksize - (col % blocksize));
+        if (len > 1) {
+          coords[ndim-1] = col + len - 1;
+          auto lpos_last = pattern.local_index(coords);
+          if (lpos_last.unit  != lpos.unit ||
+              lpos_last.index != lpos.index + static_cast<index_t>(len-1)) {
+            // Elements in block are not contiguous in local memory:
+            len = 1;
+          }
+        }
+        add_run(lpos.unit, lpos.index, dest, len);
+        col  += len;
+        dest += len;
+      }
+      r_idx += row_last - row_first;
+    }
+    // Global pointers to the local memory of source units:
+    for (auto & transfer : _transfers) {
+      _gptrs.push_back(globmem.at(transfer.unit, 0).dart_gptr());
+    }
+  }
+
+  StridedCopy(const StridedCopy &)             = delete;
+  StridedCopy & operator=(const StridedCopy &) = delete;
+
+  ~StridedCopy()
+  {
+    for (auto & handle : _handles) {
+      dart_handle_free(&handle);
+    }
+  }
+
+  /**
+   * Number of elements in the copied range.
+   */
+  inline size_t size() const noexcept
+  {
+    return _nelem;
+  }
+
+  /**
+   * Number of units holding elements of the copied range.
+   */
+  inline size_t num_units() const noexcept
+  {
+    return _transfers.size();
+  }
+
+  /**
+   * Start transfers from remote units and copy elements at the calling
+   * unit.
+   */
+  void start()
+  {
+    for (size_t ti = 0; ti < _transfers.size(); ++ti) {
+      auto & transfer = _transfers[ti];
+      if (transfer.unit == _myid) {
+        for (const auto & run : transfer.runs) {
+          local_copy(_lbegin + run.offset,
+                     _lbegin + run.offset + run.nelem,
+                     _out_first + run.dest_offset);
+        }
+        continue;
+      }
+      dart_handle_t handle;
+      if (transfer.runs.size() == 1) {
+        const auto & run  = transfer.runs.front();
+        dart_gptr_t  gptr = _gptrs[ti];
+        DASH_ASSERT_RETURNS(
+          dart_gptr_incaddr(&gptr, run.offset * sizeof(ValueType)),
+          DART_OK);
+        dash::internal::get_handle(
+          gptr, _out_first + run.dest_offset, run.nelem, &handle);
+      } else {
+        ValueType * dest = dest_contiguous(transfer)
+                           ? _out_first + transfer.runs.front().dest_offset
+                           : nullptr;
+        if (dest == nullptr) {
+          transfer.buffer.reset(new ValueType[transfer.nelem]);
+          dest = transfer.buffer.get();
+        }
+        std::vector<size_t> blocklens;
+        std::vector<size_t> offsets;
+        blocklens.reserve(transfer.runs.size());
+        offsets.reserve(transfer.runs.size());
+        for (const auto & run : transfer.runs) {
+          blocklens.push_back(storage_t(run.nelem).nelem);
+          offsets.push_back(storage_t(run.offset).nelem);
+        }
+        dart_datatype_t src_type;
+        DASH_ASSERT_RETURNS(
+          dart_type_create_indexed(
+            storage_t::dtype, transfer.runs.size(),
+            blocklens.data(), offsets.data(), &src_type),
+          DART_OK);
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(
+            dest, _gptrs[ti], storage_t(transfer.nelem).nelem,
+            src_type, storage_t::dtype, &handle),
+          DART_OK);
+        dart_type_destroy(&src_type);
+      }
+      if (handle != DART_HANDLE_NULL) {
+        _handles.push_back(handle);
+      }
+    }
+    DASH_LOG_TRACE("StridedCopy.start >",
+                   "units:", _transfers.size(),
+                   "handles:", _handles.size());
+  }
+
+  /**
+   * Whether all transfers have completed, unpacks received elements
+   * on completion.
+   */
+  bool test()
+  {
+    if (!_handles.empty()) {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_testall_local(_handles.data(), _handles.size(), &flag),
+        DART_OK);
+      if (!flag) {
+        return false;
+      }
+      _handles.clear();
+    }
+    unpack();
+    return true;
+  }
+
+  /**
+   * Wait for completion of all transfers and unpack received elements.
+   *
+   * \returns  Pointer past the final element in the destination range.
+   */
+  ValueType * wait()
+  {
+    if (!_handles.empty()) {
+      DASH_ASSERT_RETURNS(
+        dart_waitall_local(_handles.data(), _handles.size()),
+        DART_OK);
+      _handles.clear();
+    }
+    unpack();
+    return _out_first + _nelem;
+  }
+
+private:
+  void add_run(
+    team_unit_t unit,
+    size_t      offset,
+    size_t      dest_offset,
+    size_t      nelem)
+  {
+    auto & ti = _unit_transfer_idx[unit.id];
+    if (ti < 0) {
+      ti = _transfers.size();
+      _transfers.emplace_back();
+      _transfers.back().unit = unit;
+    }
+    auto & transfer = _transfers[ti];
+    transfer.nelem += nelem;
+    if (!transfer.runs.empty()) {
+      auto & prev = transfer.runs.back();
+      if (prev.offset      + prev.nelem == offset &&
+          prev.dest_offset + prev.nelem == dest_offset) {
+        prev.nelem += nelem;
+        return;
+      }
+    }
+    transfer.runs.push_back(run_t { offset, dest_offset, nelem });
+  }
+
+  static bool dest_contiguous(const unit_transfer_t & transfer)
+  {
+    for (size_t ri = 1; ri < transfer.runs.size(); ++ri) {
+      const auto & prev = transfer.runs[ri-1];
+      if (prev.dest_offset + prev.nelem != transfer.runs[ri].dest_offset) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void unpack()
+  {
+    for (auto & transfer : _transfers) {
+      if (!transfer.buffer) {
+        continue;
+      }
+      const ValueType * src = transfer.buffer.get();
+      for (const auto & run : transfer.runs) {
+        local_copy(src, src + run.nelem, _out_first + run.dest_offset);
+        src += run.nelem;
+      }
+      transfer.buffer.reset();
+    }
+  }
+
+private:
+  ValueType                    * _out_first;
+  const ValueType              * _lbegin  = nullptr;
+  size_t                         _nelem   = 0;
+  team_unit_t                    _myid;
+  std::vector<unit_transfer_t>   _transfers;
+  /// Index of a unit's transfer in _transfers, -1 if the unit holds no
+  /// elements of the range
+  std::vector<int>               _unit_transfer_idx;
+  std::vector<dart_gptr_t>       _gptrs;
+  std::vector<dart_handle_t>     _handles;
+};
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__STRIDED_COPY_H__INCLUDED
@@ -6,10 +6,14 @@
 #include <dash/Types.h>
 #include <dash/Team.h>
 
+#include <dash/memory/MemoryPlacement.h>
+
 #include <dash/internal/Logging.h>
 
 #include <vector>
 #include <algorithm>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace dash {
@@ -78,6 +82,25 @@ public:
     _nunits(team.size())
   { }
 
+  /**
+   * Constructor.
+   * Creates a new instance of \c dash::EpochSynchronizedAllocator for a
+   * given team with local memory backed by pages of the given kind.
+   *
+   * Local memory is only mapped with the given kind of pages for
+   * trivial element types, elements of other types are allocated with
+   * \c new.
+   *
+   * \see dash::MemoryPages
+   */
+  EpochSynchronizedAllocator(
+    Team        & team,
+    MemoryPages   pages) noexcept
+  : _team(&team),
+    _nunits(team.size()),
+    _pages(std::is_trivial<value_type>::value ? pages : MemoryPages::system)
+  { }
+
   /**
    * Move-constructor.
    * Takes ownership of the moved instance's allocation.
@@ -87,6 +110,7 @@ public:
   {
     std::swap(_allocated, other._allocated);
     std::swap(_team, other._team);
+    std::swap(_pages, other._pages);
   }
 
   /**
@@ -104,7 +128,8 @@ public:
    */
   EpochSynchronizedAllocator(const self_t & other) noexcept
   : _team(other._team),
-    _nunits(other._nunits)
+    _nunits(other._nunits),
+    _pages(other._pages)
   { }
 
   /**
@@ -115,7 +140,9 @@ public:
   EpochSynchronizedAllocator(
     const EpochSynchronizedAllocator<U> & other) noexcept
   : _team(other._team),
-    _nunits(other._nunits)
+    _nunits(other._nunits),
+    _pages(std::is_trivial<value_type>::value
+             ? other._pages : MemoryPages::system)
   { }
 
   /**
@@ -266,7 +293,16 @@ public:
    */
   local_pointer allocate_local(size_type num_local_elem)
   {
-    return new value_type[num_local_elem];
+    if (_pages == MemoryPages::system) {
+      return new value_type[num_local_elem];
+    }
+    void * lmem = nullptr;
+    if (dart_memmap_pages(num_local_elem * sizeof(value_type),
+                          static_cast<dart_mempages_t>(_pages),
+                          &lmem) != DART_OK) {
+      throw std::bad_alloc();
+    }
+    return static_cast<local_pointer>(lmem);
   }
 
   /**
@@ -278,8 +314,13 @@ public:
    */
   void deallocate_local(local_pointer lptr)
   {
-    if (lptr != nullptr) {
+    if (lptr == nullptr) {
+      return;
+    }
+    if (_pages == MemoryPages::system) {
       delete[] lptr;
+    } else {
+      dart_memunmap_pages(lptr);
     }
   }
 
@@ -331,7 +372,7 @@ public:
       _allocated.end(),
       [&](std::pair<value_type *, pointer> e) mutable {
         if (e.second == gptr && e.first != nullptr) {
-          delete[] e.first;
+          deallocate_local(e.first);
           e.first   = nullptr;
           do_detach = true;
           DASH_LOG_DEBUG("EpochSynchronizedAllocator.deallocate",
@@ -358,7 +399,7 @@ private:
       if (e.first != nullptr) {
         DASH_LOG_DEBUG("EpochSynchronizedAllocator.clear",
                        "deallocate local memory:", e.first);
-        delete[] e.first;
+        deallocate_local(e.first);
         e.first = nullptr;
       }
       if (!DART_GPTR_ISNULL(e.second)) {
@@ -376,6 +417,7 @@ private:
 private:
   dash::Team                                    * _team;
   size_t                                          _nunits    = 0;
+  MemoryPages                                     _pages     = MemoryPages::system;
   std::vector< std::pair<value_type *, pointer> > _allocated;
 
 }; // class EpochSynchronizedAllocator
@@ -7,6 +7,8 @@
 #include <dash/Team.h>
 #include <dash/GlobPtr.h>
 
+#include <dash/memory/MemoryPlacement.h>
+
 #include <dash/internal/Logging.h>
 #include <dash/internal/StreamConversion.h>
 
@@ -66,6 +68,8 @@ public:
 private:
   dart_team_t          _team_id;
   std::vector<pointer> _allocated;
+  MemoryPlacement      _placement = MemoryPlacement::system;
+  MemoryPages          _pages     = MemoryPages::system;
 
 public:
   /**
@@ -77,13 +81,33 @@ public:
   : _team_id(team.dart_id())
   { }
 
+  /**
+   * Constructor.
+   * Creates a new instance of \c dash::SymmetricAllocator for a given team
+   * that places the pages of local memory of every allocation according
+   * to the given policy, backed by pages of the given kind.
+   *
+   * \see dash::apply_memory_placement
+   * \see dash::MemoryPages
+   */
+  SymmetricAllocator(
+    Team            & team,
+    MemoryPlacement   placement,
+    MemoryPages       pages = MemoryPages::system) noexcept
+  : _team_id(team.dart_id()),
+    _placement(placement),
+    _pages(pages)
+  { }
+
   /**
    * Move-constructor.
    * Takes ownership of the moved instance's allocation.
    */
   SymmetricAllocator(self_t && other) noexcept
   : _team_id(other._team_id),
-    _allocated(std::move(other._allocated))
+    _allocated(std::move(other._allocated)),
+    _placement(other._placement),
+    _pages(other._pages)
   {
     // clear origin without deallocating gptrs
     other._allocated.clear();
@@ -95,7 +119,9 @@ public:
    * \see DashAllocatorConcept
    */
   SymmetricAllocator(const self_t & other) noexcept
-  : _team_id(other._team_id)
+  : _team_id(other._team_id),
+    _placement(other._placement),
+    _pages(other._pages)
   { }
 
   /**
@@ -104,7 +130,9 @@ public:
    */
   template<class U>
   SymmetricAllocator(const SymmetricAllocator<U> & other) noexcept
-  : _team_id(other._team_id)
+  : _team_id(other._team_id),
+    _placement(other.placement()),
+    _pages(other.pages())
   { }
 
   /**
@@ -132,7 +160,9 @@ public:
     if (this != &other) {
       clear();
       _allocated = std::move(other._allocated);
-      _team_id = other._team_id;
+      _team_id   = other._team_id;
+      _placement = other._placement;
+      _pages     = other._pages;
       // clear origin without deallocating gptrs
       other._allocated.clear();
     }
@@ -172,6 +202,22 @@ public:
     return !(*this == rhs);
   }
 
+  /**
+   * Placement policy of local memory of allocations.
+   */
+  MemoryPlacement placement() const noexcept
+  {
+    return _placement;
+  }
+
+  /**
+   * Kind of pages backing local memory of allocations.
+   */
+  MemoryPages pages() const noexcept
+  {
+    return _pages;
+  }
+
   /**
    * Allocates \c num_local_elem local elements at every unit in global
    * memory space.
@@ -190,9 +236,14 @@ public:
                    "number of local values:", num_local_elem);
     pointer gptr = DART_GPTR_NULL;
     dash::dart_storage<ElementType> ds(num_local_elem);
-    if (dart_team_memalloc_aligned(_team_id, ds.nelem, ds.dtype, &gptr)
+    if (dart_team_memalloc_aligned_pages(
+          _team_id, ds.nelem, ds.dtype,
+          static_cast<dart_mempages_t>(_pages), &gptr)
         == DART_OK) {
       _allocated.push_back(gptr);
+      if (_placement != MemoryPlacement::system) {
+        place_local(gptr, num_local_elem);
+      }
     } else {
       gptr = DART_GPTR_NULL;
     }
@@ -214,6 +265,21 @@ public:
   }
 
 private:
+  /**
+   * Applies the placement policy to the calling unit's local memory of
+   * an allocation, before it is initialized.
+   */
+  void place_local(pointer gptr, size_type num_local_elem)
+  {
+    dart_team_unit_t myid;
+    void           * laddr = nullptr;
+    DASH_ASSERT_RETURNS(dart_team_myid(_team_id, &myid), DART_OK);
+    DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, myid), DART_OK);
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr(gptr, &laddr), DART_OK);
+    dash::apply_memory_placement(
+      laddr, num_local_elem * sizeof(ElementType), _placement);
+  }
+
   /**
    * Frees all global memory regions allocated by this allocator instance.
    */
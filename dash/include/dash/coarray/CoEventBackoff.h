@@ -0,0 +1,153 @@
+#ifndef DASH__COARRAY__COEVENTBACKOFF_H
+#define DASH__COARRAY__COEVENTBACKOFF_H
+
+#include <dash/util/Config.h>
+
+#include <chrono>
+#include <climits>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace dash {
+namespace coarray {
+
+namespace internal {
+
+/**
+ * Hint to the processor that the caller is spinning.
+ */
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+/**
+ * Blocks until the value at \c addr differs from \c expected, the
+ * address is woken by \ref futex_wake or \c timeout_us microseconds have
+ * passed. Spurious wakeups are possible.
+ *
+ * The address may be located in memory shared between processes.
+ *
+ * \return  \c true if the calling thread has been suspended.
+ */
+inline bool futex_wait(
+  const int * addr,
+  int         expected,
+  long        timeout_us) noexcept {
+#if defined(__linux__)
+  struct timespec timeout;
+  timeout.tv_sec  = timeout_us / 1000000;
+  timeout.tv_nsec = (timeout_us % 1000000) * 1000;
+  syscall(SYS_futex, addr, FUTEX_WAIT, expected, &timeout, nullptr, 0);
+  return true;
+#else
+  (void)addr;
+  (void)expected;
+  (void)timeout_us;
+  return false;
+#endif
+}
+
+/**
+ * Wakes all threads blocked in \ref futex_wait on \c addr.
+ */
+inline void futex_wake(const int * addr) noexcept {
+#if defined(__linux__)
+  syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+  (void)addr;
+#endif
+}
+
+} // namespace internal
+
+/**
+ * Whether waits on coevents may block in the kernel until a unit on the
+ * same node posts an event, enabled by setting \c DASH_COEVENT_FUTEX=1.
+ * The setting is read once on first use as it is queried on every post.
+ *
+ * Posters on the same node then wake blocked units after every post.
+ */
+inline bool coevent_futex_enabled() {
+  static const bool enabled =
+    dash::util::Config::get<bool>("DASH_COEVENT_FUTEX");
+  return enabled;
+}
+
+/**
+ * Exponential backoff of units waiting for coevents.
+ *
+ * Waits spin on the processor for an exponentially increasing number of
+ * iterations, then yield the processor. If \ref coevent_futex_enabled,
+ * later rounds block on the event counter in local memory until a poster
+ * on the same node wakes the unit or a timeout expires, so posters on
+ * other nodes are still noticed.
+ */
+class CoEventBackoff {
+private:
+  /// Rounds spinning on the processor, round \c i spins \c 2^i times
+  static constexpr int  max_spin_rounds   = 6;
+  /// Rounds yielding the processor before blocking
+  static constexpr int  max_yield_rounds  = 64;
+  /// Timeout of a single blocking round in microseconds
+  static constexpr long block_timeout_us  = 500;
+  /// Interval of rounds in which the waiter should drive progress of the
+  /// communication runtime
+  static constexpr int  progress_interval = 16;
+
+public:
+  /**
+   * \param addr  Event counter in local memory to block on, or \c nullptr
+   *              if waiting for several counters.
+   */
+  explicit CoEventBackoff(const int * addr = nullptr)
+  : _addr(addr),
+    _block(addr != nullptr && coevent_futex_enabled())
+  { }
+
+  /**
+   * Wait for the next round, \c observed is the value of the event
+   * counter last read by the caller.
+   */
+  void pause(int observed = 0) {
+    if (_round < max_spin_rounds) {
+      for (int i = 0; i < (1 << _round); ++i) {
+        internal::cpu_relax();
+      }
+    } else if (!_block || _round < max_spin_rounds + max_yield_rounds) {
+      std::this_thread::yield();
+    } else if (!internal::futex_wait(_addr, observed, block_timeout_us)) {
+      std::this_thread::yield();
+    }
+    ++_round;
+  }
+
+  /**
+   * Whether the caller should read the event counter through the
+   * communication runtime in this round instead of from local memory,
+   * to make progress on transports that require participation of the
+   * target.
+   */
+  bool progress() const noexcept {
+    return _round > 0 && (_round % progress_interval) == 0;
+  }
+
+private:
+  const int * _addr;
+  bool        _block;
+  int         _round = 0;
+};
+
+} // namespace coarray
+} // namespace dash
+
+#endif /* DASH__COARRAY__COEVENTBACKOFF_H */
@@ -0,0 +1,151 @@
+#ifndef DASH__COARRAY__COEVENTCOUNTER_H
+#define DASH__COARRAY__COEVENTCOUNTER_H
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Exception.h>
+#include <dash/coarray/CoEventBackoff.h>
+
+#include <algorithm>
+
+namespace dash {
+namespace coarray {
+namespace internal {
+
+/**
+ * Event counters are pairs of \c int in global memory.
+ *
+ * Units on the same node as the counter's owner post events by an
+ * atomic operation on the first counter in shared memory, other units
+ * by an accumulate on the second counter through DART, so atomicity of
+ * both never depends on the interoperability of processor atomics and
+ * RMA atomics.
+ * Only the owner of a counter pair consumes events.
+ */
+constexpr int event_counter_size = 2;
+
+/**
+ * Global pointer to the counter of posts from other nodes in the event
+ * counter pair referenced by \c gptr.
+ */
+inline dart_gptr_t event_counter_rma(dart_gptr_t gptr) {
+  DASH_ASSERT_RETURNS(
+    dart_gptr_incaddr(&gptr, sizeof(int)),
+    DART_OK);
+  return gptr;
+}
+
+/**
+ * Post an event to the event counter pair referenced by \c gptr.
+ *
+ * A post to a unit on the same node is a single atomic increment in
+ * shared memory that does not wait for the target unit. Posts to units
+ * on other nodes are an atomic accumulate that is completed remotely,
+ * as RMA transports only guarantee progress of completed operations.
+ */
+inline void post_event(dart_gptr_t gptr) {
+  int * counter = nullptr;
+  if (dart_gptr_getaddr_shared(gptr, reinterpret_cast<void **>(&counter))
+      == DART_OK && counter != nullptr) {
+    __atomic_fetch_add(counter, 1, __ATOMIC_RELEASE);
+    if (coevent_futex_enabled()) {
+      futex_wake(counter);
+    }
+    return;
+  }
+  const int   one = 1;
+  dart_gptr_t rma = event_counter_rma(gptr);
+  DASH_ASSERT_RETURNS(
+    dart_accumulate(rma, &one, 1, DART_TYPE_INT, DART_OP_SUM),
+    DART_OK);
+  DASH_ASSERT_RETURNS(dart_flush(rma), DART_OK);
+}
+
+/**
+ * Number of events posted to the event counter pair referenced by
+ * \c gptr and not consumed yet.
+ */
+inline int test_events(dart_gptr_t gptr) {
+  int nothing = 0;
+  int shm     = 0;
+  int rma     = 0;
+  DASH_ASSERT_RETURNS(
+    dart_fetch_and_op(gptr, &nothing, &shm, DART_TYPE_INT, DART_OP_NO_OP),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_fetch_and_op(event_counter_rma(gptr), &nothing, &rma,
+                      DART_TYPE_INT, DART_OP_NO_OP),
+    DART_OK);
+  DASH_ASSERT_RETURNS(dart_flush_local(gptr), DART_OK);
+  return shm + rma;
+}
+
+/**
+ * Consume \c count events from the calling unit's event counter pair
+ * referenced by \c gptr at native address \c lcounters, if they have
+ * arrived.
+ *
+ * The counters are read from local memory, the counter of posts from
+ * other nodes is read through DART if \c sync is set.
+ * The value of the counter of posts from the same node is returned in
+ * \c observed.
+ */
+inline bool consume_events(
+  int         * lcounters,
+  dart_gptr_t   gptr,
+  int           count,
+  bool          sync,
+  int         & observed) {
+  dart_gptr_t rma_gptr = event_counter_rma(gptr);
+  observed = __atomic_load_n(lcounters, __ATOMIC_ACQUIRE);
+  int rma  = __atomic_load_n(lcounters + 1, __ATOMIC_ACQUIRE);
+  if (sync) {
+    int nothing = 0;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(rma_gptr, &nothing, &rma, DART_TYPE_INT,
+                        DART_OP_NO_OP),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush_local(rma_gptr), DART_OK);
+  }
+  if (observed + rma < count) {
+    return false;
+  }
+  // Posts from the same node are consumed first:
+  int from_shm;
+  do {
+    from_shm = std::min(observed, count);
+  } while (!__atomic_compare_exchange_n(
+              lcounters, &observed, observed - from_shm, false,
+              __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+  if (from_shm < count) {
+    const int dec = from_shm - count;
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(rma_gptr, &dec, 1, DART_TYPE_INT, DART_OP_SUM),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(rma_gptr), DART_OK);
+  }
+  return true;
+}
+
+/**
+ * Wait until \c count events have arrived in the calling unit's event
+ * counter pair referenced by \c gptr at native address \c lcounters and
+ * consume them.
+ */
+inline void wait_events(
+  int         * lcounters,
+  dart_gptr_t   gptr,
+  int           count) {
+  CoEventBackoff backoff(lcounters);
+  int observed;
+  while (!consume_events(lcounters, gptr, count, backoff.progress(),
+                         observed)) {
+    backoff.pause(observed);
+  }
+}
+
+} // namespace internal
+} // namespace coarray
+} // namespace dash
+
+#endif /* DASH__COARRAY__COEVENTCOUNTER_H */
@@ -14,6 +14,9 @@ class CoEventIter {
 private:
   using self_t = CoEventIter;
   using gptr_t = GlobPtr<dash::Atomic<int>>;
+
+  /// Distance of the event counters of consecutive units
+  static constexpr int stride = CoEventRef::num_counters;
 public:
   using difference_type   = typename gptr_t::gptrdiff_t;
   using value_type        = CoEventRef;
@@ -33,7 +36,7 @@ public:
     return _team;
   }
   inline value_type operator[] (int pos) const {
-    return value_type(_gptr + pos, _team);
+    return value_type(_gptr + pos * stride, _team);
   }
 
   inline value_type operator* () const {
@@ -64,34 +67,36 @@ public:
    * Arith. operators
    */
   inline self_t & operator +=(int i) noexcept {
-    _gptr += i;
+    _gptr += i * stride;
     return *this;
   }
   inline self_t & operator -=(int i) noexcept {
-    _gptr -= i;
+    _gptr -= i * stride;
     return *this;
   }
   inline self_t & operator ++() noexcept {
-    ++_gptr;
+    _gptr += stride;
     return *this;
   }
   inline self_t operator ++(int) noexcept {
-    auto oldptr = _gptr++;
+    auto oldptr = _gptr;
+    _gptr += stride;
     return self_t(oldptr);
   }
   inline self_t & operator --() noexcept{
-    --_gptr;
+    _gptr -= stride;
     return *this;
   }
   inline self_t operator --(int) noexcept {
-    auto oldptr = _gptr--;
+    auto oldptr = _gptr;
+    _gptr -= stride;
     return self_t(oldptr);
   }
   inline self_t operator +(int i) const noexcept {
-    return self_t(_gptr + i);
+    return self_t(_gptr + i * stride);
   }
   inline self_t operator -(int i) const noexcept {
-    return self_t(_gptr - i);
+    return self_t(_gptr - i * stride);
   }
 
 private:
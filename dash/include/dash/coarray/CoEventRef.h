@@ -4,6 +4,7 @@
 #include <dash/Team.h>
 #include <dash/GlobPtr.h>
 #include <dash/Atomic.h>
+#include <dash/coarray/CoEventCounter.h>
 
 namespace dash {
 namespace coarray {
@@ -14,6 +15,14 @@ private:
   using event_ctr_t = dash::Atomic<int>;
   using gptr_t      = GlobPtr<event_ctr_t>;
 
+public:
+  /**
+   * Number of event counters of every unit.
+   *
+   * \see dash::coarray::internal::event_counter_size
+   */
+  static constexpr int num_counters = internal::event_counter_size;
+
 public:
   explicit CoEventRef(
     const gptr_t & gptr,
@@ -23,11 +32,16 @@ public:
 
   /**
    * post an event to this unit. This function is thread-safe
+   *
+   * A post to a unit on the same node is a single atomic increment in
+   * shared memory that does not wait for the target unit. Posts to units
+   * on other nodes are completed remotely.
+   *
+   * \see dash::coarray::internal::post_event
    */
   inline void post() const {
     DASH_LOG_DEBUG("post event to gptr", _gptr);
-    GlobRef<event_ctr_t> gref(_gptr);
-    gref.add(1);
+    internal::post_event(_gptr.dart_gptr());
     DASH_LOG_DEBUG("event posted");
   }
 
@@ -36,8 +50,7 @@ public:
    */
   inline int test() const {
     DASH_LOG_DEBUG("test for events on", _gptr);
-    GlobRef<event_ctr_t> gref(_gptr);
-    return gref.load();
+    return internal::test_events(_gptr.dart_gptr());
   }
 
   inline Team & team() {
@@ -0,0 +1,42 @@
+#ifndef DASH__COARRAY__SYNC_H__INCLUDED
+#define DASH__COARRAY__SYNC_H__INCLUDED
+
+#include <dash/Types.h>
+
+#include <cstddef>
+
+namespace dash {
+namespace coarray {
+namespace internal {
+
+/**
+ * Allocates the event counters used by \c sync_images in global memory
+ * of \c dash::Team::All unless they are allocated already.
+ * Collective operation on \c dash::Team::All, called in the first
+ * \c dash::coarray::sync_all. The counters are freed in
+ * \c dash::Team::finalize.
+ *
+ * Every unit holds one event counter pair per unit for pairwise
+ * synchronization.
+ */
+void sync_init();
+
+/**
+ * Synchronizes the calling unit with the given units by posting an event
+ * to each of them and waiting for one event from each of them in the
+ * counter reserved for the pair.
+ * Until the event counters are allocated by \c sync_init, units are
+ * synchronized with two-sided messages over the unit with the smallest
+ * id instead. As \c sync_init is collective, all units switch to event
+ * counters at the same time.
+ * The calling unit may be contained in \c image_ids.
+ */
+void sync_images(
+  const dash::global_unit_t * image_ids,
+  std::size_t                 nimages);
+
+} // namespace internal
+} // namespace coarray
+} // namespace dash
+
+#endif // DASH__COARRAY__SYNC_H__INCLUDED
@@ -2,6 +2,10 @@
 #define DASH__COARRAY_UTILS_H__
 
 #include <dash/Types.h>
+#include <dash/coarray/Sync.h>
+
+#include <algorithm>
+#include <vector>
 
 #define DART_TAG_SYNC_IMAGES 10016;
 
@@ -49,11 +53,15 @@ inline ssize_t num_images() {
  * imply a flush. If a flush is required, use the corresponding
  * \c dash::Coarray::sync_all() method of Coarray.
  *
+ * The first call allocates the event counters used by
+ * \c dash::coarray::sync_images.
+ *
  * \sa dash::coarray::sync_images()
  *
  * \ingroup DashCoarrayLib
  */
 inline void sync_all(){
+  dash::coarray::internal::sync_init();
   dash::barrier();
 }
 
@@ -62,10 +70,17 @@ inline void sync_all(){
  * not imply a flush. If a flush is required, use the \c sync_all() method of
  * the Coarray
  *
- * \note If possible use \c sync_all() or \c Coevent for performance reasons.
- *       \c sync_images() is implemented using two-sided operations based on
- *       a implementation of \c MPI_Barrier(). For dispatching the messages
- *       we use tag DART_TAG_SYNC_IMAGES
+ * Units not contained in \c image_ids return immediately. Image sets of
+ * different units may differ, e.g. to synchronize every unit with its
+ * neighbors.
+ *
+ * Every unit holds an event counter for every other unit. Synchronizing
+ * with \c k images posts an event to each of them with a remote atomic
+ * increment and waits for their events on counters in local memory, no
+ * unit of the image set acts as root.
+ * The counters are allocated in the first \c sync_all(), before that
+ * images synchronize with two-sided messages over the image with the
+ * smallest id.
  *
  * \sa dash::coarray::sync_all()
  *
@@ -85,47 +100,12 @@ inline void sync_images(const Container & image_ids){
     return;
   }
 
-  auto root          = global_unit_t{
-                        *(std::min(image_ids.begin(), image_ids.end()))};
-  auto tag           =  DART_TAG_SYNC_IMAGES;
-  // DART does not specify if nullptr is allowed as target
-  char buffer        = 0;
-
-  if(myid == root){
-    // I am root, recv messages from leaves
-    std::for_each(image_ids.begin(), image_ids.end(), [&](const element & el){
-      if(el != root){
-        dart_recv(&buffer, 1, dart_datatype<char>::value,
-                  tag,
-                  global_unit_t{el}
-        );
-      }
-    });
-  } else {
-    // I am a leave, send message to root
-    dart_send(&buffer, 1, DART_TYPE_BYTE,
-              tag,
-              global_unit_t{root});
-  }
-
-  // Second phase: recieve message from root
-  DASH_LOG_DEBUG("Begin second phase of sync_images");
-  if(myid == root){
-    std::for_each(image_ids.begin(), image_ids.end(), [&](const element & el)
-    {
-      if(el != root){
-        dart_send(&buffer, 1, dart_datatype<char>::value,
-                  tag,
-                  global_unit_t{el}
-        );
-      }
-    });
-  } else {
-    dart_recv(&buffer, 1, dart_datatype<char>::value,
-              tag,
-              global_unit_t{root}
-    );
+  std::vector<global_unit_t> images;
+  images.reserve(image_ids.size());
+  for(const element & el : image_ids){
+    images.push_back(global_unit_t{static_cast<dart_unit_t>(el)});
   }
+  dash::coarray::internal::sync_images(images.data(), images.size());
 }
 
 /**
@@ -7,6 +7,7 @@
 #include <dash/Pattern.h>
 #include <dash/halo/HaloStencilOperator.h>
 #include <dash/memory/GlobStaticMem.h>
+#include <dash/util/Trace.h>
 
 #include <type_traits>
 #include <vector>
@@ -267,6 +268,10 @@ public:
    * Initiates a blocking halo region update for all halo elements.
    */
   void update() {
+    static const dash::util::TraceName trace_halo("halo");
+    static const dash::util::TraceName trace_update("update");
+    dash::util::Trace      trace(trace_halo);
+    dash::util::TraceState trace_state(trace, trace_update);
     for(auto& region : _region_data)
       update_halo_intern(region.second, false);
   }
@@ -285,6 +290,10 @@ public:
    * Initiates an asychronous halo region update for all halo elements.
    */
   void update_async() {
+    static const dash::util::TraceName trace_halo("halo");
+    static const dash::util::TraceName trace_update_async("update_async");
+    dash::util::Trace      trace(trace_halo);
+    dash::util::TraceState trace_state(trace, trace_update_async);
     for(auto& region : _region_data)
       update_halo_intern(region.second, true);
   }
@@ -304,6 +313,10 @@ public:
    * halo updates.
    */
   void wait() {
+    static const dash::util::TraceName trace_halo("halo");
+    static const dash::util::TraceName trace_wait("wait");
+    dash::util::Trace      trace(trace_halo);
+    dash::util::TraceState trace_state(trace, trace_wait);
     for(auto& region : _region_data)
       dart_wait_local(&region.second.halo_data.handle);
   }
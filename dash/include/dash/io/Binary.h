@@ -0,0 +1,6 @@
+#ifndef DASH__IO__BINARY_H__INCLUDED
+#define DASH__IO__BINARY_H__INCLUDED
+
+#include <dash/io/binary/StorageDriver.h>
+
+#endif
@@ -0,0 +1,722 @@
+#ifndef DASH__IO__BINARY__STORAGEDRIVER_H__
+#define DASH__IO__BINARY__STORAGEDRIVER_H__
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Distribution.h>
+#include <dash/Dimensional.h>
+#include <dash/TeamSpec.h>
+
+#include <dash/meta/TypeInfo.h>
+#include <dash/pattern/PatternProperties.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+namespace io {
+namespace binary {
+
+/**
+ * Layout of the units' local data in a binary container file,
+ * determines whether a file can be read by a container with a
+ * different pattern.
+ */
+enum class binary_layout : uint64_t {
+  /// Unknown mapping, data can only be restored by an identical pattern
+  unspecified = 0,
+  /// Rectangular blocks mapped cyclically to units, canonical
+  /// (row-major) order of local elements
+  canonical   = 1,
+  /// Rectangular blocks mapped cyclically to units, local elements in
+  /// row-major order within consecutive blocks
+  blocked     = 2,
+  /// One-dimensional, every unit stores a single contiguous range
+  /// of elements in unit order
+  contiguous  = 3
+};
+
+/**
+ * Self-describing header of a binary container file.
+ *
+ * The header is followed by the local data of all units in order of
+ * their unit ids, starting at \c data_offset.
+ */
+struct binary_file_header {
+  /// Version of the file format
+  uint64_t                 version    = 1;
+  /// Number of dimensions of the stored container
+  uint64_t                 ndim       = 0;
+  /// Size of a single element in bytes
+  uint64_t                 value_size = 0;
+  /// Hash of the element type's name
+  uint64_t                 type_hash  = 0;
+  /// Layout of the local data
+  binary_layout            layout     = binary_layout::unspecified;
+  /// Offset of the first unit's data in the file
+  uint64_t                 data_offset = 0;
+  /// Global extents in every dimension
+  std::vector<uint64_t>    extents;
+  /// Number of units in every dimension
+  std::vector<uint64_t>    team_extents;
+  /// Block extents in every dimension
+  std::vector<uint64_t>    blocksizes;
+  /// Number of local elements of every unit
+  std::vector<uint64_t>    local_sizes;
+  /// Offset of every unit's data relative to \c data_offset, in elements
+  std::vector<uint64_t>    local_offsets;
+
+  /// Number of units which wrote the file
+  inline std::size_t nunits() const {
+    return local_sizes.size();
+  }
+};
+
+namespace internal {
+
+/**
+ * Computes the file offsets of all units' data from their local sizes.
+ */
+void init_offsets(
+  binary_file_header       & header);
+
+/**
+ * Serializes the header and writes it to the beginning of the file.
+ * Also sets the file's size to hold all units' data.
+ */
+void write_header(
+  const std::string        & filename,
+  binary_file_header       & header);
+
+/**
+ * Reads the header of the given file at unit 0 of \c team and
+ * broadcasts it to all units in the team.
+ */
+void read_header(
+  const std::string        & filename,
+  binary_file_header       & header,
+  dart_team_t                team);
+
+/**
+ * Opens the file for reading or writing, throws
+ * \c dash::exception::RuntimeError on failure.
+ */
+int open_file(
+  const std::string        & filename,
+  bool                       write);
+
+void close_file(
+  int                        fd);
+
+/**
+ * Writes \c nbytes from \c buf at \c offset, retries on partial writes.
+ */
+void pwrite_all(
+  int                        fd,
+  const void               * buf,
+  std::size_t                nbytes,
+  uint64_t                   offset);
+
+/**
+ * Reads \c nbytes into \c buf from \c offset, retries on partial reads.
+ */
+void pread_all(
+  int                        fd,
+  void                     * buf,
+  std::size_t                nbytes,
+  uint64_t                   offset);
+
+/**
+ * Agrees on the success of unit-local I/O across the team, so units do
+ * not wait in subsequent collectives for a failed unit.
+ * Rethrows \c error at the failing units, other units throw
+ * \c dash::exception::RuntimeError.
+ *
+ * Collective operation.
+ */
+void agree_on_error(
+  std::exception_ptr         error,
+  const std::string        & filename,
+  dart_team_t                team);
+
+/**
+ * FNV-1a hash of the given type name, used to detect type mismatches
+ * between writer and reader.
+ */
+uint64_t type_hash(
+  const std::string        & type_name);
+
+} // namespace internal
+
+/**
+ * DASH driver to store a \c dash::Array or \c dash::Matrix in a raw
+ * binary file.
+ *
+ * Every unit writes and reads its local data directly from and into the
+ * container's local memory using \c pwrite / \c pread, without
+ * intermediate copies. A small header describes the element type,
+ * extents and distribution of the stored container.
+ *
+ * If the container's pattern differs from the pattern of the stored
+ * container, the data is redistributed while reading, provided the
+ * writer's pattern is rectangular and unshifted or one-dimensional with
+ * one contiguous range per unit.
+ *
+ * In contrast to HDF5, the file format is not portable between systems
+ * with different byte order or type sizes.
+ *
+ * All operations are collective.
+ */
+class StoreBinary {
+ private:
+  template <class PatternT>
+  static constexpr bool _is_rectangular() {
+    return dash::pattern_partitioning_traits<PatternT>::type::rectangular &&
+           !dash::pattern_mapping_traits<PatternT>::type::shifted &&
+           !dash::pattern_mapping_traits<PatternT>::type::diagonal &&
+           PatternT::memory_order() == dash::ROW_MAJOR;
+  }
+
+  template <class PatternT>
+  static constexpr bool _is_contiguous() {
+    return PatternT::ndim() == 1 &&
+           dash::pattern_partitioning_traits<PatternT>::type::minimal;
+  }
+
+ public:
+  /**
+   * Store all values of a \c dash::Array or \c dash::Matrix in a binary
+   * file.
+   *
+   * Collective operation.
+   */
+  template <typename Container_t>
+  static void write(
+      /// Container to store
+      Container_t & container,
+      /// Filename of the binary file
+      std::string   filename) {
+    using pattern_t = typename Container_t::pattern_type;
+    using value_t   = typename Container_t::value_type;
+
+    DASH_LOG_DEBUG("StoreBinary.write()", filename);
+
+    auto & team    = container.team();
+    auto & pattern = container.pattern();
+
+    binary_file_header header;
+    _describe_pattern(pattern, header);
+    header.value_size = sizeof(value_t);
+    header.type_hash  = internal::type_hash(dash::typestr<value_t>());
+
+    uint64_t lsize = pattern.local_size();
+    header.local_sizes.resize(team.size());
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&lsize, header.local_sizes.data(), sizeof(uint64_t),
+                     DART_TYPE_BYTE, team.dart_id()),
+      DART_OK);
+
+    internal::init_offsets(header);
+    // unit 0 creates the file, errors are propagated to all units
+    std::exception_ptr error;
+    int success = 1;
+    if (team.myid() == 0) {
+      try {
+        internal::write_header(filename, header);
+      } catch (...) {
+        error   = std::current_exception();
+        success = 0;
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_bcast(&success, 1, DART_TYPE_INT, dart_team_unit_t{0},
+                 team.dart_id()),
+      DART_OK);
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    if (!success) {
+      DASH_THROW(dash::exception::RuntimeError,
+                 "StoreBinary.write: could not create file " << filename);
+    }
+
+    if (lsize > 0) {
+      try {
+        int fd = internal::open_file(filename, true);
+        try {
+          internal::pwrite_all(
+            fd, container.lbegin(), lsize * sizeof(value_t),
+            header.data_offset +
+              header.local_offsets[team.myid()] * sizeof(value_t));
+        } catch (...) {
+          internal::close_file(fd);
+          throw;
+        }
+        internal::close_file(fd);
+      } catch (...) {
+        error = std::current_exception();
+      }
+    }
+    internal::agree_on_error(error, filename, team.dart_id());
+    team.barrier();
+    DASH_LOG_DEBUG("StoreBinary.write >");
+  }
+
+  /**
+   * Read a binary file into a \c dash::Array or \c dash::Matrix.
+   * If the container is already allocated, its extents have to match the
+   * stored extents and all data will be overwritten.
+   * Otherwise the container is allocated, using the stored pattern if
+   * possible.
+   *
+   * Collective operation.
+   */
+  template <typename Container_t>
+  static void read(
+      /// Container to restore
+      Container_t & container,
+      /// Filename of the binary file
+      std::string   filename) {
+    using pattern_t = typename Container_t::pattern_type;
+    using value_t   = typename Container_t::value_type;
+    using index_t   = typename pattern_t::index_type;
+
+    constexpr auto ndim = pattern_t::ndim();
+
+    DASH_LOG_DEBUG("StoreBinary.read()", filename);
+
+    bool is_alloc = (container.size() != 0);
+    dash::Team & team = is_alloc ? container.team() : dash::Team::All();
+
+    binary_file_header header;
+    internal::read_header(filename, header, team.dart_id());
+
+    if (header.ndim != ndim) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "StoreBinary.read: container has " << ndim << " "
+                 "dimensions, file " << filename << " has " << header.ndim);
+    }
+    if (header.value_size != sizeof(value_t) ||
+        header.type_hash != internal::type_hash(
+                              dash::typestr<value_t>())) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "StoreBinary.read: element type "
+                 << dash::typestr<value_t>() << " does not match "
+                 << "element type in file " << filename);
+    }
+
+    if (!is_alloc) {
+      _allocate(container, header);
+    }
+    for (dim_t d = 0; d < ndim; ++d) {
+      if (container.pattern().extent(d) != header.extents[d]) {
+        DASH_THROW(dash::exception::InvalidArgument,
+                   "StoreBinary.read: container extents do not match "
+                   "extents in file " << filename);
+      }
+    }
+
+    auto & pattern = container.pattern();
+    uint64_t lsize = pattern.local_size();
+
+    std::exception_ptr error;
+    if (lsize > 0) {
+      try {
+        int fd = internal::open_file(filename, false);
+        try {
+          if (_same_local_data(pattern, header)) {
+            DASH_LOG_DEBUG("StoreBinary.read", "identical local data");
+            internal::pread_all(
+              fd, container.lbegin(), lsize * sizeof(value_t),
+              header.data_offset +
+                header.local_offsets[team.myid()] * sizeof(value_t));
+          } else {
+            DASH_LOG_DEBUG("StoreBinary.read", "redistribute");
+            _read_redistributed(fd, pattern, header, container.lbegin());
+          }
+        } catch (...) {
+          internal::close_file(fd);
+          throw;
+        }
+        internal::close_file(fd);
+      } catch (...) {
+        error = std::current_exception();
+      }
+    }
+    internal::agree_on_error(error, filename, container.team().dart_id());
+    container.barrier();
+    DASH_LOG_DEBUG("StoreBinary.read >");
+  }
+
+ private:
+  template <class PatternT>
+  static typename std::enable_if<
+    _is_contiguous<PatternT>(), void>::type
+  _describe_pattern(const PatternT & pattern, binary_file_header & header) {
+    header.ndim   = 1;
+    header.layout = binary_layout::contiguous;
+    header.extents.assign(1, pattern.extent(0));
+    header.team_extents.assign(1, pattern.team().size());
+    header.blocksizes.assign(1, 0);
+  }
+
+  template <class PatternT>
+  static typename std::enable_if<
+    !_is_contiguous<PatternT>(), void>::type
+  _describe_pattern(const PatternT & pattern, binary_file_header & header) {
+    constexpr auto ndim = PatternT::ndim();
+    header.ndim = ndim;
+    header.extents.resize(ndim);
+    header.team_extents.resize(ndim);
+    header.blocksizes.resize(ndim);
+    for (dim_t d = 0; d < ndim; ++d) {
+      header.extents[d] = pattern.extent(d);
+    }
+    if (_is_rectangular<PatternT>()) {
+      header.layout =
+        dash::pattern_layout_traits<PatternT>::type::canonical
+        ? binary_layout::canonical
+        : binary_layout::blocked;
+      for (dim_t d = 0; d < ndim; ++d) {
+        header.team_extents[d] = pattern.teamspec().extent(d);
+        header.blocksizes[d]   = pattern.blocksize(d);
+      }
+    } else {
+      header.layout = binary_layout::unspecified;
+    }
+  }
+
+  /**
+   * Allocates the container according to the stored pattern if the
+   * number of units matches, otherwise using the default distribution.
+   */
+  template <class Container_t>
+  static typename std::enable_if<
+    _is_rectangular<typename Container_t::pattern_type>() &&
+    !_is_contiguous<typename Container_t::pattern_type>(),
+    void>::type
+  _allocate(Container_t & container, const binary_file_header & header) {
+    using pattern_t = typename Container_t::pattern_type;
+    using extent_t  = typename pattern_t::size_type;
+    constexpr auto ndim = pattern_t::ndim();
+
+    std::array<extent_t, ndim>           size_extents;
+    std::array<extent_t, ndim>           team_extents;
+    std::array<dash::Distribution, ndim> dist_extents;
+    for (dim_t d = 0; d < ndim; ++d) {
+      size_extents[d] = header.extents[d];
+    }
+    bool restore = (header.nunits() == dash::Team::All().size() &&
+                    (header.layout == binary_layout::canonical ||
+                     header.layout == binary_layout::blocked));
+    if (restore) {
+      for (dim_t d = 0; d < ndim; ++d) {
+        team_extents[d] = header.team_extents[d];
+        dist_extents[d] = dash::TILE(header.blocksizes[d]);
+      }
+      DASH_LOG_DEBUG("StoreBinary.read", "restore stored pattern");
+      const pattern_t pattern(dash::SizeSpec<ndim>(size_extents),
+                              dash::DistributionSpec<ndim>(dist_extents),
+                              dash::TeamSpec<ndim>(team_extents),
+                              dash::Team::All());
+      container.allocate(pattern);
+    } else {
+      const pattern_t pattern(dash::SizeSpec<ndim>(size_extents),
+                              dash::DistributionSpec<ndim>(),
+                              dash::TeamSpec<ndim>(),
+                              dash::Team::All());
+      container.allocate(pattern);
+    }
+  }
+
+  /**
+   * Allocates one-dimensional containers with one contiguous range per
+   * unit with the stored local sizes if the number of units matches,
+   * otherwise with balanced local sizes.
+   */
+  template <class Container_t>
+  static typename std::enable_if<
+    _is_contiguous<typename Container_t::pattern_type>(), void>::type
+  _allocate(Container_t & container, const binary_file_header & header) {
+    using pattern_t = typename Container_t::pattern_type;
+    using extent_t  = typename pattern_t::size_type;
+
+    auto   & team   = dash::Team::All();
+    auto     nunits = team.size();
+    uint64_t size   = header.extents[0];
+    std::vector<extent_t> local_sizes;
+    if (header.nunits() == nunits) {
+      DASH_LOG_DEBUG("StoreBinary.read", "restore stored local sizes");
+      local_sizes.assign(header.local_sizes.begin(),
+                         header.local_sizes.end());
+    } else {
+      for (std::size_t u = 0; u < nunits; ++u) {
+        local_sizes.push_back(size / nunits + (u < size % nunits ? 1 : 0));
+      }
+    }
+    container.allocate(
+      _contiguous_pattern<pattern_t>(
+        local_sizes, team,
+        std::is_constructible<
+          pattern_t, const std::vector<extent_t> &, dash::Team &>()));
+  }
+
+  /**
+   * Pattern with the given local sizes.
+   */
+  template <class PatternT>
+  static PatternT _contiguous_pattern(
+      const std::vector<typename PatternT::size_type> & local_sizes,
+      dash::Team                                      & team,
+      std::true_type) {
+    return PatternT(local_sizes, team);
+  }
+
+  /**
+   * Blocked pattern of the total size of the given local sizes, for
+   * pattern types that cannot be constructed from local sizes.
+   */
+  template <class PatternT>
+  static PatternT _contiguous_pattern(
+      const std::vector<typename PatternT::size_type> & local_sizes,
+      dash::Team                                      & team,
+      std::false_type) {
+    typename PatternT::size_type size = 0;
+    for (auto lsize : local_sizes) {
+      size += lsize;
+    }
+    return PatternT(dash::SizeSpec<1>(size),
+                    dash::DistributionSpec<1>(dash::BLOCKED),
+                    team);
+  }
+
+  template <class Container_t>
+  static typename std::enable_if<
+    !_is_rectangular<typename Container_t::pattern_type>() &&
+    !_is_contiguous<typename Container_t::pattern_type>(),
+    void>::type
+  _allocate(Container_t & container, const binary_file_header & header) {
+    DASH_THROW(dash::exception::InvalidArgument,
+               "StoreBinary.read: containers with pattern type " <<
+               dash::typestr<typename Container_t::pattern_type>() <<
+               " must be allocated before reading");
+  }
+
+  /**
+   * Whether the calling unit's local data in the file is identical to
+   * its local data in the given pattern.
+   */
+  template <class PatternT>
+  static bool _same_local_data(
+      const PatternT           & pattern,
+      const binary_file_header & header) {
+    binary_file_header reader;
+    _describe_pattern(pattern, reader);
+
+    auto myid = pattern.team().myid();
+    if (header.nunits() != pattern.team().size() ||
+        header.local_sizes[myid] != pattern.local_size() ||
+        header.layout != reader.layout) {
+      return false;
+    }
+    switch (header.layout) {
+      case binary_layout::contiguous:
+        return pattern.local_size() == 0 ||
+               static_cast<uint64_t>(pattern.global(0)) ==
+                 header.local_offsets[myid];
+      case binary_layout::canonical:
+      case binary_layout::blocked:
+        return header.team_extents == reader.team_extents &&
+               header.blocksizes   == reader.blocksizes;
+      default:
+        // Cannot verify the mapping, assume identical pattern
+        return true;
+    }
+  }
+
+  /**
+   * Location of a global element in the file.
+   */
+  struct file_location {
+    /// Offset relative to data offset, in elements
+    uint64_t offset;
+    /// Number of consecutive elements along the last dimension stored
+    /// contiguously in the file
+    uint64_t nelem;
+  };
+
+  /**
+   * Location of the element at the given global coordinates in the file.
+   */
+  template <std::size_t NDim, typename IndexT>
+  static file_location _locate(
+      const binary_file_header        & header,
+      const std::array<IndexT, NDim>  & gcoords) {
+    file_location loc;
+    if (header.layout == binary_layout::contiguous) {
+      // local ranges are stored in unit order, so the file offset equals
+      // the global index
+      loc.offset = gcoords[0];
+      loc.nelem  = header.extents[0] - gcoords[0];
+      return loc;
+    }
+    std::array<uint64_t, NDim> unit_coords;
+    std::array<uint64_t, NDim> block_coords;
+    std::array<uint64_t, NDim> phase;
+    std::array<uint64_t, NDim> lblocks;
+    std::array<uint64_t, NDim> lextents;
+    for (std::size_t d = 0; d < NDim; ++d) {
+      uint64_t bs      = header.blocksizes[d];
+      uint64_t nunits  = header.team_extents[d];
+      uint64_t nblocks = dash::math::div_ceil(header.extents[d], bs);
+      uint64_t block   = gcoords[d] / bs;
+      unit_coords[d]   = block % nunits;
+      block_coords[d]  = block / nunits;
+      phase[d]         = gcoords[d] % bs;
+      lblocks[d]       = (nblocks - unit_coords[d] + nunits - 1) / nunits;
+      lextents[d]      = lblocks[d] * bs;
+      if ((nblocks - 1) % nunits == unit_coords[d] &&
+          header.extents[d] % bs != 0) {
+        // unit holds underfilled last block
+        lextents[d] -= bs - (header.extents[d] % bs);
+      }
+    }
+    uint64_t unit   = 0;
+    uint64_t offset = 0;
+    for (std::size_t d = 0; d < NDim; ++d) {
+      unit = unit * header.team_extents[d] + unit_coords[d];
+    }
+    if (header.layout == binary_layout::canonical) {
+      for (std::size_t d = 0; d < NDim; ++d) {
+        offset = offset * lextents[d] +
+                 block_coords[d] * header.blocksizes[d] + phase[d];
+      }
+    } else {
+      uint64_t block_offset = 0;
+      uint64_t block_size   = 1;
+      for (std::size_t d = 0; d < NDim; ++d) {
+        block_offset = block_offset * lblocks[d] + block_coords[d];
+        offset       = offset * header.blocksizes[d] + phase[d];
+        block_size  *= header.blocksizes[d];
+      }
+      offset += block_offset * block_size;
+    }
+    loc.offset = header.local_offsets[unit] + offset;
+    loc.nelem  = std::min<uint64_t>(
+                   header.blocksizes[NDim - 1] - phase[NDim - 1],
+                   header.extents[NDim - 1] - gcoords[NDim - 1]);
+    return loc;
+  }
+
+  /**
+   * Reads the calling unit's local data from a file written with a
+   * different pattern.
+   * Local elements are read in segments which are contiguous in local
+   * memory, in global index space and in the file.
+   */
+  template <class PatternT, typename ValueT>
+  static void _read_redistributed(
+      int                        fd,
+      const PatternT           & pattern,
+      const binary_file_header & header,
+      ValueT                   * lbegin) {
+    using index_t = typename PatternT::index_type;
+    constexpr auto ndim = PatternT::ndim();
+    constexpr auto last = ndim - 1;
+
+    if (header.layout == binary_layout::unspecified) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "StoreBinary.read: data stored with pattern of unknown "
+                 "layout can only be read using an identical pattern");
+    }
+
+    auto lextents = pattern.local_extents();
+    if (pattern.local_size() == 0) {
+      return;
+    }
+    index_t nrows = 1;
+    for (dim_t d = 0; d < last; ++d) {
+      nrows *= lextents[d];
+    }
+
+    // pending read, extended as long as subsequent segments are
+    // contiguous in the file and in local memory
+    ValueT   * pending_buf    = nullptr;
+    uint64_t   pending_offset = 0;
+    uint64_t   pending_nelem  = 0;
+    auto flush_pending = [&]() {
+      if (pending_nelem > 0) {
+        internal::pread_all(
+          fd, pending_buf, pending_nelem * sizeof(ValueT),
+          header.data_offset + pending_offset * sizeof(ValueT));
+      }
+      pending_nelem = 0;
+    };
+
+    std::array<index_t, ndim> lcoords {{ }};
+    for (index_t row = 0; row < nrows; ++row) {
+      index_t r = row;
+      for (dim_t d = last; d > 0; --d) {
+        lcoords[d - 1] = r % lextents[d - 1];
+        r /= lextents[d - 1];
+      }
+      index_t col = 0;
+      while (col < static_cast<index_t>(lextents[last])) {
+        lcoords[last] = col;
+        auto gcoords  = pattern.global(lcoords);
+        auto loffset  = pattern.local_at(lcoords);
+        auto loc      = _locate(header, gcoords);
+        // longest segment contiguous in local memory and global index
+        // space, limited by the contiguous range in the file
+        index_t nelem = std::min<index_t>(
+                          loc.nelem, lextents[last] - col);
+        auto is_contiguous = [&](index_t n) {
+          auto lc = lcoords;
+          lc[last] += n - 1;
+          auto gc  = pattern.global(lc);
+          gc[last] -= n - 1;
+          return pattern.local_at(lc) == loffset + n - 1 && gc == gcoords;
+        };
+        if (!is_contiguous(nelem)) {
+          index_t lo = 1;
+          index_t hi = nelem - 1;
+          while (lo < hi) {
+            index_t mid = lo + (hi - lo + 1) / 2;
+            if (is_contiguous(mid)) {
+              lo = mid;
+            } else {
+              hi = mid - 1;
+            }
+          }
+          nelem = lo;
+        }
+        if (pending_nelem > 0 &&
+            pending_buf + pending_nelem == lbegin + loffset &&
+            pending_offset + pending_nelem == loc.offset) {
+          pending_nelem += nelem;
+        } else {
+          flush_pending();
+          pending_buf    = lbegin + loffset;
+          pending_offset = loc.offset;
+          pending_nelem  = nelem;
+        }
+        col += nelem;
+      }
+    }
+    flush_pending();
+  }
+};
+
+}  // namespace binary
+}  // namespace io
+}  // namespace dash
+
+#endif  // DASH__IO__BINARY__STORAGEDRIVER_H__
@@ -5,6 +5,7 @@
 
 #include <string>
 #include <array>
+#include <cstddef>
 
 namespace dash {
 namespace io {
@@ -77,6 +78,35 @@ class modify_dataset {
   modify_dataset(bool modify = true) : _modify(modify) {}
 };
 
+/**
+ * Stream manipulator class to set the number of units per node
+ * which access the file system. The data of all other units on a
+ * node is aggregated at these units.
+ * A value of 0 uses the defaults of the MPI-IO implementation.
+ */
+class node_aggregation {
+ public:
+  int _aggregators;
+
+ public:
+  node_aggregation(int aggregators = 1) : _aggregators(aggregators) {}
+};
+
+/**
+ * Stream manipulator class to set the maximum number of bytes per unit
+ * that are staged by an asynchronous output stream.
+ * If the limit is exceeded, storing a container blocks until previously
+ * staged data has been written.
+ * A limit of 0 allows one staged container at a time.
+ */
+class staging_limit {
+ public:
+  std::size_t _bytes;
+
+ public:
+  staging_limit(std::size_t bytes = 0) : _bytes(bytes) {}
+};
+
 /**
  * Converter function to convert non-POT types and especially structs to
  * HDF5 types.
@@ -4,15 +4,15 @@
 #ifdef DASH_ENABLE_HDF5
 
 #include <string>
-#include <future>
+#include <memory>
+#include <type_traits>
 
 #include <dash/Matrix.h>
 #include <dash/Array.h>
 
 #include <dash/LaunchPolicy.h>
 
-#include <chrono>
-#include <thread>
+#include <dash/io/hdf5/internal/StagingQueue.h>
 
 namespace dash {
 namespace io {
@@ -39,18 +39,23 @@ class OutputStream : public ::dash::io::IOSBase<StreamMode> {
   bool _use_cust_conv = false;
   dash::launch _launch_policy;
 
-  std::vector<std::shared_future<void> > _async_ops;
+  std::unique_ptr<internal::StagingQueue> _staging;
 
  public:
   /**
    * Creates an HDF5 output stream using a launch policy
    *
-   * Support of \ref dash::launch::async is still highly experimental and requires
-   * thread support in MPI. If multi-threaded access is not supported,
-   * blocking I/O is used as fallback. To wait for outstanding IO operations use
-   * \c flush(). Until the stream is not flushed, no write accesses to the
-   * container, as well as no barriers are allowed.
-   * Otherwise the behavior is undefined.
+   * Using \ref dash::launch::async, the local data of a container is copied
+   * into a staging buffer and written to the file by a dedicated IO thread.
+   * The container can be modified as soon as the stream operation returns.
+   * The amount of staged data is bounded by \ref staging_limit, storing
+   * further containers blocks until enough staged data has been written.
+   * Containers which do not provide contiguous local memory are written
+   * synchronously after all staged data has been written.
+   *
+   * Asynchronous IO requires thread support in MPI. If multi-threaded
+   * access is not supported, blocking I/O is used as fallback.
+   * To wait for outstanding IO operations use \c flush().
    */
   OutputStream(
       ///
@@ -68,6 +73,9 @@ class OutputStream : public ::dash::io::IOSBase<StreamMode> {
           "multi-threaded access. Blocking IO is used"
           "as fallback");
     }
+    if (_launch_policy == dash::launch::async) {
+      _staging.reset(new internal::StagingQueue());
+    }
   }
 
   /**
@@ -93,11 +101,11 @@ class OutputStream : public ::dash::io::IOSBase<StreamMode> {
       mode_t open_mode = DeviceMode::no_flags)
   : OutputStream(dash::launch::sync, filename, open_mode) {}
 
-  ~OutputStream() {
-    if (!_async_ops.empty()) {
-      _async_ops.back().wait();
-    }
-  }
+  /**
+   * Waits until all staged data is written.
+   * Collective operation if \ref dash::launch::async is used.
+   */
+  ~OutputStream() = default;
 
   OutputStream()                      = delete;
   OutputStream(const self_t & other)  = delete;
@@ -111,9 +119,9 @@ class OutputStream : public ::dash::io::IOSBase<StreamMode> {
    * If \ref dash::launch::async is used, waits until all data is written
    */
   self_t & flush() {
-    DASH_LOG_DEBUG("flush output stream", _async_ops.size());
-    if (!_async_ops.empty()) {
-      _async_ops.back().wait();
+    DASH_LOG_DEBUG("flush output stream");
+    if (_staging) {
+      _staging->wait();
     }
     DASH_LOG_DEBUG("output stream flushed");
     return *this;
@@ -145,6 +153,21 @@ class OutputStream : public ::dash::io::IOSBase<StreamMode> {
     return os;
   }
 
+  /// set number of units per node accessing the file system
+  friend OutputStream& operator<<(OutputStream& os,
+                                  const node_aggregation na) {
+    os._foptions.node_aggregators = na._aggregators;
+    return os;
+  }
+
+  /// set maximum number of bytes staged by asynchronous IO
+  friend OutputStream& operator<<(OutputStream& os, const staging_limit sl) {
+    if (os._staging) {
+      os._staging->set_capacity(sl._bytes);
+    }
+    return os;
+  }
+
   /// custom type converter function to convert native type to HDF5 type
   friend OutputStream& operator<<(OutputStream& os, const type_converter conv) {
     os._converter = conv;
@@ -166,38 +189,52 @@ class OutputStream : public ::dash::io::IOSBase<StreamMode> {
     }
   }
 
+  /**
+   * Stage the local data of the container and write it on the IO thread.
+   */
   template <typename Container_t>
-  void _store_object_impl_async(Container_t& container) {
-    auto pos = _async_ops.size();
+  typename std::enable_if<StoreHDF::is_stageable<Container_t>(), void>::type
+  _store_object_impl_async(Container_t& container) {
+    using value_t = typename Container_t::value_type;
+
+    auto io_team = _staging->io_team(container.team());
+    auto nbytes  = container.pattern().local_size() * sizeof(value_t);
+
+    // blocks if capacity of staging buffer is exceeded
+    _staging->acquire(nbytes);
+    decltype(StoreHDF::stage(container)) staged;
+    try {
+      staged = StoreHDF::stage(container);
+    } catch (...) {
+      _staging->release(nbytes);
+      throw;
+    }
 
     // copy state of stream
     auto s_filename = _filename;
-    auto s_dataset = _dataset;
+    auto s_dataset  = _dataset;
     auto s_foptions = _foptions;
-    auto s_use_cust_conv = _use_cust_conv;
-    type_converter_fun_type s_converter = _converter;
-
-    // pass pos by value as it might be out of scope when function is called
-    std::shared_future<void> fut = std::async(
-        std::launch::async, [&, pos, s_filename, s_dataset, s_foptions,
-                             s_converter, s_use_cust_conv]() {
-          if (pos != 0) {
-            // wait for previous tasks
-            auto last_task = _async_ops[pos - 1];
-            DASH_LOG_DEBUG("waiting for future", pos);
-            last_task.wait();
-          }
-          DASH_LOG_DEBUG("execute async io task");
-
-          if (s_use_cust_conv) {
-            StoreHDF::write(container, s_filename, s_dataset, s_foptions,
-                            s_converter);
-          } else {
-            StoreHDF::write(container, s_filename, s_dataset, s_foptions);
-          }
-          DASH_LOG_DEBUG("execute async io task done");
-        });
-    _async_ops.push_back(fut);
+    type_converter_fun_type s_converter = get_h5_datatype<value_t>;
+    if (_use_cust_conv) {
+      s_converter = _converter;
+    }
+
+    _staging->submit(nbytes, [staged, io_team, s_filename, s_dataset,
+                              s_foptions, s_converter]() {
+      StoreHDF::write_staged(*staged, io_team, s_filename, s_dataset,
+                             s_foptions, s_converter);
+    });
+  }
+
+  /**
+   * Containers without contiguous local memory cannot be staged,
+   * they are written synchronously after all staged data.
+   */
+  template <typename Container_t>
+  typename std::enable_if<!StoreHDF::is_stageable<Container_t>(), void>::type
+  _store_object_impl_async(Container_t& container) {
+    flush();
+    _store_object_impl(container);
   }
 };
 
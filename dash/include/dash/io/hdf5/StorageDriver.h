@@ -31,6 +31,8 @@
 #include <type_traits>
 #include <functional>
 #include <utility>
+#include <memory>
+#include <algorithm>
 
 #include <dash/dart/if/dart_io.h>
 
@@ -66,6 +68,12 @@ struct hdf5_options {
   bool restore_pattern = true;
   /// Metadata attribute key in HDF5 file.
   std::string pattern_metadata_key = "DASH_PATTERN";
+  /**
+   * Number of units per node accessing the file system, the data of all
+   * other units on the node is aggregated at these units.
+   * Values <= 0 use the defaults of the MPI-IO implementation.
+   */
+  int node_aggregators = 0;
 };
 
 /**
@@ -165,8 +173,10 @@ class StoreHDF {
 
     // setup mpi access
     plist_id = H5Pcreate(H5P_FILE_ACCESS);
-    DASH_ASSERT_RETURNS(dart__io__hdf5__prep_mpio(plist_id, team.dart_id()),
-                        DART_OK);
+    DASH_ASSERT_RETURNS(
+        dart__io__hdf5__prep_mpio_aggregated(plist_id, team.dart_id(),
+                                             foptions.node_aggregators),
+        DART_OK);
 
     dash::Shared<int> f_exists;
     if (team.myid() == 0) {
@@ -308,11 +318,14 @@ class StoreHDF {
     plist_id = H5Pcreate(H5P_FILE_ACCESS);
     if (is_alloc) {
       DASH_ASSERT_RETURNS(
-          dart__io__hdf5__prep_mpio(plist_id, matrix.team().dart_id()),
+          dart__io__hdf5__prep_mpio_aggregated(
+              plist_id, matrix.team().dart_id(), foptions.node_aggregators),
           DART_OK);
     } else {
       DASH_ASSERT_RETURNS(
-          dart__io__hdf5__prep_mpio(plist_id, dash::Team::All().dart_id()),
+          dart__io__hdf5__prep_mpio_aggregated(
+              plist_id, dash::Team::All().dart_id(),
+              foptions.node_aggregators),
           DART_OK);
     }
 
@@ -439,6 +452,76 @@ class StoreHDF {
     hdf5_hyperslab_spec() {};
   };
 
+  /**
+   * Snapshot of the local data of a container which is written to an
+   * HDF5 file independent of the container's lifetime and state.
+   */
+  template <typename ValueT, class PatternT>
+  struct hdf5_staged_data {
+    typedef ValueT   value_type;
+    typedef PatternT pattern_type;
+
+    /// Copy of the pattern of the staged container
+    PatternT pattern;
+    /// Global extents of the staged container
+    hdf5_filespace_spec<PatternT::ndim()> extents;
+    /// Number of staged local elements
+    std::size_t lsize = 0;
+    /// Copy of the container's local elements
+    std::unique_ptr<ValueT[]> lbuffer;
+
+    explicit hdf5_staged_data(const PatternT& pat) : pattern(pat) {}
+  };
+
+  /**
+   * test at compile time if the local data of a container can be staged
+   * by \c stage and written by \c write_staged
+   * \return true if container can be staged
+   */
+  template <class Container_t>
+  static constexpr bool is_stageable() {
+    return _is_origin_view<Container_t>() &&
+           _compatible_pattern<
+               typename dash::view_traits<Container_t>::pattern_type>();
+  }
+
+  /**
+   * Copy the local data of a container into a staging buffer.
+   * The container can be modified as soon as this function returns.
+   *
+   * Local operation.
+   */
+  template <typename Container_t>
+  static std::shared_ptr<hdf5_staged_data<typename Container_t::value_type,
+                                          typename Container_t::pattern_type>>
+  stage(Container_t& container);
+
+  /**
+   * Store data staged by \c stage in an HDF5 file using parallel IO.
+   *
+   * In contrast to \c write, no collective operations on the team of the
+   * staged container are used, all communication is performed on
+   * \c io_team which must consist of the same units.
+   * This allows to write the data on a dedicated IO thread while the
+   * container's team continues computation.
+   *
+   * Collective operation on \c io_team.
+   */
+  template <typename ValueT, class PatternT>
+  static void write_staged(
+      /// Staged data to store
+      hdf5_staged_data<ValueT, PatternT>& staged,
+      /// DART team used for communication and file access
+      dart_team_t io_team,
+      /// Filename of HDF5 file including extension
+      std::string filename,
+      /// HDF5 Dataset in which the data is stored
+      std::string datapath,
+      /// options how to open and modify data
+      hdf5_options foptions = hdf5_options(),
+      /// \c std::function to convert native type into h5 type
+      type_converter_fun_type to_h5_dt_converter = get_h5_datatype<ValueT>);
+
  private:
   enum class Mode : uint16_t {
     READ = 0x1,
@@ -630,12 +713,15 @@ class StoreHDF {
       _is_origin_view<Container_t>(),
       void>::type static _store_pattern(Container_t& container, hid_t h5dset,
                                         hdf5_options& foptions) {
-    using pattern_t = typename Container_t::pattern_type;
+    _store_pattern_spec(container.pattern(), h5dset, foptions);
+  }
+
+  template <class pattern_t>
+  static void _store_pattern_spec(const pattern_t& pattern, hid_t h5dset,
+                                  hdf5_options& foptions) {
     using extent_t = typename pattern_t::size_type;
     constexpr auto ndim = pattern_t::ndim();
 
-    auto& pattern = container.pattern();
-
     auto pat_key = foptions.pattern_metadata_key.c_str();
     extent_t pattern_spec[ndim * 4];
 
@@ -755,6 +841,14 @@ class StoreHDF {
                                               const hid_t& h5dset,
                                               const hid_t& internal_type);
 
+  template <class pattern_t>
+  static void _process_local_data_zero_copy(StoreHDF::Mode io_mode,
+                                            const pattern_t& pattern,
+                                            dart_team_t teamid,
+                                            void* lbuffer,
+                                            const hid_t& h5dset,
+                                            const hid_t& internal_type);
+
   template <class Container_t>
   static void _write_dataset_impl_buffered(Container_t& container,
                                            const hid_t& h5dset,
@@ -794,6 +888,7 @@ class StoreHDF {
 #include <dash/io/hdf5/internal/DriverImplZeroCopy.h>
 #include <dash/io/hdf5/internal/DriverImplBuffered.h>
 #include <dash/io/hdf5/internal/DriverImplNdBlock.h>
+#include <dash/io/hdf5/internal/DriverImplStaged.h>
 
 #include <dash/io/hdf5/internal/StorageDriver-inl.h>
 
@@ -0,0 +1,154 @@
+#ifndef DASH__IO__HDF5__INTERNAL_IMPL_STAGED_H__
+#define DASH__IO__HDF5__INTERNAL_IMPL_STAGED_H__
+
+#include <hdf5.h>
+#include <hdf5_hl.h>
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <string>
+
+namespace dash {
+namespace io {
+namespace hdf5 {
+
+template <typename Container_t>
+std::shared_ptr<StoreHDF::hdf5_staged_data<
+    typename Container_t::value_type, typename Container_t::pattern_type>>
+StoreHDF::stage(Container_t& container) {
+  using value_t = typename Container_t::value_type;
+  using pattern_t = typename Container_t::pattern_type;
+
+  DASH_LOG_DEBUG("StoreHDF.stage()");
+
+  const pattern_t& pattern = container.pattern();
+  auto staged =
+      std::make_shared<hdf5_staged_data<value_t, pattern_t>>(pattern);
+
+  staged->extents = _get_container_extents(container);
+  staged->lsize = pattern.local_size();
+  // default-initialized buffer, avoids touching memory twice
+  staged->lbuffer.reset(new value_t[staged->lsize]);
+  std::copy(container.lbegin(), container.lbegin() + staged->lsize,
+            staged->lbuffer.get());
+
+  DASH_LOG_DEBUG("StoreHDF.stage >", staged->lsize);
+  return staged;
+}
+
+template <typename ValueT, class PatternT>
+void StoreHDF::write_staged(hdf5_staged_data<ValueT, PatternT>& staged,
+                            dart_team_t io_team, std::string filename,
+                            std::string datapath, hdf5_options foptions,
+                            type_converter_fun_type to_h5_dt_converter) {
+  constexpr auto ndim = PatternT::ndim();
+
+  DASH_LOG_DEBUG("StoreHDF.write_staged()", filename, datapath);
+
+  // Map native types to HDF5 types
+  auto h5datatype = to_h5_dt_converter();
+  // for tracking opened groups
+  std::list<hid_t> open_groups;
+  // Split path in groups and dataset
+  auto path_vec = _split_string(datapath, '/');
+  auto dataset = path_vec.back();
+  // remove dataset from path
+  path_vec.pop_back();
+
+  /* HDF5 definition */
+  hid_t file_id;
+  hid_t h5dset;
+  hid_t internal_type;
+  hid_t plist_id;  // property list identifier
+  hid_t filespace;
+  hid_t loc_id;
+
+  // setup mpi access
+  plist_id = H5Pcreate(H5P_FILE_ACCESS);
+  DASH_ASSERT_RETURNS(
+      dart__io__hdf5__prep_mpio_aggregated(plist_id, io_team,
+                                           foptions.node_aggregators),
+      DART_OK);
+
+  dart_team_unit_t myid;
+  DASH_ASSERT_RETURNS(dart_team_myid(io_team, &myid), DART_OK);
+
+  int f_exists = -1;
+  if (myid.id == 0 && access(filename.c_str(), F_OK) != -1) {
+    // check if file exists
+    f_exists = static_cast<int>(H5Fis_hdf5(filename.c_str()));
+  }
+  DASH_ASSERT_RETURNS(
+      dart_bcast(&f_exists, 1, DART_TYPE_INT, dart_team_unit_t{0}, io_team),
+      DART_OK);
+
+  if (foptions.overwrite_file || (f_exists <= 0)) {
+    // HD5 create file
+    file_id = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+  } else {
+    // Open file in RW mode
+    file_id = H5Fopen(filename.c_str(), H5F_ACC_RDWR, plist_id);
+  }
+
+  // close property list
+  H5Pclose(plist_id);
+
+  // Traverse path
+  loc_id = file_id;
+  for (std::string elem : path_vec) {
+    if (H5Lexists(loc_id, elem.c_str(), H5P_DEFAULT)) {
+      loc_id = H5Gopen2(loc_id, elem.c_str(), H5P_DEFAULT);
+    } else {
+      loc_id = H5Gcreate2(loc_id, elem.c_str(), H5P_DEFAULT, H5P_DEFAULT,
+                          H5P_DEFAULT);
+    }
+    if (loc_id != file_id) {
+      open_groups.push_back(loc_id);
+    }
+  }
+
+  // Create dataspace
+  filespace = H5Screate_simple(ndim, staged.extents.extent, NULL);
+  internal_type = H5Tcopy(h5datatype);
+
+  if (foptions.modify_dataset) {
+    // Open dataset in RW mode
+    h5dset = H5Dopen(loc_id, dataset.c_str(), H5P_DEFAULT);
+  } else {
+    // Create dataset
+    h5dset = H5Dcreate(loc_id, dataset.c_str(), internal_type, filespace,
+                       H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  }
+
+  // Close global dataspace
+  H5Sclose(filespace);
+
+  _process_local_data_zero_copy(StoreHDF::Mode::WRITE, staged.pattern,
+                                io_team, staged.lbuffer.get(), h5dset,
+                                internal_type);
+
+  // Add Attributes
+  if (foptions.store_pattern) {
+    DASH_LOG_DEBUG("store pattern in hdf5 file");
+    _store_pattern_spec(staged.pattern, h5dset, foptions);
+  }
+
+  // Close all
+  H5Dclose(h5dset);
+  H5Tclose(internal_type);
+
+  std::for_each(open_groups.rbegin(), open_groups.rend(),
+                [](hid_t& group_id) { H5Gclose(group_id); });
+
+  H5Fclose(file_id);
+
+  DASH_ASSERT_RETURNS(dart_barrier(io_team), DART_OK);
+  DASH_LOG_DEBUG("StoreHDF.write_staged >");
+}
+
+}  // namespace hdf5
+}  // namespace io
+}  // namespace dash
+
+#endif  // DASH__IO__HDF5__INTERNAL_IMPL_STAGED_H__
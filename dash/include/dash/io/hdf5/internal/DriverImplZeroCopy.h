@@ -16,7 +16,18 @@ void StoreHDF::_process_dataset_impl_zero_copy(StoreHDF::Mode io_mode,
                                                Container_t& container,
                                                const hid_t& h5dset,
                                                const hid_t& internal_type) {
-  using pattern_t = typename Container_t::pattern_type;
+  _process_local_data_zero_copy(io_mode, container.pattern(),
+                                container.team().dart_id(),
+                                container.lbegin(), h5dset, internal_type);
+}
+
+template <class pattern_t>
+void StoreHDF::_process_local_data_zero_copy(StoreHDF::Mode io_mode,
+                                             const pattern_t& pattern,
+                                             dart_team_t teamid,
+                                             void* lbuffer,
+                                             const hid_t& h5dset,
+                                             const hid_t& internal_type) {
   constexpr auto ndim = pattern_t::ndim();
 
   DASH_LOG_DEBUG("Use zero_copy impl");
@@ -29,7 +40,7 @@ void StoreHDF::_process_dataset_impl_zero_copy(StoreHDF::Mode io_mode,
   H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
 
   // TODO: Optimize
-  auto hyperslabs = _get_hdf_slabs(container.pattern());
+  auto hyperslabs = _get_hdf_slabs(pattern);
 
   // hyperslab data can be quite large => sort indices only
   std::vector<int> hs_index_set(hyperslabs.size());
@@ -48,7 +59,7 @@ void StoreHDF::_process_dataset_impl_zero_copy(StoreHDF::Mode io_mode,
 
   DASH_ASSERT_RETURNS(dart_allreduce(&hs_count_local, &hs_count_max, 1,
                                      dart_datatype<int>::value, DART_OP_MAX,
-                                     container.team().dart_id()),
+                                     teamid),
                       DART_OK);
 
   const hdf5_hyperslab_spec<ndim> hs_empty;
@@ -73,10 +84,10 @@ void StoreHDF::_process_dataset_impl_zero_copy(StoreHDF::Mode io_mode,
 
     if (io_mode == StoreHDF::Mode::WRITE) {
       H5Dwrite(h5dset, internal_type, memspace, filespace, plist_id,
-               (container.lbegin()));
+               lbuffer);
     } else {
       H5Dread(h5dset, internal_type, memspace, filespace, plist_id,
-              (container.lbegin()));
+              lbuffer);
     }
     H5Sclose(memspace);
   }
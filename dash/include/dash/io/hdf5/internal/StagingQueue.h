@@ -0,0 +1,208 @@
+#ifndef DASH__IO__HDF5__INTERNAL__STAGING_QUEUE_H__INCLUDED
+#define DASH__IO__HDF5__INTERNAL__STAGING_QUEUE_H__INCLUDED
+
+#include <dash/Team.h>
+#include <dash/Init.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_team_group.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace dash {
+namespace io {
+namespace hdf5 {
+namespace internal {
+
+/**
+ * Queue of IO tasks operating on staged data which are executed in
+ * order of submission by a single, dedicated IO thread.
+ *
+ * The amount of staged data is bounded by the capacity of the queue:
+ * \c acquire blocks until enough tasks finished to release the requested
+ * number of bytes (back-pressure).
+ * A single request is always admitted if no other data is staged, so a
+ * capacity of 0 allows one checkpoint being written while the next one
+ * is computed.
+ *
+ * To avoid interference with collective operations of the application,
+ * IO tasks communicate on clones of the containers' teams which are only
+ * used by the IO thread.
+ */
+class StagingQueue {
+ public:
+  typedef std::function<void(void)> task_type;
+
+ private:
+  typedef std::pair<std::size_t, task_type> entry_type;
+
+ public:
+  explicit StagingQueue(std::size_t capacity = 0)
+  : _capacity(capacity),
+    _thread(&StagingQueue::_run, this) {}
+
+  /**
+   * Waits for completion of all submitted tasks.
+   * Destroys the IO teams, collective operation.
+   */
+  ~StagingQueue() {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv_done.wait(lock, [this]() { return _pending == 0; });
+      _shutdown = true;
+    }
+    _cv_task.notify_one();
+    _thread.join();
+    if (dash::is_initialized()) {
+      for (auto& teams : _io_teams) {
+        dart_team_destroy(&teams.second);
+      }
+    }
+  }
+
+  StagingQueue(const StagingQueue& other) = delete;
+  StagingQueue& operator=(const StagingQueue& other) = delete;
+
+  /**
+   * DART team used by the IO thread for operations on containers
+   * allocated in the given team.
+   * Created on first request, collective operation on \c team.
+   */
+  dart_team_t io_team(const dash::Team& team) {
+    auto it = _io_teams.find(team.dart_id());
+    if (it != _io_teams.end()) {
+      return it->second;
+    }
+    dart_team_t io_team = DART_TEAM_NULL;
+    DASH_ASSERT_RETURNS(dart_team_clone(team.dart_id(), &io_team), DART_OK);
+    _io_teams.insert(std::make_pair(team.dart_id(), io_team));
+    return io_team;
+  }
+
+  /// Maximum number of staged bytes
+  std::size_t capacity() const { return _capacity; }
+
+  /// Set maximum number of staged bytes
+  void set_capacity(std::size_t capacity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+  }
+
+  /**
+   * Reserves staging memory, blocks until the requested number of bytes
+   * fits into the capacity of the queue or no other data is staged.
+   */
+  void acquire(std::size_t nbytes) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    DASH_LOG_DEBUG("StagingQueue.acquire()", nbytes, "staged:", _staged);
+    _cv_done.wait(lock, [this, nbytes]() {
+      return _staged == 0 || _staged + nbytes <= _capacity;
+    });
+    _staged += nbytes;
+  }
+
+  /**
+   * Releases staging memory reserved by \c acquire which is not handed
+   * over to a task.
+   */
+  void release(std::size_t nbytes) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _staged -= nbytes;
+    }
+    _cv_done.notify_all();
+  }
+
+  /**
+   * Appends a task to the queue. The given number of staged bytes
+   * previously reserved by \c acquire is released once the task finished.
+   */
+  void submit(std::size_t nbytes, task_type task) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _tasks.emplace_back(nbytes, std::move(task));
+      ++_pending;
+    }
+    _cv_task.notify_one();
+  }
+
+  /**
+   * Blocks until all submitted tasks are completed.
+   * Rethrows the first exception raised by a task since the last call.
+   */
+  void wait() {
+    std::exception_ptr error;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv_done.wait(lock, [this]() { return _pending == 0; });
+      std::swap(error, _error);
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  void _run() {
+    while (true) {
+      entry_type entry;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv_task.wait(lock,
+                      [this]() { return _shutdown || !_tasks.empty(); });
+        if (_tasks.empty()) {
+          return;
+        }
+        entry = std::move(_tasks.front());
+        _tasks.pop_front();
+      }
+      DASH_LOG_DEBUG("StagingQueue._run", "execute io task");
+      std::exception_ptr error;
+      try {
+        entry.second();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      // free staged data before releasing its capacity
+      entry.second = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _staged -= entry.first;
+        --_pending;
+        if (error && !_error) {
+          _error = error;
+        }
+      }
+      _cv_done.notify_all();
+      DASH_LOG_DEBUG("StagingQueue._run", "io task done");
+    }
+  }
+
+ private:
+  std::mutex                         _mutex;
+  std::condition_variable            _cv_task;
+  std::condition_variable            _cv_done;
+  std::deque<entry_type>             _tasks;
+  std::size_t                        _capacity;
+  std::size_t                        _staged   = 0;
+  std::size_t                        _pending  = 0;
+  bool                               _shutdown = false;
+  std::exception_ptr                 _error;
+  std::map<dart_team_t, dart_team_t> _io_teams;
+  std::thread                        _thread;
+};
+
+}  // namespace internal
+}  // namespace hdf5
+}  // namespace io
+}  // namespace dash
+
+#endif  // DASH__IO__HDF5__INTERNAL__STAGING_QUEUE_H__INCLUDED
@@ -207,8 +207,24 @@ public:
    */
   void pop_back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef.pop_back is not implemented");
+    DASH_LOG_TRACE("LocalListRef.pop_back()");
+    // Number of local elements before operation:
+    auto l_size_old = _list->_local_sizes.local[0];
+    if (l_size_old == 0) {
+      DASH_THROW(dash::exception::OutOfRange,
+                 "dash::LocalListRef.pop_back on empty local list");
+    }
+    if (l_size_old > 1) {
+      // Unlink removed node from its predecessor (cast from
+      // LocalBucketIter<T> to T *), the node's memory is reused by the
+      // next push_back:
+      ListNode_t * node_lprev = static_cast<ListNode_t *>(
+                                  _list->_globmem->lbegin() +
+                                  (l_size_old - 2));
+      node_lprev->lnext = nullptr;
+    }
+    _list->_local_sizes.local[0]--;
+    DASH_LOG_TRACE("LocalListRef.pop_back >");
   }
 
   /**
@@ -90,7 +90,10 @@ inline Matrix<T, NumDim, IndexT, PatternT>
   _glob_mem(other._glob_mem),
   _lbegin(other._lbegin),
   _lend(other._lend),
-  _ref(other._ref)
+  _ref(other._ref),
+  _read_cache(std::move(other._read_cache)),
+  _placement(other._placement),
+  _pages(other._pages)
 {
   // do not free other globmem
   other._glob_mem = nullptr;
@@ -129,6 +132,9 @@ Matrix<T, NumDim, IndexT, PatternT>
   _lbegin    = other._lbegin;
   _lend      = other._lend;
   _ref       = other._ref;
+  _read_cache = std::move(other._read_cache);
+  _placement  = other._placement;
+  _pages      = other._pages;
 
   // Re-register team deallocator:
   if (_glob_mem != nullptr) {
@@ -211,7 +217,11 @@ bool Matrix<T, NumDim, IndexT, PatternT>
   DASH_LOG_TRACE_VAR("Matrix.allocate", _lcapacity);
   // Allocate and initialize memory
   // use _lcapacity as tje collective allocator requires symmetric allocations
-  _glob_mem        = new GlobMem_t(_lcapacity, _pattern.team());
+  _glob_mem        = (_placement == MemoryPlacement::system &&
+                      _pages     == MemoryPages::system)
+                     ? new GlobMem_t(_lcapacity, _pattern.team())
+                     : new GlobMem_t(_lcapacity, _pattern.team(),
+                                     _placement, _pages);
   _begin           = iterator(_glob_mem, _pattern);
   _lbegin          = _glob_mem->lbegin();
   _lend            = _lbegin + _lsize;
@@ -270,6 +280,9 @@ void Matrix<T, NumDim, IndexT, PatternT>
   // double-free:
   _team->unregister_deallocator(
     this, std::bind(&Matrix::deallocate, this));
+  // The segment id of the cached memory may be reused by subsequent
+  // allocations:
+  _read_cache.reset();
   // Actual destruction of the array instance:
   delete _glob_mem;
   _size = 0;
@@ -392,6 +405,59 @@ Matrix<T, NumDim, IndexT, PatternT>
   _glob_mem->flush_local(target);
 }
 
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+void
+Matrix<T, NumDim, IndexT, PatternT>
+::enable_read_cache(const ReadCacheConfig & config) {
+  _read_cache.reset();
+  _read_cache.reset(
+    new ReadCache(_glob_mem->begin().dart_gptr(),
+                  _glob_mem->local_size() * sizeof(value_type),
+                  config));
+}
+
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+inline void
+Matrix<T, NumDim, IndexT, PatternT>
+::disable_read_cache() {
+  _read_cache.reset();
+}
+
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+inline ReadCache *
+Matrix<T, NumDim, IndexT, PatternT>
+::read_cache() const noexcept {
+  return _read_cache.get();
+}
+
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+inline void
+Matrix<T, NumDim, IndexT, PatternT>
+::set_memory_placement(MemoryPlacement placement) noexcept {
+  _placement = placement;
+}
+
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+inline MemoryPlacement
+Matrix<T, NumDim, IndexT, PatternT>
+::memory_placement() const noexcept {
+  return _placement;
+}
+
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+inline void
+Matrix<T, NumDim, IndexT, PatternT>
+::set_memory_pages(MemoryPages pages) noexcept {
+  _pages = pages;
+}
+
+template <typename T, dim_t NumDim, typename IndexT, class PatternT>
+inline MemoryPages
+Matrix<T, NumDim, IndexT, PatternT>
+::memory_pages() const noexcept {
+  return _pages;
+}
+
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
 constexpr typename Matrix<T, NumDim, IndexT, PatternT>::const_iterator
 Matrix<T, NumDim, IndexT, PatternT>
@@ -1200,10 +1200,11 @@ private:
         u_bucket_cumul_sizes.back() += u_local_size_diff;
       }
     }
-    // Detach array of local unattached bucket sizes, implicit barrier:
-    attach_buckets_sizes_allocator.detach(attach_buckets_sizes_gptr);
-    // Implicit barrier in allocator.detach
+    // Remote units might still be reading this unit's bucket sizes and
+    // detaching is a local operation:
     _team->barrier();
+    // Detach array of local unattached bucket sizes:
+    attach_buckets_sizes_allocator.detach(attach_buckets_sizes_gptr);
 #if DASH_ENABLE_TRACE_LOGGING
     for (size_type u = 0; u < _nunits; ++u) {
       DASH_LOG_TRACE("GlobHeapMem.update_remote_size",
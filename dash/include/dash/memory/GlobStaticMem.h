@@ -9,6 +9,8 @@
 #include <dash/Team.h>
 #include <dash/Onesided.h>
 
+#include <dash/memory/MemoryPlacement.h>
+
 #include <dash/internal/Logging.h>
 
 namespace dash {
@@ -176,6 +178,45 @@ public:
     DASH_LOG_TRACE("GlobStaticMem(nlocal,team) >");
   }
 
+  /**
+   * Constructor, collectively allocates the given number of elements in
+   * local memory of every unit in a team and places the pages of local
+   * memory according to the given policy, backed by pages of the given
+   * kind.
+   *
+   * Requires an allocator type constructible from a team, a placement
+   * policy and a kind of pages, like
+   * \c dash::allocator::SymmetricAllocator.
+   */
+  GlobStaticMem(
+    /// Number of local elements to allocate in global memory space
+    size_type         n_local_elem,
+    /// Team containing all units operating on the global memory region
+    Team            & team,
+    /// Placement policy of the pages of local memory
+    MemoryPlacement   placement,
+    /// Kind of pages backing local memory
+    MemoryPages       pages = MemoryPages::system)
+  : _allocator(team, placement, pages),
+    _team(&team),
+    _teamid(team.dart_id()),
+    _nunits(team.size()),
+    _myid(team.myid()),
+    _nlelem(n_local_elem)
+  {
+    DASH_LOG_TRACE("GlobStaticMem(nlocal,team,placement)",
+                   "number of local values:", _nlelem,
+                   "team size:",              team.size(),
+                   "placement:",              placement,
+                   "pages:",                  pages);
+    _begptr = _allocator.allocate(_nlelem);
+    DASH_ASSERT_MSG(!DART_GPTR_ISNULL(_begptr), "allocation failed");
+
+    update_lbegin();
+    update_lend();
+    DASH_LOG_TRACE("GlobStaticMem(nlocal,team,placement) >");
+  }
+
   /**
    * Constructor, collectively allocates the given number of elements in
    * local memory of every unit in a team.
@@ -0,0 +1,92 @@
+#ifndef DASH__MEMORY__MEMORY_PLACEMENT_H__
+#define DASH__MEMORY__MEMORY_PLACEMENT_H__
+
+#include <dash/dart/if/dart_globmem.h>
+
+#include <cstddef>
+#include <iosfwd>
+
+
+namespace dash {
+
+/**
+ * Placement policies of the pages of a unit's local memory in global
+ * memory allocations.
+ *
+ * Local segments are placed when they are allocated, before they are
+ * initialized. Pages not placed explicitly are mapped to the NUMA node
+ * of the thread touching them first, which is the node of the unit's
+ * main thread if local elements are initialized sequentially.
+ *
+ * \see dash::apply_memory_placement
+ */
+enum class MemoryPlacement {
+  /// Placement is left to the operating system
+  system,
+  /// Pages are touched by the unit's threads in a static schedule,
+  /// matching OpenMP loops with \c schedule(static) over local elements
+  first_touch_parallel,
+  /// Pages are interleaved across all NUMA nodes available to the unit
+  interleaved,
+  /// Pages are bound to the NUMA node of the unit, see
+  /// \c dart_hwinfo_t::numa_id
+  unit_domain
+};
+
+/**
+ * Kinds of pages backing a unit's local memory in global memory
+ * allocations.
+ *
+ * Huge pages reduce TLB misses of random accesses to large local memory
+ * ranges. Local memory backed by huge pages is not allocated in shared
+ * memory windows, accesses of units at the same node are performed via
+ * MPI instead of in shared memory.
+ * Explicit huge pages fall back to smaller huge pages and to transparent
+ * huge pages if the system's huge page pool is exhausted.
+ *
+ * \see dart_team_memalloc_aligned_pages
+ */
+enum class MemoryPages : int {
+  /// Pages of the system's default size
+  system   = DART_MEMPAGES_DEFAULT,
+  /// Transparent huge pages, if enabled in the system configuration
+  huge     = DART_MEMPAGES_HUGE,
+  /// Explicit 2 MiB huge pages
+  huge_2mb = DART_MEMPAGES_HUGE_2M,
+  /// Explicit 1 GiB huge pages
+  huge_1gb = DART_MEMPAGES_HUGE_1G
+};
+
+/**
+ * Applies a placement policy to the pages of a local memory range.
+ *
+ * Only pages entirely contained in the range are placed, pages shared
+ * with adjacent memory ranges are not modified.
+ * Pages of the range already touched are migrated for policies
+ * \c MemoryPlacement::interleaved and \c MemoryPlacement::unit_domain,
+ * \c MemoryPlacement::first_touch_parallel only places pages that have
+ * not been touched before.
+ *
+ * \returns  true if the policy has been applied, false if it is not
+ *           supported in the build configuration or on the calling
+ *           unit's node. Memory remains valid in any case.
+ */
+bool apply_memory_placement(
+  /// Begin of the local memory range, its content is undefined after
+  /// \c MemoryPlacement::first_touch_parallel was applied
+  void            * addr,
+  /// Size of the local memory range in bytes
+  size_t            nbytes,
+  MemoryPlacement   placement);
+
+std::ostream & operator<<(
+  std::ostream          & os,
+  MemoryPlacement         placement);
+
+std::ostream & operator<<(
+  std::ostream          & os,
+  MemoryPages             pages);
+
+} // namespace dash
+
+#endif // DASH__MEMORY__MEMORY_PLACEMENT_H__
@@ -0,0 +1,248 @@
+#ifndef DASH__MEMORY__READ_CACHE_H__
+#define DASH__MEMORY__READ_CACHE_H__
+
+#include <dash/dart/if/dart.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Modes of a \c dash::ReadCache.
+ */
+enum class ReadCacheMode {
+  /// Direct-mapped cache of fixed-size blocks of remote memory,
+  /// invalidated at every barrier of the team
+  blocks,
+  /// Copy of the complete remote memory, fetched on the first read and
+  /// only invalidated explicitly
+  replicated
+};
+
+/**
+ * Configuration of a \c dash::ReadCache.
+ */
+struct ReadCacheConfig {
+  ReadCacheMode mode       = ReadCacheMode::blocks;
+  /// Size of a cache block in bytes
+  size_t        block_size = 4096;
+  /// Number of cache blocks, the cache holds up to
+  /// \c block_size * \c num_blocks bytes of remote memory
+  size_t        num_blocks = 256;
+  /// Whether memory of units on the same node is cached, too, otherwise
+  /// it is accessed directly in shared memory
+  bool          node_local = false;
+};
+
+/**
+ * Counters of a \c dash::ReadCache.
+ */
+struct ReadCacheStats {
+  /// Blocks read from the cache
+  uint64_t hits          = 0;
+  /// Blocks fetched from remote memory on access
+  uint64_t misses        = 0;
+  /// Blocks fetched from remote memory ahead of access by \c prefetch
+  uint64_t prefetches    = 0;
+  /// Valid blocks replaced by a fetched block
+  uint64_t evictions     = 0;
+  /// Invalidations of the complete cache
+  uint64_t invalidations = 0;
+  /// Bytes fetched from remote memory
+  uint64_t bytes_fetched = 0;
+};
+
+/**
+ * Software-managed cache of remote memory of a global memory segment
+ * for read-mostly access patterns.
+ *
+ * While a cache is registered for a segment, blocking reads of single
+ * values in the segment, like conversions of \c dash::GlobRef, are
+ * served from the cache. Values written by the calling unit via
+ * blocking and non-blocking puts are updated in the cache, values
+ * written by other units become visible after the cache has been
+ * invalidated.
+ *
+ * Caches in mode \c ReadCacheMode::blocks are invalidated by every
+ * \c dash::Team::barrier of the segment's team, caches in mode
+ * \c ReadCacheMode::replicated only by \c invalidate.
+ *
+ * Usually not created directly but via \c enable_read_cache of a
+ * container:
+ *
+ * \code
+ *   dash::Array<int> table(nelem);
+ *   // ... initialize table ...
+ *   table.barrier();
+ *   table.enable_read_cache();
+ *   for (...) {
+ *     sum += table[idx];
+ *   }
+ *   auto stats = table.read_cache()->stats();
+ * \endcode
+ */
+class ReadCache
+{
+public:
+  /**
+   * Creates a cache of the global memory segment starting at \c begin,
+   * allocated with \c local_bytes bytes at every unit of its team.
+   *
+   * Local operation.
+   */
+  ReadCache(
+    dart_gptr_t             begin,
+    size_t                  local_bytes,
+    const ReadCacheConfig & config = ReadCacheConfig());
+
+  ~ReadCache();
+
+  ReadCache(const ReadCache &)             = delete;
+  ReadCache & operator=(const ReadCache &) = delete;
+
+  /**
+   * Read \c nbytes bytes at \c gptr from the cache, fetching missing
+   * blocks.
+   *
+   * \returns  false if the memory at \c gptr is not cached.
+   */
+  bool get(const dart_gptr_t & gptr, void * dst, size_t nbytes);
+
+  /**
+   * Update cached copies of \c nbytes bytes at \c gptr after the calling
+   * unit has written them.
+   */
+  void update(const dart_gptr_t & gptr, const void * src, size_t nbytes);
+
+  /**
+   * Start fetching the blocks of \c nbytes bytes at \c gptr that are not
+   * cached yet without waiting for their completion, reads of the blocks
+   * wait for their transfer.
+   * Replicated caches fetch the complete remote memory.
+   *
+   * \returns  false if the memory at \c gptr is not cached.
+   */
+  bool prefetch(const dart_gptr_t & gptr, size_t nbytes);
+
+  /**
+   * Discard all cached data.
+   */
+  void invalidate();
+
+  ReadCacheStats stats() const;
+
+  void reset_stats();
+
+  inline const ReadCacheConfig & config() const noexcept
+  {
+    return _config;
+  }
+
+  inline dart_team_t team() const noexcept
+  {
+    return _begin.teamid;
+  }
+
+  /**
+   * Whether \c gptr references the cached segment.
+   */
+  bool covers(const dart_gptr_t & gptr) const noexcept;
+
+  /**
+   * Number of bytes of remote memory the cache holds at most.
+   */
+  size_t capacity() const noexcept;
+
+private:
+  /**
+   * Offset of \c gptr in the local memory of its unit, or -1 if the
+   * memory at \c gptr is not cached.
+   */
+  int64_t local_offset(const dart_gptr_t & gptr, size_t nbytes) const;
+
+  /**
+   * Fetch the complete memory of all cached units.
+   */
+  void replicate();
+
+  /**
+   * Cache line holding block \c block of unit \c unit, fetches the
+   * block on a miss.
+   */
+  char * block_line(dart_unit_t unit, size_t block);
+
+  /**
+   * Wait for a pending prefetch of cache line \c line.
+   */
+  void complete_line(size_t line);
+
+private:
+  dart_gptr_t                     _begin;
+  size_t                          _local_bytes;
+  ReadCacheConfig                 _config;
+  size_t                          _blocks_per_unit = 0;
+  /// Whether memory of a unit is cached
+  std::vector<bool>               _cached_units;
+  /// Global block number held by a cache line, -1 if invalid
+  std::vector<int64_t>            _tags;
+  std::vector<char>               _lines;
+  /// Pending prefetch of a cache line, DART_HANDLE_NULL if none
+  std::vector<dart_handle_t>      _pending;
+  /// Replica of the local memory of every cached unit
+  std::vector<std::vector<char>>  _replica;
+  bool                            _replicated      = false;
+  ReadCacheStats                  _stats;
+};
+
+namespace internal {
+
+/// Number of registered read caches
+extern std::atomic<int> num_read_caches;
+
+inline bool read_caches_active()
+{
+  return num_read_caches.load(std::memory_order_relaxed) > 0;
+}
+
+/**
+ * Read \c nbytes bytes at \c gptr from the read cache registered for
+ * its segment.
+ *
+ * \returns  false if no registered read cache holds the memory at
+ *           \c gptr.
+ */
+bool read_cache_get(const dart_gptr_t & gptr, void * dst, size_t nbytes);
+
+/**
+ * Update copies of \c nbytes bytes at \c gptr in the read cache
+ * registered for its segment after the calling unit has written them.
+ */
+void read_cache_update(
+  const dart_gptr_t & gptr,
+  const void        * src,
+  size_t              nbytes);
+
+/**
+ * Start fetching \c nbytes bytes at \c gptr into the read cache
+ * registered for its segment.
+ *
+ * \returns  false if no registered read cache holds the memory at
+ *           \c gptr.
+ */
+bool read_cache_prefetch(const dart_gptr_t & gptr, size_t nbytes);
+
+/**
+ * Invalidate the read caches of segments of the given team that are
+ * invalidated at barriers.
+ */
+void read_cache_barrier(dart_team_t team);
+
+} // namespace internal
+
+} // namespace dash
+
+#endif // DASH__MEMORY__READ_CACHE_H__
@@ -11,11 +11,12 @@
 #include <dash/Dimensional.h>
 #include <dash/Cartesian.h>
 #include <dash/Team.h>
-#include <dash/PatternProperties.h>
+
+#include <dash/pattern/PatternProperties.h>
+#include <dash/pattern/internal/PatternArguments.h>
 
 #include <dash/internal/Math.h>
 #include <dash/internal/Logging.h>
-#include <dash/internal/PatternArguments.h>
 
 namespace dash {
 
@@ -620,7 +621,7 @@ public:
 
   /**
    * The actual number of elements in this pattern that are local to the
-   * given unit, by dimension.
+   * given unit, by dimension. Defaults to the active unit.
    *
    * \see  local_extent()
    * \see  blocksize()
@@ -630,11 +631,14 @@ public:
    * \see  DashPatternConcept
    */
   std::array<SizeType, NumDimensions> local_extents(
-      team_unit_t unit) const
+      team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const
   {
+    if (unit == UNDEFINED_TEAM_UNIT_ID) {
+      unit = _myid;
+    }
     DASH_LOG_DEBUG_VAR("DynamicPattern.local_extents()", unit);
-    DASH_LOG_DEBUG_VAR("DynamicPattern.local_extents >", _local_size);
-    return std::array<SizeType, 1> { _local_size };
+    DASH_LOG_DEBUG_VAR("DynamicPattern.local_extents >", _local_sizes[unit]);
+    return std::array<SizeType, 1> {{ _local_sizes[unit] }};
   }
 
   ////////////////////////////////////////////////////////////////////////////
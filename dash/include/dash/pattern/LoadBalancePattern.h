@@ -24,6 +24,38 @@
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Capacities of units relative to the mean capacity of all units.
+ *
+ * Units with unknown capacity, i.e. a value <= 0, are assigned neutral
+ * weight 1, the mean of the other units' capacities. Returns a vector of
+ * 1's if no unit capacity is known.
+ */
+inline std::vector<double> relative_unit_capacities(
+  std::vector<double> capacities)
+{
+  double sum       = 0;
+  size_t num_known = 0;
+  for (auto cap : capacities) {
+    if (cap > 0) {
+      sum += cap;
+      ++num_known;
+    }
+  }
+  if (num_known == 0) {
+    return std::vector<double>(capacities.size(), 1.0);
+  }
+  double mean = sum / num_known;
+  for (auto & cap : capacities) {
+    cap = (cap > 0) ? cap / mean : 1.0;
+  }
+  return capacities;
+}
+
+} // namespace internal
+
 class UnitClockFreqMeasure
 {
 private:
@@ -35,28 +67,21 @@ public:
    * Returns unit CPU capacities as percentage of the team's total CPU
    * capacity average, e.g. vector of 1's if all units have identical
    * CPU capacity.
+   * Units with unknown CPU capacity are assigned neutral weight 1.
    */
   static std::vector<double> unit_weights(
     const TeamLocality_t & tloc)
   {
     std::vector<double> unit_cpu_capacities;
-    double sum = 0;
 
     for (auto u : tloc.global_units()) {
       auto   unit_loc      = tloc.unit_locality(u);
       double unit_cpu_cap  = unit_loc.num_cores() *
                              unit_loc.num_threads() *
                              unit_loc.cpu_mhz();
-      sum += unit_cpu_cap;
       unit_cpu_capacities.push_back(unit_cpu_cap);
     }
-    double mean = sum / tloc.global_units().size();
-    std::transform(unit_cpu_capacities.begin(),
-                   unit_cpu_capacities.end(),
-                   unit_cpu_capacities.begin(),
-
-                   [&](double v) { return v / mean; });
-    return unit_cpu_capacities;
+    return internal::relative_unit_capacities(unit_cpu_capacities);
   }
 };
 
@@ -72,6 +97,8 @@ public:
    * mean memory bandwidth capacity of all units in the team.
    * Consequently, a vector of 1's is returned if all units have identical
    * memory bandwidth.
+   * Units located at cores with unknown memory bandwidth or CPU frequency
+   * are assigned neutral weight 1.
    *
    * The memory bandwidth balancing weight for a unit is relative to the
    * bytes/cycle measure of its affine core and considers the
@@ -98,65 +125,20 @@ public:
   static std::vector<double> unit_weights(
     const TeamLocality_t & tloc)
   {
-    std::vector<double> unit_mem_perc;
-
-#if 0
-    // TODO: Calculate and assign neutral weights for units located at
-    //       cores with unknown memory bandwidth.
-
-    std::vector<size_t> unit_mem_capacities;
-    size_t total_mem_capacity = 0;
-
-    // Calculate average memory bandwidth first:
-    for (auto u : tloc.units()) {
-      auto & unit_loc     = tloc.unit_locality(u);
-      size_t unit_mem_cap = std::max<int>(0, unit_loc.max_shmem_mbps());
-      if (unit_mem_cap > 0) {
-        total_mem_capacity += unit_mem_cap;
-      }
-      unit_mem_capacities.push_back(unit_mem_cap);
-    }
-    if (total_mem_capacity == 0) {
-      total_mem_capacity = tloc.units().size();
-    }
-    DASH_LOG_TRACE_VAR("LoadBalancePattern.init_mem_bandwidth_weights",
-                       total_mem_capacity);
-    DASH_LOG_TRACE_VAR("LoadBalancePattern.init_mem_bandwidth_weights",
-                       unit_mem_capacities);
-
-    double avg_mem_capacity = static_cast<double>(total_mem_capacity) /
-                              tloc.units().size();
-
-    // Use average value for units with unknown memory bandwidth:
-    for (auto membw = unit_mem_capacities.begin();
-         membw != unit_mem_capacities.end(); ++membw) {
-      if (*membw <= 0) {
-        *membw = avg_mem_capacity;
-      }
-    }
-#endif
-
     std::vector<double> unit_bytes_per_cycle;
-    double total_bytes_per_cycle = 0;
 
     // Calculating bytes/cycle per core for every unit:
     for (auto u : tloc.global_units()) {
       auto   unit_loc     = tloc.unit_locality(u);
-      double unit_mem_bw  = std::max<int>(0, unit_loc.max_shmem_mbps());
+      double unit_mem_bw  = unit_loc.max_shmem_mbps();
       double unit_core_fq = unit_loc.num_threads() *
                             unit_loc.cpu_mhz();
-      double unit_bps     = unit_mem_bw / unit_core_fq;
+      double unit_bps     = (unit_mem_bw > 0 && unit_core_fq > 0)
+                            ? unit_mem_bw / unit_core_fq
+                            : 0;
       unit_bytes_per_cycle.push_back(unit_bps);
-      total_bytes_per_cycle += unit_bps;
     }
-
-    double avg_bytes_per_cycle =
-      static_cast<double>(total_bytes_per_cycle) / tloc.global_units().size();
-
-    for (auto unit_bps : unit_bytes_per_cycle) {
-      unit_mem_perc.push_back(unit_bps / avg_bytes_per_cycle);
-    }
-    return unit_mem_perc;
+    return internal::relative_unit_capacities(unit_bytes_per_cycle);
   }
 };
 
@@ -306,7 +288,7 @@ public:
     _local_sizes(
       initialize_local_sizes(
         sizespec.size(),
-        team_loc)),
+        team_loc.team().size())),
     _block_offsets(
       initialize_block_offsets(
         _local_sizes)),
@@ -350,6 +332,64 @@ public:
   : LoadBalancePattern(sizespec, TeamLocality_t(team))
   { }
 
+  /**
+   * Constructor, initializes a pattern from explicit load balance weights
+   * of the units in the team, e.g. relative throughput measured in
+   * previous iterations of an application.
+   *
+   * \see dash::util::LoadBalancer
+   */
+  LoadBalancePattern(
+    /// Size spec of the pattern.
+    const SizeSpec_t          & sizespec,
+    /// Load balance weight of every unit in the team, relative to the
+    /// mean weight.
+    const std::vector<double> & unit_weights,
+    /// Team containing units to which this pattern maps its elements.
+    dash::Team                & team = dash::Team::All())
+  : _size(sizespec.size()),
+    _unit_cpu_weights(team.size(), 1.0),
+    _unit_membw_weights(team.size(), 1.0),
+    _unit_load_weights(
+       initialize_load_weights(
+         unit_weights,
+         _unit_membw_weights)),
+    _local_sizes(
+      initialize_local_sizes(
+        sizespec.size(),
+        team.size())),
+    _block_offsets(
+      initialize_block_offsets(
+        _local_sizes)),
+    _memory_layout(
+      std::array<SizeType, 1> {{ _size }}),
+    _blockspec(
+      initialize_blockspec(
+        _local_sizes)),
+    _distspec(dash::BLOCKED),
+    _team(&team),
+    _myid(_team->myid()),
+    _teamspec(*_team),
+    _nunits(_team->size()),
+    _local_size(
+      initialize_local_extent(
+        _team->myid(),
+        _local_sizes)),
+    _local_memory_layout(
+      std::array<SizeType, 1> {{ _local_size }}),
+    _local_capacity(
+      initialize_local_capacity(
+        _local_sizes))
+  {
+    DASH_LOG_TRACE("LoadBalancePattern()", "(sizespec, weights, team)");
+    DASH_ASSERT_EQ(
+      _local_sizes.size(), _nunits,
+      "Number of given local sizes "   << _local_sizes.size() << " " <<
+      "does not match number of units" << _nunits);
+    initialize_local_range();
+    DASH_LOG_TRACE("LoadBalancePattern()", "LoadBalancePattern initialized");
+  }
+
   LoadBalancePattern(const self_t & other) = default;
   LoadBalancePattern(self_t && other)      = default;
   self_t & operator=(const self_t & other) = default;
@@ -526,7 +566,7 @@ public:
 
   /**
    * The actual number of elements in this pattern that are local to the
-   * given unit, by dimension.
+   * given unit, by dimension. Defaults to the active unit.
    *
    * \see  local_extent()
    * \see  blocksize()
@@ -536,8 +576,11 @@ public:
    * \see  DashPatternConcept
    */
   std::array<SizeType, NumDimensions> local_extents(
-      team_unit_t unit) const
+      team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const
   {
+    if (unit == UNDEFINED_TEAM_UNIT_ID) {
+      unit = _myid;
+    }
     DASH_LOG_DEBUG_VAR("LoadBalancePattern.local_extents()", unit);
     DASH_LOG_DEBUG_VAR("LoadBalancePattern.local_extents >",
                        _local_sizes[unit]);
@@ -1132,16 +1175,15 @@ private:
   }
 
   /**
-   * Initialize local sizes from pattern size, team and team locality
-   * hierarchy.
+   * Initialize local sizes from pattern size and load weights of the
+   * units in the team.
    */
   std::vector<size_type> initialize_local_sizes(
     size_type              total_size,
-    const TeamLocality_t & locality) const
+    size_type              nunits) const
   {
     DASH_LOG_TRACE_VAR("LoadBalancePattern.init_local_sizes()", total_size);
     std::vector<size_type> l_sizes;
-    auto nunits = locality.team().size();
     DASH_LOG_TRACE_VAR("LoadBalancePattern.init_local_sizes()", nunits);
     if (nunits == 1) {
       l_sizes.push_back(total_size);
@@ -1163,9 +1205,9 @@ private:
     size_t      unit_max_cpu_cap  = 0;
     for (team_unit_t u{0}; u < nunits; u++) {
       double weight         = _unit_load_weights[u];
-      size_t unit_capacity  = weight > 1
-                              ? std::ceil(weight * balanced_lsize)
-                              : std::floor(weight * balanced_lsize);
+      // Rounding down so the sum of assigned capacities cannot exceed the
+      // total size:
+      size_t unit_capacity  = std::floor(weight * balanced_lsize);
       if (unit_capacity > unit_max_cpu_cap) {
         max_cpu_cap_unit = u;
         unit_max_cpu_cap = unit_capacity;
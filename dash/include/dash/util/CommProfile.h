@@ -0,0 +1,78 @@
+#ifndef DASH__UTIL__COMM_PROFILE_H__
+#define DASH__UTIL__COMM_PROFILE_H__
+
+#include <dash/Team.h>
+
+#include <dash/dart/if/dart_profile.h>
+
+#include <iosfwd>
+#include <string>
+
+
+namespace dash {
+namespace util {
+
+/**
+ * Report of the communication operations issued by the units of a team,
+ * recorded by the DART communication profiler.
+ *
+ * The profiler is enabled when building DART with
+ * \c ENABLE_DART_PROFILING, otherwise reports contain no operations.
+ * If the environment variable \c DASH_COMM_PROFILE_FILE is set,
+ * \c dash::finalize writes the report of \c dash::Team::All to the
+ * specified file.
+ *
+ * Usage:
+ *
+ * \code
+ *   dash::util::CommProfile::reset();
+ *   // ... communication to be profiled ...
+ *   dash::util::CommProfile::write_json("profile.json");
+ * \endcode
+ *
+ * The report is a JSON object with the following members:
+ *
+ * - \c ops: statistics of every operation summed over all units,
+ *   see \ref dart_profile_op_stats_t
+ * - \c sources: one-sided operations issued by every unit
+ * - \c targets: one-sided operations targeting every global unit
+ * - \c segments: one-sided operations per global memory segment
+ */
+class CommProfile
+{
+public:
+  /**
+   * Whether DART records communication operations.
+   */
+  static bool enabled();
+
+  /**
+   * Reset the counters of the calling unit.
+   */
+  static void reset();
+
+  /**
+   * Merge the counters of all units in \c team and write the report to
+   * \c out at unit 0 of the team.
+   *
+   * Collective operation.
+   */
+  static void write_json(
+    std::ostream      & out,
+    dash::Team        & team = dash::Team::All());
+
+  /**
+   * Merge the counters of all units in \c team and write the report to
+   * the file \c filename at unit 0 of the team.
+   *
+   * Collective operation.
+   */
+  static void write_json(
+    const std::string & filename,
+    dash::Team        & team = dash::Team::All());
+};
+
+} // namespace util
+} // namespace dash
+
+#endif // DASH__UTIL__COMM_PROFILE_H__
@@ -159,6 +159,18 @@ public:
     set(key, std::string(cstr));
   }
 
+  /**
+   * Removes the key from the configuration, subsequent calls of
+   * \c is_set return false for the key.
+   */
+  static void
+  unset(
+    const std::string & key)
+  {
+    DASH_LOG_TRACE("util::Config::unset", key);
+    Config::config_values_.erase(key);
+  }
+
   ///////////////////////////////////////////////////////////////////////////
   // Config::begin(), Config::end()
   ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,365 @@
+#ifndef DASH__UTIL__LOAD_BALANCER_H__
+#define DASH__UTIL__LOAD_BALANCER_H__
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Dimensional.h>
+
+#include <dash/algorithm/Redistribute.h>
+#include <dash/pattern/LoadBalancePattern.h>
+
+#include <dash/util/Timer.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+namespace util {
+
+namespace internal {
+
+/**
+ * Pattern with the extent and team of \c pattern and local sizes
+ * proportional to the given unit weights.
+ * The pattern type must be constructible from local sizes like
+ * \c dash::CSRPattern and \c dash::DynamicPattern.
+ */
+template <class PatternT>
+PatternT make_weighted_pattern(
+  const PatternT            & pattern,
+  const std::vector<double> & unit_weights)
+{
+  typedef typename PatternT::size_type size_type;
+
+  auto      nunits   = unit_weights.size();
+  size_type size     = pattern.size();
+  double    sum      = std::accumulate(unit_weights.begin(),
+                                       unit_weights.end(), 0.0);
+  size_type assigned = 0;
+  size_t    max_unit = 0;
+  std::vector<size_type> l_sizes(nunits, 0);
+  for (size_t u = 0; u < nunits; ++u) {
+    l_sizes[u] = static_cast<size_type>(
+                   std::floor(size * unit_weights[u] / sum));
+    assigned  += l_sizes[u];
+    if (unit_weights[u] > unit_weights[max_unit]) {
+      max_unit = u;
+    }
+  }
+  // Elements unassigned due to rounding are assigned to the unit with
+  // highest weight, like in dash::LoadBalancePattern:
+  l_sizes[max_unit] += size - assigned;
+  return PatternT(l_sizes, pattern.team());
+}
+
+template <
+  typename   CompBasedMeasure,
+  typename   MemBasedMeasure,
+  MemArrange Arrangement,
+  typename   IndexType >
+LoadBalancePattern<
+  1, CompBasedMeasure, MemBasedMeasure, Arrangement, IndexType>
+make_weighted_pattern(
+  const LoadBalancePattern<
+          1, CompBasedMeasure, MemBasedMeasure, Arrangement, IndexType>
+                            & pattern,
+  const std::vector<double> & unit_weights)
+{
+  typedef LoadBalancePattern<
+            1, CompBasedMeasure, MemBasedMeasure, Arrangement, IndexType>
+    pattern_t;
+  return pattern_t(
+           dash::SizeSpec<1, typename pattern_t::size_type>(pattern.size()),
+           unit_weights,
+           pattern.team());
+}
+
+} // namespace internal
+
+/**
+ * Feedback-driven load balancing of one-dimensional containers from the
+ * measured throughput of every unit.
+ *
+ * Units measure the time spent on their local elements in iterations of
+ * an application. If the imbalance of the measured times exceeds a
+ * threshold, the container's elements are redistributed to a pattern
+ * with local sizes proportional to every unit's throughput, i.e. local
+ * elements processed per time.
+ * In contrast to the static weights of \c dash::LoadBalancePattern
+ * derived from hardware capacities, measured throughput accounts for
+ * contention and varying clock rates.
+ *
+ * Elements keep their global order, so only elements in the ranges
+ * between old and new block boundaries change their owner. Elements
+ * remaining at a unit are copied locally, see \c dash::redistribute.
+ *
+ * Containers must be one-dimensional, constructible from a pattern and
+ * move-assignable like \c dash::Array. Their pattern type must be
+ * \c dash::LoadBalancePattern or constructible from local sizes like
+ * \c dash::CSRPattern and \c dash::DynamicPattern.
+ *
+ * Usage:
+ *
+ * \code
+ *   typedef dash::CSRPattern<1>                   pattern_t;
+ *   typedef dash::Array<double, long, pattern_t>  array_t;
+ *
+ *   array_t array(pattern_t(local_sizes));
+ *   dash::util::LoadBalancer balancer(array.team());
+ *   for (int it = 0; it < niter; ++it) {
+ *     balancer.start();
+ *     compute(array.lbegin(), array.lend());
+ *     balancer.stop();
+ *     if (it % 10 == 9) {
+ *       // collective, resets measurements if elements were moved:
+ *       balancer.rebalance(array);
+ *     }
+ *   }
+ * \endcode
+ */
+class LoadBalancer
+{
+private:
+  typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer_t;
+
+  /// Measurements of a unit: elapsed time and number of local elements.
+  typedef std::pair<double, double> measure_t;
+
+public:
+  /**
+   * Constructor.
+   */
+  explicit LoadBalancer(
+    /// Team of the units measuring their local work
+    dash::Team & team      = dash::Team::All(),
+    /// Imbalance of measured times that triggers a redistribution,
+    /// see \c imbalance()
+    double       threshold = 0.1)
+  : _team(&team),
+    _threshold(threshold)
+  { }
+
+  /**
+   * Starts measuring the calling unit's work on its local elements.
+   */
+  void start()
+  {
+    _timestamp = Timer_t::Now();
+  }
+
+  /**
+   * Stops measuring the calling unit's work, adds the time since the
+   * last call of \c start() to the elapsed time.
+   */
+  void stop()
+  {
+    record(Timer_t::ElapsedSince(_timestamp));
+  }
+
+  /**
+   * Adds a time measured by the application, e.g. from existing timers
+   * of its compute kernels, in microseconds.
+   */
+  void record(double elapsed)
+  {
+    _elapsed += elapsed;
+    ++_iterations;
+  }
+
+  /**
+   * Discards the measurements of the calling unit.
+   */
+  void reset()
+  {
+    _elapsed    = 0;
+    _iterations = 0;
+  }
+
+  /**
+   * Time measured at the calling unit since the last reset, in
+   * microseconds.
+   */
+  double elapsed() const
+  {
+    return _elapsed;
+  }
+
+  /**
+   * Number of measured iterations since the last reset.
+   */
+  size_t iterations() const
+  {
+    return _iterations;
+  }
+
+  double threshold() const
+  {
+    return _threshold;
+  }
+
+  void set_threshold(double threshold)
+  {
+    _threshold = threshold;
+  }
+
+  dash::Team & team() const
+  {
+    return *_team;
+  }
+
+  /**
+   * Imbalance of the times measured at all units, the maximum time
+   * relative to the mean time minus 1, so 0 if all units measured
+   * identical times.
+   *
+   * Collective operation.
+   */
+  double imbalance()
+  {
+    return imbalance(gather_measures(0));
+  }
+
+  /**
+   * Load balance weights of the units in the team from their throughput,
+   * the number of local elements in the given pattern processed per
+   * time relative to the mean throughput of all units.
+   * Units without measurements or local elements are assigned neutral
+   * weight 1.
+   *
+   * Collective operation.
+   */
+  template <class PatternT>
+  std::vector<double> unit_weights(
+    const PatternT & pattern)
+  {
+    return unit_weights(gather_measures(pattern.local_size()));
+  }
+
+  /**
+   * Pattern with local sizes balanced from the measured throughput of
+   * every unit.
+   *
+   * Collective operation.
+   */
+  template <class PatternT>
+  PatternT balanced_pattern(
+    const PatternT & pattern)
+  {
+    return internal::make_weighted_pattern(pattern, unit_weights(pattern));
+  }
+
+  /**
+   * Redistributes the elements of the container to a pattern balanced
+   * from the measured throughput of every unit if the imbalance of
+   * measured times exceeds the threshold.
+   * Measurements are reset if the container has been redistributed.
+   *
+   * Collective operation, invalidates global and local pointers and
+   * iterators of the container if elements have been redistributed.
+   *
+   * \returns  true if the elements have been redistributed
+   */
+  template <class ContainerT>
+  bool rebalance(
+    ContainerT & container)
+  {
+    typedef typename ContainerT::pattern_type pattern_t;
+    static_assert(pattern_t::ndim() == 1,
+                  "LoadBalancer only supports one-dimensional containers");
+
+    const pattern_t & pattern = container.pattern();
+    if (pattern.team().dart_id() != _team->dart_id()) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "LoadBalancer.rebalance: container is not allocated in the "
+        "load balancer's team");
+    }
+    auto   measures      = gather_measures(pattern.local_size());
+    double imbalance_val = imbalance(measures);
+    DASH_LOG_DEBUG("LoadBalancer.rebalance()",
+                   "imbalance:", imbalance_val, "threshold:", _threshold);
+    if (imbalance_val <= _threshold) {
+      return false;
+    }
+    auto balanced = internal::make_weighted_pattern(
+                      pattern, unit_weights(measures));
+    if (balanced == pattern) {
+      DASH_LOG_DEBUG("LoadBalancer.rebalance >", "pattern unchanged");
+      return false;
+    }
+    DASH_LOG_DEBUG("LoadBalancer.rebalance", "local size:",
+                   pattern.local_size(), "->", balanced.local_size());
+    ContainerT redistributed(balanced);
+    dash::redistribute(container, redistributed);
+    container = std::move(redistributed);
+    reset();
+    DASH_LOG_DEBUG("LoadBalancer.rebalance >", "redistributed");
+    return true;
+  }
+
+private:
+  /**
+   * Elapsed time and given number of local elements of every unit.
+   */
+  std::vector<measure_t> gather_measures(size_t local_size) const
+  {
+    measure_t              local(_elapsed, static_cast<double>(local_size));
+    std::vector<measure_t> measures(_team->size());
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&local, measures.data(), 2, DART_TYPE_DOUBLE,
+                     _team->dart_id()),
+      DART_OK);
+    return measures;
+  }
+
+  static double imbalance(const std::vector<measure_t> & measures)
+  {
+    double max_time = 0;
+    double sum_time = 0;
+    for (const auto & m : measures) {
+      max_time  = std::max(max_time, m.first);
+      sum_time += m.first;
+    }
+    if (sum_time <= 0) {
+      return 0;
+    }
+    return max_time / (sum_time / measures.size()) - 1;
+  }
+
+  static std::vector<double> unit_weights(
+    const std::vector<measure_t> & measures)
+  {
+    std::vector<double> throughput;
+    throughput.reserve(measures.size());
+    for (const auto & m : measures) {
+      throughput.push_back(m.first > 0 ? m.second / m.first : 0);
+    }
+    return dash::internal::relative_unit_capacities(throughput);
+  }
+
+private:
+  /// Team of the units measuring their local work
+  dash::Team                * _team;
+  /// Imbalance of measured times that triggers a redistribution
+  double                      _threshold;
+  /// Start of the current measurement
+  Timer_t::timestamp_t        _timestamp  = 0;
+  /// Time measured since the last reset
+  double                      _elapsed    = 0;
+  /// Number of measurements since the last reset
+  size_t                      _iterations = 0;
+};
+
+} // namespace util
+} // namespace dash
+
+#endif // DASH__UTIL__LOAD_BALANCER_H__
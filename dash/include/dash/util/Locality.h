@@ -54,11 +54,63 @@ public:
 
 public:
 
-  static inline int NumNodes()
+  /**
+   * Hardware parameters of the calling unit used in performance-critical
+   * code paths, like the cache sizes selecting local copy kernels.
+   */
+  typedef struct {
+    /// Cache sizes in bytes by cache level (L1, L2, L3), 0 if unknown
+    std::array<size_t, DART_LOCALITY_MAX_CACHE_LEVELS> cache_sizes;
+    /// Cache line sizes in bytes by cache level (L1, L2, L3)
+    std::array<int,    DART_LOCALITY_MAX_CACHE_LEVELS> cache_line_sizes;
+    /// Number of threads available to the unit, see
+    /// \c dash::util::UnitLocality::num_domain_threads
+    int                                                num_threads;
+    /// NUMA node of the unit, -1 if unknown
+    int                                                numa_id;
+  } HardwareParams;
+
+public:
+
+  /**
+   * Resolves the locality domain hierarchy of all units on the first
+   * query.
+   */
+  static int NumNodes();
+
+  /**
+   * Hardware parameters of the calling unit.
+   *
+   * Resolved from the unit's locality data on the first query and cached
+   * for the lifetime of the process, subsequent queries are free of
+   * locality lookups and configuration parsing.
+   */
+  static const HardwareParams & UnitHardwareParams();
+
+  /**
+   * Cache line size in bytes of the given cache level (0: L1) of the
+   * calling unit, defaults to 64 bytes if unknown.
+   */
+  static inline int CacheLineSize(int cache_level)
+  {
+    return UnitHardwareParams().cache_line_sizes[cache_level];
+  }
+
+  /**
+   * Size in bytes of the given cache level (0: L1) of the calling unit,
+   * 0 if unknown.
+   */
+  static inline size_t CacheSize(int cache_level)
+  {
+    return UnitHardwareParams().cache_sizes[cache_level];
+  }
+
+  /**
+   * Number of threads available to the calling unit.
+   */
+  static inline int NumUnitDomainThreads()
   {
-    return (_team_loc == nullptr)
-//         ? -1 : std::max<int>(_team_loc->num_nodes, 1);
-           ? -1 : std::max<int>(_team_loc->num_domains, 1);
+    return UnitHardwareParams().num_threads;
   }
 
 
@@ -3,6 +3,9 @@
 
 #include <dash/Init.h>
 #include <dash/util/Timer.h>
+#include <dash/util/internal/TraceBuffer.h>
+
+#include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -13,22 +16,39 @@
 namespace dash {
 namespace util {
 
+/**
+ * Storage of trace events recorded by \c dash::util::Trace.
+ *
+ * Every thread records events in its own ring buffer of fixed capacity
+ * (environment variable \c DASH_TRACE_BUFFER_SIZE, number of events per
+ * thread, default 65536). Once a buffer is full, the oldest events are
+ * overwritten.
+ *
+ * Timestamps are taken from the timestamp counter and converted to
+ * microseconds when traces are written.
+ */
 class TraceStore
 {
 public:
   typedef std::string
     state_t;
-  typedef dash::util::Timer<dash::util::TimeMeasure::Clock>
+  typedef dash::util::Timer<dash::util::TimeMeasure::Counter>
     timer_t;
   typedef typename timer_t::timestamp_t
     timestamp_t;
+  /// Id of an interned context or state name
+  typedef uint32_t
+    name_id_t;
   typedef struct {
     timestamp_t start;
     timestamp_t end;
-    state_t     state;
+    name_id_t   context;
+    name_id_t   state;
   } state_timespan_t;
-  typedef std::vector<state_timespan_t>
-    trace_events_t;
+  typedef dash::util::internal::TraceBuffer<state_timespan_t>
+    trace_buffer_t;
+  typedef typename trace_buffer_t::seq_t
+    event_seq_t;
 
 public:
   /**
@@ -65,9 +85,31 @@ public:
   static void add_context(const std::string & context);
 
   /**
-   * Return reference to traces list for given context.
+   * Id of the given context or state name, registers the name if
+   * it is not known yet.
+   */
+  static name_id_t name_id(const std::string & name);
+
+  /**
+   * Record the start of a state in the trace buffer of the calling
+   * thread.
+   *
+   * \returns  The sequence number of the event in the calling thread's
+   *           trace buffer, to be passed to \c exit_state.
+   */
+  static event_seq_t enter_state(name_id_t context, name_id_t state);
+
+  /**
+   * Record the end of the state started by the calling thread with the
+   * given sequence number.
+   */
+  static void exit_state(event_seq_t seq);
+
+  /**
+   * Number of trace events overwritten in the trace buffers of the
+   * calling unit.
    */
-  static trace_events_t & context_trace(const std::string & context);
+  static uint64_t dropped();
 
   /**
    * Write trace data to given output stream.
@@ -81,43 +123,110 @@ public:
     const std::string & filename,
     const std::string & path = "");
 
+  /**
+   * Write trace events of all units as JSON in Chrome trace event format
+   * to given output stream at unit 0.
+   *
+   * Timestamps of all units are corrected by the offset of their clock
+   * to the clock of unit 0, estimated from message round trips.
+   * Processes in the trace are units, threads are the threads of a unit
+   * in the order they recorded their first event.
+   *
+   * Collective operation on \c dash::Team::All().
+   */
+  static void write_chrome(std::ostream & out);
+
+  /**
+   * Write trace events of all units as JSON in Chrome trace event format
+   * to the given file at unit 0.
+   *
+   * Collective operation on \c dash::Team::All().
+   */
+  static void write_chrome(const std::string & filename);
+
 private:
-  static std::map<std::string, trace_events_t> _traces;
-  static bool                                  _trace_enabled;
+  static bool _trace_enabled;
 };
 
+/**
+ * Context or state name interned in the trace store on construction.
+ *
+ * Interning a name locks the trace store, frequently executed call sites
+ * therefore intern their names once in function-local static instances:
+ *
+ * \code
+ *   static const dash::util::TraceName trace_copy("copy");
+ *   static const dash::util::TraceName trace_g2l("global_to_local");
+ *   dash::util::Trace      trace(trace_copy);
+ *   dash::util::TraceState trace_state(trace, trace_g2l);
+ * \endcode
+ */
+class TraceName
+{
+private:
+  typedef typename TraceStore::name_id_t
+    name_id_t;
+
+private:
+  name_id_t _id;
+
+public:
+  explicit TraceName(const char * name)
+  : _id(TraceStore::name_id(name))
+  { }
+
+  inline name_id_t id() const
+  {
+    return _id;
+  }
+};
+
+/**
+ * Records states of a context, e.g. the phases of an algorithm, in the
+ * trace store.
+ *
+ * \code
+ *   dash::util::Trace trace("min_element");
+ *   trace.enter_state("local");
+ *   // ...
+ *   trace.exit_state("local");
+ * \endcode
+ *
+ * States of a trace may be nested, \c exit_state ends the most recently
+ * entered state.
+ */
 class Trace
 {
 private:
-  typedef typename TraceStore::timestamp_t
-    timestamp_t;
   typedef typename TraceStore::state_t
     state_t;
-  typedef typename TraceStore::timer_t
-    timer_t;
-  typedef typename TraceStore::state_timespan_t
-    state_timespan_t;
-  typedef typename TraceStore::trace_events_t
-    trace_events_t;
+  typedef typename TraceStore::name_id_t
+    name_id_t;
+  typedef typename TraceStore::event_seq_t
+    event_seq_t;
 
 private:
-  std::string _context;
-  timestamp_t _ts_start;
+  name_id_t                _context = 0;
+  std::vector<event_seq_t> _open_states;
 
 public:
   Trace() : Trace("global")
   { }
 
   Trace(const std::string & context)
-  : _context(context)
   {
     if (!TraceStore::enabled()) {
       return;
     }
-    TraceStore::add_context(_context);
-    timer_t::Calibrate(0);
-    dash::barrier();
-    _ts_start = timer_t::Now();
+    _context = TraceStore::name_id(context);
+  }
+
+  Trace(const TraceName & context)
+  {
+    if (!TraceStore::enabled()) {
+      return;
+    }
+    _context = context.id();
   }
 
   inline void enter_state(const state_t & state)
@@ -125,23 +234,76 @@ public:
     if (!TraceStore::enabled()) {
       return;
     }
-    state_timespan_t state_timespan;
-    timestamp_t ts_event = timer_t::Now() - _ts_start;
-    state_timespan.start = ts_event;
-    state_timespan.end   = ts_event;
-    state_timespan.state = state;
-    TraceStore::context_trace(_context).push_back(state_timespan);
+    _open_states.push_back(
+      TraceStore::enter_state(_context, TraceStore::name_id(state)));
   }
 
-  inline void exit_state(const state_t &)
+  inline void enter_state(const TraceName & state)
   {
     if (!TraceStore::enabled()) {
       return;
     }
-    timestamp_t ts_event = timer_t::Now() - _ts_start;
-    TraceStore::context_trace(_context).back().end = ts_event;
+    _open_states.push_back(TraceStore::enter_state(_context, state.id()));
+  }
+
+  inline void exit_state(const state_t &)
+  {
+    exit_state();
   }
 
+  inline void exit_state(const TraceName &)
+  {
+    exit_state();
+  }
+
+  /**
+   * End the most recently entered state.
+   */
+  inline void exit_state()
+  {
+    if (_open_states.empty()) {
+      return;
+    }
+    TraceStore::exit_state(_open_states.back());
+    _open_states.pop_back();
+  }
+
+};
+
+/**
+ * Records a state of a \c dash::util::Trace for the lifetime of the
+ * instance.
+ *
+ * \code
+ *   dash::util::Trace      trace("copy");
+ *   dash::util::TraceState trace_state(trace, "global_to_local");
+ * \endcode
+ */
+class TraceState
+{
+private:
+  Trace & _trace;
+
+public:
+  TraceState(Trace & trace, const std::string & state)
+  : _trace(trace)
+  {
+    _trace.enter_state(state);
+  }
+
+  TraceState(Trace & trace, const TraceName & state)
+  : _trace(trace)
+  {
+    _trace.enter_state(state);
+  }
+
+  TraceState(const TraceState &) = delete;
+  TraceState & operator=(const TraceState &) = delete;
+
+  ~TraceState()
+  {
+    _trace.exit_state();
+  }
 };
 
 } // namspace util
@@ -0,0 +1,132 @@
+#ifndef DASH__UTIL__INTERNAL__TRACE_BUFFER_H__
+#define DASH__UTIL__INTERNAL__TRACE_BUFFER_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+
+namespace dash {
+namespace util {
+namespace internal {
+
+/**
+ * Ring buffer of trace events with fixed capacity.
+ *
+ * Once the buffer is full, recording an event overwrites the oldest
+ * event. Events are addressed by their sequence number, the number of
+ * events recorded before them.
+ *
+ * Not thread-safe, every buffer is written by a single thread.
+ */
+template <class EventT>
+class TraceBuffer
+{
+public:
+  typedef EventT   event_type;
+  typedef uint64_t seq_t;
+
+public:
+  explicit TraceBuffer(std::size_t capacity)
+  : _events(std::max<std::size_t>(capacity, 1))
+  { }
+
+  /**
+   * Maximum number of events retained.
+   */
+  inline std::size_t capacity() const
+  {
+    return _events.size();
+  }
+
+  /**
+   * Number of events retained.
+   */
+  inline std::size_t size() const
+  {
+    return static_cast<std::size_t>(
+             std::min<seq_t>(_count, _events.size()));
+  }
+
+  /**
+   * Number of events overwritten since the buffer has been cleared.
+   */
+  inline seq_t dropped() const
+  {
+    return _dropped + (_count - size());
+  }
+
+  /**
+   * Record an event, overwriting the oldest event if the buffer is full.
+   *
+   * \returns  The sequence number of the recorded event.
+   */
+  inline seq_t push(const event_type & event)
+  {
+    _events[_count % _events.size()] = event;
+    return _count++;
+  }
+
+  /**
+   * The event with sequence number \c seq, or \c nullptr if it has
+   * already been overwritten.
+   */
+  inline event_type * at_seq(seq_t seq)
+  {
+    if (seq >= _count || _count - seq > _events.size()) {
+      return nullptr;
+    }
+    return &_events[seq % _events.size()];
+  }
+
+  /**
+   * Invoke \c func on all retained events from oldest to newest.
+   */
+  template <class UnaryFunction>
+  void for_each(UnaryFunction func) const
+  {
+    for (seq_t seq = _count - size(); seq < _count; ++seq) {
+      func(_events[seq % _events.size()]);
+    }
+  }
+
+  /**
+   * Remove all retained events satisfying \c pred, preserving the order
+   * of remaining events. Removed events are not counted as dropped.
+   */
+  template <class UnaryPredicate>
+  void remove_if(UnaryPredicate pred)
+  {
+    std::vector<event_type> retained;
+    retained.reserve(size());
+    for_each([&](const event_type & event) {
+               if (!pred(event)) { retained.push_back(event); }
+             });
+    std::copy(retained.begin(), retained.end(), _events.begin());
+    _dropped += _count - size();
+    _count    = retained.size();
+  }
+
+  /**
+   * Remove all events.
+   */
+  inline void clear()
+  {
+    _count   = 0;
+    _dropped = 0;
+  }
+
+private:
+  std::vector<event_type> _events;
+  /// Number of events recorded since the buffer has been cleared
+  seq_t                   _count   = 0;
+  /// Number of events overwritten before the sequence numbers have been
+  /// reset by \c remove_if
+  seq_t                   _dropped = 0;
+};
+
+} // namespace internal
+} // namespace util
+} // namespace dash
+
+#endif // DASH__UTIL__INTERNAL__TRACE_BUFFER_H__
@@ -0,0 +1,189 @@
+#ifndef DASH__VIEW__NODE_LOCAL_H__INCLUDED
+#define DASH__VIEW__NODE_LOCAL_H__INCLUDED
+
+#include <dash/Types.h>
+
+#include <dash/view/ViewTraits.h>
+
+#include <vector>
+#include <type_traits>
+
+
+namespace dash {
+
+/**
+ * Contiguous range of elements in the local memory of a single unit,
+ * accessible from the calling unit by native pointers.
+ */
+template <typename ElementType>
+struct NodeLocalSegment
+{
+  typedef ElementType                                        value_type;
+  typedef ElementType *                                        iterator;
+  typedef std::size_t                                         size_type;
+
+  /// Unit owning the segment's memory
+  dash::team_unit_t   unit;
+  /// Native pointer to the first element of the segment
+  ElementType       * lbegin;
+  /// Native pointer past the last element of the segment
+  ElementType       * lend;
+
+  constexpr iterator begin() const noexcept { return lbegin; }
+  constexpr iterator end()   const noexcept { return lend;   }
+
+  constexpr size_type size() const noexcept {
+    return static_cast<size_type>(lend - lbegin);
+  }
+};
+
+/**
+ * Range of the local memory segments of all units on the calling unit's
+ * node, i.e. all units whose memory is mapped into the calling unit's
+ * address space.
+ *
+ * Segments are ordered by unit id and include the calling unit's own
+ * segment. Segments of units that hold no elements are omitted.
+ * Elements of other units are accessed with plain loads and stores, the
+ * caller is responsible for synchronization, e.g. by a barrier on the
+ * container's team.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<double> array(size);
+ *   // ...
+ *   array.barrier();
+ *   // Node-level reduction, all units of a node compute the same value:
+ *   double node_sum = 0;
+ *   for (auto & segment : dash::node_local(array)) {
+ *     node_sum = std::accumulate(segment.begin(), segment.end(),
+ *                                node_sum);
+ *   }
+ * \endcode
+ *
+ * \see dash::node_local
+ */
+template <typename ElementType>
+class NodeLocalRange
+{
+public:
+  typedef NodeLocalSegment<ElementType>                    segment_type;
+  typedef NodeLocalSegment<ElementType>                      value_type;
+  typedef std::vector<segment_type>                        segments_type;
+  typedef typename segments_type::const_iterator               iterator;
+  typedef typename segments_type::const_iterator         const_iterator;
+  typedef std::size_t                                         size_type;
+
+public:
+  NodeLocalRange() = default;
+
+  explicit NodeLocalRange(segments_type && segments)
+  : _segments(std::move(segments))
+  { }
+
+  /**
+   * Iterator to the first segment.
+   */
+  const_iterator begin() const noexcept {
+    return _segments.begin();
+  }
+
+  /**
+   * Iterator past the last segment.
+   */
+  const_iterator end() const noexcept {
+    return _segments.end();
+  }
+
+  /**
+   * Number of segments in the range.
+   */
+  size_type size() const noexcept {
+    return _segments.size();
+  }
+
+  /**
+   * Segment at the given position in the range.
+   */
+  const segment_type & operator[](size_type pos) const {
+    return _segments[pos];
+  }
+
+  /**
+   * Total number of elements in all segments.
+   */
+  size_type num_elements() const noexcept {
+    size_type nelem = 0;
+    for (const auto & segment : _segments) {
+      nelem += segment.size();
+    }
+    return nelem;
+  }
+
+  /**
+   * Units owning the segments in the range.
+   */
+  std::vector<dash::team_unit_t> units() const {
+    std::vector<dash::team_unit_t> units;
+    units.reserve(_segments.size());
+    for (const auto & segment : _segments) {
+      units.push_back(segment.unit);
+    }
+    return units;
+  }
+
+private:
+  segments_type _segments;
+};
+
+/**
+ * Native pointer ranges of the local memory of every unit on the calling
+ * unit's node that holds elements of the given container.
+ *
+ * Units are on the same node if DART maps their memory into a shared
+ * memory window. If shared memory windows are disabled, the range
+ * only contains the calling unit's local segment.
+ *
+ * \see dash::NodeLocalRange
+ * \see dash::local
+ *
+ * \concept{DashViewConcept}
+ */
+template <
+  class    ContainerType,
+  typename ContainerDecayType = typename std::decay<ContainerType>::type,
+  typename ElementType        = typename std::conditional<
+                                  std::is_const<ContainerType>::value,
+                                  const typename ContainerDecayType::value_type,
+                                  typename ContainerDecayType::value_type
+                                >::type >
+typename std::enable_if<
+  ( !dash::view_traits<ContainerDecayType>::is_view::value &&
+     dash::view_traits<ContainerDecayType>::is_origin::value ),
+  NodeLocalRange<ElementType>
+>::type
+node_local(ContainerType & c) {
+  typedef NodeLocalSegment<ElementType> segment_t;
+
+  std::vector<segment_t> segments;
+  const auto & pattern  = c.pattern();
+  const auto & globmem  = c.begin().globmem();
+  auto         nunits   = pattern.team().size();
+  for (dash::team_unit_t unit{0}; unit < nunits; unit++) {
+    auto nlocal = pattern.local_size(unit);
+    if (nlocal == 0) {
+      continue;
+    }
+    ElementType * lbegin = globmem.at(unit, 0).node_local();
+    if (lbegin == nullptr) {
+      continue;
+    }
+    segments.push_back(segment_t { unit, lbegin, lbegin + nlocal });
+  }
+  return NodeLocalRange<ElementType>(std::move(segments));
+}
+
+} // namespace dash
+
+#endif // DASH__VIEW__NODE_LOCAL_H__INCLUDED
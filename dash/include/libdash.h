@@ -57,8 +57,10 @@ namespace dash {
 #include <dash/util/BenchmarkParams.h>
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
+#include <dash/util/CommProfile.h>
 #include <dash/util/PatternMetrics.h>
 #include <dash/util/Timer.h>
+#include <dash/util/LoadBalancer.h>
 
 #include <dash/util/Locality.h>
 #include <dash/util/LocalityDomain.h>
@@ -68,6 +70,7 @@ namespace dash {
 
 #include <dash/IO.h>
 #include <dash/io/HDF5.h>
+#include <dash/io/Binary.h>
 
 #include <dash/internal/Math.h>
 #include <dash/internal/Logging.h>
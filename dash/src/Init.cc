@@ -5,6 +5,8 @@
 #include <dash/Shared.h>
 
 #include <dash/util/Locality.h>
+#include <dash/util/CommProfile.h>
+#include <dash/util/Trace.h>
 #include <dash/util/Config.h>
 #include <dash/internal/Logging.h>
 
@@ -65,6 +67,9 @@ void dash::init(int * argc, char ** *argv)
 
   DASH_LOG_DEBUG("dash::init", "dash::util::Locality::init()");
   dash::util::Locality::init();
+
+  DASH_LOG_DEBUG("dash::init", "dash::util::TraceStore::on()");
+  dash::util::TraceStore::on();
   DASH_LOG_DEBUG("dash::init >");
 }
 
@@ -81,6 +86,21 @@ void dash::finalize()
   // Wait for all units:
   dash::barrier();
 
+  // Write communication profile before teams are destroyed:
+  if (dash::util::Config::is_set("DASH_COMM_PROFILE_FILE")) {
+    DASH_LOG_DEBUG("dash::finalize", "write communication profile");
+    dash::util::CommProfile::write_json(
+      dash::util::Config::get<std::string>("DASH_COMM_PROFILE_FILE"));
+  }
+
+  // Write trace timeline of all units:
+  if (dash::util::TraceStore::enabled() &&
+      dash::util::Config::is_set("DASH_TRACE_FILE")) {
+    DASH_LOG_DEBUG("dash::finalize", "write trace");
+    dash::util::TraceStore::write_chrome(
+      dash::util::Config::get<std::string>("DASH_TRACE_FILE"));
+  }
+
   // Deallocate global memory allocated in teams:
   DASH_LOG_DEBUG("dash::finalize", "free team global memory");
   dash::Team::finalize();
@@ -2,6 +2,10 @@
 #include <dash/Types.h>
 #include <dash/Pattern.h>
 #include <dash/algorithm/SUMMA.h>
+#include <dash/util/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <string>
 
 // Prefer MKL if available:
 #ifdef DASH_ENABLE_MKL
@@ -19,15 +23,68 @@ extern "C"
 #endif
 
 namespace dash {
+
+bool gemm_backend_available(
+  dash::gemm_backend backend)
+{
+  switch (backend) {
+    case dash::gemm_backend::builtin:
+      return true;
+    case dash::gemm_backend::blas:
+#if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
+      return true;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+dash::gemm_backend summa_gemm_backend()
+{
+  auto backend = dash::gemm_backend::blas;
+  if (dash::util::Config::is_set("DASH_GEMM_BACKEND")) {
+    auto backend_name = dash::util::Config::get<std::string>(
+                          "DASH_GEMM_BACKEND");
+    if (backend_name == "builtin") {
+      backend = dash::gemm_backend::builtin;
+    } else if (backend_name != "blas" &&
+               backend_name != gemm_backend_name(dash::gemm_backend::blas)) {
+      DASH_LOG_ERROR("dash::summa_gemm_backend",
+                     "unknown value of DASH_GEMM_BACKEND:", backend_name);
+    }
+  }
+  if (!gemm_backend_available(backend)) {
+    backend = dash::gemm_backend::builtin;
+  }
+  return backend;
+}
+
+const char * gemm_backend_name(
+  dash::gemm_backend backend)
+{
+  switch (backend) {
+    case dash::gemm_backend::builtin:
+      return "builtin";
+    case dash::gemm_backend::blas:
+#if defined(DASH_ENABLE_MKL)
+      return "mkl";
+#else
+      return "blas";
+#endif
+  }
+  return "unknown";
+}
+
 namespace internal {
 
 #if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 
 /**
- * Matrix multiplication for local multiplication of matrix blocks via MKL.
+ * Matrix multiplication for local multiplication of matrix blocks via
+ * CBLAS.
  */
-template<>
-void mmult_local<float>(
+void mmult_local_blas(
   /// Matrix to multiply, m rows by k columns.
   const float * A,
   /// Matrix to multiply, k rows by n columns.
@@ -49,14 +106,17 @@ void mmult_local<float>(
   auto   tp_a  = CblasNoTrans;
   auto   tp_b  = CblasNoTrans;
   /// Leading dimension of A, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   lda   = k;
+  /// rows (for row major storage) or columns (for column major storage)
+  /// in memory.
+  auto   lda   = (storage == dash::ROW_MAJOR) ? k : m;
   /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldb   = n;
-  /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldc   = n;
+  /// rows (for row major storage) or columns (for column major storage)
+  /// in memory.
+  auto   ldb   = (storage == dash::ROW_MAJOR) ? n : k;
+  /// Leading dimension of C, or the number of elements between successive
+  /// rows (for row major storage) or columns (for column major storage)
+  /// in memory.
+  auto   ldc   = (storage == dash::ROW_MAJOR) ? n : m;
   /// Real value used to scale the product of matrices A and B.
   value_t alpha = 1.0;
   /// Real value used to scale matrix C.
@@ -89,10 +149,10 @@ void mmult_local<float>(
               C, ldc);
 }
 /**
- * Matrix multiplication for local multiplication of matrix blocks via MKL.
+ * Matrix multiplication for local multiplication of matrix blocks via
+ * CBLAS.
  */
-template<>
-void mmult_local<double>(
+void mmult_local_blas(
   /// Matrix to multiply, m rows by k columns.
   const double * A,
   /// Matrix to multiply, k rows by n columns.
@@ -114,14 +174,17 @@ void mmult_local<double>(
   auto   tp_a  = CblasNoTrans;
   auto   tp_b  = CblasNoTrans;
   /// Leading dimension of A, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   lda   = k;
-  /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldb   = n;
+  /// rows (for row major storage) or columns (for column major storage)
+  /// in memory.
+  auto   lda   = (storage == dash::ROW_MAJOR) ? k : m;
   /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldc   = n;
+  /// rows (for row major storage) or columns (for column major storage)
+  /// in memory.
+  auto   ldb   = (storage == dash::ROW_MAJOR) ? n : k;
+  /// Leading dimension of C, or the number of elements between successive
+  /// rows (for row major storage) or columns (for column major storage)
+  /// in memory.
+  auto   ldc   = (storage == dash::ROW_MAJOR) ? n : m;
   /// Real value used to scale the product of matrices A and B.
   value_t alpha = 1.0;
   /// Real value used to scale matrix C.
@@ -0,0 +1,135 @@
+
+#include <dash/coarray/Sync.h>
+#include <dash/coarray/CoEventCounter.h>
+
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+
+
+namespace dash {
+namespace coarray {
+namespace internal {
+
+namespace {
+
+/// Tag of the messages of the two-sided \c sync_images
+constexpr int _sync_tag       = 10016;
+
+/// Global pointer to the event counters of unit 0
+dart_gptr_t   _sync_gptr      = DART_GPTR_NULL;
+/// Native pointer to the event counters of the calling unit
+int         * _sync_lcounters = nullptr;
+
+/**
+ * Offset of the event counter pair used for pairwise synchronization
+ * with the unit of id \c unit.
+ */
+inline int sync_slot_offset(int unit) {
+  return unit * event_counter_size;
+}
+
+inline dart_gptr_t sync_gptr(int unit, int slot) {
+  dart_gptr_t gptr = _sync_gptr;
+  dart_gptr_setunit(&gptr, dart_team_unit_t { unit });
+  dart_gptr_incaddr(&gptr, sync_slot_offset(slot) * sizeof(int));
+  return gptr;
+}
+
+inline void sync_wait(int slot) {
+  wait_events(_sync_lcounters + sync_slot_offset(slot),
+              sync_gptr(dash::myid().id, slot),
+              1);
+}
+
+void sync_free() {
+  DASH_LOG_DEBUG("coarray::internal::sync_free()");
+  if (!DART_GPTR_ISNULL(_sync_gptr)) {
+    dart_team_memfree(_sync_gptr);
+  }
+  _sync_gptr      = DART_GPTR_NULL;
+  _sync_lcounters = nullptr;
+}
+
+/**
+ * Two-sided synchronization over the image with the smallest id, used
+ * until the event counters are allocated.
+ */
+void sync_images_twosided(
+  const dash::global_unit_t * image_ids,
+  std::size_t                 nimages)
+{
+  dash::global_unit_t myid = dash::myid();
+  dash::global_unit_t root = *std::min_element(image_ids,
+                                               image_ids + nimages);
+  // DART does not specify if nullptr is allowed as buffer
+  char buffer = 0;
+  if (myid == root) {
+    for (std::size_t i = 0; i < nimages; ++i) {
+      if (image_ids[i] != root) {
+        dart_recv(&buffer, 1, DART_TYPE_BYTE, _sync_tag, image_ids[i]);
+      }
+    }
+    for (std::size_t i = 0; i < nimages; ++i) {
+      if (image_ids[i] != root) {
+        dart_send(&buffer, 1, DART_TYPE_BYTE, _sync_tag, image_ids[i]);
+      }
+    }
+  } else {
+    dart_send(&buffer, 1, DART_TYPE_BYTE, _sync_tag, root);
+    dart_recv(&buffer, 1, DART_TYPE_BYTE, _sync_tag, root);
+  }
+}
+
+} // namespace
+
+void sync_init()
+{
+  if (_sync_lcounters != nullptr) {
+    return;
+  }
+  DASH_LOG_DEBUG("coarray::internal::sync_init()");
+  int    nunits = static_cast<int>(dash::size());
+  size_t nelem  = sync_slot_offset(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_team_memalloc_aligned(DART_TEAM_ALL, nelem, DART_TYPE_INT,
+                               &_sync_gptr),
+    DART_OK);
+  dart_gptr_t lgptr = sync_gptr(dash::myid().id, 0);
+  DASH_ASSERT_RETURNS(
+    dart_gptr_getaddr(lgptr, reinterpret_cast<void **>(&_sync_lcounters)),
+    DART_OK);
+  std::fill(_sync_lcounters, _sync_lcounters + nelem, 0);
+  dash::Team::All().register_deallocator(&_sync_gptr, sync_free);
+  dash::barrier();
+  DASH_LOG_DEBUG("coarray::internal::sync_init >");
+}
+
+void sync_images(
+  const dash::global_unit_t * image_ids,
+  std::size_t                 nimages)
+{
+  if (_sync_lcounters == nullptr) {
+    sync_images_twosided(image_ids, nimages);
+    return;
+  }
+  int myid = dash::myid().id;
+  for (std::size_t i = 0; i < nimages; ++i) {
+    if (image_ids[i].id != myid) {
+      post_event(sync_gptr(image_ids[i].id, myid));
+    }
+  }
+  for (std::size_t i = 0; i < nimages; ++i) {
+    if (image_ids[i].id != myid) {
+      sync_wait(image_ids[i].id);
+    }
+  }
+}
+
+} // namespace internal
+} // namespace coarray
+} // namespace dash
@@ -0,0 +1,277 @@
+#include <dash/io/binary/StorageDriver.h>
+
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+
+namespace dash {
+namespace io {
+namespace binary {
+namespace internal {
+
+namespace {
+
+/// "DASHBIN1" in little-endian byte order
+constexpr uint64_t binary_file_magic   = 0x314e494248534144ULL;
+/// Number of header words preceding the extents
+constexpr uint64_t binary_header_words = 8;
+/// Alignment of the data section in the file
+constexpr uint64_t binary_data_align   = 4096;
+
+} // namespace
+
+void init_offsets(
+  binary_file_header       & header)
+{
+  uint64_t nwords = binary_header_words +
+                    3 * header.ndim + header.nunits();
+  header.data_offset = dash::math::div_ceil(
+                         nwords * sizeof(uint64_t), binary_data_align) *
+                       binary_data_align;
+  header.local_offsets.resize(header.nunits());
+  uint64_t offset = 0;
+  for (std::size_t u = 0; u < header.nunits(); ++u) {
+    header.local_offsets[u] = offset;
+    offset += header.local_sizes[u];
+  }
+}
+
+int open_file(
+  const std::string        & filename,
+  bool                       write)
+{
+  int fd = write ? ::open(filename.c_str(), O_WRONLY | O_CREAT, 0644)
+                 : ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    DASH_THROW(dash::exception::RuntimeError,
+               "Could not open file " << filename << ": " <<
+               std::strerror(errno));
+  }
+  return fd;
+}
+
+void close_file(
+  int                        fd)
+{
+  ::close(fd);
+}
+
+void pwrite_all(
+  int                        fd,
+  const void               * buf,
+  std::size_t                nbytes,
+  uint64_t                   offset)
+{
+  auto bytes = static_cast<const char *>(buf);
+  while (nbytes > 0) {
+    ssize_t ret = ::pwrite(fd, bytes, nbytes, offset);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      DASH_THROW(dash::exception::RuntimeError,
+                 "Writing " << nbytes << " bytes at offset " << offset <<
+                 " failed: " << std::strerror(errno));
+    }
+    bytes  += ret;
+    nbytes -= ret;
+    offset += ret;
+  }
+}
+
+void pread_all(
+  int                        fd,
+  void                     * buf,
+  std::size_t                nbytes,
+  uint64_t                   offset)
+{
+  auto bytes = static_cast<char *>(buf);
+  while (nbytes > 0) {
+    ssize_t ret = ::pread(fd, bytes, nbytes, offset);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      DASH_THROW(dash::exception::RuntimeError,
+                 "Reading " << nbytes << " bytes at offset " << offset <<
+                 " failed: " << std::strerror(errno));
+    }
+    if (ret == 0) {
+      DASH_THROW(dash::exception::RuntimeError,
+                 "Unexpected end of file reading " << nbytes <<
+                 " bytes at offset " << offset);
+    }
+    bytes  += ret;
+    nbytes -= ret;
+    offset += ret;
+  }
+}
+
+uint64_t type_hash(
+  const std::string        & type_name)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (unsigned char c : type_name) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+void write_header(
+  const std::string        & filename,
+  binary_file_header       & header)
+{
+  DASH_LOG_DEBUG("StoreBinary.write_header()", filename);
+  init_offsets(header);
+
+  std::vector<uint64_t> words;
+  words.reserve(binary_header_words + 3 * header.ndim + header.nunits());
+  words.push_back(binary_file_magic);
+  words.push_back(header.version);
+  words.push_back(header.ndim);
+  words.push_back(header.value_size);
+  words.push_back(header.type_hash);
+  words.push_back(header.nunits());
+  words.push_back(static_cast<uint64_t>(header.layout));
+  words.push_back(header.data_offset);
+  words.insert(words.end(), header.extents.begin(), header.extents.end());
+  words.insert(words.end(), header.team_extents.begin(),
+                            header.team_extents.end());
+  words.insert(words.end(), header.blocksizes.begin(),
+                            header.blocksizes.end());
+  words.insert(words.end(), header.local_sizes.begin(),
+                            header.local_sizes.end());
+
+  uint64_t data_size = 0;
+  for (auto lsize : header.local_sizes) {
+    data_size += lsize;
+  }
+
+  int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    DASH_THROW(dash::exception::RuntimeError,
+               "Could not create file " << filename << ": " <<
+               std::strerror(errno));
+  }
+  try {
+    pwrite_all(fd, words.data(), words.size() * sizeof(uint64_t), 0);
+    if (::ftruncate(fd, header.data_offset +
+                        data_size * header.value_size) != 0) {
+      DASH_THROW(dash::exception::RuntimeError,
+                 "Could not resize file " << filename << ": " <<
+                 std::strerror(errno));
+    }
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+  ::close(fd);
+  DASH_LOG_DEBUG("StoreBinary.write_header >");
+}
+
+void read_header(
+  const std::string        & filename,
+  binary_file_header       & header,
+  dart_team_t                team)
+{
+  DASH_LOG_DEBUG("StoreBinary.read_header()", filename);
+
+  dart_team_unit_t myid;
+  DASH_ASSERT_RETURNS(dart_team_myid(team, &myid), DART_OK);
+
+  // number of header words, 0 if the file could not be read
+  uint64_t              nwords = 0;
+  std::vector<uint64_t> words(binary_header_words);
+  if (myid.id == 0) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd >= 0) {
+      try {
+        pread_all(fd, words.data(), words.size() * sizeof(uint64_t), 0);
+        if (words[0] == binary_file_magic) {
+          nwords = binary_header_words + 3 * words[2] + words[5];
+          words.resize(nwords);
+          pread_all(fd, words.data() + binary_header_words,
+                    (nwords - binary_header_words) * sizeof(uint64_t),
+                    binary_header_words * sizeof(uint64_t));
+        }
+      } catch (const dash::exception::RuntimeError &) {
+        nwords = 0;
+      }
+      ::close(fd);
+    }
+  }
+  DASH_ASSERT_RETURNS(
+    dart_bcast(&nwords, sizeof(uint64_t), DART_TYPE_BYTE,
+               dart_team_unit_t{0}, team),
+    DART_OK);
+  if (nwords == 0) {
+    DASH_THROW(dash::exception::RuntimeError,
+               "Could not read header of binary file " << filename);
+  }
+  words.resize(nwords);
+  DASH_ASSERT_RETURNS(
+    dart_bcast(words.data(), nwords * sizeof(uint64_t), DART_TYPE_BYTE,
+               dart_team_unit_t{0}, team),
+    DART_OK);
+
+  header.version     = words[1];
+  header.ndim        = words[2];
+  header.value_size  = words[3];
+  header.type_hash   = words[4];
+  header.layout      = static_cast<binary_layout>(words[6]);
+  auto nunits        = words[5];
+  auto it            = words.begin() + binary_header_words;
+  header.extents.assign(it, it + header.ndim);
+  it += header.ndim;
+  header.team_extents.assign(it, it + header.ndim);
+  it += header.ndim;
+  header.blocksizes.assign(it, it + header.ndim);
+  it += header.ndim;
+  header.local_sizes.assign(it, it + nunits);
+  init_offsets(header);
+
+  if (header.data_offset != words[7]) {
+    DASH_THROW(dash::exception::RuntimeError,
+               "Invalid header in binary file " << filename);
+  }
+  DASH_LOG_DEBUG("StoreBinary.read_header >");
+}
+
+void agree_on_error(
+  std::exception_ptr         error,
+  const std::string        & filename,
+  dart_team_t                team)
+{
+  int success     = error ? 0 : 1;
+  int all_success = 0;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&success, &all_success, 1, DART_TYPE_INT, DART_OP_MIN,
+                   team),
+    DART_OK);
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  if (!all_success) {
+    DASH_THROW(dash::exception::RuntimeError,
+               "I/O of binary file " << filename << " failed at "
+               "another unit");
+  }
+}
+
+} // namespace internal
+} // namespace binary
+} // namespace io
+} // namespace dash
@@ -0,0 +1,181 @@
+#include <dash/memory/MemoryPlacement.h>
+
+#include <dash/util/Locality.h>
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#ifdef DASH_ENABLE_NUMA
+#include <numa.h>
+#include <numaif.h>
+#endif
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+
+namespace dash {
+
+namespace {
+
+/**
+ * Pages entirely contained in a memory range.
+ */
+struct PageRange {
+  char   * begin     = nullptr;
+  size_t   num_pages = 0;
+  size_t   page_size = 0;
+
+  size_t nbytes() const
+  {
+    return num_pages * page_size;
+  }
+};
+
+PageRange inner_pages(void * addr, size_t nbytes)
+{
+  static const size_t page_size =
+    static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+  PageRange pages;
+  pages.page_size  = page_size;
+  auto      begin  = reinterpret_cast<uintptr_t>(addr);
+  auto      end    = begin + nbytes;
+  begin            = (begin + page_size - 1) / page_size * page_size;
+  end              = end / page_size * page_size;
+  if (end > begin) {
+    pages.begin     = reinterpret_cast<char *>(begin);
+    pages.num_pages = (end - begin) / page_size;
+  }
+  return pages;
+}
+
+bool touch_pages_parallel(const PageRange & pages)
+{
+#ifdef DASH_ENABLE_OPENMP
+  auto      n_threads = dash::util::Locality::NumUnitDomainThreads();
+  long long num_pages = pages.num_pages;
+  DASH_LOG_DEBUG("dash::apply_memory_placement", "first touch",
+                 "pages:", num_pages, "threads:", n_threads);
+  // Same static schedule as loops over the local elements, so every
+  // thread touches the pages of the elements it processes:
+  #pragma omp parallel for num_threads(n_threads) schedule(static)
+  for (long long p = 0; p < num_pages; ++p) {
+    *reinterpret_cast<volatile char *>(pages.begin + p * pages.page_size)
+      = 0;
+  }
+  return true;
+#else
+  DASH_LOG_DEBUG("dash::apply_memory_placement",
+                 "first touch requires OpenMP");
+  return false;
+#endif
+}
+
+bool bind_pages(const PageRange & pages, MemoryPlacement placement)
+{
+#ifdef DASH_ENABLE_NUMA
+  if (numa_available() < 0) {
+    DASH_LOG_DEBUG("dash::apply_memory_placement", "NUMA not available");
+    return false;
+  }
+  struct bitmask * nodes;
+  int              mode;
+  if (placement == MemoryPlacement::interleaved) {
+    mode  = MPOL_INTERLEAVE;
+    nodes = numa_get_mems_allowed();
+  } else {
+    int numa_id = dash::util::Locality::UnitHardwareParams().numa_id;
+    if (numa_id < 0 || numa_id > numa_max_node()) {
+      DASH_LOG_DEBUG("dash::apply_memory_placement",
+                     "unknown NUMA node of unit:", numa_id);
+      return false;
+    }
+    mode  = MPOL_BIND;
+    nodes = numa_allocate_nodemask();
+    numa_bitmask_setbit(nodes, numa_id);
+  }
+  // Pages already touched are migrated, pages mapped by other processes
+  // are left in place:
+  long ret = mbind(pages.begin, pages.nbytes(), mode,
+                   nodes->maskp, nodes->size + 1, MPOL_MF_MOVE);
+  int  err = errno;
+  numa_bitmask_free(nodes);
+  if (ret != 0) {
+    DASH_LOG_WARN("dash::apply_memory_placement",
+                  "mbind failed:", std::strerror(err));
+    return false;
+  }
+  return true;
+#else
+  DASH_LOG_DEBUG("dash::apply_memory_placement",
+                 "placement", placement, "requires libnuma");
+  return false;
+#endif
+}
+
+} // namespace
+
+bool apply_memory_placement(
+  void            * addr,
+  size_t            nbytes,
+  MemoryPlacement   placement)
+{
+  DASH_LOG_DEBUG("dash::apply_memory_placement()",
+                 "addr:", addr, "nbytes:", nbytes, "placement:", placement);
+  if (placement == MemoryPlacement::system || addr == nullptr) {
+    return false;
+  }
+  auto pages = inner_pages(addr, nbytes);
+  if (pages.num_pages == 0) {
+    return false;
+  }
+  bool applied = (placement == MemoryPlacement::first_touch_parallel)
+                 ? touch_pages_parallel(pages)
+                 : bind_pages(pages, placement);
+  DASH_LOG_DEBUG("dash::apply_memory_placement >", applied);
+  return applied;
+}
+
+std::ostream & operator<<(
+  std::ostream          & os,
+  MemoryPlacement         placement)
+{
+  switch (placement) {
+    case MemoryPlacement::system:
+      os << "system";               break;
+    case MemoryPlacement::first_touch_parallel:
+      os << "first_touch_parallel"; break;
+    case MemoryPlacement::interleaved:
+      os << "interleaved";          break;
+    case MemoryPlacement::unit_domain:
+      os << "unit_domain";          break;
+    default:
+      os << "undefined";            break;
+  }
+  return os;
+}
+
+std::ostream & operator<<(
+  std::ostream          & os,
+  MemoryPages             pages)
+{
+  switch (pages) {
+    case MemoryPages::system:   os << "system";   break;
+    case MemoryPages::huge:     os << "huge";     break;
+    case MemoryPages::huge_2mb: os << "huge_2mb"; break;
+    case MemoryPages::huge_1gb: os << "huge_1gb"; break;
+    default:                    os << "undefined"; break;
+  }
+  return os;
+}
+
+} // namespace dash
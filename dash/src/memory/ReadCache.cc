@@ -0,0 +1,381 @@
+#include <dash/memory/ReadCache.h>
+
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+std::atomic<int> num_read_caches(0);
+
+} // namespace internal
+
+namespace {
+
+/**
+ * Registered read caches, also guards access to their state as caches
+ * are used from reads of any thread.
+ */
+struct ReadCacheRegistry {
+  std::recursive_mutex     mutex;
+  std::vector<ReadCache *> caches;
+};
+
+ReadCacheRegistry & registry()
+{
+  static ReadCacheRegistry instance;
+  return instance;
+}
+
+ReadCache * find_cache(const dart_gptr_t & gptr)
+{
+  for (auto * cache : registry().caches) {
+    if (cache->covers(gptr)) {
+      return cache;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace
+
+ReadCache::ReadCache(
+  dart_gptr_t             begin,
+  size_t                  local_bytes,
+  const ReadCacheConfig & config)
+: _begin(begin),
+  _local_bytes(local_bytes),
+  _config(config)
+{
+  if (_config.block_size == 0 || _config.num_blocks == 0) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "ReadCache requires block size and number of blocks > 0");
+  }
+  _blocks_per_unit = (_local_bytes + _config.block_size - 1)
+                     / _config.block_size;
+
+  size_t           nunits;
+  dart_team_unit_t myid;
+  DASH_ASSERT_RETURNS(dart_team_size(_begin.teamid, &nunits), DART_OK);
+  DASH_ASSERT_RETURNS(dart_team_myid(_begin.teamid, &myid),   DART_OK);
+  _cached_units.resize(nunits, false);
+  for (size_t unit = 0; unit < nunits; ++unit) {
+    if (static_cast<dart_unit_t>(unit) == myid.id) {
+      continue;
+    }
+    dart_gptr_t unit_gptr = _begin;
+    unit_gptr.unitid      = unit;
+    void * addr           = nullptr;
+    bool   node_local     = dart_gptr_getaddr_shared(unit_gptr, &addr)
+                              == DART_OK && addr != nullptr;
+    _cached_units[unit]   = _config.node_local || !node_local;
+  }
+  if (_config.mode == ReadCacheMode::blocks) {
+    _tags.resize(_config.num_blocks, -1);
+    _lines.resize(_config.num_blocks * _config.block_size);
+    _pending.resize(_config.num_blocks, DART_HANDLE_NULL);
+  } else {
+    _replica.resize(nunits);
+  }
+  DASH_LOG_DEBUG("ReadCache()",
+                 "team:",        _begin.teamid,
+                 "segment:",     _begin.segid,
+                 "local bytes:", _local_bytes,
+                 "capacity:",    capacity());
+
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  registry().caches.push_back(this);
+  ++dash::internal::num_read_caches;
+}
+
+ReadCache::~ReadCache()
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  for (size_t line = 0; line < _pending.size(); ++line) {
+    complete_line(line);
+  }
+  auto & caches = registry().caches;
+  caches.erase(std::remove(caches.begin(), caches.end(), this),
+               caches.end());
+  --dash::internal::num_read_caches;
+}
+
+bool ReadCache::covers(const dart_gptr_t & gptr) const noexcept
+{
+  return gptr.teamid == _begin.teamid &&
+         gptr.segid  == _begin.segid;
+}
+
+size_t ReadCache::capacity() const noexcept
+{
+  if (_config.mode == ReadCacheMode::replicated) {
+    return std::count(_cached_units.begin(), _cached_units.end(), true)
+           * _local_bytes;
+  }
+  return _config.num_blocks * _config.block_size;
+}
+
+int64_t ReadCache::local_offset(
+  const dart_gptr_t & gptr,
+  size_t              nbytes) const
+{
+  if (!covers(gptr) ||
+      gptr.unitid < 0 ||
+      static_cast<size_t>(gptr.unitid) >= _cached_units.size() ||
+      !_cached_units[gptr.unitid] ||
+      gptr.addr_or_offs.offset < _begin.addr_or_offs.offset) {
+    return -1;
+  }
+  uint64_t offset = gptr.addr_or_offs.offset - _begin.addr_or_offs.offset;
+  if (offset + nbytes > _local_bytes) {
+    return -1;
+  }
+  return static_cast<int64_t>(offset);
+}
+
+bool ReadCache::get(const dart_gptr_t & gptr, void * dst, size_t nbytes)
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  int64_t offset = local_offset(gptr, nbytes);
+  if (offset < 0) {
+    return false;
+  }
+  if (_config.mode == ReadCacheMode::replicated) {
+    if (!_replicated) {
+      replicate();
+    }
+    std::memcpy(dst, _replica[gptr.unitid].data() + offset, nbytes);
+    ++_stats.hits;
+    return true;
+  }
+  char * out = static_cast<char *>(dst);
+  while (nbytes > 0) {
+    size_t block      = offset / _config.block_size;
+    size_t block_offs = offset % _config.block_size;
+    size_t len        = std::min(nbytes, _config.block_size - block_offs);
+    std::memcpy(out, block_line(gptr.unitid, block) + block_offs, len);
+    out    += len;
+    offset += len;
+    nbytes -= len;
+  }
+  return true;
+}
+
+void ReadCache::update(
+  const dart_gptr_t & gptr,
+  const void        * src,
+  size_t              nbytes)
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  int64_t offset = local_offset(gptr, nbytes);
+  if (offset < 0) {
+    return;
+  }
+  if (_config.mode == ReadCacheMode::replicated) {
+    if (_replicated) {
+      std::memcpy(_replica[gptr.unitid].data() + offset, src, nbytes);
+    }
+    return;
+  }
+  const char * in = static_cast<const char *>(src);
+  while (nbytes > 0) {
+    size_t  block      = offset / _config.block_size;
+    size_t  block_offs = offset % _config.block_size;
+    size_t  len        = std::min(nbytes, _config.block_size - block_offs);
+    int64_t tag        = gptr.unitid * _blocks_per_unit + block;
+    size_t  line       = tag % _config.num_blocks;
+    if (_tags[line] == tag) {
+      complete_line(line);
+      std::memcpy(&_lines[line * _config.block_size] + block_offs, in, len);
+    }
+    in     += len;
+    offset += len;
+    nbytes -= len;
+  }
+}
+
+bool ReadCache::prefetch(const dart_gptr_t & gptr, size_t nbytes)
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  int64_t offset = local_offset(gptr, nbytes);
+  if (offset < 0) {
+    return false;
+  }
+  if (_config.mode == ReadCacheMode::replicated) {
+    if (!_replicated) {
+      replicate();
+    }
+    return true;
+  }
+  size_t block_first = offset / _config.block_size;
+  size_t block_last  = (offset + std::max<size_t>(nbytes, 1) - 1)
+                       / _config.block_size;
+  for (size_t block = block_first; block <= block_last; ++block) {
+    int64_t tag  = gptr.unitid * _blocks_per_unit + block;
+    size_t  line = tag % _config.num_blocks;
+    if (_tags[line] == tag) {
+      continue;
+    }
+    // Line may still receive an earlier prefetched block:
+    complete_line(line);
+    if (_tags[line] >= 0) {
+      ++_stats.evictions;
+    }
+    size_t block_start     = block * _config.block_size;
+    size_t block_bytes     = std::min(_config.block_size,
+                                      _local_bytes - block_start);
+    dart_gptr_t block_gptr = _begin;
+    block_gptr.unitid      = gptr.unitid;
+    block_gptr.addr_or_offs.offset += block_start;
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(&_lines[line * _config.block_size], block_gptr,
+                      block_bytes, DART_TYPE_BYTE, DART_TYPE_BYTE,
+                      &_pending[line]),
+      DART_OK);
+    _tags[line] = tag;
+    ++_stats.prefetches;
+    _stats.bytes_fetched += block_bytes;
+  }
+  return true;
+}
+
+void ReadCache::complete_line(size_t line)
+{
+  if (_pending[line] != DART_HANDLE_NULL) {
+    DASH_ASSERT_RETURNS(dart_wait_local(&_pending[line]), DART_OK);
+    _pending[line] = DART_HANDLE_NULL;
+  }
+}
+
+void ReadCache::invalidate()
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  for (size_t line = 0; line < _pending.size(); ++line) {
+    complete_line(line);
+  }
+  std::fill(_tags.begin(), _tags.end(), -1);
+  _replicated = false;
+  ++_stats.invalidations;
+}
+
+ReadCacheStats ReadCache::stats() const
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  return _stats;
+}
+
+void ReadCache::reset_stats()
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  _stats = ReadCacheStats();
+}
+
+void ReadCache::replicate()
+{
+  DASH_LOG_DEBUG("ReadCache.replicate()", "local bytes:", _local_bytes);
+  std::vector<dart_handle_t> handles;
+  for (size_t unit = 0; unit < _cached_units.size(); ++unit) {
+    if (!_cached_units[unit]) {
+      continue;
+    }
+    _replica[unit].resize(_local_bytes);
+    dart_gptr_t unit_gptr = _begin;
+    unit_gptr.unitid      = unit;
+    dart_handle_t handle;
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(_replica[unit].data(), unit_gptr, _local_bytes,
+                      DART_TYPE_BYTE, DART_TYPE_BYTE, &handle),
+      DART_OK);
+    handles.push_back(handle);
+    ++_stats.misses;
+    _stats.bytes_fetched += _local_bytes;
+  }
+  DASH_ASSERT_RETURNS(
+    dart_waitall(handles.data(), handles.size()),
+    DART_OK);
+  _replicated = true;
+}
+
+char * ReadCache::block_line(dart_unit_t unit, size_t block)
+{
+  int64_t tag   = unit * _blocks_per_unit + block;
+  size_t  line  = tag % _config.num_blocks;
+  char  * data  = &_lines[line * _config.block_size];
+  if (_tags[line] == tag) {
+    complete_line(line);
+    ++_stats.hits;
+    return data;
+  }
+  complete_line(line);
+  if (_tags[line] >= 0) {
+    ++_stats.evictions;
+  }
+  // The final block of a unit may be shorter than a cache block:
+  size_t block_start    = block * _config.block_size;
+  size_t nbytes         = std::min(_config.block_size,
+                                   _local_bytes - block_start);
+  dart_gptr_t block_gptr = _begin;
+  block_gptr.unitid      = unit;
+  block_gptr.addr_or_offs.offset += block_start;
+  DASH_ASSERT_RETURNS(
+    dart_get_blocking(data, block_gptr, nbytes,
+                      DART_TYPE_BYTE, DART_TYPE_BYTE),
+    DART_OK);
+  _tags[line] = tag;
+  ++_stats.misses;
+  _stats.bytes_fetched += nbytes;
+  return data;
+}
+
+namespace internal {
+
+bool read_cache_get(const dart_gptr_t & gptr, void * dst, size_t nbytes)
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  auto * cache = find_cache(gptr);
+  return cache != nullptr && cache->get(gptr, dst, nbytes);
+}
+
+void read_cache_update(
+  const dart_gptr_t & gptr,
+  const void        * src,
+  size_t              nbytes)
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  auto * cache = find_cache(gptr);
+  if (cache != nullptr) {
+    cache->update(gptr, src, nbytes);
+  }
+}
+
+bool read_cache_prefetch(const dart_gptr_t & gptr, size_t nbytes)
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  auto * cache = find_cache(gptr);
+  return cache != nullptr && cache->prefetch(gptr, nbytes);
+}
+
+void read_cache_barrier(dart_team_t team)
+{
+  std::lock_guard<std::recursive_mutex> lock(registry().mutex);
+  for (auto * cache : registry().caches) {
+    if (cache->team() == team &&
+        cache->config().mode == ReadCacheMode::blocks) {
+      cache->invalidate();
+    }
+  }
+}
+
+} // namespace internal
+
+} // namespace dash
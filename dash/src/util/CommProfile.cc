@@ -0,0 +1,225 @@
+#include <dash/util/CommProfile.h>
+
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+namespace util {
+
+namespace {
+
+typedef std::pair<dart_team_t, int16_t> segment_key_t;
+
+void write_counts(std::ostream & out, const dart_profile_counts_t & counts)
+{
+  out << "{\"count\":" << counts.count
+      << ",\"bytes\":" << counts.bytes << "}";
+}
+
+void write_op_stats(std::ostream & out, const dart_profile_op_stats_t & stats)
+{
+  out << "{\"count\":"   << stats.count
+      << ",\"bytes\":"   << stats.bytes
+      << ",\"timed\":"   << stats.timed
+      << ",\"time_ns\":" << stats.time_ns
+      << ",\"hist\":[";
+  for (int bin = 0; bin < DART_PROFILE_HIST_BINS; ++bin) {
+    out << (bin > 0 ? "," : "") << stats.hist[bin];
+  }
+  out << "]}";
+}
+
+} // namespace
+
+bool CommProfile::enabled()
+{
+  return dart_profile_enabled();
+}
+
+void CommProfile::reset()
+{
+  DASH_ASSERT_RETURNS(dart_profile_reset(), DART_OK);
+}
+
+void CommProfile::write_json(
+  std::ostream      & out,
+  dash::Team        & team)
+{
+  DASH_LOG_DEBUG("CommProfile.write_json()");
+
+  const dart_team_unit_t root { 0 };
+  const size_t           nunits   = team.size();
+  const size_t           nglobal  = dash::size();
+  const bool             is_root  = (team.myid() == 0);
+  // Statistics are reduced as arrays of uint64_t:
+  const size_t           op_words = sizeof(dart_profile_op_stats_t)
+                                    / sizeof(uint64_t);
+  const size_t           ct_words = sizeof(dart_profile_counts_t)
+                                    / sizeof(uint64_t);
+
+  // Operation statistics summed over all units:
+  std::vector<dart_profile_op_stats_t> ops(DART_PROFILE_NUM_OPS);
+  std::vector<dart_profile_op_stats_t> team_ops(DART_PROFILE_NUM_OPS);
+  for (int op = 0; op < DART_PROFILE_NUM_OPS; ++op) {
+    DASH_ASSERT_RETURNS(
+      dart_profile_op_stats(static_cast<dart_profile_op_t>(op), &ops[op]),
+      DART_OK);
+  }
+  DASH_ASSERT_RETURNS(
+    dart_reduce(ops.data(), team_ops.data(),
+                DART_PROFILE_NUM_OPS * op_words, DART_TYPE_ULONGLONG,
+                DART_OP_SUM, root, team.dart_id()),
+    DART_OK);
+
+  // One-sided operations issued by every unit:
+  dart_profile_counts_t issued { 0, 0 };
+  for (int op = 0; op < DART_PROFILE_NUM_RMA_OPS; ++op) {
+    issued.count += ops[op].count;
+    issued.bytes += ops[op].bytes;
+  }
+  std::vector<dart_profile_counts_t> sources(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_gather(&issued, sources.data(), ct_words, DART_TYPE_ULONGLONG,
+                root, team.dart_id()),
+    DART_OK);
+
+  // One-sided operations per target unit summed over all units:
+  std::vector<dart_profile_counts_t> targets(nglobal);
+  std::vector<dart_profile_counts_t> team_targets(nglobal);
+  DASH_ASSERT_RETURNS(dart_profile_targets(targets.data()), DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_reduce(targets.data(), team_targets.data(),
+                nglobal * ct_words, DART_TYPE_ULONGLONG,
+                DART_OP_SUM, root, team.dart_id()),
+    DART_OK);
+
+  // Segments accessed by any unit:
+  size_t nsegments = 0;
+  DASH_ASSERT_RETURNS(
+    dart_profile_segments(nullptr, 0, &nsegments),
+    DART_OK);
+  std::vector<dart_profile_segment_stats_t> segments(nsegments);
+  DASH_ASSERT_RETURNS(
+    dart_profile_segments(segments.data(), nsegments, &nsegments),
+    DART_OK);
+  nsegments = std::min(nsegments, segments.size());
+
+  size_t              seg_bytes = nsegments
+                                  * sizeof(dart_profile_segment_stats_t);
+  std::vector<size_t> unit_seg_bytes(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(&seg_bytes, unit_seg_bytes.data(), 1, DART_TYPE_SIZET,
+                   team.dart_id()),
+    DART_OK);
+  std::vector<size_t> unit_seg_displs(nunits, 0);
+  std::partial_sum(unit_seg_bytes.begin(), unit_seg_bytes.end() - 1,
+                   unit_seg_displs.begin() + 1);
+  size_t total_seg_bytes = unit_seg_displs.back() + unit_seg_bytes.back();
+  std::vector<dart_profile_segment_stats_t> team_segments(
+    total_seg_bytes / sizeof(dart_profile_segment_stats_t));
+  DASH_ASSERT_RETURNS(
+    dart_allgatherv(segments.data(), seg_bytes, DART_TYPE_BYTE,
+                    team_segments.data(), unit_seg_bytes.data(),
+                    unit_seg_displs.data(), team.dart_id()),
+    DART_OK);
+
+  if (!is_root) {
+    return;
+  }
+
+  std::map<segment_key_t, dart_profile_segment_stats_t> merged_segments;
+  for (const auto & seg : team_segments) {
+    auto it = merged_segments.find(segment_key_t(seg.teamid, seg.segid));
+    if (it == merged_segments.end()) {
+      merged_segments.insert(
+        std::make_pair(segment_key_t(seg.teamid, seg.segid), seg));
+      continue;
+    }
+    for (int op = 0; op < DART_PROFILE_NUM_RMA_OPS; ++op) {
+      it->second.ops[op].count += seg.ops[op].count;
+      it->second.ops[op].bytes += seg.ops[op].bytes;
+    }
+  }
+
+  out << "{\n"
+      << "  \"units\": "   << nunits << ",\n"
+      << "  \"enabled\": " << (enabled() ? "true" : "false") << ",\n"
+      << "  \"ops\": {";
+  for (int op = 0; op < DART_PROFILE_NUM_OPS; ++op) {
+    out << (op > 0 ? "," : "") << "\n    \""
+        << dart_profile_op_name(static_cast<dart_profile_op_t>(op))
+        << "\": ";
+    write_op_stats(out, team_ops[op]);
+  }
+  out << "\n  },\n"
+      << "  \"sources\": [";
+  for (size_t unit = 0; unit < nunits; ++unit) {
+    out << (unit > 0 ? "," : "") << "\n    {\"unit\":"
+        << team.global_id(dash::team_unit_t(unit)).id << ",\"ops\":";
+    write_counts(out, sources[unit]);
+    out << "}";
+  }
+  out << "\n  ],\n"
+      << "  \"targets\": [";
+  bool first = true;
+  for (size_t unit = 0; unit < nglobal; ++unit) {
+    if (team_targets[unit].count == 0) {
+      continue;
+    }
+    out << (first ? "" : ",") << "\n    {\"unit\":" << unit << ",\"ops\":";
+    write_counts(out, team_targets[unit]);
+    out << "}";
+    first = false;
+  }
+  out << "\n  ],\n"
+      << "  \"segments\": [";
+  first = true;
+  for (const auto & seg : merged_segments) {
+    out << (first ? "" : ",") << "\n    {\"team\":" << seg.first.first
+        << ",\"segid\":" << seg.first.second;
+    for (int op = 0; op < DART_PROFILE_NUM_RMA_OPS; ++op) {
+      out << ",\""
+          << dart_profile_op_name(static_cast<dart_profile_op_t>(op))
+          << "\":";
+      write_counts(out, seg.second.ops[op]);
+    }
+    out << "}";
+    first = false;
+  }
+  out << "\n  ]\n"
+      << "}" << std::endl;
+
+  DASH_LOG_DEBUG("CommProfile.write_json >");
+}
+
+void CommProfile::write_json(
+  const std::string & filename,
+  dash::Team        & team)
+{
+  std::ofstream out;
+  if (team.myid() == 0) {
+    out.open(filename);
+    if (!out) {
+      DASH_LOG_ERROR("CommProfile.write_json",
+                     "could not open file", filename);
+    }
+  }
+  write_json(out, team);
+}
+
+} // namespace util
+} // namespace dash
@@ -6,6 +6,7 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_locality.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -102,20 +103,28 @@ void Locality::init()
                "Locality::init(): dart_unit_locality returned nullptr " <<
                "for unit " << dash::Team::GlobalUnitID());
   }
-  if (dart_domain_team_locality(
+  // The team's domain is resolved on first use as it requires the
+  // locality data of all units:
+  _team_loc = nullptr;
+  DASH_LOG_DEBUG("dash::util::Locality::init >");
+}
+
+int Locality::NumNodes()
+{
+  if (_unit_loc == nullptr) {
+    return -1;
+  }
+  if (_team_loc == nullptr &&
+      dart_domain_team_locality(
         DART_TEAM_ALL, _unit_loc->domain_tag, &_team_loc)
       != DART_OK) {
     DASH_THROW(dash::exception::RuntimeError,
-               "Locality::init(): dart_domain_team_locality failed " <<
+               "Locality::NumNodes(): dart_domain_team_locality failed " <<
                "for domain '" << _unit_loc->domain_tag << "'");
   }
-  DASH_LOG_TRACE_VAR("dash::util::Locality::init", _team_loc);
-  if (_team_loc == nullptr) {
-    DASH_THROW(dash::exception::RuntimeError,
-               "Locality::init(): dart_domain_team_locality returned 0 " <<
-               "for domain '" << _unit_loc->domain_tag << "'");
-  }
-  DASH_LOG_DEBUG("dash::util::Locality::init >");
+  return (_team_loc == nullptr)
+//       ? -1 : std::max<int>(_team_loc->num_nodes, 1);
+         ? -1 : std::max<int>(_team_loc->num_domains, 1);
 }
 
 std::ostream & operator<<(
@@ -136,6 +145,57 @@ std::ostream & operator<<(
   return os;
 }
 
+const Locality::HardwareParams & Locality::UnitHardwareParams()
+{
+  // Initialized on first use, thread-safe:
+  static const HardwareParams params = []() {
+    HardwareParams hw;
+    hw.cache_sizes.fill(0);
+    hw.cache_line_sizes.fill(64);
+    hw.num_threads = 1;
+    hw.numa_id     = -1;
+    if (_unit_loc == nullptr) {
+      DASH_LOG_DEBUG("Locality::UnitHardwareParams",
+                     "no locality data, using defaults");
+      return hw;
+    }
+    const auto & hwinfo = _unit_loc->hwinfo;
+    // DART only resolves L1 to L3 caches, entries of higher levels are
+    // not initialized:
+    for (int level = 0; level < 3; ++level) {
+      if (hwinfo.cache_sizes[level] > 0) {
+        hw.cache_sizes[level] = hwinfo.cache_sizes[level];
+      }
+      if (hwinfo.cache_line_sizes[level] > 0) {
+        hw.cache_line_sizes[level] = hwinfo.cache_line_sizes[level];
+      }
+    }
+    int n_threads = std::max(hwinfo.num_cores, 1);
+    if (dash::util::Config::get<bool>("DASH_DISABLE_THREADS")) {
+      n_threads  = 1;
+    } else if (dash::util::Config::get<bool>("DASH_MAX_SMT")) {
+      n_threads *= std::max(hwinfo.max_threads, 1);
+    } else {
+      n_threads *= std::max(hwinfo.min_threads, 1);
+    }
+    if (dash::util::Config::is_set("DASH_MAX_UNIT_THREADS")) {
+      n_threads  = std::min(dash::util::Config::get<int>(
+                              "DASH_MAX_UNIT_THREADS"),
+                            n_threads);
+    }
+    hw.num_threads = std::max(n_threads, 1);
+    hw.numa_id     = std::max(hwinfo.numa_id, -1);
+    DASH_LOG_DEBUG("Locality::UnitHardwareParams",
+                   "L1:",      hw.cache_sizes[0],
+                   "L2:",      hw.cache_sizes[1],
+                   "L3:",      hw.cache_sizes[2],
+                   "threads:", hw.num_threads,
+                   "numa:",    hw.numa_id);
+    return hw;
+  }();
+  return params;
+}
+
 dart_unit_locality_t   * Locality::_unit_loc = nullptr;
 dart_domain_locality_t * Locality::_team_loc = nullptr;
 
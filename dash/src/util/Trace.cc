@@ -1,20 +1,213 @@
 #include <dash/util/Trace.h>
 #include <dash/util/Config.h>
 #include <dash/Team.h>
+#include <dash/Exception.h>
 
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <unistd.h>
 
-std::map<std::string, dash::util::TraceStore::trace_events_t>
-dash::util::TraceStore::_traces
-  = {{ }};
+
+namespace {
+
+typedef dash::util::TraceStore::timer_t          timer_t;
+typedef dash::util::TraceStore::timestamp_t      timestamp_t;
+typedef dash::util::TraceStore::name_id_t        name_id_t;
+typedef dash::util::TraceStore::state_timespan_t state_timespan_t;
+typedef dash::util::TraceStore::trace_buffer_t   trace_buffer_t;
+
+/// Default number of events in the trace buffer of a thread
+constexpr size_t trace_buffer_default_size = 1 << 16;
+/// Message tag used to estimate clock offsets
+constexpr int    trace_clock_sync_tag      = 0x7ace;
+/// Number of round trips to estimate the clock offset of a unit
+constexpr int    trace_clock_sync_rounds   = 8;
+
+/**
+ * Interned names and trace buffers of all threads.
+ */
+struct TraceRegistry {
+  std::mutex                                      mutex;
+  std::vector<std::string>                        names { "global" };
+  std::unordered_map<std::string, name_id_t>      name_ids { { "global", 0 } };
+  /// Trace buffers of all threads that recorded events, indexed by
+  /// thread id, never deallocated so threads may exit before traces
+  /// are written
+  std::vector<std::unique_ptr<trace_buffer_t>>    buffers;
+  size_t      buffer_size = trace_buffer_default_size;
+  /// Timestamp counter value at start of trace
+  timestamp_t epoch_ts    = 0;
+  /// Clock time in microseconds at start of trace
+  double      epoch_us    = 0;
+};
+
+TraceRegistry & trace_registry()
+{
+  static TraceRegistry registry;
+  return registry;
+}
+
+thread_local trace_buffer_t * trace_thread_buffer = nullptr;
+
+trace_buffer_t & thread_buffer()
+{
+  if (trace_thread_buffer == nullptr) {
+    auto & registry = trace_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffers.emplace_back(new trace_buffer_t(registry.buffer_size));
+    trace_thread_buffer = registry.buffers.back().get();
+  }
+  return *trace_thread_buffer;
+}
+
+/**
+ * Monotonic clock time in microseconds.
+ */
+double clock_us()
+{
+  return std::chrono::duration<double, std::micro>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void reset_epoch()
+{
+  auto & registry   = trace_registry();
+  registry.epoch_ts = timer_t::Now();
+  registry.epoch_us = clock_us();
+}
+
+/**
+ * Conversion of timestamp counter values to clock time, calibrated from
+ * the counter and clock values at the start of the trace and at the time
+ * of the conversion.
+ */
+class TraceClock
+{
+public:
+  TraceClock()
+  {
+    auto & registry = trace_registry();
+    _epoch_ts = registry.epoch_ts;
+    _epoch_us = registry.epoch_us;
+    double elapsed_us    = clock_us() - _epoch_us;
+    double elapsed_ticks = ticks(timer_t::Now());
+    if (elapsed_us > 0 && elapsed_ticks > 0) {
+      _ticks_per_us = elapsed_ticks / elapsed_us;
+    }
+  }
+
+  /**
+   * Clock time in microseconds of the given counter value.
+   */
+  double time_us(timestamp_t ts) const
+  {
+    return _epoch_us + ticks(ts) / _ticks_per_us;
+  }
+
+  /**
+   * Microseconds between the given counter values.
+   */
+  double duration_us(timestamp_t start, timestamp_t end) const
+  {
+    return static_cast<double>(end - start) / _ticks_per_us;
+  }
+
+  double epoch_us() const
+  {
+    return _epoch_us;
+  }
+
+private:
+  double ticks(timestamp_t ts) const
+  {
+    return static_cast<double>(static_cast<int64_t>(ts - _epoch_ts));
+  }
+
+private:
+  timestamp_t _epoch_ts;
+  double      _epoch_us;
+  double      _ticks_per_us = 1.0;
+};
+
+/**
+ * Estimate the offset of the clock of the calling unit to the clock of
+ * unit 0 from the message round trip with minimal latency.
+ *
+ * Collective operation on all units.
+ */
+double clock_offset_us()
+{
+  auto   myid   = dash::Team::GlobalUnitID();
+  auto   nunits = dash::size();
+  double offset = 0;
+  if (myid == 0) {
+    for (size_t unit = 1; unit < nunits; ++unit) {
+      dart_global_unit_t peer { static_cast<dart_unit_t>(unit) };
+      for (int round = 0; round < trace_clock_sync_rounds; ++round) {
+        double ts_peer;
+        DASH_ASSERT_RETURNS(
+          dart_recv(&ts_peer, 1, DART_TYPE_DOUBLE, trace_clock_sync_tag,
+                    peer),
+          DART_OK);
+        double ts_root = clock_us();
+        DASH_ASSERT_RETURNS(
+          dart_send(&ts_root, 1, DART_TYPE_DOUBLE, trace_clock_sync_tag,
+                    peer),
+          DART_OK);
+      }
+    }
+    return offset;
+  }
+  dart_global_unit_t root { 0 };
+  double min_rtt = std::numeric_limits<double>::max();
+  for (int round = 0; round < trace_clock_sync_rounds; ++round) {
+    double ts_send = clock_us();
+    double ts_root;
+    DASH_ASSERT_RETURNS(
+      dart_send(&ts_send, 1, DART_TYPE_DOUBLE, trace_clock_sync_tag, root),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_recv(&ts_root, 1, DART_TYPE_DOUBLE, trace_clock_sync_tag, root),
+      DART_OK);
+    double ts_recv = clock_us();
+    // Assume the root's clock has been read in the middle of the
+    // round trip:
+    if (ts_recv - ts_send < min_rtt) {
+      min_rtt = ts_recv - ts_send;
+      offset  = (ts_send + ts_recv) / 2 - ts_root;
+    }
+  }
+  return offset;
+}
+
+std::string json_escape(const std::string & str)
+{
+  std::string escaped;
+  escaped.reserve(str.size());
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+} // namespace
 
 bool dash::util::TraceStore::_trace_enabled
   = false;
@@ -22,6 +215,16 @@ bool dash::util::TraceStore::_trace_enabled
 bool dash::util::TraceStore::on()
 {
   _trace_enabled = dash::util::Config::get<bool>("DASH_ENABLE_TRACE");
+  if (_trace_enabled) {
+    auto & registry = trace_registry();
+    if (dash::util::Config::is_set("DASH_TRACE_BUFFER_SIZE")) {
+      registry.buffer_size = dash::util::Config::get<size_t>(
+                               "DASH_TRACE_BUFFER_SIZE");
+    }
+    if (registry.epoch_ts == 0) {
+      reset_epoch();
+    }
+  }
   return _trace_enabled;
 }
 
@@ -37,25 +240,75 @@ bool dash::util::TraceStore::enabled()
 
 void dash::util::TraceStore::clear()
 {
-  _traces.clear();
+  auto & registry = trace_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto & buffer : registry.buffers) {
+    buffer->clear();
+  }
+  reset_epoch();
 }
 
 void dash::util::TraceStore::clear(const std::string & context)
 {
-  _traces[context].clear();
+  name_id_t context_id = name_id(context);
+  auto & registry = trace_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto & buffer : registry.buffers) {
+    buffer->remove_if([context_id](const state_timespan_t & event) {
+                        return event.context == context_id;
+                      });
+  }
 }
 
 void dash::util::TraceStore::add_context(const std::string & context)
 {
-  if (_traces.count(context) == 0) {
-    _traces[context] = trace_events_t();
+  name_id(context);
+}
+
+dash::util::TraceStore::name_id_t
+dash::util::TraceStore::name_id(const std::string & name)
+{
+  auto & registry = trace_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.name_ids.find(name);
+  if (it != registry.name_ids.end()) {
+    return it->second;
+  }
+  name_id_t id = static_cast<name_id_t>(registry.names.size());
+  registry.names.push_back(name);
+  registry.name_ids.insert(std::make_pair(name, id));
+  return id;
+}
+
+dash::util::TraceStore::event_seq_t
+dash::util::TraceStore::enter_state(name_id_t context, name_id_t state)
+{
+  state_timespan_t state_timespan;
+  state_timespan.start   = timer_t::Now();
+  // Events that have not been exited end before they start:
+  state_timespan.end     = 0;
+  state_timespan.context = context;
+  state_timespan.state   = state;
+  return thread_buffer().push(state_timespan);
+}
+
+void dash::util::TraceStore::exit_state(event_seq_t seq)
+{
+  auto state_timespan = thread_buffer().at_seq(seq);
+  if (state_timespan != nullptr) {
+    state_timespan->end = timer_t::Now();
   }
 }
 
-dash::util::TraceStore::trace_events_t &
-dash::util::TraceStore::context_trace(const std::string & context)
+uint64_t dash::util::TraceStore::dropped()
 {
-  return _traces[context];
+  auto & registry = trace_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  uint64_t num_dropped = 0;
+  for (auto & buffer : registry.buffers) {
+    num_dropped += buffer->dropped();
+  }
+  return num_dropped;
 }
 
 void dash::util::TraceStore::write(std::ostream & out)
@@ -67,34 +320,42 @@ void dash::util::TraceStore::write(std::ostream & out)
   std::ostringstream os;
   auto unit   = dash::Team::GlobalUnitID();
   auto nunits = dash::size();
-  for (auto context_traces : _traces) {
-    std::string      context = context_traces.first;
-    trace_events_t & events  = context_traces.second;
-
-    // Master prints CSV headers:
-    if (unit == 0) {
-      os << "-- [TRACE] "
-         << std::setw(15) << "context"  << ","
-         << std::setw(5)  << "unit"     << ","
-         << std::setw(15) << "start"    << ","
-         << std::setw(15) << "end"      << ","
-         << std::setw(12) << "state"
-         << std::endl;
-    }
 
-    dash::barrier();
+  // Master prints CSV headers:
+  if (unit == 0) {
+    os << "-- [TRACE] "
+       << std::setw(15) << "context"  << ","
+       << std::setw(5)  << "unit"     << ","
+       << std::setw(15) << "start"    << ","
+       << std::setw(15) << "end"      << ","
+       << std::setw(12) << "state"
+       << std::endl;
+  }
 
-    for (auto state_timespan : events) {
-      auto   start    = state_timespan.start;
-      auto   end      = state_timespan.end;
-      auto   state    = state_timespan.state;
-      os << "-- [TRACE] "
-         << std::setw(15) << std::fixed << context  << ","
-         << std::setw(5)  << std::fixed << unit     << ","
-         << std::setw(15) << std::fixed << start    << ","
-         << std::setw(15) << std::fixed << end      << ","
-         << std::setw(12) << std::fixed << state
-         << std::endl;
+  dash::barrier();
+
+  {
+    auto & registry = trace_registry();
+    TraceClock clock;
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto & buffer : registry.buffers) {
+      buffer->for_each([&](const state_timespan_t & state_timespan) {
+        if (state_timespan.end < state_timespan.start) {
+          return;
+        }
+        // Microseconds since start of trace:
+        auto start = clock.time_us(state_timespan.start) - clock.epoch_us();
+        auto end   = clock.time_us(state_timespan.end)   - clock.epoch_us();
+        os << "-- [TRACE] "
+           << std::setw(15) << std::fixed
+           << registry.names[state_timespan.context]     << ","
+           << std::setw(5)  << std::fixed << unit          << ","
+           << std::setw(15) << std::fixed << start         << ","
+           << std::setw(15) << std::fixed << end           << ","
+           << std::setw(12) << std::fixed
+           << registry.names[state_timespan.state]
+           << std::endl;
+      });
     }
   }
   // Print trace events of units sequentially:
@@ -139,3 +400,102 @@ void dash::util::TraceStore::write(
   write(out);
   out.close();
 }
+
+void dash::util::TraceStore::write_chrome(std::ostream & out)
+{
+  DASH_LOG_DEBUG("TraceStore.write_chrome()");
+
+  auto   unit       = dash::Team::GlobalUnitID();
+  auto   nunits     = dash::size();
+  auto & registry   = trace_registry();
+  TraceClock clock;
+
+  // Clock time of unit 0 is the reference time of all units, the origin
+  // of the trace is the earliest start of a unit's trace:
+  double offset_us  = clock_offset_us();
+  double epoch_us   = clock.epoch_us() - offset_us;
+  double origin_us;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&epoch_us, &origin_us, 1, DART_TYPE_DOUBLE, DART_OP_MIN,
+                   DART_TEAM_ALL),
+    DART_OK);
+
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(3)
+     << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << unit
+     << ",\"tid\":0,\"args\":{\"name\":\"unit " << unit << "\"}}";
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    uint64_t num_dropped = 0;
+    for (size_t tid = 0; tid < registry.buffers.size(); ++tid) {
+      auto & buffer = *registry.buffers[tid];
+      num_dropped  += buffer.dropped();
+      buffer.for_each([&](const state_timespan_t & state_timespan) {
+        if (state_timespan.end < state_timespan.start) {
+          return;
+        }
+        os << ",\n{\"name\":\""
+           << json_escape(registry.names[state_timespan.state])
+           << "\",\"cat\":\""
+           << json_escape(registry.names[state_timespan.context])
+           << "\",\"ph\":\"X\",\"pid\":" << unit
+           << ",\"tid\":"  << tid
+           << ",\"ts\":"
+           << clock.time_us(state_timespan.start) - offset_us - origin_us
+           << ",\"dur\":"
+           << clock.duration_us(state_timespan.start, state_timespan.end)
+           << "}";
+      });
+    }
+    if (num_dropped > 0) {
+      os << ",\n{\"name\":\"process_labels\",\"ph\":\"M\",\"pid\":" << unit
+         << ",\"tid\":0,\"args\":{\"labels\":\"dropped " << num_dropped
+         << " events\"}}";
+    }
+  }
+
+  // Unit 0 receives the events of all units in sequence:
+  std::string events = os.str();
+  if (unit != 0) {
+    dart_global_unit_t root { 0 };
+    size_t nbytes = events.size();
+    DASH_ASSERT_RETURNS(
+      dart_send(&nbytes, 1, DART_TYPE_SIZET, trace_clock_sync_tag, root),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_send(events.data(), nbytes, DART_TYPE_BYTE, trace_clock_sync_tag,
+                root),
+      DART_OK);
+    return;
+  }
+  out << "{\"traceEvents\":[\n" << events;
+  for (size_t trace_unit = 1; trace_unit < nunits; ++trace_unit) {
+    dart_global_unit_t peer { static_cast<dart_unit_t>(trace_unit) };
+    size_t nbytes;
+    DASH_ASSERT_RETURNS(
+      dart_recv(&nbytes, 1, DART_TYPE_SIZET, trace_clock_sync_tag, peer),
+      DART_OK);
+    std::string unit_events(nbytes, '\0');
+    DASH_ASSERT_RETURNS(
+      dart_recv(&unit_events[0], nbytes, DART_TYPE_BYTE,
+                trace_clock_sync_tag, peer),
+      DART_OK);
+    out << ",\n" << unit_events;
+  }
+  out << "\n],\n\"displayTimeUnit\":\"ns\"\n}" << std::endl;
+
+  DASH_LOG_DEBUG("TraceStore.write_chrome >");
+}
+
+void dash::util::TraceStore::write_chrome(const std::string & filename)
+{
+  std::ofstream out;
+  if (dash::Team::GlobalUnitID() == 0) {
+    out.open(filename);
+    if (!out) {
+      DASH_LOG_ERROR("TraceStore.write_chrome",
+                     "could not open file", filename);
+    }
+  }
+  write_chrome(out);
+}
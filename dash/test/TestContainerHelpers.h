@@ -0,0 +1,75 @@
+#ifndef DASH__TEST__TEST_CONTAINER_HELPERS_H__
+#define DASH__TEST__TEST_CONTAINER_HELPERS_H__
+
+#include "TestBase.h"
+
+#include <dash/Types.h>
+
+#include <array>
+#include <cstddef>
+
+namespace dash {
+namespace test {
+
+/**
+ * Row-major offset of the given global coordinates.
+ */
+template <class PatternT>
+long linear_offset(
+  const PatternT & pattern,
+  const std::array<typename PatternT::index_type, PatternT::ndim()> & coords)
+{
+  long offset = 0;
+  for (dash::dim_t d = 0; d < PatternT::ndim(); ++d) {
+    offset = offset * pattern.extent(d) + coords[d];
+  }
+  return offset;
+}
+
+/**
+ * Assigns the row-major global offset of every element plus an offset
+ * to its value.
+ *
+ * Collective operation.
+ */
+template <class ContainerT>
+void fill_linear(ContainerT & container, int offset = 0)
+{
+  auto & pattern = container.pattern();
+  for (size_t g = 0; g < pattern.size(); ++g) {
+    auto gcoords = pattern.coords(g);
+    auto lpos    = pattern.local_index(gcoords);
+    if (lpos.unit == pattern.team().myid()) {
+      container.lbegin()[lpos.index] = linear_offset(pattern, gcoords)
+                                       + offset;
+    }
+  }
+  container.barrier();
+}
+
+/**
+ * Asserts that every local element has the value assigned by
+ * \c fill_linear with the same offset, independent of the container's
+ * pattern.
+ *
+ * Collective operation.
+ */
+template <class ContainerT>
+void verify_linear(ContainerT & container, int offset = 0)
+{
+  auto & pattern = container.pattern();
+  for (size_t g = 0; g < pattern.size(); ++g) {
+    auto gcoords = pattern.coords(g);
+    auto lpos    = pattern.local_index(gcoords);
+    if (lpos.unit == pattern.team().myid()) {
+      ASSERT_EQ_U(linear_offset(pattern, gcoords) + offset,
+                  container.lbegin()[lpos.index]);
+    }
+  }
+  container.barrier();
+}
+
+} // namespace test
+} // namespace dash
+
+#endif // DASH__TEST__TEST_CONTAINER_HELPERS_H__
@@ -13,6 +13,7 @@
 #include "../TestLogHelpers.h"
 #include "CopyTest.h"
 
+#include <algorithm>
 #include <vector>
 
 
@@ -889,6 +890,365 @@ TEST_F(CopyTest, AsyncGlobalToLocalTest)
   }
 }
 
+TEST_F(CopyTest, Blocking2DimGlobalToLocalSubMatrix)
+{
+  typedef dash::TilePattern<2>           pattern_t;
+  typedef typename pattern_t::index_type index_t;
+  typedef int                            value_t;
+
+  const size_t extent_x = 4 * _dash_size;
+  const size_t extent_y = 12;
+  pattern_t pattern(
+    dash::SizeSpec<2>(extent_x, extent_y),
+    dash::DistributionSpec<2>(dash::TILE(2), dash::TILE(3)));
+  dash::Matrix<value_t, 2, dash::default_index_t, pattern_t> matrix(pattern);
+
+  if (dash::myid() == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        matrix[x][y] = x * 1000 + y;
+      }
+    }
+  }
+  matrix.barrier();
+
+  // Sub-matrix spanning partial tiles of all units:
+  const index_t sub_offset_x = 1;
+  const index_t sub_offset_y = 2;
+  const size_t  sub_extent_x = extent_x - 2;
+  const size_t  sub_extent_y = 7;
+  auto submatrix = matrix.sub<0>(sub_offset_x, sub_extent_x)
+                         .sub<1>(sub_offset_y, sub_extent_y);
+  std::vector<value_t> local_copy(sub_extent_x * sub_extent_y);
+  auto copy_last = dash::copy(submatrix.begin(),
+                              submatrix.end(),
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.size(), copy_last - local_copy.data());
+  for (size_t x = 0; x < sub_extent_x; ++x) {
+    for (size_t y = 0; y < sub_extent_y; ++y) {
+      EXPECT_EQ_U((x + sub_offset_x) * 1000 + (y + sub_offset_y),
+                  local_copy[x * sub_extent_y + y]);
+    }
+  }
+
+  // Range starting and ending within rows of the sub-matrix:
+  std::fill(local_copy.begin(), local_copy.end(), -1);
+  copy_last = dash::copy(submatrix.begin() + 3,
+                         submatrix.end() - 2,
+                         local_copy.data());
+  EXPECT_EQ_U(local_copy.size() - 5, copy_last - local_copy.data());
+  for (size_t i = 0; i < local_copy.size() - 5; ++i) {
+    size_t x = (i + 3) / sub_extent_y;
+    size_t y = (i + 3) % sub_extent_y;
+    EXPECT_EQ_U((x + sub_offset_x) * 1000 + (y + sub_offset_y),
+                local_copy[i]);
+  }
+  EXPECT_EQ_U(-1, local_copy[local_copy.size() - 5]);
+  matrix.barrier();
+}
+
+TEST_F(CopyTest, Blocking3DimGlobalToLocalSubMatrix)
+{
+  typedef double value_t;
+
+  const size_t extent_x = 2 * _dash_size;
+  const size_t extent_y = 5;
+  const size_t extent_z = 6;
+  dash::NArray<value_t, 3> matrix(extent_x, extent_y, extent_z);
+
+  if (dash::myid() == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        for (size_t z = 0; z < extent_z; ++z) {
+          matrix[x][y][z] = x * 100 + y * 10 + z;
+        }
+      }
+    }
+  }
+  matrix.barrier();
+
+  auto submatrix = matrix.sub<0>(1, extent_x - 1)
+                         .sub<1>(1, 3)
+                         .sub<2>(2, 3);
+  std::vector<value_t> local_copy((extent_x - 1) * 3 * 3);
+  auto copy_last = dash::copy(submatrix.begin(),
+                              submatrix.end(),
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.size(), copy_last - local_copy.data());
+  size_t i = 0;
+  for (size_t x = 1; x < extent_x; ++x) {
+    for (size_t y = 1; y < 4; ++y) {
+      for (size_t z = 2; z < 5; ++z) {
+        EXPECT_EQ_U(x * 100 + y * 10 + z, local_copy[i++]);
+      }
+    }
+  }
+  matrix.barrier();
+}
+
+TEST_F(CopyTest, AsyncGlobalToLocalSubMatrix)
+{
+  typedef int value_t;
+
+  const size_t extent_x = 3 * _dash_size;
+  const size_t extent_y = 8;
+  dash::Matrix<value_t, 2> matrix(extent_x, extent_y);
+
+  if (dash::myid() == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        matrix[x][y] = x * 100 + y;
+      }
+    }
+  }
+  matrix.barrier();
+
+  // Columns 2..5 of all rows, rows are contiguous at their unit:
+  auto submatrix = matrix.sub<1>(2, 4);
+  std::vector<value_t> local_copy(extent_x * 4);
+  auto fut = dash::copy_async(submatrix.begin(),
+                              submatrix.end(),
+                              local_copy.data());
+  auto copy_last = fut.get();
+  EXPECT_EQ_U(local_copy.size(), copy_last - local_copy.data());
+  for (size_t x = 0; x < extent_x; ++x) {
+    for (size_t y = 0; y < 4; ++y) {
+      EXPECT_EQ_U(x * 100 + y + 2, local_copy[x * 4 + y]);
+    }
+  }
+  matrix.barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalShift)
+{
+  typedef int value_t;
+
+  const size_t num_elem_per_unit = 10;
+  const size_t shift             = 3;
+  dash::Array<value_t> array(num_elem_per_unit * _dash_size);
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  // Overlapping source and destination range crossing unit boundaries:
+  auto copy_last = dash::copy(array.begin(),
+                              array.end() - shift,
+                              array.begin() + shift);
+  EXPECT_EQ_U(array.size(), copy_last.pos());
+  for (size_t i = 0; i < array.size(); ++i) {
+    value_t expected = (i < shift) ? i : i - shift;
+    EXPECT_EQ_U(expected, static_cast<value_t>(array[i]));
+  }
+  array.barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalPatterns)
+{
+  typedef double value_t;
+
+  const size_t num_elem_per_unit = 17;
+  const size_t num_elem_total    = num_elem_per_unit * _dash_size;
+  dash::Array<value_t> src(num_elem_total, dash::BLOCKED);
+  dash::Array<value_t> dst(num_elem_total + 5, dash::BLOCKCYCLIC(3));
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    src.local[l] = src.pattern().global(l);
+  }
+  std::fill(dst.lbegin(), dst.lend(), -1.0);
+  dst.barrier();
+
+  // Plan is reused for repeated copies:
+  auto plan = dash::make_copy_plan(src.begin() + 1, src.end(),
+                                   dst.begin() + 4);
+  EXPECT_EQ_U(num_elem_total - 1, plan.size());
+  for (int rep = 0; rep < 2; ++rep) {
+    auto copy_last = dash::copy(src.begin() + 1, src.end(),
+                                dst.begin() + 4, plan);
+    EXPECT_EQ_U(num_elem_total + 3, copy_last.pos());
+    for (size_t i = 0; i < dst.size(); ++i) {
+      value_t expected = (i < 4 || i >= num_elem_total + 3)
+                         ? -1.0
+                         : rep * 1000.0 + (i - 3);
+      EXPECT_EQ_U(expected, static_cast<value_t>(dst[i]));
+    }
+    dst.barrier();
+    for (size_t l = 0; l < num_elem_per_unit; ++l) {
+      src.local[l] += 1000.0;
+    }
+  }
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalSubMatrix)
+{
+  typedef int value_t;
+
+  const size_t extent_x = 4 * _dash_size;
+  const size_t extent_y = 6;
+  dash::Matrix<value_t, 2> matrix_a(extent_x, extent_y);
+  dash::Matrix<value_t, 2> matrix_b(extent_x, extent_y);
+  if (dash::myid() == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        matrix_a[x][y] = x * 100 + y;
+        matrix_b[x][y] = -1;
+      }
+    }
+  }
+  matrix_a.barrier();
+
+  // Columns 1..3 of matrix_a to columns 2..4 of matrix_b:
+  auto sub_a = matrix_a.sub<1>(1, 3);
+  auto sub_b = matrix_b.sub<1>(2, 3);
+  dash::copy(sub_a.begin(), sub_a.end(), sub_b.begin());
+  for (size_t x = 0; x < extent_x; ++x) {
+    for (size_t y = 0; y < extent_y; ++y) {
+      value_t expected = (y >= 2 && y < 5) ? x * 100 + y - 1 : -1;
+      EXPECT_EQ_U(expected, static_cast<value_t>(matrix_b[x][y]));
+    }
+  }
+  matrix_b.barrier();
+}
+
+TEST_F(CopyTest, LocalCopyKernels)
+{
+  auto & thresholds = dash::internal::local_copy_thresholds();
+  auto   defaults   = thresholds;
+  // Select the streaming and the parallel kernel for small copies:
+  thresholds.streaming_bytes  = 256;
+  thresholds.parallel_bytes   = 4096;
+  thresholds.parallel_threads = 3;
+
+  // Sizes below, between and above the thresholds, none a multiple of
+  // 64 bytes:
+  const size_t max_bytes = 64 * 1024 + 37;
+  std::vector<char> src(max_bytes + 16);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<char>((i * 7 + 3) % 251);
+  }
+  // 4225 and 4226 bytes split among 3 threads have a floored quotient
+  // that is a multiple of 64 bytes:
+  for (size_t nbytes : { size_t(100), size_t(300), size_t(4100),
+                         size_t(4225), size_t(4226), max_bytes }) {
+    // Destination offsets not aligned to 16 bytes:
+    for (size_t dst_offset : { 0, 1, 5, 13 }) {
+      std::vector<char> dst(max_bytes + 32, 0);
+      dash::internal::copy_bytes(dst.data() + dst_offset, src.data() + 3,
+                                 nbytes);
+      auto   mismatch = std::mismatch(src.begin() + 3,
+                                      src.begin() + 3 + nbytes,
+                                      dst.begin() + dst_offset);
+      size_t ncopied  = mismatch.first - (src.begin() + 3);
+      EXPECT_EQ_U(nbytes, ncopied);
+      // Bytes outside of the destination range are not written:
+      size_t nzero    = std::count(dst.begin(), dst.begin() + dst_offset, 0)
+                        + std::count(dst.begin() + dst_offset + nbytes,
+                                     dst.end(), 0);
+      EXPECT_EQ_U(dst.size() - nbytes, nzero);
+    }
+  }
+  thresholds = defaults;
+}
+
+TEST_F(CopyTest, StreamGlobalToLocal)
+{
+  typedef int value_t;
+
+  const size_t num_elem_per_unit = 100;
+  const size_t num_elem_total    = num_elem_per_unit * _dash_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKCYCLIC(7));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  dash::CopyStreamConfig config;
+  config.chunk_size    = 3 * sizeof(value_t);
+  config.max_in_flight = 2;
+  std::vector<value_t> local_copy(num_elem_total - 5, -1);
+  auto stream = dash::copy_stream(array.begin() + 5, array.end(),
+                                  local_copy.data(), config);
+  EXPECT_EQ_U(local_copy.size(), stream.size());
+
+  size_t num_received = 0;
+  dash::LocalRange<value_t> chunk;
+  while (stream.next(chunk)) {
+    EXPECT_LE_U(stream.num_in_flight(), config.max_in_flight);
+    for (auto it = chunk.begin; it != chunk.end; ++it) {
+      // Chunk elements are complete when the chunk is returned:
+      EXPECT_EQ_U((it - local_copy.data()) + 5, *it);
+    }
+    num_received += chunk.end - chunk.begin;
+  }
+  EXPECT_TRUE_U(stream.done());
+  EXPECT_EQ_U(local_copy.size(), num_received);
+  array.barrier();
+}
+
+TEST_F(CopyTest, StreamMoveAssignment)
+{
+  typedef int value_t;
+
+  const size_t num_elem_per_unit = 100;
+  const size_t num_elem_total    = num_elem_per_unit * _dash_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKCYCLIC(7));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  dash::CopyStreamConfig config;
+  config.chunk_size    = 3 * sizeof(value_t);
+  config.max_in_flight = 2;
+  std::vector<value_t> copy_a(num_elem_total, -1);
+  std::vector<value_t> copy_b(num_elem_total, -1);
+  auto stream = dash::copy_stream(array.begin(), array.end(),
+                                  copy_a.data(), config);
+  // Transfers in flight of the assigned stream are completed:
+  stream = dash::copy_stream(array.begin(), array.end(),
+                             copy_b.data(), config);
+  stream.wait();
+  EXPECT_TRUE_U(stream.done());
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(g, copy_b[g]);
+  }
+  array.barrier();
+}
+
+TEST_F(CopyTest, ChunkedGlobalToLocal)
+{
+  typedef double value_t;
+
+  const size_t num_elem_per_unit = 64;
+  const size_t num_elem_total    = num_elem_per_unit * _dash_size;
+  dash::Array<value_t> array(num_elem_total);
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = dash::myid() + 0.01 * l;
+  }
+  array.barrier();
+
+  dash::CopyStreamConfig config;
+  config.chunk_size = 16 * sizeof(value_t);
+  std::vector<value_t> local_copy(num_elem_total);
+  size_t num_chunks   = 0;
+  size_t num_received = 0;
+  auto copy_last = dash::copy_chunked(
+                     array.begin(), array.end(), local_copy.data(),
+                     [&](value_t * first, value_t * last) {
+                       ++num_chunks;
+                       num_received += last - first;
+                     },
+                     config);
+  EXPECT_EQ_U(local_copy.data() + num_elem_total, copy_last);
+  EXPECT_EQ_U(num_elem_total, num_received);
+  // Local block is copied in a single chunk:
+  EXPECT_EQ_U(1 + (_dash_size - 1) * (num_elem_per_unit / 16), num_chunks);
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    EXPECT_EQ_U((i / num_elem_per_unit) + 0.01 * (i % num_elem_per_unit),
+                local_copy[i]);
+  }
+  array.barrier();
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
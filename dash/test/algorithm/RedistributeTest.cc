@@ -0,0 +1,89 @@
+#include "RedistributeTest.h"
+#include "../TestContainerHelpers.h"
+
+#include <dash/algorithm/Redistribute.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/pattern/TilePattern.h>
+#include <dash/pattern/CSRPattern.h>
+
+#include <array>
+#include <vector>
+
+using dash::test::fill_linear;
+using dash::test::verify_linear;
+
+TEST_F(RedistributeTest, BlockedToBlockCyclic)
+{
+  auto ext = dash::size() * 23 + 5;
+
+  dash::Array<int> src(ext, dash::BLOCKED);
+  dash::Array<int> dst(ext, dash::BLOCKCYCLIC(3));
+  fill_linear(src, 42);
+
+  dash::redistribute(src, dst);
+  verify_linear(dst, 42);
+}
+
+TEST_F(RedistributeTest, CSRToBlocked)
+{
+  typedef dash::CSRPattern<1>                   pattern_t;
+  typedef typename pattern_t::size_type         extent_t;
+  typedef typename pattern_t::index_type        index_t;
+
+  std::vector<extent_t> local_sizes;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    local_sizes.push_back((u % 3) * 7 + 1);
+  }
+  pattern_t pattern(local_sizes);
+  dash::Array<int, index_t, pattern_t> src(pattern);
+  dash::Array<int, index_t>            dst(pattern.size(), dash::BLOCKED);
+  fill_linear(src, 3);
+
+  dash::redistribute(src, dst);
+  verify_linear(dst, 3);
+
+  // and back
+  fill_linear(dst, 5);
+  dash::redistribute(dst, src);
+  verify_linear(src, 5);
+}
+
+TEST_F(RedistributeTest, MatrixBlockedToTile)
+{
+  typedef dash::TilePattern<2>  tile_pattern_t;
+  typedef dash::Pattern<2>      block_pattern_t;
+
+  dash::TeamSpec<2> teamspec(dash::size(), 1);
+  teamspec.balance_extents();
+
+  auto ext_x = teamspec.extent(0) * 8;
+  auto ext_y = teamspec.extent(1) * 6;
+
+  block_pattern_t src_pattern(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+    dash::TeamSpec<2>(dash::size(), 1));
+  tile_pattern_t  dst_pattern(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::TILE(4), dash::TILE(3)),
+    teamspec);
+
+  dash::Matrix<int, 2, long, block_pattern_t> src(src_pattern);
+  dash::Matrix<int, 2, long, tile_pattern_t>  dst(dst_pattern);
+
+  auto plan = dash::make_redistribution_plan(src, dst);
+  // Rows of a tile are located at the same unit in the source pattern
+  // and should be transferred in a single strided operation:
+  for (const auto & t : plan.transfers()) {
+    EXPECT_EQ_U(3, t.nelem);
+  }
+  EXPECT_LE_U(plan.transfers().size(), dst.local_size() / 3);
+
+  // Repeated redistribution using the same plan
+  for (int i = 0; i < 3; ++i) {
+    fill_linear(src, i);
+    dash::redistribute(src, dst, plan);
+    verify_linear(dst, i);
+  }
+}
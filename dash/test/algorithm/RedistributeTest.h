@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__REDISTRIBUTE_TEST_H_
+#define DASH__TEST__REDISTRIBUTE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::redistribute.
+ */
+class RedistributeTest : public dash::test::TestBase {
+protected:
+
+  RedistributeTest() {
+  }
+
+  virtual ~RedistributeTest() {
+  }
+};
+#endif // DASH__TEST__REDISTRIBUTE_TEST_H_
@@ -276,3 +276,77 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
 
   dash::barrier();
 }
+
+TEST_F(SUMMATest, LocalGEMMBackends)
+{
+  typedef double value_t;
+
+  // Extents not divisible by the micro-kernel tile and block sizes:
+  long long m = 103;
+  long long n = 71;
+  long long k = 301;
+
+  std::vector<value_t> a(m * k);
+  std::vector<value_t> b(k * n);
+  for (long long i = 0; i < m * k; ++i) {
+    a[i] = static_cast<value_t>((i * 7) % 13) - 6;
+  }
+  for (long long i = 0; i < k * n; ++i) {
+    b[i] = static_cast<value_t>((i * 5) % 11) - 5;
+  }
+
+  // Backend selection to be restored after testing every backend:
+  bool        backend_set  = dash::util::Config::is_set("DASH_GEMM_BACKEND");
+  std::string backend_prev = backend_set
+                             ? dash::util::Config::get<std::string>(
+                                 "DASH_GEMM_BACKEND")
+                             : std::string();
+  for (auto storage : { dash::ROW_MAJOR, dash::COL_MAJOR }) {
+    // Reference result, C is initialized to 1 to verify C += A x B:
+    std::vector<value_t> c_exp(m * n, 1);
+    for (long long i = 0; i < m; ++i) {
+      for (long long j = 0; j < n; ++j) {
+        value_t sum = 0;
+        for (long long p = 0; p < k; ++p) {
+          sum += (storage == dash::ROW_MAJOR)
+                 ? a[i * k + p] * b[p * n + j]
+                 : a[p * m + i] * b[j * k + p];
+        }
+        auto c_idx = (storage == dash::ROW_MAJOR) ? i * n + j : j * m + i;
+        c_exp[c_idx] += sum;
+      }
+    }
+    for (auto backend : { dash::gemm_backend::builtin,
+                          dash::gemm_backend::blas }) {
+      if (!dash::gemm_backend_available(backend)) {
+        continue;
+      }
+      dash::util::Config::set("DASH_GEMM_BACKEND",
+                              dash::gemm_backend_name(backend));
+      EXPECT_EQ_U(backend, dash::summa_gemm_backend());
+
+      std::vector<value_t> c(m * n, 1);
+      dash::internal::mmult_local<value_t>(
+        a.data(), b.data(), c.data(), m, n, k, storage);
+      for (long long i = 0; i < m * n; ++i) {
+        ASSERT_EQ_U(c_exp[i], c[i]);
+      }
+    }
+  }
+  if (backend_set) {
+    dash::util::Config::set("DASH_GEMM_BACKEND", backend_prev);
+  } else {
+    dash::util::Config::unset("DASH_GEMM_BACKEND");
+  }
+
+  // Multithreaded built-in kernel:
+  std::vector<value_t> c_seq(m * n, 0);
+  std::vector<value_t> c_par(m * n, 0);
+  dash::internal::gemm_builtin(a.data(), b.data(), c_seq.data(), m, n, k,
+                               dash::ROW_MAJOR, 1);
+  dash::internal::gemm_builtin(a.data(), b.data(), c_par.data(), m, n, k,
+                               dash::ROW_MAJOR, 4);
+  for (long long i = 0; i < m * n; ++i) {
+    ASSERT_EQ_U(c_seq[i], c_par[i]);
+  }
+}
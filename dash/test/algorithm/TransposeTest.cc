@@ -0,0 +1,132 @@
+#include "TransposeTest.h"
+
+#include <dash/algorithm/Transpose.h>
+#include <dash/Matrix.h>
+#include <dash/pattern/TilePattern.h>
+
+#include <array>
+#include <vector>
+
+/**
+ * Assigns the value 1000 * row + col to every element.
+ */
+template <class MatrixT>
+void fill_coords(MatrixT & matrix)
+{
+  auto & pattern = matrix.pattern();
+  for (size_t g = 0; g < pattern.size(); ++g) {
+    auto gcoords = pattern.coords(g);
+    auto lpos    = pattern.local_index(gcoords);
+    if (lpos.unit == pattern.team().myid()) {
+      matrix.lbegin()[lpos.index] = 1000 * gcoords[0] + gcoords[1];
+    }
+  }
+  matrix.barrier();
+}
+
+/**
+ * Checks that every element has the value 1000 * col + row.
+ */
+template <class MatrixT>
+void verify_transposed(MatrixT & matrix)
+{
+  auto & pattern = matrix.pattern();
+  for (size_t g = 0; g < pattern.size(); ++g) {
+    auto gcoords = pattern.coords(g);
+    auto lpos    = pattern.local_index(gcoords);
+    if (lpos.unit == pattern.team().myid()) {
+      ASSERT_EQ_U(1000 * gcoords[1] + gcoords[0],
+                  matrix.lbegin()[lpos.index]);
+    }
+  }
+  matrix.barrier();
+}
+
+TEST_F(TransposeTest, LocalKernel)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  size_t rows = 45;
+  size_t cols = 71;
+  std::vector<int> in(rows * (cols + 3));
+  std::vector<int> out(cols * rows);
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < cols; ++j) {
+      in[i * (cols + 3) + j] = 1000 * i + j;
+    }
+  }
+  dash::internal::transpose_local(
+    in.data(), rows, cols, cols + 3, out.data(), rows);
+  for (size_t j = 0; j < cols; ++j) {
+    for (size_t i = 0; i < rows; ++i) {
+      ASSERT_EQ_U(1000 * i + j, out[j * rows + i]);
+    }
+  }
+}
+
+TEST_F(TransposeTest, BlockedRectangular)
+{
+  auto ext_x = dash::size() * 5 + 3;
+  auto ext_y = dash::size() * 3 + 1;
+
+  dash::Matrix<int, 2> src(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE));
+  dash::Matrix<int, 2> dst(
+    dash::SizeSpec<2>(ext_y, ext_x),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE));
+
+  fill_coords(src);
+  dash::transpose(src, dst);
+  verify_transposed(dst);
+}
+
+TEST_F(TransposeTest, TileToBlocked)
+{
+  typedef dash::TilePattern<2> pattern_t;
+  typedef dash::Matrix<int, 2, long, pattern_t> matrix_t;
+
+  dash::TeamSpec<2> teamspec(dash::size(), 1);
+  teamspec.balance_extents();
+
+  auto ext_x = teamspec.extent(0) * 8;
+  auto ext_y = teamspec.extent(1) * 12;
+
+  pattern_t pattern(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::TILE(4), dash::TILE(6)),
+    teamspec);
+  matrix_t src(pattern);
+  dash::Matrix<int, 2> dst(
+    dash::SizeSpec<2>(ext_y, ext_x),
+    dash::DistributionSpec<2>(dash::NONE, dash::BLOCKED));
+
+  auto plan = dash::make_transpose_plan(src, dst);
+  for (int i = 0; i < 2; ++i) {
+    fill_coords(src);
+    dash::transpose(src, dst, plan);
+    verify_transposed(dst);
+  }
+}
+
+TEST_F(TransposeTest, InPlace)
+{
+  typedef dash::TilePattern<2> pattern_t;
+  typedef dash::Matrix<int, 2, long, pattern_t> matrix_t;
+
+  dash::TeamSpec<2> teamspec(dash::size(), 1);
+  teamspec.balance_extents();
+
+  auto ext = teamspec.extent(0) * teamspec.extent(1) * 6;
+
+  pattern_t pattern(
+    dash::SizeSpec<2>(ext, ext),
+    dash::DistributionSpec<2>(dash::TILE(3), dash::TILE(3)),
+    teamspec);
+  matrix_t matrix(pattern);
+
+  fill_coords(matrix);
+  dash::transpose(matrix);
+  verify_transposed(matrix);
+}
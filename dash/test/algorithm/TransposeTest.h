@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__TRANSPOSE_TEST_H_
+#define DASH__TEST__TRANSPOSE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::transpose.
+ */
+class TransposeTest : public dash::test::TestBase {
+protected:
+
+  TransposeTest() {
+  }
+
+  virtual ~TransposeTest() {
+  }
+};
+#endif // DASH__TEST__TRANSPOSE_TEST_H_
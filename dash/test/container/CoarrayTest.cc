@@ -546,3 +546,83 @@ TEST_F(CoarrayTest, CoEventIter)
     events.wait(num_images());
   }
 }
+
+TEST_F(CoarrayTest, CoEventWaitAnyAll)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("This test requires at least 2 units");
+  }
+  auto myid   = static_cast<int>(this_image());
+  auto nunits = static_cast<int>(num_images());
+  auto right  = (myid + 1) % nunits;
+  auto left   = (myid + nunits - 1) % nunits;
+
+  dash::Coevent from_left;
+  dash::Coevent from_right;
+
+  ASSERT_FALSE_U(from_left.try_wait());
+  ASSERT_EQ_U(0, from_left.test());
+  dash::barrier();
+
+  from_left(right).post();
+  from_right(left).post();
+  dash::wait_all({ from_left, from_right });
+
+  ASSERT_FALSE_U(from_left.try_wait());
+  ASSERT_FALSE_U(from_right.try_wait());
+  dash::barrier();
+
+  if(myid == 0){
+    from_right(1).post();
+    from_right(1).post();
+  }
+  if(myid == 1){
+    auto idx = dash::wait_any({ from_left, from_right });
+    ASSERT_EQ_U(1, idx);
+    std::vector<std::reference_wrapper<dash::Coevent>> events {
+      from_left, from_right };
+    auto it = dash::wait_any(events.begin(), events.end());
+    ASSERT_EQ_U(events.begin() + 1, it);
+    ASSERT_FALSE_U(from_right.try_wait());
+  }
+  dash::barrier();
+}
+
+TEST_F(CoarrayTest, SyncImagesNeighbors)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("This test requires at least 2 units");
+  }
+  auto myid   = static_cast<int>(this_image());
+  auto nunits = static_cast<int>(num_images());
+  auto right  = (myid + 1) % nunits;
+  auto left   = (myid + nunits - 1) % nunits;
+
+  // the calling image is part of the image set:
+  std::vector<int> neighbors { left, myid, right };
+  dash::Coarray<int> x;
+  x = -1;
+  sync_all();
+
+  for(int it = 0; it < 20; ++it){
+    // write to right neighbor, read value of left neighbor:
+    x(right) = it * nunits + myid;
+    sync_images(neighbors);
+    ASSERT_EQ_U(it * nunits + left, static_cast<int>(x));
+    sync_images(neighbors);
+  }
+
+  // every unit increments the counter of every unit once per round,
+  // counters must be complete after sync_all:
+  dash::Array<dash::Atomic<int>> counts(nunits);
+  counts.local[0] = dash::Atomic<int>(0);
+  sync_all();
+  for(int it = 1; it <= 5; ++it){
+    for(int u = 0; u < nunits; ++u){
+      counts[u].add(1);
+    }
+    sync_all();
+    ASSERT_EQ_U(it * nunits, counts[myid].load());
+    sync_all();
+  }
+}
@@ -96,3 +96,66 @@ TEST_F(ListTest, Initialization)
   }
 }
 
+
+TEST_F(ListTest, PushBackPopBack)
+{
+  typedef int value_t;
+
+  auto nunits  = dash::size();
+  auto myid    = dash::myid();
+  // Number of elements appended by every unit, exceeds the local buffer
+  // size to force re-allocation at the last unit:
+  int  nappend = 100;
+
+  dash::List<value_t> list(nunits, 8);
+
+  for (int i = 0; i < nappend; ++i) {
+    list.push_back(1000 * myid + i);
+  }
+  // Appends are not visible before barrier:
+  EXPECT_EQ_U(0, list.size());
+  list.barrier();
+
+  EXPECT_EQ_U(nappend * nunits, list.size());
+  if (myid == nunits - 1) {
+    EXPECT_EQ_U(nappend * nunits, list.lsize());
+  } else {
+    EXPECT_EQ_U(0, list.lsize());
+  }
+
+  // Elements of all units are appended at the last unit, ordered by unit:
+  for (size_t li = 0; li < list.lsize(); ++li) {
+    auto    node   = *(list.local.begin() + li);
+    value_t expect = 1000 * (li / nappend) + (li % nappend);
+    EXPECT_EQ_U(expect, node.value);
+  }
+
+  // Cancels own append of the same epoch:
+  list.push_back(-1);
+  list.pop_back();
+  // Removes two elements at the end of the list at the barrier:
+  if (myid == 0) {
+    list.pop_back();
+    list.pop_back();
+  }
+  list.barrier();
+
+  EXPECT_EQ_U(nappend * nunits - 2, list.size());
+  if (myid == nunits - 1) {
+    EXPECT_EQ_U(nappend * nunits - 2, list.lsize());
+    auto last = *(list.local.begin() + (list.lsize() - 1));
+    EXPECT_EQ_U(1000 * (nunits - 1) + nappend - 3, last.value);
+    EXPECT_EQ_U(nullptr, last.lnext);
+  }
+
+  // Removed slots are reused by subsequent appends:
+  if (myid == 0) {
+    list.push_back(-2);
+  }
+  list.barrier();
+  EXPECT_EQ_U(nappend * nunits - 1, list.size());
+  if (myid == nunits - 1) {
+    auto last = *(list.local.begin() + (list.lsize() - 1));
+    EXPECT_EQ_U(-2, last.value);
+  }
+}
@@ -0,0 +1,194 @@
+#include "ReadCacheTest.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/memory/ReadCache.h>
+#include <dash/algorithm/CopyStream.h>
+
+
+TEST_F(ReadCacheTest, BlocksHitMiss)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t nlocal = 100;
+  dash::Array<int> array(nlocal * dash::size());
+  for (size_t li = 0; li < nlocal; ++li) {
+    array.local[li] = dash::myid() * 1000 + li;
+  }
+  array.barrier();
+
+  // Units in the tests run on the same node, cache their memory anyway:
+  dash::ReadCacheConfig config;
+  config.block_size = 64;
+  config.num_blocks = 4;
+  config.node_local = true;
+  array.enable_read_cache(config);
+  ASSERT_TRUE_U(array.read_cache() != nullptr);
+
+  auto   neighbor  = (dash::myid() + 1) % dash::size();
+  // 100 ints in blocks of 16 ints:
+  size_t nblocks   = (nlocal * sizeof(int) + 63) / 64;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (size_t li = 0; li < nlocal; ++li) {
+      int value = array[neighbor * nlocal + li];
+      EXPECT_EQ_U(neighbor * 1000 + li, value);
+    }
+  }
+  // Blocks 0..6 in 4 lines: the first pass fetches all 7 blocks and
+  // evicts blocks 0..2, the second pass only hits block 3.
+  ASSERT_EQ_U(7, nblocks);
+  auto stats = array.read_cache()->stats();
+  EXPECT_EQ_U(13, stats.misses);
+  EXPECT_EQ_U(2 * nlocal - 13, stats.hits);
+  EXPECT_EQ_U(9, stats.evictions);
+
+  // Local elements are not cached:
+  array.read_cache()->reset_stats();
+  EXPECT_EQ_U(dash::myid() * 1000, array[dash::myid() * nlocal]);
+  EXPECT_EQ_U(0, array.read_cache()->stats().hits);
+  EXPECT_EQ_U(0, array.read_cache()->stats().misses);
+  array.barrier();
+
+  array.disable_read_cache();
+  EXPECT_TRUE_U(array.read_cache() == nullptr);
+}
+
+TEST_F(ReadCacheTest, InvalidateAtBarrier)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t nlocal = 10;
+  dash::Array<int> array(nlocal * dash::size());
+  for (size_t li = 0; li < nlocal; ++li) {
+    array.local[li] = 1;
+  }
+  array.barrier();
+
+  dash::ReadCacheConfig config;
+  config.node_local = true;
+  array.enable_read_cache(config);
+
+  auto neighbor = (dash::myid() + 1) % dash::size();
+  EXPECT_EQ_U(1, static_cast<int>(array[neighbor * nlocal]));
+  // Make sure all units have cached their neighbor's values:
+  dash::Team::All().barrier();
+
+  // Write of the calling unit updates its cached copy:
+  array[neighbor * nlocal + 1] = 2;
+  EXPECT_EQ_U(2, static_cast<int>(array[neighbor * nlocal + 1]));
+  array.barrier();
+
+  // Other units' writes are visible after barrier:
+  array.local[0] = 3;
+  array.barrier();
+  EXPECT_EQ_U(3, static_cast<int>(array[neighbor * nlocal]));
+  EXPECT_GT_U(array.read_cache()->stats().invalidations, 0);
+  array.barrier();
+}
+
+TEST_F(ReadCacheTest, Replicated)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t nlocal = 50;
+  dash::Array<double> array(nlocal * dash::size());
+  for (size_t li = 0; li < nlocal; ++li) {
+    array.local[li] = dash::myid() + 0.5 * li;
+  }
+  array.barrier();
+
+  dash::ReadCacheConfig config;
+  config.mode       = dash::ReadCacheMode::replicated;
+  config.node_local = true;
+  array.enable_read_cache(config);
+  EXPECT_EQ_U((dash::size() - 1) * nlocal * sizeof(double),
+              array.read_cache()->capacity());
+
+  for (size_t gi = 0; gi < array.size(); ++gi) {
+    double value = array[gi];
+    EXPECT_EQ_U((gi / nlocal) + 0.5 * (gi % nlocal), value);
+  }
+  auto stats = array.read_cache()->stats();
+  EXPECT_EQ_U(dash::size() - 1, stats.misses);
+  EXPECT_EQ_U((dash::size() - 1) * nlocal, stats.hits);
+  array.barrier();
+
+  // Replicas are only invalidated explicitly:
+  array.local[0] = -1.0;
+  array.barrier();
+  auto neighbor = (dash::myid() + 1) % dash::size();
+  EXPECT_EQ_U(neighbor * 1.0, static_cast<double>(array[neighbor * nlocal]));
+  array.read_cache()->invalidate();
+  EXPECT_EQ_U(-1.0, static_cast<double>(array[neighbor * nlocal]));
+  array.barrier();
+}
+
+TEST_F(ReadCacheTest, Matrix)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t extent_x = 4 * dash::size();
+  const size_t extent_y = 8;
+  dash::Matrix<int, 2> matrix(extent_x, extent_y);
+  if (dash::myid() == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        matrix[x][y] = x * 100 + y;
+      }
+    }
+  }
+  matrix.barrier();
+
+  dash::ReadCacheConfig config;
+  config.node_local = true;
+  matrix.enable_read_cache(config);
+  for (size_t x = 0; x < extent_x; ++x) {
+    for (size_t y = 0; y < extent_y; ++y) {
+      EXPECT_EQ_U(x * 100 + y, static_cast<int>(matrix[x][y]));
+    }
+  }
+  EXPECT_GT_U(matrix.read_cache()->stats().hits, 0);
+  matrix.barrier();
+}
+
+TEST_F(ReadCacheTest, Prefetch)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  const size_t nlocal = 64;
+  dash::Array<int> array(nlocal * dash::size());
+  for (size_t li = 0; li < nlocal; ++li) {
+    array.local[li] = dash::myid() * 1000 + li;
+  }
+  array.barrier();
+
+  // Without read cache, prefetching has no effect:
+  EXPECT_FALSE_U(dash::prefetch(array));
+
+  dash::ReadCacheConfig config;
+  config.block_size = 64;
+  config.num_blocks = 16;
+  config.node_local = true;
+  array.enable_read_cache(config);
+
+  auto neighbor = (dash::myid() + 1) % dash::size();
+  auto first    = array.begin() + neighbor * nlocal;
+  // 64 ints in 4 blocks of 16 ints:
+  EXPECT_TRUE_U(dash::prefetch(first, first + nlocal));
+  EXPECT_EQ_U(4, array.read_cache()->stats().prefetches);
+  // Blocks are not prefetched twice:
+  EXPECT_TRUE_U(dash::prefetch(first, first + nlocal));
+  EXPECT_EQ_U(4, array.read_cache()->stats().prefetches);
+  for (size_t li = 0; li < nlocal; ++li) {
+    EXPECT_EQ_U(neighbor * 1000 + li, static_cast<int>(*(first + li)));
+  }
+  auto stats = array.read_cache()->stats();
+  EXPECT_EQ_U(0, stats.misses);
+  EXPECT_EQ_U(nlocal, stats.hits);
+  array.barrier();
+}
@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__READ_CACHE_TEST_H_
+#define DASH__TEST__READ_CACHE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::ReadCache
+ */
+class ReadCacheTest : public dash::test::TestBase {
+protected:
+
+  ReadCacheTest() {
+    LOG_MESSAGE(">>> Test suite: ReadCacheTest");
+  }
+
+  virtual ~ReadCacheTest()
+  {
+    LOG_MESSAGE("<<< Closing test suite: ReadCacheTest");
+  }
+};
+
+#endif // DASH__TEST__READ_CACHE_TEST_H_
@@ -1,7 +1,9 @@
 
 #include <gtest/gtest.h>
 
-// #include <dash/Vector.h>
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/Vector.h>
 
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/Fill.h>
@@ -13,6 +15,161 @@
 #include "VectorTest.h"
 
 
+TEST_F(VectorTest, GrowWithoutRelocation)
+{
+  const size_t initial = 4;
+  const size_t nappend = 1000;
+  dash::Vector<int> vec(initial);
+  int * lbegin = vec.lbegin();
+  for (size_t i = 0; i < initial; ++i) {
+    lbegin[i] = _dash_id * 10000 + i;
+  }
+
+  for (size_t i = initial; i < initial + nappend; ++i) {
+    vec.lpush_back(_dash_id * 10000 + i);
+  }
+  vec.commit();
+  vec.barrier();
+
+  // Elements are not moved when the vector grows:
+  EXPECT_EQ_U(lbegin, vec.lbegin());
+  EXPECT_EQ_U(initial + nappend, vec.lsize());
+  EXPECT_GE_U(vec.lcapacity(), initial + nappend);
+  EXPECT_EQ_U((initial + nappend) * _dash_size, vec.size());
+  for (size_t i = 0; i < initial + nappend; ++i) {
+    EXPECT_EQ_U(static_cast<int>(_dash_id * 10000 + i), vec.lbegin()[i]);
+  }
+
+  // Elements in all chunks are accessible from other units:
+  auto unit = (_dash_id + 1) % _dash_size;
+  auto gidx = unit * (initial + nappend);
+  for (size_t i = 0; i < initial + nappend; i += 97) {
+    EXPECT_EQ_U(static_cast<int>(unit * 10000 + i),
+                static_cast<int>(vec[gidx + i]));
+  }
+  vec.barrier();
+}
+
+TEST_F(VectorTest, GrowWithRelocation)
+{
+  using dash::util::Config;
+
+  const size_t initial = 4;
+  const size_t nappend = 5000;
+  // Reserve a single page so growing exceeds the reserved range:
+  Config::set("DASH_VECTOR_RESERVE_SIZE", "4K");
+  dash::Vector<int> vec(initial);
+  Config::unset("DASH_VECTOR_RESERVE_SIZE");
+  Config::unset("DASH_VECTOR_RESERVE_SIZE_BYTES");
+
+  for (size_t i = 0; i < initial; ++i) {
+    vec.lbegin()[i] = _dash_id * 10000 + i;
+  }
+  for (size_t i = initial; i < initial + nappend; ++i) {
+    vec.lpush_back(_dash_id * 10000 + i);
+  }
+  vec.commit();
+  vec.barrier();
+
+  EXPECT_EQ_U(initial + nappend, vec.lsize());
+  EXPECT_GE_U(vec.lcapacity(), initial + nappend);
+  for (size_t i = 0; i < initial + nappend; ++i) {
+    EXPECT_EQ_U(static_cast<int>(_dash_id * 10000 + i), vec.lbegin()[i]);
+  }
+
+  auto unit = (_dash_id + 1) % _dash_size;
+  auto gidx = unit * (initial + nappend);
+  for (size_t i = 0; i < initial + nappend; i += 97) {
+    EXPECT_EQ_U(static_cast<int>(unit * 10000 + i),
+                static_cast<int>(vec[gidx + i]));
+  }
+  vec.barrier();
+}
+
+TEST_F(VectorTest, PushBackGlobal)
+{
+  const size_t nappend = 100;
+  dash::Vector<int> vec;
+  for (size_t i = 0; i < nappend; ++i) {
+    vec.push_back(_dash_id * nappend + i);
+  }
+  vec.commit();
+  vec.barrier();
+
+  EXPECT_EQ_U(nappend * _dash_size, vec.size());
+  if (_dash_id == _dash_size - 1) {
+    EXPECT_EQ_U(nappend * _dash_size, vec.lsize());
+    std::vector<int> values(vec.lbegin(), vec.lend());
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i < values.size(); ++i) {
+      EXPECT_EQ_U(static_cast<int>(i), values[i]);
+    }
+  } else {
+    EXPECT_EQ_U(0, vec.lsize());
+  }
+  vec.barrier();
+}
+
+TEST_F(VectorTest, PushBackBatched)
+{
+  // Exceeds the batch size of push_back, appends are written to global
+  // memory in multiple batches:
+  const size_t nappend = 3000;
+  dash::Vector<int> vec;
+  vec.reserve(nappend * _dash_size);
+  for (size_t i = 0; i < nappend; ++i) {
+    vec.push_back(_dash_id * nappend + i);
+  }
+  vec.barrier();
+
+  EXPECT_EQ_U(nappend * _dash_size, vec.size());
+  if (_dash_id == _dash_size - 1) {
+    EXPECT_EQ_U(nappend * _dash_size, vec.lsize());
+    // Appends of every unit keep their order:
+    std::vector<int> last_value(_dash_size, -1);
+    for (auto it = vec.lbegin(); it != vec.lend(); ++it) {
+      size_t unit = *it / nappend;
+      ASSERT_LT_U(unit, _dash_size);
+      EXPECT_LT_U(last_value[unit], *it);
+      last_value[unit] = *it;
+    }
+  }
+  vec.barrier();
+}
+
+TEST_F(VectorTest, Balance)
+{
+  // Unit u holds u * 3 + 1 elements:
+  dash::Vector<int> vec;
+  size_t first = 0;
+  for (size_t u = 0; u < _dash_id; ++u) {
+    first += u * 3 + 1;
+  }
+  for (size_t i = 0; i < _dash_id * 3 + 1; ++i) {
+    vec.lpush_back(first + i);
+  }
+  vec.commit();
+  vec.barrier();
+
+  size_t size = vec.size();
+  vec.balance();
+
+  EXPECT_EQ_U(size, vec.size());
+  size_t lsize = vec.lsize();
+  EXPECT_GE_U(lsize, size / _dash_size);
+  EXPECT_LE_U(lsize, size / _dash_size + 1);
+
+  // Global order of elements is preserved:
+  int expected = 0;
+  for (auto it = vec.begin(); it != vec.end(); ++it) {
+    EXPECT_EQ_U(expected, static_cast<int>(*it));
+    ++expected;
+  }
+  EXPECT_EQ_U(size, static_cast<size_t>(expected));
+  vec.barrier();
+}
+
+
 // // global var
 // dash::Array<int> array_global;
 //
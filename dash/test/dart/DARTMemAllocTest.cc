@@ -169,3 +169,85 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     DART_OK,
     dart_team_memfree(gptr2));
 }
+
+TEST_F(DARTMemAllocTest, HugePagesAlloc)
+{
+  typedef int value_t;
+  // more than a huge page per unit:
+  const size_t block_size = (3 << 20) / sizeof(value_t);
+
+  const dart_mempages_t kinds[] = {
+    DART_MEMPAGES_HUGE,
+    DART_MEMPAGES_HUGE_2M,
+    DART_MEMPAGES_HUGE_1G
+  };
+  for (auto pages : kinds) {
+    dart_gptr_t gptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memalloc_aligned_pages(
+          DART_TEAM_ALL, block_size, DART_TYPE_INT, pages, &gptr));
+    ASSERT_NE_U(
+      DART_GPTR_NULL,
+      gptr);
+
+    dart_gptr_t lgptr = gptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_setunit(&lgptr, dart_team_unit_t{dash::myid().id}));
+    value_t *baseptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(lgptr, (void**)&baseptr));
+    ASSERT_NE(nullptr, baseptr);
+    for (size_t i = 0; i < block_size; ++i) {
+      baseptr[i] = dash::myid().id;
+    }
+    dash::barrier();
+
+    // read the last element of the neighbor's block
+    value_t      neighbor_val;
+    dart_unit_t  neighbor_id = (dash::myid().id + 1) % dash::size();
+    dart_gptr_t  rgptr       = gptr;
+    dash::dart_storage<value_t> ds(1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_setunit(&rgptr, dart_team_unit_t{neighbor_id}));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_incaddr(&rgptr, (block_size - 1) * sizeof(value_t)));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(
+          &neighbor_val, rgptr, ds.nelem, ds.dtype, ds.dtype));
+    ASSERT_EQ_U(
+      neighbor_id,
+      neighbor_val);
+
+    dash::barrier();
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memfree(gptr));
+  }
+}
+
+TEST_F(DARTMemAllocTest, HugePagesLocalMap)
+{
+  const size_t nbytes = 3 << 20;
+  char *addr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memmap_pages(nbytes, DART_MEMPAGES_HUGE, (void**)&addr));
+  ASSERT_NE(nullptr, addr);
+  // mappings are aligned to huge pages
+  ASSERT_EQ_U(0, reinterpret_cast<uintptr_t>(addr) % (2 << 20));
+  addr[0]          = 1;
+  addr[nbytes - 1] = 1;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memunmap_pages(addr));
+  // unknown addresses are rejected
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_memunmap_pages(addr));
+}
@@ -596,3 +596,100 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+
+TEST_F(DARTOnesidedTest, SharedMemDerivedTypesMatchMPI) {
+
+  constexpr size_t num_elem_per_unit = 120;
+  constexpr size_t num_blocks        = 3;
+  constexpr size_t num_instances     = 4;
+  constexpr size_t to_stride         = 3;
+
+  std::vector<size_t> blocklens { 2, 0, 3 };
+  std::vector<size_t> offsets   { 1, 4, 6 };
+  size_t num_elems = 0;
+  for (size_t i = 0; i < num_blocks; ++i) {
+    num_elems += blocklens[i];
+  }
+  // lower bound 1 and upper bound 9 of the indexed type, the empty block
+  // does not contribute to its extent:
+  constexpr size_t type_extent = 8;
+  // transfer multiple instances of the indexed type:
+  size_t nelem = num_elems * num_instances;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (size_t i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = dash::myid() * 1000 + i;
+  }
+  dash::barrier();
+
+  dart_datatype_t from_type;
+  dart_type_create_indexed(DART_TYPE_INT, num_blocks, blocklens.data(),
+                           offsets.data(), &from_type);
+  dart_datatype_t to_type;
+  dart_type_create_strided(DART_TYPE_INT, to_stride, 1, &to_type);
+
+  // indexed-to-strided get from the right neighbor, using direct copies
+  // and MPI:
+  gptr.unitid = (dash::myid() + 1) % dash::size();
+  std::vector<int> buf_shm(num_elem_per_unit, 0);
+  std::vector<int> buf_mpi(num_elem_per_unit, 0);
+
+  dart_config_t * config;
+  dart_config(&config);
+  config->shmem_dtype_copy = 1;
+  dart_get_blocking(buf_shm.data(), gptr, nelem, from_type, to_type);
+  config->shmem_dtype_copy = 0;
+  dart_get_blocking(buf_mpi.data(), gptr, nelem, from_type, to_type);
+  config->shmem_dtype_copy = 1;
+
+  for (size_t i = 0; i < num_elem_per_unit; ++i) {
+    ASSERT_EQ_U(buf_mpi[i], buf_shm[i]);
+  }
+  size_t idx = 0;
+  for (size_t inst = 0; inst < num_instances; ++inst) {
+    for (size_t b = 0; b < num_blocks; ++b) {
+      for (size_t j = 0; j < blocklens[b]; ++j) {
+        int expected = gptr.unitid * 1000 + inst * type_extent + offsets[b] + j;
+        ASSERT_EQ_U(expected, buf_shm[idx * to_stride]);
+        ++idx;
+      }
+    }
+  }
+
+  dash::barrier();
+
+  // strided-to-indexed put to the right neighbor:
+  std::vector<int> src(num_elem_per_unit);
+  for (size_t i = 0; i < num_elem_per_unit; ++i) {
+    src[i] = -static_cast<int>(i);
+  }
+  dart_put_blocking(gptr, src.data(), nelem, to_type, from_type);
+  dart_flush_all(gptr);
+
+  dash::barrier();
+
+  idx = 0;
+  for (size_t inst = 0; inst < num_instances; ++inst) {
+    for (size_t b = 0; b < num_blocks; ++b) {
+      for (size_t j = 0; j < blocklens[b]; ++j) {
+        ASSERT_EQ_U(-static_cast<int>(idx * to_stride),
+                    local_ptr[inst * type_extent + offsets[b] + j]);
+        ++idx;
+      }
+    }
+  }
+
+  dart_type_destroy(&from_type);
+  dart_type_destroy(&to_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+}
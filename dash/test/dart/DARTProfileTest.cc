@@ -0,0 +1,139 @@
+#include "DARTProfileTest.h"
+
+#include <dash/util/CommProfile.h>
+#include <dash/Array.h>
+#include <dash/dart/if/dart.h>
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+TEST_F(DARTProfileTest, OpNames) {
+  std::set<std::string> names;
+  for (int op = 0; op < DART_PROFILE_NUM_OPS; ++op) {
+    std::string name = dart_profile_op_name(static_cast<dart_profile_op_t>(op));
+    ASSERT_NE_U("unknown", name);
+    names.insert(name);
+  }
+  ASSERT_EQ_U(static_cast<size_t>(DART_PROFILE_NUM_OPS), names.size());
+  ASSERT_EQ_U(
+    std::string("unknown"),
+    dart_profile_op_name(DART_PROFILE_NUM_OPS));
+}
+
+TEST_F(DARTProfileTest, CountOneSidedOperations) {
+  constexpr int      num_puts = 10;
+  constexpr uint64_t nputs    = num_puts;
+  dart_gptr_t        gptr     = DART_GPTR_NULL;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(DART_TEAM_ALL, num_puts, DART_TYPE_INT,
+                               &gptr));
+  dash::barrier();
+  dash::util::CommProfile::reset();
+
+  int right = (dash::myid().id + 1) % dash::size();
+  dart_gptr_t target = gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_gptr_setunit(&target, dart_team_unit_t { right }));
+  for (int i = 0; i < num_puts; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_put_blocking(target, &i, 1, DART_TYPE_INT, DART_TYPE_INT));
+  }
+
+  dart_profile_op_stats_t put_stats;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_profile_op_stats(DART_PROFILE_OP_PUT, &put_stats));
+  std::vector<dart_profile_counts_t> targets(dash::size());
+  ASSERT_EQ_U(DART_OK, dart_profile_targets(targets.data()));
+  size_t nsegments = 0;
+  ASSERT_EQ_U(DART_OK, dart_profile_segments(nullptr, 0, &nsegments));
+  std::vector<dart_profile_segment_stats_t> segments(nsegments);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_profile_segments(segments.data(), nsegments, &nsegments));
+
+  if (!dash::util::CommProfile::enabled()) {
+    ASSERT_EQ_U(0ULL, put_stats.count);
+    ASSERT_EQ_U(0ULL, targets[right].count);
+    ASSERT_EQ_U(0ULL, nsegments);
+  } else {
+    ASSERT_EQ_U(nputs, put_stats.count);
+    ASSERT_EQ_U(nputs * sizeof(int), put_stats.bytes);
+    uint64_t hist_count = 0;
+    for (int bin = 0; bin < DART_PROFILE_HIST_BINS; ++bin) {
+      hist_count += put_stats.hist[bin];
+    }
+    // latencies are measured for a subset of operations:
+    ASSERT_LE_U(put_stats.timed, put_stats.count);
+    ASSERT_EQ_U(put_stats.timed, hist_count);
+    ASSERT_EQ_U(nputs, targets[right].count);
+    ASSERT_EQ_U(nputs * sizeof(int), targets[right].bytes);
+
+    bool found = false;
+    for (const auto & seg : segments) {
+      if (seg.teamid == gptr.teamid && seg.segid == gptr.segid) {
+        ASSERT_EQ_U(nputs, seg.ops[DART_PROFILE_OP_PUT].count);
+        found = true;
+      }
+    }
+    ASSERT_TRUE_U(found);
+  }
+
+  dash::barrier();
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+}
+
+TEST_F(DARTProfileTest, CountNodeLocalAccesses) {
+  dash::Array<int> arr(dash::size());
+  arr.local[0] = 0;
+  arr.barrier();
+  dash::util::CommProfile::reset();
+
+  // accesses to units on the same node are copied through shared
+  // memory windows in DART and must be counted as well:
+  int right = (dash::myid().id + 1) % dash::size();
+  arr[right] = dash::myid().id;
+  int value  = arr[right];
+  ASSERT_EQ_U(dash::myid().id, value);
+
+  dart_profile_op_stats_t put_stats;
+  dart_profile_op_stats_t get_stats;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_profile_op_stats(DART_PROFILE_OP_PUT, &put_stats));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_profile_op_stats(DART_PROFILE_OP_GET, &get_stats));
+  if (dash::util::CommProfile::enabled()) {
+    ASSERT_EQ_U(1ULL, put_stats.count);
+    ASSERT_EQ_U(1ULL, get_stats.count);
+  } else {
+    ASSERT_EQ_U(0ULL, put_stats.count);
+    ASSERT_EQ_U(0ULL, get_stats.count);
+  }
+  arr.barrier();
+}
+
+TEST_F(DARTProfileTest, TeamReport) {
+  dash::util::CommProfile::reset();
+  dash::barrier();
+
+  std::ostringstream os;
+  dash::util::CommProfile::write_json(os);
+
+  std::string report = os.str();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U('{', report.front());
+    ASSERT_NE_U(std::string::npos, report.find("\"barrier\""));
+    ASSERT_NE_U(std::string::npos, report.find("\"sources\""));
+    ASSERT_NE_U(std::string::npos, report.find("\"segments\""));
+  } else {
+    ASSERT_TRUE_U(report.empty());
+  }
+}
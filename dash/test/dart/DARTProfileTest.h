@@ -0,0 +1,19 @@
+#ifndef DASH_DASH_TEST_DARTPROFILETEST_H_
+#define DASH_DASH_TEST_DARTPROFILETEST_H_
+
+#include "../TestBase.h"
+
+
+/**
+ * Test fixture for the DART communication profiler
+ */
+class DARTProfileTest : public dash::test::TestBase {
+protected:
+
+  DARTProfileTest() {}
+
+  virtual ~DARTProfileTest() {}
+};
+
+
+#endif /* DASH_DASH_TEST_DARTPROFILETEST_H_ */
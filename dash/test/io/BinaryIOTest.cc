@@ -0,0 +1,119 @@
+#include "BinaryIOTest.h"
+#include "../TestContainerHelpers.h"
+
+#include <dash/io/Binary.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/pattern/TilePattern.h>
+#include <dash/pattern/CSRPattern.h>
+
+using dash::io::binary::StoreBinary;
+
+using dash::test::fill_linear;
+using dash::test::verify_linear;
+
+TEST_F(BinaryIOTest, ArrayRestorePattern)
+{
+  auto ext = dash::size() * 17 + 3;
+  {
+    dash::Array<int> array_a(ext, dash::BLOCKCYCLIC(5));
+    fill_linear(array_a, 7);
+    StoreBinary::write(array_a, _filename);
+  }
+  dash::Array<int> array_b;
+  StoreBinary::read(array_b, _filename);
+
+  ASSERT_EQ_U(ext, array_b.size());
+  ASSERT_EQ_U(5, array_b.pattern().blocksize(0));
+  verify_linear(array_b, 7);
+}
+
+TEST_F(BinaryIOTest, ArrayRedistribute)
+{
+  auto ext = dash::size() * 17 + 3;
+  {
+    dash::Array<int> array_a(ext, dash::BLOCKCYCLIC(5));
+    fill_linear(array_a);
+    StoreBinary::write(array_a, _filename);
+  }
+  dash::Array<int> array_b(ext, dash::BLOCKED);
+  StoreBinary::read(array_b, _filename);
+  verify_linear(array_b);
+
+  // and back, written with canonical layout
+  StoreBinary::write(array_b, _filename);
+  dash::Array<int> array_c(ext, dash::BLOCKCYCLIC(3));
+  StoreBinary::read(array_c, _filename);
+  verify_linear(array_c);
+}
+
+TEST_F(BinaryIOTest, ArrayContiguousPattern)
+{
+  typedef dash::CSRPattern<1>                 pattern_t;
+  typedef dash::Array<int, long, pattern_t>   array_t;
+
+  std::vector<pattern_t::size_type> local_sizes;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    local_sizes.push_back(2 * u + 3);
+  }
+  {
+    array_t array_a{pattern_t(local_sizes)};
+    fill_linear(array_a, 2);
+    StoreBinary::write(array_a, _filename);
+  }
+  array_t array_b;
+  StoreBinary::read(array_b, _filename);
+
+  ASSERT_EQ_U(dash::size() * (dash::size() + 2), array_b.size());
+  ASSERT_EQ_U(local_sizes[dash::myid()], array_b.lsize());
+  verify_linear(array_b, 2);
+}
+
+TEST_F(BinaryIOTest, MatrixRedistribute)
+{
+  typedef dash::TilePattern<2> tile_pattern_t;
+  typedef dash::Pattern<2>     block_pattern_t;
+
+  auto nunits = dash::size();
+  dash::TeamSpec<2> teamspec(nunits, 1);
+  teamspec.balance_extents();
+
+  auto ext_x = teamspec.extent(0) * 6;
+  auto ext_y = teamspec.extent(1) * 6;
+
+  {
+    block_pattern_t pattern(
+      dash::SizeSpec<2>(ext_x, ext_y),
+      dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKCYCLIC(4)),
+      teamspec);
+    dash::Matrix<int, 2, long, block_pattern_t> matrix_a(pattern);
+    fill_linear(matrix_a, 1);
+    StoreBinary::write(matrix_a, _filename);
+  }
+
+  tile_pattern_t tile_pattern(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::TILE(3), dash::TILE(2)),
+    teamspec);
+  dash::Matrix<int, 2, long, tile_pattern_t> matrix_b(tile_pattern);
+  StoreBinary::read(matrix_b, _filename);
+  verify_linear(matrix_b, 1);
+
+  StoreBinary::write(matrix_b, _filename);
+  dash::Matrix<int, 2> matrix_c;
+  StoreBinary::read(matrix_c, _filename);
+  verify_linear(matrix_c, 1);
+}
+
+TEST_F(BinaryIOTest, TypeMismatch)
+{
+  {
+    dash::Array<int> array_a(dash::size() * 4);
+    fill_linear(array_a);
+    StoreBinary::write(array_a, _filename);
+  }
+  dash::Array<float> array_b(dash::size() * 4);
+  EXPECT_THROW(
+    StoreBinary::read(array_b, _filename),
+    dash::exception::InvalidArgument);
+}
@@ -0,0 +1,36 @@
+#ifndef DASH__TEST__BINARY_IO_TEST_H__INCLUDED
+#define DASH__TEST__BINARY_IO_TEST_H__INCLUDED
+
+#include "../TestBase.h"
+
+#include <cstdio>
+#include <string>
+
+class BinaryIOTest : public dash::test::TestBase {
+ protected:
+  std::string _filename = "test_container.bin";
+
+  BinaryIOTest() { LOG_MESSAGE(">>> Test suite: BinaryIOTest"); }
+
+  virtual ~BinaryIOTest() {
+    LOG_MESSAGE("<<< Closing test suite: BinaryIOTest");
+  }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    if (dash::myid() == 0) {
+      remove(_filename.c_str());
+    }
+    dash::Team::All().barrier();
+  }
+
+  virtual void TearDown() {
+    dash::Team::All().barrier();
+    if (dash::myid() == 0) {
+      remove(_filename.c_str());
+    }
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif  // DASH__TEST__BINARY_IO_TEST_H__INCLUDED
@@ -410,7 +410,6 @@ TEST_F(HDF5ArrayTest, CustomType) {
   });
 }
 
-/** TODO currently highly experimental */
 TEST_F(HDF5ArrayTest, AsyncIO) {
   int ext_x = dash::size() * 1;
 #ifndef DASH_DEBUG
@@ -442,13 +441,14 @@ TEST_F(HDF5ArrayTest, AsyncIO) {
     dash::barrier();
     // things below work as expected
 
-    // Currently only works if just one container is passed
     OutputStream os(dash::launch::async, _filename);
     os << dio::dataset("array_a") << array_a << dio::dataset("g1/array_b")
        << array_b << dio::dataset("g1/g2/array_c") << array_c;
 
     LOG_MESSAGE("Async OS setup");
-    // Do some computation intense work
+    // Containers are staged, modifications do not affect stored data
+    fill_array(array_a, -secret[0]);
+    fill_array(array_b, -secret[1]);
     os.flush();
     LOG_MESSAGE("Async OS flushed");
   }
@@ -21,6 +21,50 @@ TEST_F(GlobRefTest, IsLocal) {
   ASSERT_EQ_U(true, gref.is_local());
 }
 
+TEST_F(GlobRefTest, IsNodeLocal) {
+  int num_elem_per_unit = 20;
+  dash::Array<int> array(dash::size() * num_elem_per_unit);
+  for (auto li = 0; li < array.lcapacity(); ++li) {
+    array.local[li] = dash::myid().id;
+  }
+  array.barrier();
+
+  int  right = (dash::myid().id + 1) % dash::size();
+  dash::util::UnitLocality my_uloc;
+  dash::util::UnitLocality right_uloc { dash::global_unit_t(right) };
+  bool same_node = my_uloc.hostname() == right_uloc.hostname();
+
+  auto gidx = array.pattern().global_index(
+                dash::team_unit_t(right), {{ 0 }});
+  dash::GlobRef<int> gref = array[gidx];
+  ASSERT_EQ_U(right == dash::myid().id, gref.is_local());
+  // Shared memory windows may be disabled in DART, so only units on
+  // the same node can be node-local:
+  if (!same_node) {
+    ASSERT_EQ_U(false, gref.is_node_local());
+  }
+  if (right == dash::myid().id) {
+    ASSERT_EQ_U(true, gref.is_node_local());
+  }
+  ASSERT_EQ_U(right, static_cast<int>(gref));
+
+  auto git = array.begin() + gidx;
+  auto gp  = static_cast<decltype(git)::pointer>(git);
+  if (gref.is_node_local()) {
+    // Plain loads through the native pointer see the remote values:
+    int * native = gp.node_local();
+    ASSERT_NE_U(nullptr, native);
+    ASSERT_EQ_U(right, native[num_elem_per_unit - 1]);
+  }
+  array.barrier();
+
+  // Stores through the reference are visible at the owning unit:
+  gref = 100 + dash::myid().id;
+  array.barrier();
+  auto left = (dash::myid().id + dash::size() - 1) % dash::size();
+  ASSERT_EQ_U(100 + left, array.local[0]);
+}
+
 TEST_F(GlobRefTest, Member) {
   struct value_t {
     double x; int y;
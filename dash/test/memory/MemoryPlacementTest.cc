@@ -0,0 +1,152 @@
+#include "MemoryPlacementTest.h"
+
+#include <dash/memory/MemoryPlacement.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+
+#ifdef DASH_ENABLE_NUMA
+#include <numaif.h>
+#endif
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <sstream>
+
+
+namespace {
+
+const dash::MemoryPlacement placements[] = {
+  dash::MemoryPlacement::system,
+  dash::MemoryPlacement::first_touch_parallel,
+  dash::MemoryPlacement::interleaved,
+  dash::MemoryPlacement::unit_domain
+};
+
+} // namespace
+
+TEST_F(MemoryPlacementTest, LocalRange)
+{
+  const size_t page_size = sysconf(_SC_PAGESIZE);
+  const size_t nbytes    = 8 * page_size;
+  void       * buf       = nullptr;
+  ASSERT_EQ_U(0, posix_memalign(&buf, page_size, nbytes));
+  char       * bytes     = static_cast<char *>(buf);
+
+  EXPECT_FALSE_U(dash::apply_memory_placement(
+                   bytes, nbytes, dash::MemoryPlacement::system));
+  // No page entirely contained in range:
+  EXPECT_FALSE_U(dash::apply_memory_placement(
+                   bytes + 1, page_size, dash::MemoryPlacement::interleaved));
+  EXPECT_FALSE_U(dash::apply_memory_placement(
+                   bytes, 0, dash::MemoryPlacement::first_touch_parallel));
+
+  for (auto placement : placements) {
+    bool applied = dash::apply_memory_placement(bytes, nbytes, placement);
+    DASH_LOG_DEBUG("MemoryPlacementTest.LocalRange",
+                   "placement:", placement, "applied:", applied);
+#ifdef DASH_ENABLE_NUMA
+    if (applied && placement == dash::MemoryPlacement::interleaved) {
+      int mode = -1;
+      ASSERT_EQ_U(0, get_mempolicy(&mode, nullptr, 0, bytes,
+                                   MPOL_F_ADDR));
+      EXPECT_EQ_U(MPOL_INTERLEAVE, mode);
+    }
+#endif
+    // Memory remains usable in any case:
+    for (size_t b = 0; b < nbytes; ++b) {
+      bytes[b] = static_cast<char>(b);
+    }
+    for (size_t b = 0; b < nbytes; ++b) {
+      ASSERT_EQ_U(static_cast<char>(b), bytes[b]);
+    }
+  }
+  free(buf);
+}
+
+TEST_F(MemoryPlacementTest, Array)
+{
+  const size_t nlocal = 100000;
+  for (auto placement : placements) {
+    dash::Array<int> array;
+    array.set_memory_placement(placement);
+    array.allocate(nlocal * _dash_size, dash::BLOCKED);
+    EXPECT_EQ_U(placement, array.memory_placement());
+    ASSERT_EQ_U(nlocal, array.lsize());
+
+    for (size_t li = 0; li < array.lsize(); ++li) {
+      array.local[li] = static_cast<int>(_dash_id * nlocal + li);
+    }
+    array.barrier();
+    for (size_t gi = 0; gi < array.size(); gi += nlocal / 4) {
+      EXPECT_EQ_U(static_cast<int>(gi), static_cast<int>(array[gi]));
+    }
+    array.barrier();
+  }
+}
+
+TEST_F(MemoryPlacementTest, Matrix)
+{
+  const size_t nrows = 200 * _dash_size;
+  const size_t ncols = 300;
+  for (auto placement : placements) {
+    typedef dash::Matrix<double, 2>  matrix_t;
+    typedef matrix_t::pattern_type   pattern_t;
+    typedef pattern_t::index_type    index_t;
+    pattern_t pattern(dash::SizeSpec<2>(nrows, ncols));
+    matrix_t  matrix;
+    matrix.set_memory_placement(placement);
+    matrix.allocate(pattern);
+    EXPECT_EQ_U(placement, matrix.memory_placement());
+
+    std::fill(matrix.lbegin(), matrix.lend(), static_cast<double>(_dash_id));
+    matrix.barrier();
+    for (size_t row = 0; row < nrows; row += 50) {
+      auto owner = pattern.unit_at(
+                     std::array<index_t, 2> {{
+                       static_cast<index_t>(row), 0 }});
+      EXPECT_EQ_U(static_cast<double>(owner.id),
+                  static_cast<double>(matrix[row][0]));
+    }
+    matrix.barrier();
+  }
+}
+
+TEST_F(MemoryPlacementTest, HugePages)
+{
+  // more than a huge page per unit:
+  const size_t nlocal = (3 << 20) / sizeof(int);
+  const dash::MemoryPages kinds[] = {
+    dash::MemoryPages::system,
+    dash::MemoryPages::huge,
+    dash::MemoryPages::huge_2mb
+  };
+  for (auto pages : kinds) {
+    dash::Array<int> array;
+    array.set_memory_pages(pages);
+    array.set_memory_placement(dash::MemoryPlacement::first_touch_parallel);
+    array.allocate(nlocal * _dash_size, dash::BLOCKED);
+    EXPECT_EQ_U(pages, array.memory_pages());
+    ASSERT_EQ_U(nlocal, array.lsize());
+
+    for (size_t li = 0; li < array.lsize(); ++li) {
+      array.local[li] = static_cast<int>(_dash_id * nlocal + li);
+    }
+    array.barrier();
+    for (size_t gi = 0; gi < array.size(); gi += nlocal / 4) {
+      EXPECT_EQ_U(static_cast<int>(gi), static_cast<int>(array[gi]));
+    }
+    array.barrier();
+  }
+
+  typedef dash::Matrix<double, 2> matrix_t;
+  matrix_t matrix;
+  matrix.set_memory_pages(dash::MemoryPages::huge);
+  matrix.allocate(dash::SizeSpec<2>(512 * _dash_size, 1024));
+  EXPECT_EQ_U(dash::MemoryPages::huge, matrix.memory_pages());
+  std::fill(matrix.lbegin(), matrix.lend(), static_cast<double>(_dash_id));
+  matrix.barrier();
+  EXPECT_EQ_U(static_cast<double>(_dash_size - 1),
+              static_cast<double>(matrix[matrix.extent(0) - 1][0]));
+  matrix.barrier();
+}
@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__MEMORY_PLACEMENT_TEST_H_
+#define DASH__TEST__MEMORY_PLACEMENT_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for placement policies of local memory,
+ * see dash::MemoryPlacement
+ */
+class MemoryPlacementTest : public dash::test::TestBase {
+protected:
+  size_t _dash_id   = 0;
+  size_t _dash_size = 0;
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _dash_id   = dash::myid();
+    _dash_size = dash::size();
+  }
+};
+
+#endif // DASH__TEST__MEMORY_PLACEMENT_TEST_H_
@@ -7,11 +7,108 @@
 #include <dash/Dimensional.h>
 #include <dash/util/TeamLocality.h>
 
+#include <dash/dart/if/dart.h>
+
 #include <array>
 #include <sstream>
 #include <unistd.h>
 #include <iostream>
 #include <fstream>
+#include <vector>
+
+namespace {
+
+/**
+ * Splits all units into \c ngroups teams, allocates global memory in the
+ * team of the calling unit and writes to and reads from the memory of
+ * the neighboring unit before destroying the team.
+ * Repeated calls create teams of identical groups.
+ */
+void split_alloc_access(size_t ngroups, int round)
+{
+  dart_group_t group_all;
+  ASSERT_EQ_U(DART_OK, dart_team_get_group(DART_TEAM_ALL, &group_all));
+  std::vector<dart_group_t> groups(ngroups);
+  size_t nout;
+  ASSERT_EQ_U(DART_OK,
+              dart_group_split(group_all, ngroups, &nout, groups.data()));
+  ASSERT_EQ_U(DART_OK, dart_group_destroy(&group_all));
+
+  dart_team_t team = DART_TEAM_NULL;
+  for (const auto & group : groups) {
+    dart_team_t newteam;
+    ASSERT_EQ_U(DART_OK, dart_team_create(DART_TEAM_ALL, group, &newteam));
+    if (newteam != DART_TEAM_NULL) {
+      team = newteam;
+    }
+  }
+  for (auto & group : groups) {
+    ASSERT_EQ_U(DART_OK, dart_group_destroy(&group));
+  }
+  ASSERT_NE(DART_TEAM_NULL, team);
+
+  dart_team_unit_t myid;
+  size_t           size;
+  ASSERT_EQ_U(DART_OK, dart_team_myid(team, &myid));
+  ASSERT_EQ_U(DART_OK, dart_team_size(team, &size));
+
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(DART_OK,
+              dart_team_memalloc_aligned(team, 1, DART_TYPE_INT, &gptr));
+  dart_gptr_t gptr_right = gptr;
+  dart_gptr_t gptr_left  = gptr;
+  dart_team_unit_t right { static_cast<int>((myid.id + 1) % size) };
+  dart_team_unit_t left  { static_cast<int>((myid.id + size - 1) % size) };
+  ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptr_right, right));
+  ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptr_left,  left));
+
+  int value = dash::myid().id * 100 + round;
+  ASSERT_EQ_U(DART_OK, dart_put_blocking(gptr_right, &value, 1,
+                                         DART_TYPE_INT, DART_TYPE_INT));
+  ASSERT_EQ_U(DART_OK, dart_barrier(team));
+  // Values written by the left neighbor to the calling unit and by the
+  // calling unit to the right neighbor:
+  int left_value  = -1;
+  int right_value = -1;
+  dart_gptr_t gptr_mine = gptr;
+  ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptr_mine, myid));
+  ASSERT_EQ_U(DART_OK, dart_get_blocking(&left_value, gptr_mine, 1,
+                                         DART_TYPE_INT, DART_TYPE_INT));
+  ASSERT_EQ_U(DART_OK, dart_get_blocking(&right_value, gptr_right, 1,
+                                         DART_TYPE_INT, DART_TYPE_INT));
+  EXPECT_EQ_U(value, right_value);
+  EXPECT_EQ_U(round, left_value % 100);
+  ASSERT_EQ_U(DART_OK, dart_barrier(team));
+
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
+
+/**
+ * Sets the team cache size of the calling unit, restores the previous
+ * size on destruction.
+ */
+class TeamCacheSize
+{
+public:
+  explicit TeamCacheSize(int size)
+  {
+    dart_config(&_config);
+    _size = _config->team_cache_size;
+    _config->team_cache_size = size;
+  }
+
+  ~TeamCacheSize()
+  {
+    _config->team_cache_size = _size;
+  }
+
+private:
+  dart_config_t * _config;
+  int             _size;
+};
+
+} // namespace
 
 
 TEST_F(TeamTest, Deallocate) {
@@ -106,3 +203,43 @@ TEST_F(TeamTest, SplitTeamSync)
   }
 }
 
+
+TEST_F(TeamTest, CachedCommReuse)
+{
+  TeamCacheSize cache_size(16);
+  auto ngroups = std::min<size_t>(2, dash::size());
+  // The communicator of the destroyed team is reused for the next team
+  // of the same group:
+  for (int round = 0; round < 3; ++round) {
+    split_alloc_access(ngroups, round);
+  }
+  dash::Team::All().barrier();
+}
+
+TEST_F(TeamTest, CachedCommDisagreement)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  TeamCacheSize cache_size(16);
+  split_alloc_access(1, 0);
+  {
+    // Unit 0 does not look up the cached communicator, the new team's
+    // communicator is created:
+    TeamCacheSize unit_cache_size(dash::myid() == 0 ? 0 : 16);
+    split_alloc_access(1, 1);
+  }
+  // All units use the communicator cached in the first round:
+  split_alloc_access(1, 2);
+  dash::Team::All().barrier();
+}
+
+TEST_F(TeamTest, CachedCommDisabled)
+{
+  TeamCacheSize cache_size(0);
+  auto ngroups = std::min<size_t>(2, dash::size());
+  for (int round = 0; round < 2; ++round) {
+    split_alloc_access(ngroups, round);
+  }
+  dash::Team::All().barrier();
+}
@@ -19,6 +19,8 @@ TEST_F(ConfigTest, BasicSetGet) {
   EXPECT_EQ(123, Config::get<int>("CONFIG_TEST_INT"));
   Config::set("CONFIG_TEST_INT", 234);
   EXPECT_EQ(234, Config::get<int>("CONFIG_TEST_INT"));
+  Config::unset("CONFIG_TEST_INT");
+  EXPECT_FALSE(Config::is_set("CONFIG_TEST_INT"));
 
   Config::set("CONFIG_TEST_STRING", "foo");
   EXPECT_EQ("foo", Config::get<std::string>("CONFIG_TEST_STRING"));
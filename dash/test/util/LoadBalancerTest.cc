@@ -0,0 +1,145 @@
+#include "LoadBalancerTest.h"
+
+#include <dash/util/LoadBalancer.h>
+#include <dash/pattern/LoadBalancePattern.h>
+#include <dash/pattern/CSRPattern.h>
+#include <dash/pattern/DynamicPattern.h>
+#include <dash/Array.h>
+
+#include <numeric>
+#include <vector>
+
+
+namespace {
+
+/**
+ * Records times at unit 0 that are twice as long per local element as
+ * at other units, rebalances the array and validates its elements.
+ */
+template <class ArrayT>
+void test_rebalance(ArrayT & array)
+{
+  typedef typename ArrayT::pattern_type pattern_t;
+  typedef typename ArrayT::index_type   index_t;
+
+  auto nunits = dash::size();
+  auto size   = array.size();
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<int>(array.pattern().global(li));
+  }
+
+  dash::util::LoadBalancer balancer(array.team(), 0.2);
+  // Measurements of no unit, nothing to balance:
+  EXPECT_EQ_U(0, balancer.imbalance());
+  EXPECT_FALSE_U(balancer.rebalance(array));
+
+  double time_per_elem = dash::myid() == 0 ? 2.0 : 1.0;
+  balancer.record(time_per_elem * array.lsize());
+  auto weights = balancer.unit_weights(array.pattern());
+  ASSERT_EQ_U(nunits, weights.size());
+  if (nunits > 1) {
+    EXPECT_GT_U(balancer.imbalance(), 0.2);
+    EXPECT_LT_U(weights[0], weights[1]);
+    EXPECT_EQ_U(weights[1], weights[nunits-1]);
+  }
+  double sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+  EXPECT_NEAR(nunits, sum, 1.0e-9);
+
+  bool rebalanced = balancer.rebalance(array);
+  EXPECT_EQ_U(nunits > 1, rebalanced);
+  if (!rebalanced) {
+    return;
+  }
+  EXPECT_EQ_U(0, balancer.iterations());
+  EXPECT_EQ_U(size, array.size());
+
+  // Unit 0 processes half the number of elements of other units,
+  // remaining elements are assigned to unit 1:
+  const pattern_t & pattern = array.pattern();
+  double lsize_0 = static_cast<double>(size) / (2 * nunits - 1);
+  if (dash::myid() == 0) {
+    EXPECT_NEAR(lsize_0, pattern.local_size(), 1.0);
+  } else {
+    EXPECT_GE_U(pattern.local_size() + 1, 2 * lsize_0);
+    EXPECT_LE_U(pattern.local_size(), 2 * lsize_0 + nunits);
+  }
+  EXPECT_EQ_U(pattern.local_size(), array.lsize());
+
+  // Local elements have been moved with their global index:
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    EXPECT_EQ_U(static_cast<int>(pattern.global(li)), array.local[li]);
+  }
+  array.barrier();
+  // Global access uses the balanced pattern:
+  for (index_t gi = 0; gi < static_cast<index_t>(size); gi += 97) {
+    EXPECT_EQ_U(static_cast<int>(gi), static_cast<int>(array[gi]));
+  }
+  array.barrier();
+}
+
+} // namespace
+
+TEST_F(LoadBalancerTest, WeightedPattern)
+{
+  typedef dash::LoadBalancePattern<1> pattern_t;
+
+  auto                nunits = dash::size();
+  size_t              size   = 1000 * nunits + 7;
+  std::vector<double> weights(nunits, 1.0);
+  weights[0] = 2.0;
+
+  pattern_t pattern(dash::SizeSpec<1>(size), weights);
+  ASSERT_EQ_U(size, pattern.size());
+  size_t sum = 0;
+  for (dash::team_unit_t u{0}; u < nunits; ++u) {
+    sum += pattern.local_size(u);
+  }
+  EXPECT_EQ_U(size, sum);
+  if (nunits > 1) {
+    EXPECT_GE_U(pattern.local_size(dash::team_unit_t{0}),
+                2 * pattern.local_size(dash::team_unit_t{1}));
+  }
+  // Load weights are relative to their mean:
+  double wsum = std::accumulate(pattern.unit_load_weights().begin(),
+                                pattern.unit_load_weights().end(), 0.0);
+  EXPECT_NEAR(nunits, wsum, 1.0e-9);
+}
+
+TEST_F(LoadBalancerTest, RebalanceLoadBalancePattern)
+{
+  typedef dash::LoadBalancePattern<1>            pattern_t;
+  typedef dash::Array<int, long, pattern_t>      array_t;
+
+  auto nunits = dash::size();
+  pattern_t pattern(dash::SizeSpec<1>(2000 * nunits),
+                    std::vector<double>(nunits, 1.0));
+  array_t   array(pattern);
+  test_rebalance(array);
+}
+
+TEST_F(LoadBalancerTest, RebalanceCSRPattern)
+{
+  typedef dash::CSRPattern<1>                    pattern_t;
+  typedef dash::Array<int, long, pattern_t>      array_t;
+
+  auto nunits = dash::size();
+  std::vector<pattern_t::size_type> local_sizes;
+  for (size_t u = 0; u < nunits; ++u) {
+    local_sizes.push_back(1000 + 100 * u);
+  }
+  pattern_t pattern(local_sizes);
+  array_t   array(pattern);
+  test_rebalance(array);
+}
+
+TEST_F(LoadBalancerTest, RebalanceDynamicPattern)
+{
+  typedef dash::DynamicPattern<1>                pattern_t;
+  typedef dash::Array<int, long, pattern_t>      array_t;
+
+  auto nunits = dash::size();
+  std::vector<pattern_t::size_type> local_sizes(nunits, 1500);
+  pattern_t pattern(local_sizes);
+  array_t   array(pattern);
+  test_rebalance(array);
+}
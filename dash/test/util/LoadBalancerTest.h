@@ -0,0 +1,12 @@
+#ifndef DASH__TEST__LOAD_BALANCER_TEST_H_
+#define DASH__TEST__LOAD_BALANCER_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::util::LoadBalancer
+ */
+class LoadBalancerTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__LOAD_BALANCER_TEST_H_
@@ -0,0 +1,95 @@
+
+#include "TraceTest.h"
+
+#include <dash/util/Trace.h>
+#include <dash/util/Config.h>
+#include <dash/algorithm/ForEach.h>
+#include <dash/Array.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+TEST_F(TraceTest, RingBuffer) {
+  DASH_TEST_LOCAL_ONLY();
+
+  dash::util::internal::TraceBuffer<int> buffer(4);
+  EXPECT_EQ_U(4, buffer.capacity());
+  EXPECT_EQ_U(0, buffer.size());
+
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ_U(i, buffer.push(i));
+  }
+  EXPECT_EQ_U(4, buffer.size());
+  EXPECT_EQ_U(2, buffer.dropped());
+  // Oldest events have been overwritten:
+  EXPECT_TRUE_U(buffer.at_seq(1) == nullptr);
+  EXPECT_TRUE_U(buffer.at_seq(6) == nullptr);
+  ASSERT_TRUE_U(buffer.at_seq(2) != nullptr);
+  EXPECT_EQ_U(2, *buffer.at_seq(2));
+
+  std::vector<int> events;
+  buffer.for_each([&](int event) { events.push_back(event); });
+  EXPECT_EQ_U((std::vector<int> { 2, 3, 4, 5 }), events);
+
+  buffer.remove_if([](int event) { return event % 2 == 0; });
+  events.clear();
+  buffer.for_each([&](int event) { events.push_back(event); });
+  EXPECT_EQ_U((std::vector<int> { 3, 5 }), events);
+  // Removed events do not reset the number of dropped events:
+  EXPECT_EQ_U(2, buffer.dropped());
+  for (int i = 6; i < 9; ++i) {
+    buffer.push(i);
+  }
+  EXPECT_EQ_U(4, buffer.size());
+  EXPECT_EQ_U(3, buffer.dropped());
+
+  buffer.clear();
+  EXPECT_EQ_U(0, buffer.size());
+  EXPECT_EQ_U(0, buffer.dropped());
+}
+
+TEST_F(TraceTest, ChromeTimeline) {
+  using dash::util::Config;
+  using dash::util::TraceStore;
+
+  bool trace_enabled = Config::get<bool>("DASH_ENABLE_TRACE");
+  Config::set("DASH_ENABLE_TRACE", true);
+  ASSERT_TRUE_U(TraceStore::on());
+  TraceStore::clear();
+
+  dash::Array<int> array(dash::size() * 10);
+  {
+    dash::util::Trace trace("TraceTest");
+    trace.enter_state("outer");
+    trace.enter_state("inner");
+    trace.exit_state("inner");
+    dash::for_each(array.begin(), array.end(), [](int & v) { v = 1; });
+    trace.exit_state("outer");
+    // State that is not exited is not written:
+    trace.enter_state("open");
+  }
+
+  std::ostringstream os;
+  TraceStore::write_chrome(os);
+  TraceStore::off();
+  Config::set("DASH_ENABLE_TRACE", trace_enabled);
+
+  std::string timeline = os.str();
+  if (dash::myid() != 0) {
+    EXPECT_TRUE_U(timeline.empty());
+    return;
+  }
+  EXPECT_EQ_U(0U, timeline.find("{\"traceEvents\":["));
+  EXPECT_NE_U(std::string::npos,
+              timeline.find("\"name\":\"inner\",\"cat\":\"TraceTest\""));
+  EXPECT_NE_U(std::string::npos,
+              timeline.find("\"name\":\"local\",\"cat\":\"for_each\""));
+  EXPECT_EQ_U(std::string::npos, timeline.find("\"name\":\"open\""));
+  for (size_t unit = 0; unit < dash::size(); ++unit) {
+    std::ostringstream process_name;
+    process_name << "\"name\":\"unit " << unit << "\"";
+    EXPECT_NE_U(std::string::npos, timeline.find(process_name.str()));
+  }
+}
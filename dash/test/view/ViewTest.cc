@@ -10,6 +10,7 @@
 
 #include <array>
 #include <algorithm>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <iomanip>
@@ -1854,6 +1855,66 @@ TEST_F(ViewTest, ArrayBlockCyclicPatternLocalView)
   }
 }
 
+TEST_F(ViewTest, NodeLocalArray)
+{
+  int block_size = 13;
+  int array_size = dash::size() * block_size - 3;
+
+  dash::Array<int> a(array_size);
+  for (int li = 0; li < static_cast<int>(a.lsize()); ++li) {
+    a.local[li] = 1000 * dash::myid() + li;
+  }
+  a.barrier();
+
+  auto node_view = dash::node_local(a);
+
+  // Units on another node are never node-local, units on the same node
+  // are node-local unless shared memory windows are disabled in DART:
+  dash::util::UnitLocality my_uloc;
+  std::vector<dash::team_unit_t> exp_units;
+  for (dash::team_unit_t u{0}; u < dash::size(); u++) {
+    dash::util::UnitLocality uloc { dash::global_unit_t(u) };
+    if (uloc.hostname() == my_uloc.hostname() &&
+        a.pattern().local_size(u) > 0) {
+      exp_units.push_back(u);
+    }
+  }
+  EXPECT_LE_U(node_view.size(), exp_units.size());
+  EXPECT_GE_U(node_view.size(), 1);
+
+  bool found_self = false;
+  for (const auto & segment : node_view) {
+    EXPECT_TRUE_U(std::find(exp_units.begin(), exp_units.end(),
+                            segment.unit) != exp_units.end());
+    EXPECT_EQ_U(a.pattern().local_size(segment.unit), segment.size());
+    for (size_t li = 0; li < segment.size(); ++li) {
+      EXPECT_EQ_U(1000 * segment.unit + li, segment.begin()[li]);
+    }
+    if (segment.unit == a.team().myid()) {
+      found_self = true;
+      EXPECT_EQ_U(a.lbegin(), segment.begin());
+      EXPECT_EQ_U(a.lend(),   segment.end());
+    }
+  }
+  EXPECT_TRUE_U(found_self);
+
+  // Node-level reduction followed by a reduction over nodes:
+  long node_sum = 0;
+  for (const auto & segment : node_view) {
+    node_sum = std::accumulate(segment.begin(), segment.end(), node_sum);
+  }
+  if (node_view.size() == exp_units.size()) {
+    long exp_sum = 0;
+    for (auto u : exp_units) {
+      for (size_t li = 0; li < a.pattern().local_size(u); ++li) {
+        exp_sum += 1000 * u + li;
+      }
+    }
+    EXPECT_EQ_U(exp_sum, node_sum);
+  }
+  a.barrier();
+}
+
 /*
 TEST_F(ViewTest, ArrayBlockedPatternViewUnion)
 {